@@ -79,6 +79,17 @@ extern "C" {
 
 /* Data structures for communication object. */
 
+typedef struct Zoltan_Comm_Persist {	/* state kept by Zoltan_Comm_Do_Replay */
+    int       tag;		/* message tag requests were built with */
+    int       nbytes;		/* item size requests were built with */
+    char     *send_buff;	/* packed outgoing msgs, if indices_to */
+    char     *recv_buff;	/* incoming msgs, if indices_from */
+    char     *send_bound;	/* array send requests are bound to */
+    char     *recv_bound;	/* array recv requests are bound to */
+    MPI_Request *request;	/* recvs, then one send per procs_to entry */
+    MPI_Status *status;		/* MPI status for those requests */
+} ZOLTAN_COMM_PERSIST;
+
 struct Zoltan_Comm_Obj {	/* data for mapping between decompositions */
     int      *procs_to;         /* processors I'll send to */
     int      *procs_from;       /* processors I'll receive from*/
@@ -133,8 +144,11 @@ struct Zoltan_Comm_Obj {	/* data for mapping between decompositions */
     
     ZOLTAN_COMM_OBJ* plan_reverse;   /* to support POST & WAIT */
     char*     recv_buff;  /* To support POST & WAIT */    
+    ZOLTAN_COMM_PERSIST* persist;    /* to support REPLAY; NULL until used */
 };
 
+extern void Zoltan_Comm_Persist_Free(ZOLTAN_COMM_OBJ *);
+
 /* Red Storm MPI permits a maximum of 2048 receives.  We set our
  * limit of posted receives to 2000, leaving some for the application.
  */
@@ -322,6 +322,7 @@ Mem_Err:
     plan->maxed_recvs = 0;
     plan->comm = comm;
     plan->plan_reverse = NULL;
+    plan->persist = NULL;
 
     if (MPI_RECV_LIMIT > 0){
       /* If we have a limit to the number of posted receives we are allowed,
@@ -396,6 +397,8 @@ int Zoltan_Comm_Copy_To(ZOLTAN_COMM_OBJ **toptr, ZOLTAN_COMM_OBJ *from)
 
     MPI_Comm_dup(from->comm, &(to->comm));
 
+    to->persist = NULL;		/* requests are bound to from's buffers */
+
     COPY_BUFFER(procs_to, int, to->nsends);
     COPY_BUFFER(procs_from, int, to->nrecvs);
     COPY_BUFFER(lengths_to, int, to->nsends);
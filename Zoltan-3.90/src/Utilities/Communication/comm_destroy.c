@@ -62,6 +62,7 @@ ZOLTAN_COMM_OBJ **plan)		/* communication data structure pointer */
     if (*plan == NULL) return ZOLTAN_OK;
 
     /* Free fields of the communication object. */
+    Zoltan_Comm_Persist_Free(*plan);
     ZOLTAN_FREE(&((*plan)->status));
     ZOLTAN_FREE(&((*plan)->request));
     ZOLTAN_FREE(&((*plan)->sizes));
@@ -0,0 +1,363 @@
+/* 
+ * @HEADER
+ *
+ * ***********************************************************************
+ *
+ *  Zoltan Toolkit for Load-balancing, Partitioning, Ordering and Coloring
+ *                  Copyright 2012 Sandia Corporation
+ *
+ * Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+ * the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the Corporation nor the names of the
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Questions? Contact Karen Devine	kddevin@sandia.gov
+ *                    Erik Boman	egboman@sandia.gov
+ *
+ * ***********************************************************************
+ *
+ * @HEADER
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan_mem.h"
+#include "comm.h"
+
+
+#ifdef __cplusplus
+/* if C++, define the rest of this header file as extern C */
+extern "C" {
+#endif
+
+/* Exchange of column-oriented data along a plan.
+
+   Zoltan_Comm_Do moves items stored contiguously in one array, so callers
+   whose data lives in several arrays (one per field, possibly strided) pack
+   it into a buffer first and unpack it afterwards.  Zoltan_Comm_Do_Fields
+   takes one descriptor per field instead: item k of a field is the size
+   bytes at send + k * send_stride, and is received at recv + slot *
+   recv_stride, where slot is the position Zoltan_Comm_Do would give it in
+   recv_data.
+
+   Each message is gathered field by field into a send buffer.  It is
+   received directly into the field arrays through an MPI derived
+   datatype, so there is neither receive buffer nor unpacking.  Derived
+   datatypes are not used on the send side: scattered rows make MPI pack
+   them item by item, which is slower than the gather.  Items kept on this
+   processor are copied directly.
+
+   If send_index is not NULL, item k of the plan is row send_index[k] of
+   the send arrays.  Fields of size 0 are ignored.  Plans with variable
+   item sizes are not supported.
+*/
+
+/*****************************************************************************/
+
+/* Build the datatype receiving items into rows[0..n-1] of all the fields. */
+
+static void Zoltan_Comm_Fields_Type(
+int nfields,			/* number of field descriptors */
+ZOLTAN_COMM_FIELD *fields,	/* field descriptors */
+int n,				/* number of items in the message */
+int *rows,			/* rows of the items in the field arrays */
+int *lengths,			/* work array of n block lengths */
+MPI_Aint *disps,		/* work array of n displacements */
+MPI_Datatype *field_type,	/* work array of nfields types */
+MPI_Aint *address,		/* work array of nfields addresses */
+int *ones,			/* nfields ones */
+MPI_Datatype *msg_type)		/* datatype built */
+{
+    char     *base;		/* first row of the field */
+    int       f, m;		/* field counters */
+    int       k;		/* item counter */
+    int       contiguous;	/* set if rows are consecutive */
+
+    /* Consecutive rows (no indices_from) are described as such */
+    for (k = 1; k < n && rows[k] == rows[0] + k; k++);
+    contiguous = (k >= n);
+
+    for (f = m = 0; f < nfields; f++) {
+	if (fields[f].size <= 0)
+	    continue;
+	base = fields[f].recv;
+	if (contiguous) {
+	    base += (size_t) rows[0] * (size_t) fields[f].recv_stride;
+#if MPI_VERSION >= 2
+	    MPI_Type_create_hvector(n, fields[f].size,
+				    (MPI_Aint) fields[f].recv_stride,
+				    MPI_BYTE, &field_type[m]);
+#else /* MPI 1.x */
+	    MPI_Type_hvector(n, fields[f].size,
+			     (MPI_Aint) fields[f].recv_stride,
+			     MPI_BYTE, &field_type[m]);
+#endif /* MPI_VERSION >= 2 */
+	}
+	else {
+	    for (k = 0; k < n; k++) {
+		lengths[k] = fields[f].size;
+		disps[k] = (MPI_Aint) rows[k] * fields[f].recv_stride;
+	    }
+#if MPI_VERSION >= 2
+	    MPI_Type_create_hindexed(n, lengths, disps, MPI_BYTE,
+				     &field_type[m]);
+#else /* MPI 1.x */
+	    MPI_Type_hindexed(n, lengths, disps, MPI_BYTE, &field_type[m]);
+#endif /* MPI_VERSION >= 2 */
+	}
+#if MPI_VERSION >= 2
+	MPI_Get_address(base, &address[m]);
+#else /* MPI 1.x */
+	MPI_Address(base, &address[m]);
+#endif /* MPI_VERSION >= 2 */
+	m++;
+    }
+#if MPI_VERSION >= 2
+    MPI_Type_create_struct(m, ones, address, field_type, msg_type);
+#else /* MPI 1.x */
+    MPI_Type_struct(m, ones, address, field_type, msg_type);
+#endif /* MPI_VERSION >= 2 */
+    MPI_Type_commit(msg_type);
+    for (f = 0; f < m; f++)
+	MPI_Type_free(&field_type[f]);
+}
+
+/*****************************************************************************/
+
+int       Zoltan_Comm_Do_Fields(
+ZOLTAN_COMM_OBJ * plan,		/* communication data structure */
+int tag,			/* message tag for communicating */
+int nfields,			/* number of field descriptors */
+ZOLTAN_COMM_FIELD *fields,	/* where each field is sent from and to */
+int *send_index)		/* rows of the items sent, or NULL */
+{
+    MPI_Datatype *field_type = NULL;	/* work array for message types */
+    MPI_Datatype *msg_type = NULL;	/* type of each message received */
+    MPI_Request *request = NULL;	/* MPI requests of the messages */
+    MPI_Status *status = NULL;		/* MPI status of the messages */
+    MPI_Aint *address = NULL;		/* addresses of the field arrays */
+    int      *ones = NULL;		/* block lengths of the message types */
+    int      *rows = NULL;		/* rows of the items of one message */
+    int      *lengths = NULL;		/* block lengths of one message */
+    MPI_Aint *disps = NULL;		/* displacements of one message */
+    char     *send_buff = NULL;		/* gathered messages */
+    char     *send_ptr;		/* where current message is gathered */
+    char     *msg_start;	/* start of current message */
+    size_t    row_bytes = 0;	/* bytes of one item, all fields */
+    size_t    send_items = 0;	/* items sent to other processors */
+    int       my_proc;		/* processor ID */
+    int       nmsgs;		/* number of messages sent and received */
+    int       maxlen = 0;	/* longest message, in items */
+    int       nrecvd = 0;	/* number of receives posted */
+    int       nreq = 0;		/* number of requests posted */
+    int       out_of_mem = 0;	/* am I out of memory? */
+    int       i, j, k, f;	/* loop counters */
+    int       ierr = ZOLTAN_OK;
+
+    static char *yo = "Zoltan_Comm_Do_Fields";
+
+
+    /* Check input parameters */
+    if (!plan) {
+        MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
+	ZOLTAN_COMM_ERROR("Communication plan = NULL", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+
+    MPI_Comm_rank(plan->comm, &my_proc);
+
+    if (plan->sizes != NULL) {
+	ZOLTAN_COMM_ERROR("Variable item sizes are not supported", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+    if (nfields < 0 || (nfields > 0 && fields == NULL)) {
+	ZOLTAN_COMM_ERROR("Invalid field descriptors", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+    for (f = 0; f < nfields; f++) {
+	if (fields[f].size <= 0)
+	    continue;
+	if (((plan->nsends + plan->self_msg) && fields[f].send == NULL) ||
+	    ((plan->nrecvs + plan->self_msg) && fields[f].recv == NULL) ||
+	    fields[f].send_stride < fields[f].size ||
+	    fields[f].recv_stride < fields[f].size) {
+	    ZOLTAN_COMM_ERROR("Invalid field descriptor", yo, my_proc);
+	    return ZOLTAN_FATAL;
+	}
+	row_bytes += fields[f].size;
+    }
+    if (row_bytes == 0)
+	return (ZOLTAN_OK);
+
+    /* Items I keep are copied directly */
+    for (i = 0; i < plan->nsends + plan->self_msg; i++) {
+	if (plan->procs_to[i] == my_proc)
+	    break;
+    }
+    if (i < plan->nsends + plan->self_msg) {
+	for (j = 0; j < plan->nrecvs + plan->self_msg; j++) {
+	    if (plan->procs_from[j] == my_proc)
+		break;
+	}
+	for (k = 0; k < plan->lengths_to[i]; k++) {
+	    int       item = plan->starts_to[i] + k;
+	    int       slot = plan->starts_from[j] + k;
+	    if (plan->indices_to != NULL)
+		item = plan->indices_to[item];
+	    if (send_index != NULL)
+		item = send_index[item];
+	    if (plan->indices_from != NULL)
+		slot = plan->indices_from[slot];
+	    for (f = 0; f < nfields; f++) {
+		if (fields[f].size > 0)
+		    memcpy(fields[f].recv + (size_t) slot * fields[f].recv_stride,
+			   fields[f].send + (size_t) item * fields[f].send_stride,
+			   fields[f].size);
+	    }
+	}
+    }
+
+    nmsgs = plan->nrecvs + plan->nsends;
+
+    for (i = 0; i < plan->nsends + plan->self_msg; i++) {
+	if (plan->procs_to[i] == my_proc)
+	    continue;
+	send_items += plan->lengths_to[i];
+	if (plan->lengths_to[i] > maxlen)
+	    maxlen = plan->lengths_to[i];
+    }
+    for (i = 0; i < plan->nrecvs + plan->self_msg; i++) {
+	if (plan->lengths_from[i] > maxlen)
+	    maxlen = plan->lengths_from[i];
+    }
+
+    if (nmsgs > 0) {		/* Idle processes still join the Allreduce below */
+	field_type = (MPI_Datatype *) ZOLTAN_MALLOC(nfields * sizeof(MPI_Datatype));
+	msg_type = (MPI_Datatype *) ZOLTAN_MALLOC(nmsgs * sizeof(MPI_Datatype));
+	request = (MPI_Request *) ZOLTAN_MALLOC(nmsgs * sizeof(MPI_Request));
+	status = (MPI_Status *) ZOLTAN_MALLOC(nmsgs * sizeof(MPI_Status));
+	address = (MPI_Aint *) ZOLTAN_MALLOC(nfields * sizeof(MPI_Aint));
+	ones = (int *) ZOLTAN_MALLOC(nfields * sizeof(int));
+	rows = (int *) ZOLTAN_MALLOC(maxlen * sizeof(int));
+	lengths = (int *) ZOLTAN_MALLOC(maxlen * sizeof(int));
+	disps = (MPI_Aint *) ZOLTAN_MALLOC(maxlen * sizeof(MPI_Aint));
+	send_buff = (char *) ZOLTAN_MALLOC(send_items * row_bytes);
+	if (field_type == NULL || msg_type == NULL ||
+	    request == NULL || status == NULL || address == NULL || ones == NULL ||
+	    (maxlen && (rows == NULL || lengths == NULL || disps == NULL)) ||
+	    (send_items && send_buff == NULL))
+	    out_of_mem = 1;
+    }
+
+    /* See if anyone out of memory, as Zoltan_Comm_Do_Post does */
+    MPI_Allreduce(&out_of_mem, &j, 1, MPI_INT, MPI_SUM, plan->comm);
+    if (j > 0) {
+	if (out_of_mem)
+	    ZOLTAN_COMM_ERROR("Out of memory", yo, my_proc);
+	ierr = ZOLTAN_MEMERR;
+	goto End;
+    }
+    if (nmsgs == 0)
+	goto End;
+
+    for (f = 0; f < nfields; f++)
+	ones[f] = 1;
+
+    /* Post the receives, then send; no barrier, since these are not */
+    /* ready sends.                                                   */
+    for (i = 0; i < plan->nrecvs + plan->self_msg; i++) {
+	if (plan->procs_from[i] == my_proc)
+	    continue;
+	for (k = 0; k < plan->lengths_from[i]; k++) {
+	    rows[k] = plan->starts_from[i] + k;
+	    if (plan->indices_from != NULL)
+		rows[k] = plan->indices_from[rows[k]];
+	}
+	Zoltan_Comm_Fields_Type(nfields, fields, plan->lengths_from[i], rows,
+				lengths, disps, field_type, address, ones,
+				&msg_type[nrecvd]);
+	MPI_Irecv(MPI_BOTTOM, 1, msg_type[nrecvd], plan->procs_from[i], tag,
+		  plan->comm, &request[nreq]);
+	nrecvd++;
+	nreq++;
+    }
+
+    /* Gather each message field by field, the layout of its datatype */
+    send_ptr = send_buff;
+    for (i = 0; i < plan->nsends + plan->self_msg; i++) {
+	if (plan->procs_to[i] == my_proc)
+	    continue;
+	for (k = 0; k < plan->lengths_to[i]; k++) {
+	    rows[k] = plan->starts_to[i] + k;
+	    if (plan->indices_to != NULL)
+		rows[k] = plan->indices_to[rows[k]];
+	    if (send_index != NULL)
+		rows[k] = send_index[rows[k]];
+	}
+	msg_start = send_ptr;
+	for (f = 0; f < nfields; f++) {
+	    if (fields[f].size <= 0)
+		continue;
+	    for (k = 0; k < plan->lengths_to[i]; k++) {
+		memcpy(send_ptr,
+		       fields[f].send + (size_t) rows[k] * fields[f].send_stride,
+		       fields[f].size);
+		send_ptr += fields[f].size;
+	    }
+	}
+	MPI_Isend(msg_start, (int) (send_ptr - msg_start), MPI_BYTE,
+		  plan->procs_to[i], tag, plan->comm, &request[nreq]);
+	nreq++;
+    }
+
+    MPI_Waitall(nreq, request, status);
+
+    for (i = 0; i < nrecvd; i++)
+	MPI_Type_free(&msg_type[i]);
+
+End:
+    ZOLTAN_FREE(&field_type);
+    ZOLTAN_FREE(&msg_type);
+    ZOLTAN_FREE(&request);
+    ZOLTAN_FREE(&status);
+    ZOLTAN_FREE(&address);
+    ZOLTAN_FREE(&ones);
+    ZOLTAN_FREE(&rows);
+    ZOLTAN_FREE(&lengths);
+    ZOLTAN_FREE(&disps);
+    ZOLTAN_FREE(&send_buff);
+
+    return (ierr);
+}
+
+#ifdef __cplusplus
+} /* closing bracket for extern "C" */
+#endif
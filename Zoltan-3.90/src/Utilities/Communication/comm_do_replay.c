@@ -0,0 +1,355 @@
+/* 
+ * @HEADER
+ *
+ * ***********************************************************************
+ *
+ *  Zoltan Toolkit for Load-balancing, Partitioning, Ordering and Coloring
+ *                  Copyright 2012 Sandia Corporation
+ *
+ * Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+ * the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the Corporation nor the names of the
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Questions? Contact Karen Devine	kddevin@sandia.gov
+ *                    Erik Boman	egboman@sandia.gov
+ *
+ * ***********************************************************************
+ *
+ * @HEADER
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan_mem.h"
+#include "comm.h"
+
+
+#ifdef __cplusplus
+/* if C++, define the rest of this header file as extern C */
+extern "C" {
+#endif
+
+/* Repeated exchanges along one plan.
+
+   A load-balancing loop typically moves data along the same plan at every
+   step.  Zoltan_Comm_Do allocates its packing buffers, synchronizes all
+   processors before sending and frees the buffers at every call.
+   Zoltan_Comm_Do_Replay instead keeps, with the plan, persistent requests
+   (MPI_Recv_init/MPI_Send_init) and the packing buffers they need.  Later
+   calls with the same tag and item size only pack the payload and restart
+   the requests, so the caller may pass new send_data and recv_data at
+   every step.  Messages which need no packing are sent from (received
+   into) user space: their requests are bound to the user arrays, and
+   are rebuilt locally only when the caller passes another array.
+   The persistent state is freed with the plan, or when Zoltan_Comm_Resize
+   changes its message sizes.
+
+   Plans with variable item sizes or using MPI_Alltoallv are handed to
+   Zoltan_Comm_Do unchanged.
+*/
+
+/*****************************************************************************/
+
+static void Zoltan_Comm_Persist_Unbind(
+MPI_Request *request,		/* requests to free */
+int count)			/* number of requests */
+{
+    int       i;
+
+    for (i = 0; i < count; i++)
+	if (request[i] != MPI_REQUEST_NULL)
+	    MPI_Request_free(&request[i]);
+}
+
+/*****************************************************************************/
+
+void      Zoltan_Comm_Persist_Free(
+ZOLTAN_COMM_OBJ * plan)		/* communication data structure */
+{
+    ZOLTAN_COMM_PERSIST *persist;
+
+    if (plan == NULL || plan->persist == NULL)
+	return;
+
+    persist = plan->persist;
+    if (persist->recv_bound != NULL)
+	Zoltan_Comm_Persist_Unbind(persist->request, plan->nrecvs);
+    if (persist->send_bound != NULL)
+	Zoltan_Comm_Persist_Unbind(persist->request + plan->nrecvs,
+				   plan->nsends + plan->self_msg);
+    ZOLTAN_FREE(&persist->request);
+    ZOLTAN_FREE(&persist->status);
+    ZOLTAN_FREE(&persist->send_buff);
+    ZOLTAN_FREE(&persist->recv_buff);
+    ZOLTAN_FREE(&plan->persist);
+}
+
+/*****************************************************************************/
+
+static void Zoltan_Comm_Persist_Bind(
+ZOLTAN_COMM_OBJ * plan,		/* communication data structure */
+char *send_base,		/* array sends are made from */
+char *recv_base,		/* array receives are made into */
+int my_proc)			/* processor ID */
+{
+    ZOLTAN_COMM_PERSIST *persist = plan->persist;
+    int       nbytes = persist->nbytes;
+    int       i, k;		/* loop counters */
+
+    /* Receives first, in procs_from order without self message */
+    if (recv_base != persist->recv_bound) {
+	if (persist->recv_bound != NULL)
+	    Zoltan_Comm_Persist_Unbind(persist->request, plan->nrecvs);
+	for (i = 0, k = 0; i < plan->nrecvs + plan->self_msg; i++) {
+	    if (plan->procs_from[i] != my_proc) {
+		MPI_Recv_init((void *)
+		    &recv_base[(size_t)(plan->starts_from[i]) * (size_t)nbytes],
+		    plan->lengths_from[i] * nbytes,
+		    (MPI_Datatype) MPI_BYTE, plan->procs_from[i], persist->tag,
+		    plan->comm, &persist->request[k]);
+		k++;
+	    }
+	}
+	persist->recv_bound = recv_base;
+    }
+
+    /* Then one send per procs_to entry; self message has a null one */
+    if (send_base != persist->send_bound) {
+	if (persist->send_bound != NULL)
+	    Zoltan_Comm_Persist_Unbind(persist->request + plan->nrecvs,
+				       plan->nsends + plan->self_msg);
+	for (i = 0, k = plan->nrecvs; i < plan->nsends + plan->self_msg;
+	     i++, k++) {
+	    if (plan->procs_to[i] != my_proc) {
+		MPI_Send_init((void *)
+		    &send_base[(size_t)(plan->starts_to[i]) * (size_t)nbytes],
+		    plan->lengths_to[i] * nbytes,
+		    (MPI_Datatype) MPI_BYTE, plan->procs_to[i], persist->tag,
+		    plan->comm, &persist->request[k]);
+	    }
+	    else
+		persist->request[k] = MPI_REQUEST_NULL;
+	}
+	persist->send_bound = send_base;
+    }
+}
+
+/*****************************************************************************/
+
+static int Zoltan_Comm_Persist_Init(
+ZOLTAN_COMM_OBJ * plan,		/* communication data structure */
+int tag,			/* message tag for communicating */
+int nbytes,			/* multiplier for sizes */
+int my_proc)			/* processor ID */
+{
+    ZOLTAN_COMM_PERSIST *persist;
+    size_t    ssize = 0;	/* size of send buffer */
+    size_t    rsize = 0;	/* size of receive buffer */
+    int       nrequests;	/* number of persistent requests */
+    int       out_of_mem;	/* am I out of memory? */
+    int       i, j;		/* loop counters */
+
+    static char *yo = "Zoltan_Comm_Persist_Init";
+
+
+    /* Packing buffers, only where data is not blocked by processor. */
+    /* Messages of a plan occupy disjoint ranges from starts_to.      */
+    if (plan->indices_to != NULL) {
+	for (i = 0; i < plan->nsends + plan->self_msg; i++) {
+	    if ((size_t) (plan->starts_to[i] + plan->lengths_to[i]) > ssize)
+		ssize = (size_t) (plan->starts_to[i] + plan->lengths_to[i]);
+	}
+	ssize *= (size_t) nbytes;
+    }
+    if (plan->indices_from != NULL)
+	rsize = (size_t) (plan->total_recv_size) * (size_t) nbytes;
+    nrequests = plan->nrecvs + plan->nsends + plan->self_msg;
+
+    out_of_mem = 0;
+    persist = (ZOLTAN_COMM_PERSIST *) ZOLTAN_MALLOC(sizeof(ZOLTAN_COMM_PERSIST));
+    if (persist == NULL)
+	out_of_mem = 1;
+    else {
+	persist->tag = tag;
+	persist->nbytes = nbytes;
+	persist->send_bound = NULL;	/* No request built yet */
+	persist->recv_bound = NULL;
+	persist->send_buff = (char *) ZOLTAN_MALLOC(ssize);
+	persist->recv_buff = (char *) ZOLTAN_MALLOC(rsize);
+	persist->request = (MPI_Request *)
+	    ZOLTAN_MALLOC(nrequests * sizeof(MPI_Request));
+	persist->status = (MPI_Status *)
+	    ZOLTAN_MALLOC(nrequests * sizeof(MPI_Status));
+	if ((persist->send_buff == NULL && ssize != 0) ||
+	    (persist->recv_buff == NULL && rsize != 0) ||
+	    (nrequests && (persist->request == NULL || persist->status == NULL)))
+	    out_of_mem = 1;
+	plan->persist = persist;
+    }
+
+    /* See if anyone out of memory, as Zoltan_Comm_Do_Post does */
+    MPI_Allreduce(&out_of_mem, &j, 1, MPI_INT, MPI_SUM, plan->comm);
+    if (j > 0) {
+	if (out_of_mem)
+	    ZOLTAN_COMM_ERROR("Out of memory", yo, my_proc);
+	Zoltan_Comm_Persist_Free(plan);
+	return (ZOLTAN_MEMERR);
+    }
+
+    return (ZOLTAN_OK);
+}
+
+/*****************************************************************************/
+
+int       Zoltan_Comm_Do_Replay(
+ZOLTAN_COMM_OBJ * plan,		/* communication data structure */
+int tag,			/* message tag for communicating */
+char *send_data,		/* array of data I currently own */
+int nbytes,			/* multiplier for sizes */
+char *recv_data)		/* array of data I'll own after comm */
+{
+    ZOLTAN_COMM_PERSIST *persist;
+    char     *send_base;	/* array sends are made from */
+    char     *recv_base;	/* array receives are made into */
+    char     *send_buff;	/* where current message is packed */
+    size_t    self_recv_address = 0;/* where in recv_base self info starts */
+    int       my_proc;		/* processor ID */
+    int       nblocks;		/* number of procs who need my data */
+    int       proc_index;	/* loop counter over procs to send to */
+    int       status;		/* return from initialization */
+    int       i, j, k;		/* loop counters */
+
+    static char *yo = "Zoltan_Comm_Do_Replay";
+
+
+    /* Check input parameters */
+    if (!plan) {
+        MPI_Comm_rank(MPI_COMM_WORLD, &my_proc);
+	ZOLTAN_COMM_ERROR("Communication plan = NULL", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+
+    /* Cases without persistent requests */
+    if (plan->sizes != NULL || plan->maxed_recvs)
+	return (Zoltan_Comm_Do(plan, tag, send_data, nbytes, recv_data));
+
+    MPI_Comm_rank(plan->comm, &my_proc);
+
+    if ((plan->nsends + plan->self_msg) && !send_data) {
+	ZOLTAN_COMM_ERROR("nsends not zero, but send_data = NULL", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+    if ((plan->nrecvs + plan->self_msg) && !recv_data) {
+	ZOLTAN_COMM_ERROR("nrecvs not zero, but recv_data = NULL", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+    if (nbytes < 0) {
+	ZOLTAN_COMM_ERROR("Scale factor nbytes is negative", yo, my_proc);
+	return ZOLTAN_FATAL;
+    }
+
+    /* Allocate persistent state if the exchange is a new one.   */
+    /* All processors see the same tag and nbytes, so all agree. */
+    if (plan->persist == NULL || plan->persist->tag != tag ||
+	plan->persist->nbytes != nbytes) {
+	Zoltan_Comm_Persist_Free(plan);
+	status = Zoltan_Comm_Persist_Init(plan, tag, nbytes, my_proc);
+	if (status != ZOLTAN_OK)
+	    return (status);
+    }
+    persist = plan->persist;
+
+    send_base = (plan->indices_to == NULL) ? send_data : persist->send_buff;
+    recv_base = (plan->indices_from == NULL) ? recv_data : persist->recv_buff;
+    Zoltan_Comm_Persist_Bind(plan, send_base, recv_base, my_proc);
+
+    /* Start receives; no barrier needed, since sends are not ready sends */
+    if (plan->nrecvs > 0)
+	MPI_Startall(plan->nrecvs, persist->request);
+
+    for (i = 0; i < plan->nrecvs + plan->self_msg; i++) {
+	if (plan->procs_from[i] == my_proc)
+	    self_recv_address = (size_t)(plan->starts_from[i]) * (size_t)nbytes;
+    }
+
+    /* Pack and start each send, beginning w/ higher numbered procs */
+    /* as Zoltan_Comm_Do_Post does, to balance message traffic.      */
+    nblocks = plan->nsends + plan->self_msg;
+    proc_index = 0;
+    while (proc_index < nblocks && plan->procs_to[proc_index] < my_proc)
+	proc_index++;
+    if (proc_index == nblocks)
+	proc_index = 0;
+
+    for (i = proc_index, j = 0; j < nblocks; j++) {
+	if (plan->procs_to[i] == my_proc) {	/* Copy data to self. */
+	    send_buff = &recv_base[self_recv_address];
+	    if (plan->indices_to == NULL)
+		memmove(send_buff,
+			&send_data[(size_t)(plan->starts_to[i]) * (size_t)nbytes],
+			(size_t)(plan->lengths_to[i]) * (size_t)nbytes);
+	}
+	else
+	    send_buff = &send_base[(size_t)(plan->starts_to[i]) * (size_t)nbytes];
+
+	if (plan->indices_to != NULL) {	/* Need to pack message first. */
+	    for (k = plan->starts_to[i];
+		 k < plan->starts_to[i] + plan->lengths_to[i]; k++) {
+		memcpy(send_buff,
+		       &send_data[(size_t)(plan->indices_to[k]) * (size_t)nbytes],
+		       nbytes);
+		send_buff += nbytes;
+	    }
+	}
+
+	if (plan->procs_to[i] != my_proc)
+	    MPI_Start(&persist->request[plan->nrecvs + i]);
+	if (++i == nblocks)
+	    i = 0;
+    }
+
+    if (nblocks + plan->nrecvs > 0)
+	MPI_Waitall(plan->nrecvs + nblocks, persist->request, persist->status);
+
+    /* Unpack received data if it was not received in place */
+    if (plan->indices_from != NULL) {
+	for (k = 0; k < plan->total_recv_size; k++)
+	    memcpy(&recv_data[(size_t)(plan->indices_from[k]) * (size_t)nbytes],
+		   &persist->recv_buff[(size_t)k * (size_t)nbytes], nbytes);
+    }
+
+    return (ZOLTAN_OK);
+}
+
+#ifdef __cplusplus
+} /* closing bracket for extern "C" */
+#endif
@@ -133,6 +133,7 @@ int      *sizes)		/* variable size of objects (if not NULL) */
     plan->plan_reverse->indices_from_ptr = NULL;
     plan->plan_reverse->maxed_recvs = 0;
     plan->plan_reverse->plan_reverse = NULL;
+    plan->plan_reverse->persist = NULL;
     plan->plan_reverse->recv_buff = NULL;
 
     if (MPI_RECV_LIMIT > 0){
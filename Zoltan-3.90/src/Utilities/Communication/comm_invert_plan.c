@@ -127,6 +127,7 @@ int max_recv_length;
   new->total_recv_size = total_send_length;
   new->comm = old->comm;
   new->maxed_recvs = 0;
+  new->persist = NULL;
 
   if (MPI_RECV_LIMIT > 0){
     /* If we have a limit to the number of posted receives we are allowed,
@@ -164,6 +165,7 @@ End:
     if (old->indices_from_ptr) ZOLTAN_FREE(&(old->indices_from_ptr));
     if (old->request)          ZOLTAN_FREE(&(old->request));
     if (old->status)           ZOLTAN_FREE(&(old->status));
+    Zoltan_Comm_Persist_Free(old);
     ZOLTAN_FREE(&old);
     *plan = new;
   }
@@ -99,6 +99,8 @@ int      *sum_recv_sizes)       /* sum of the sizes of the items I'll receive */
 	return(ZOLTAN_FATAL);
     }
 
+    Zoltan_Comm_Persist_Free(plan);	/* replay buffers have old sizes */
+
     ZOLTAN_FREE(&plan->sizes);
     ZOLTAN_FREE(&plan->sizes_to);
     ZOLTAN_FREE(&plan->sizes_from);
@@ -84,6 +84,13 @@ extern "C" {
  *
  * The "user_length" parameter specifies the number of chars in the
  * user data.
+ *
+ * Zoltan_DD_Create_Table() also takes the "table_type" parameter, which
+ * selects how each processor stores its part of the directory:
+ * ZOLTAN_DD_TABLE_CHAINED (what Zoltan_DD_Create gives) or
+ * ZOLTAN_DD_TABLE_OPEN.  For the open addressing table, "table_length"
+ * is the number of GIDs expected on a processor, or 0 to size the table
+ * on the first update.
  */
 
 /*******************  Zoltan_DD_Create()  ***************************/
@@ -98,11 +105,29 @@ int Zoltan_DD_Create (
  int table_length,            /* sizeof hash table, use default if 0   */
  int debug_level              /* control actions to errors, normally 0 */
 )
+{
+   return Zoltan_DD_Create_Table (dd, comm, num_gid, num_lid, user_length,
+    table_length, ZOLTAN_DD_TABLE_CHAINED, debug_level);
+}
+
+/*******************  Zoltan_DD_Create_Table()  *********************/
+
+int Zoltan_DD_Create_Table (
+ Zoltan_DD_Directory **dd,    /* contains directory state and pointers */
+ MPI_Comm comm,               /* Dup'ed and saved for future use       */
+ int num_gid,                 /* Number of entries in a global ID.     */
+ int num_lid,                 /* Number of entries in a local ID.      
+                                 If zero, ignore LIDs                  */
+ int user_length,             /* Optional user data length in chars, 0 ignore */
+ int table_length,            /* sizeof hash table, use default if 0   */
+ int table_type,              /* ZOLTAN_DD_TABLE_CHAINED or _OPEN      */
+ int debug_level              /* control actions to errors, normally 0 */
+)
 {
    int size, i;
    int my_proc;
    int array[3], max_array[3], min_array[3];
-   char *yo = "Zoltan_DD_Create";
+   char *yo = "Zoltan_DD_Create_Table";
 
    if (MPI_Comm_rank(comm, &my_proc) != MPI_SUCCESS)  {
       ZOLTAN_PRINT_ERROR (-1, yo, "MPI_Comm_rank failed");
@@ -110,7 +135,9 @@ int Zoltan_DD_Create (
    }
 
    /* input sanity check */
-   if (dd == NULL || num_gid < 1 || table_length < 0 || num_lid < 0)  {
+   if (dd == NULL || num_gid < 1 || table_length < 0 || num_lid < 0
+    || (table_type != ZOLTAN_DD_TABLE_CHAINED
+     && table_type != ZOLTAN_DD_TABLE_OPEN))  {
       ZOLTAN_PRINT_ERROR (my_proc, yo, "Invalid input argument");
       return ZOLTAN_FATAL;
    }
@@ -130,8 +157,13 @@ int Zoltan_DD_Create (
    }
 
    /* malloc memory for the directory structure + hash table */
-   size = (table_length) ? table_length: ZOLTAN_DD_HASH_TABLE_COUNT;
-   size = Zoltan_Recommended_Hash_Size(size);
+   /* (an open addressing table keeps no linked list heads)    */
+   if (table_type == ZOLTAN_DD_TABLE_OPEN)
+      size = 1;
+   else {
+      size = (table_length) ? table_length: ZOLTAN_DD_HASH_TABLE_COUNT;
+      size = Zoltan_Recommended_Hash_Size(size);
+   }
    *dd  = (Zoltan_DD_Directory*) ZOLTAN_MALLOC (sizeof (Zoltan_DD_Directory)
         + size * sizeof(DD_NodeIdx));
    if (*dd == NULL)  {
@@ -154,6 +186,7 @@ int Zoltan_DD_Create (
    (*dd)->gid_length       = num_gid;      /* saved input Num_GID       */
    (*dd)->lid_length       = num_lid;      /* saved input Num_LIB       */
    (*dd)->table_length     = size;         /* # of linked list heads    */
+   (*dd)->table_type       = table_type;   /* local storage scheme      */
    (*dd)->user_data_length = user_length;  /* optional user data length */
    (*dd)->hash             = Zoltan_DD_Hash2;/* default hash algorithm   */
    (*dd)->hashdata         = NULL;         /* no hash data */
@@ -187,6 +220,17 @@ int Zoltan_DD_Create (
          return ZOLTAN_FATAL;
    }
 
+   /* size the open addressing table now if its use is known */
+   if (table_type == ZOLTAN_DD_TABLE_OPEN) {
+      (*dd)->table_length = 0;             /* no slots until allocated  */
+      if (table_length > 0
+       && DD_Open_Alloc (*dd, (DD_NodeIdx) table_length) != ZOLTAN_OK)  {
+         ZOLTAN_PRINT_ERROR (my_proc, yo, "Can not malloc open table");
+         Zoltan_DD_Destroy (dd);
+         return ZOLTAN_MEMERR;
+      }
+   }
+
    if (debug_level > 4)
       ZOLTAN_TRACE_OUT (my_proc, yo, NULL);
    return ZOLTAN_OK;
@@ -221,10 +265,13 @@ int Zoltan_DD_Copy_To(Zoltan_DD_Directory **toptr, Zoltan_DD_Directory *from)
   if (from) {
     DD_NodeIdx i;
 
+    int heads = (from->table_type == ZOLTAN_DD_TABLE_OPEN)
+              ? 1 : from->table_length;
+
     to = *toptr = 
       (Zoltan_DD_Directory *)ZOLTAN_MALLOC(
         sizeof (Zoltan_DD_Directory) + 
-        (from->table_length * sizeof(DD_NodeIdx)));
+        (heads * sizeof(DD_NodeIdx)));
 
     if (!to) {
       ZOLTAN_PRINT_ERROR(from->my_proc, yo, "Insufficient memory."); 
@@ -232,7 +279,7 @@ int Zoltan_DD_Copy_To(Zoltan_DD_Directory **toptr, Zoltan_DD_Directory *from)
     }
   
     *to = *from;
-    memcpy(to->table, from->table, to->table_length * sizeof(DD_NodeIdx));
+    memcpy(to->table, from->table, heads * sizeof(DD_NodeIdx));
 
     MPI_Comm_dup(from->comm, &(to->comm));
 
@@ -68,10 +68,24 @@ int Zoltan_DD_GetLocalKeys(Zoltan_DD_Directory *dd,
   int gid_alloc_size;
 
   gid_alloc_size = dd->table_length;
+  if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  /* may have no slots yet */
+    gid_alloc_size = (dd->nodecnt > 0) ? dd->nodecnt : 1;
   (*gid) = (ZOLTAN_ID_PTR)ZOLTAN_MALLOC(
                           gid_alloc_size*dd->gid_length*sizeof(ZOLTAN_ID_TYPE));
 
   k= 0;
+  if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  {
+    for (nodeidx = 0; nodeidx < dd->nodelistlen; nodeidx++) {
+      ptr = dd->nodelist + nodeidx;
+      if (ptr->free)
+        continue;
+      ZOLTAN_SET_ID (dd->gid_length, (*gid)+k*dd->gid_length, ptr->gid);
+      k++;
+    }
+    (*size) = k;
+    return (ierr);
+  }
+
   for (i = 0; i < dd->table_length; i++)
     for (nodeidx = dd->table[i]; nodeidx != -1;
          nodeidx = dd->nodelist[nodeidx].next) {
@@ -116,6 +130,7 @@ int Zoltan_DD_Find (
    char            *sbuff = NULL;     /* send buffer                     */
    char            *sbufftmp = NULL;  /* pointer into send buffer        */
    int             *procs = NULL;     /* list of processors to contact   */
+   int             *order = NULL;     /* GIDs packed by processor        */
    DD_Find_Msg     *ptr   = NULL;
    int              i;
    int              nrec;             /* number of messages to receive   */
@@ -159,17 +174,25 @@ int Zoltan_DD_Find (
    if (dd->debug_level > 6)
       ZOLTAN_PRINT_INFO(dd->my_proc, yo, "After mallocs");
 
-   /* for each GID, fill DD_Find_Msg buffer and contact list */
-   sbufftmp = sbuff;
-   for (i = 0; i < count; i++)  {
+   /* for each GID, fill contact list */
+   for (i = 0; i < count; i++)
       procs[i] = dd->hash (gid + i*dd->gid_length, dd->gid_length, dd->nproc,
                            dd->hashdata, dd->hashfn);
+
+   /* open addressing table: pack find messages by processor */
+   err = DD_Open_Order (dd, procs, count, &order);
+   if (err != ZOLTAN_OK)
+      goto fini;
+
+   /* for each GID, fill DD_Find_Msg buffer */
+   sbufftmp = sbuff;
+   for (i = 0; i < count; i++)  {
       ptr      = (DD_Find_Msg*) sbufftmp;
       sbufftmp += dd->find_msg_size;
 
-      ptr->index = i;
+      ptr->index = (order) ? order[i] : i;
       ptr->proc  = procs[i];
-      ZOLTAN_SET_ID (dd->gid_length, ptr->id, gid + i*dd->gid_length);
+      ZOLTAN_SET_ID (dd->gid_length, ptr->id, gid + ptr->index*dd->gid_length);
    }
    if (dd->debug_level > 6)
       ZOLTAN_PRINT_INFO(dd->my_proc, yo, "After fill");
@@ -257,6 +280,7 @@ fini:
    ZOLTAN_FREE (&sbuff);
    ZOLTAN_FREE (&rbuff);
    ZOLTAN_FREE (&procs) ;
+   ZOLTAN_FREE (&order);
    Zoltan_Comm_Destroy (&plan);
 
    if (dd->debug_level > 4)
@@ -297,12 +321,20 @@ static int DD_Find_Local (Zoltan_DD_Directory *dd,
    if (dd->debug_level > 5)
       ZOLTAN_TRACE_IN (dd->my_proc, yo, NULL);
 
-   /* compute offset into hash table to find head of linked list */
-   index = Zoltan_DD_Hash2 (gid, dd->gid_length, dd->table_length,
-                            dd->hashdata, NULL);
+   /* open addressing table: probe for gid from its home slot */
+   if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  {
+      index   = -1;
+      nodeidx = DD_Open_Find (dd, gid);
+   }
+   else {
+      /* compute offset into hash table to find head of linked list */
+      index = Zoltan_DD_Hash2 (gid, dd->gid_length, dd->table_length,
+                               dd->hashdata, NULL);
+      nodeidx = dd->table[index];
+   }
    /* walk link list until end looking for matching global ID */
-   for (nodeidx = dd->table[index]; nodeidx != -1;
-        nodeidx = dd->nodelist[nodeidx].next) {
+   for ( ; nodeidx != -1; nodeidx = (index == -1) ? -1
+                                  : dd->nodelist[nodeidx].next) {
       ptr = dd->nodelist + nodeidx;
       if (ZOLTAN_EQ_ID (dd->gid_length, gid, ptr->gid) == TRUE)  {
          /* matching global ID found! Return gid's information */
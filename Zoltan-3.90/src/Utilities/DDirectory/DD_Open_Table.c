@@ -0,0 +1,292 @@
+/* 
+ * @HEADER
+ *
+ * ***********************************************************************
+ *
+ *  Zoltan Toolkit for Load-balancing, Partitioning, Ordering and Coloring
+ *                  Copyright 2012 Sandia Corporation
+ *
+ * Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+ * the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the Corporation nor the names of the
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Questions? Contact Karen Devine	kddevin@sandia.gov
+ *                    Erik Boman	egboman@sandia.gov
+ *
+ * ***********************************************************************
+ *
+ * @HEADER
+ */
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "zoltan_dd_const.h"
+
+
+#ifdef __cplusplus
+/* if C++, define the rest of this header file as extern C */
+extern "C" {
+#endif
+
+/*
+ * Idea:  Store the directory as one flat open addressing table instead of
+ * hash table heads pointing into linked lists of nodes.  The nodelist
+ * itself is the table: its length is a power of two, a GID lives in the
+ * first free slot at or after its home slot (linear probing), and its
+ * LID and user data sit inline in the matching nodedata slot.  A lookup
+ * therefore touches consecutive slots instead of chasing indices.
+ * In this layout DD_Node.next is not a link: it caches the full hash of
+ * the GID, so that probes skip most key compares and deletions and table
+ * growth never rehash a GID.  Deletion shifts the following slots back
+ * (no tombstones), so a probe always stops at the first free slot.
+ */
+
+#define DD_OPEN_MIN_LENGTH  16  /* smallest table allocated             */
+
+/* The table is grown before its load exceeds 3/4 */
+#define DD_OPEN_MAX_COUNT(len)  ((len) - ((len) >> 2))
+
+/******************************************************************************/
+
+static unsigned int DD_Open_Hash (
+  Zoltan_DD_Directory *dd,
+  ZOLTAN_ID_PTR gid)
+{
+/* Full width hash of a GID.  All GIDs stored on a processor share the   */
+/* same value of Zoltan_DD_Hash2() modulo nproc, so its low bits must be */
+/* remixed (MurmurHash3 finalizer) before they can index the table.      */
+  unsigned int h;
+
+  h = Zoltan_DD_Hash2 (gid, dd->gid_length, 0xFFFFFFFFU, NULL, NULL);
+  h ^= h >> 16;
+  h *= 0x85EBCA6BU;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35U;
+  h ^= h >> 16;
+
+  return h;
+}
+
+/******************************************************************************/
+
+int DD_Open_Alloc (
+  Zoltan_DD_Directory *dd,  /* directory state information       */
+  DD_NodeIdx count)         /* Number of GIDs the table must hold */
+{
+/* Make room for at least count GIDs, rehashing the current contents */
+/* into a larger table if needed.                                     */
+  DD_Node    *oldlist;
+  char       *olddata;
+  DD_NodeIdx  oldlen;
+  DD_NodeIdx  len;
+  DD_NodeIdx  i, j;
+  unsigned int mask;
+  char       *yo = "DD_Open_Alloc";
+
+  if (count <= DD_OPEN_MAX_COUNT(dd->nodelistlen))
+    return ZOLTAN_OK;                       /* Already large enough */
+
+  len = (dd->nodelistlen > 0) ? dd->nodelistlen : DD_OPEN_MIN_LENGTH;
+  while (count > DD_OPEN_MAX_COUNT(len))
+    len *= 2;
+
+  oldlist = dd->nodelist;
+  olddata = dd->nodedata;
+  oldlen  = dd->nodelistlen;
+
+  dd->nodelist = (DD_Node *) ZOLTAN_MALLOC(sizeof(DD_Node) * len);
+  dd->nodedata = (char *) ZOLTAN_MALLOC(dd->nodedata_size * len);
+  if (dd->nodelist == NULL || dd->nodedata == NULL) {
+    ZOLTAN_PRINT_ERROR (dd->my_proc, yo, "Unable to malloc table");
+    ZOLTAN_FREE(&(dd->nodelist));
+    ZOLTAN_FREE(&(dd->nodedata));
+    dd->nodelist = oldlist;                 /* Leave directory untouched */
+    dd->nodedata = olddata;
+    return ZOLTAN_MEMERR;
+  }
+
+  for (i = 0; i < len; i++) {
+    dd->nodelist[i].gid  = (ZOLTAN_ID_PTR) (dd->nodedata + i * dd->nodedata_size);
+    dd->nodelist[i].free = 1;
+  }
+  dd->nodelistlen  = len;
+  dd->table_length = len;
+
+  /* Move old slots to their new place; their cached hash is reused */
+  mask = (unsigned int) len - 1;
+  for (i = 0; i < oldlen; i++) {
+    if (oldlist[i].free)
+      continue;
+    for (j = (DD_NodeIdx) ((unsigned int) oldlist[i].next & mask);
+         ! dd->nodelist[j].free; j = (DD_NodeIdx) ((j + 1) & mask)) ;
+    dd->nodelist[j].owner     = oldlist[i].owner;
+    dd->nodelist[j].partition = oldlist[i].partition;
+    dd->nodelist[j].errcheck  = oldlist[i].errcheck;
+    dd->nodelist[j].next      = oldlist[i].next;
+    dd->nodelist[j].free      = 0;
+    memcpy (dd->nodelist[j].gid, oldlist[i].gid, dd->nodedata_size);
+  }
+
+  ZOLTAN_FREE(&oldlist);
+  ZOLTAN_FREE(&olddata);
+
+  return ZOLTAN_OK;
+}
+
+/******************************************************************************/
+
+DD_NodeIdx DD_Open_Find (
+  Zoltan_DD_Directory *dd,
+  ZOLTAN_ID_PTR gid)
+{
+/* Return the slot holding gid, or -1 if gid is not in the directory. */
+  unsigned int h, mask;
+  DD_NodeIdx   i;
+
+  if (dd->nodecnt == 0)
+    return -1;
+
+  h    = DD_Open_Hash (dd, gid);
+  mask = (unsigned int) dd->nodelistlen - 1;
+  for (i = (DD_NodeIdx) (h & mask); ! dd->nodelist[i].free;
+       i = (DD_NodeIdx) ((i + 1) & mask))
+    if ((unsigned int) dd->nodelist[i].next == h
+     && ZOLTAN_EQ_ID (dd->gid_length, gid, dd->nodelist[i].gid) == TRUE)
+      return i;
+
+  return -1;
+}
+
+/******************************************************************************/
+
+DD_NodeIdx DD_Open_Insert (
+  Zoltan_DD_Directory *dd,
+  ZOLTAN_ID_PTR gid)
+{
+/* Claim a slot for gid, which must not be in the directory yet, and */
+/* store gid in it.  Return the slot, or -1 if the table can't grow. */
+  unsigned int h, mask;
+  DD_NodeIdx   i;
+
+  if (DD_Open_Alloc (dd, dd->nodecnt + 1) != ZOLTAN_OK)
+    return -1;
+
+  h    = DD_Open_Hash (dd, gid);
+  mask = (unsigned int) dd->nodelistlen - 1;
+  for (i = (DD_NodeIdx) (h & mask); ! dd->nodelist[i].free;
+       i = (DD_NodeIdx) ((i + 1) & mask)) ;
+
+  dd->nodelist[i].next = (DD_NodeIdx) h;
+  dd->nodelist[i].free = 0;
+  ZOLTAN_SET_ID (dd->gid_length, dd->nodelist[i].gid, gid);
+  dd->nodecnt++;
+
+  return i;
+}
+
+/******************************************************************************/
+
+void DD_Open_Remove (
+  Zoltan_DD_Directory *dd,
+  DD_NodeIdx freenode)
+{
+/* Empty slot freenode.  Following slots of the same cluster which are */
+/* not at their home slot are moved back so that no probe sequence is  */
+/* broken by the hole.                                                  */
+  unsigned int mask;
+  DD_NodeIdx   i, j;
+
+  mask = (unsigned int) dd->nodelistlen - 1;
+  for (i = freenode, j = (DD_NodeIdx) ((freenode + 1) & mask);
+       ! dd->nodelist[j].free; j = (DD_NodeIdx) ((j + 1) & mask)) {
+    if (DD_Open_Probe (dd, j) < (int) ((j - i) & mask))
+      continue;                             /* Home slot lies in ]i,j] */
+    dd->nodelist[i].owner     = dd->nodelist[j].owner;
+    dd->nodelist[i].partition = dd->nodelist[j].partition;
+    dd->nodelist[i].errcheck  = dd->nodelist[j].errcheck;
+    dd->nodelist[i].next      = dd->nodelist[j].next;
+    memcpy (dd->nodelist[i].gid, dd->nodelist[j].gid, dd->nodedata_size);
+    i = j;
+  }
+  dd->nodelist[i].free = 1;
+  dd->nodecnt--;
+}
+
+/******************************************************************************/
+
+int DD_Open_Probe (
+  Zoltan_DD_Directory *dd,
+  DD_NodeIdx nodeidx)
+{
+/* Return the distance of used slot nodeidx from its home slot, */
+/* that is, the number of extra slots a lookup walks to reach it. */
+  unsigned int mask;
+
+  mask = (unsigned int) dd->nodelistlen - 1;
+  return (int) (((unsigned int) nodeidx
+               - ((unsigned int) dd->nodelist[nodeidx].next & mask)) & mask);
+}
+
+/******************************************************************************/
+
+int DD_Open_Order (
+  Zoltan_DD_Directory *dd,  /* directory state information            */
+  int *procs,               /* destination of each GID; sorted on exit */
+  int count,                /* Number of GIDs                          */
+  int **order)              /* GID index of each sorted position (out)  */
+{
+/* With the open addressing table, requests are packed by destination */
+/* processor, so that Zoltan_Comm sends every message as one block of */
+/* consecutive keys instead of gathering them through an index array. */
+/* The sort is stable, so updates of a GID keep their order.  With    */
+/* the chained table, *order is left NULL, i.e. the identity.          */
+  int  i;
+  char *yo = "DD_Open_Order";
+
+  *order = NULL;
+  if (dd->table_type != ZOLTAN_DD_TABLE_OPEN || count < 2)
+    return ZOLTAN_OK;
+
+  *order = (int *) ZOLTAN_MALLOC (sizeof(int) * count);
+  if (*order == NULL) {
+    ZOLTAN_PRINT_ERROR (dd->my_proc, yo, "Unable to malloc order list");
+    return ZOLTAN_MEMERR;
+  }
+  for (i = 0; i < count; i++)
+    (*order)[i] = i;
+
+  return Zoltan_Comm_Sort_Ints (procs, *order, count);
+}
+
+#ifdef __cplusplus
+} /* closing bracket for extern "C" */
+#endif
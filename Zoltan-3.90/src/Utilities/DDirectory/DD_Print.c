@@ -84,9 +84,13 @@ int Zoltan_DD_Print (
       ZOLTAN_TRACE_IN (dd->my_proc, yo, NULL);
 
    /* walk linked list printing each node */
+   /* (open addressing table: walk used slots, i = slot) */
    for (i = 0; i < dd->table_length; i++)
-      for (nodeidx = dd->table[i]; nodeidx != -1;
-           nodeidx = dd->nodelist[nodeidx].next) {
+      for (nodeidx = (dd->table_type == ZOLTAN_DD_TABLE_OPEN)
+                   ? (dd->nodelist[i].free ? -1 : i) : dd->table[i];
+           nodeidx != -1;
+           nodeidx = (dd->table_type == ZOLTAN_DD_TABLE_OPEN)
+                   ? -1 : dd->nodelist[nodeidx].next) {
          ptr = dd->nodelist + nodeidx;
          printf ("ZOLTAN DD Print(%d): \tList %3d, \tGID ", dd->my_proc, i);
          printf("(");
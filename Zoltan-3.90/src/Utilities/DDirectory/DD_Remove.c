@@ -74,6 +74,7 @@ int Zoltan_DD_Remove (
  int count)                          /* Number of GIDs in removal list  */
 {
    int             *procs = NULL;   /* list of processors to contact   */
+   int             *order = NULL;   /* GIDs packed by processor        */
    DD_Remove_Msg   *ptr   = NULL;
    ZOLTAN_COMM_OBJ *plan  = NULL;   /* efficient MPI communication     */
    char            *sbuff = NULL;   /* send buffer                     */
@@ -82,7 +83,7 @@ int Zoltan_DD_Remove (
    char            *rbufftmp = NULL;/* pointer into receive buffer     */
 
    int              nrec;           /* number of receives to expect    */
-   int              i;
+   int              i, j;
    int              err;            /* error condition to return       */
    int              errcount;       /* count of GIDs not found         */
    char             str[100];       /* string to build error messages  */
@@ -124,15 +125,24 @@ int Zoltan_DD_Remove (
    if (dd->debug_level > 6)
       ZOLTAN_PRINT_INFO (dd->my_proc, yo, "After proc & sbuff mallocs");
 
-   /* for each GID, fill in contact list and then message structure */
-   sbufftmp = sbuff;
-   for (i = 0; i < count; i++)  {
+   /* for each GID, fill in contact list */
+   for (i = 0; i < count; i++)
       procs[i] = dd->hash(gid + i*dd->gid_length, dd->gid_length, dd->nproc,
                           dd->hashdata, dd->hashfn);
+
+   /* open addressing table: pack remove messages by processor */
+   err = DD_Open_Order (dd, procs, count, &order);
+   if (err != ZOLTAN_OK)
+      goto fini;
+
+   /* for each GID, fill in message structure */
+   sbufftmp = sbuff;
+   for (i = 0; i < count; i++)  {
+      j   = (order) ? order[i] : i;
       ptr = (DD_Remove_Msg*) sbufftmp;
       sbufftmp += dd->remove_msg_size;
       ptr->owner = dd->my_proc;
-      ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid + i * dd->gid_length);
+      ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid + j * dd->gid_length);
    }
 
    /* now create efficient communication plan */
@@ -188,6 +198,7 @@ int Zoltan_DD_Remove (
    /* done, now free up things and return */
  fini:
    ZOLTAN_FREE (&procs);
+   ZOLTAN_FREE (&order);
    ZOLTAN_FREE (&sbuff);
    ZOLTAN_FREE (&rbuff);
    Zoltan_Comm_Destroy (&plan);
@@ -226,6 +237,17 @@ static int DD_Remove_Local (Zoltan_DD_Directory *dd,
    if (dd->debug_level > 5)
       ZOLTAN_TRACE_IN (dd->my_proc, yo, NULL);
 
+   /* open addressing table: empty the slot and close the gap */
+   if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  {
+      nodeidx = DD_Open_Find (dd, gid);
+      if (nodeidx != -1)
+         DD_Open_Remove (dd, nodeidx);
+
+      if (dd->debug_level > 5)
+         ZOLTAN_TRACE_OUT (dd->my_proc, yo, NULL);
+      return (nodeidx != -1) ? ZOLTAN_OK : ZOLTAN_WARN;
+   }
+
    /* compute offset into hash table to find head of linked list */
    index = Zoltan_DD_Hash2 (gid, dd->gid_length, dd->table_length,
                             dd->hashdata, NULL);
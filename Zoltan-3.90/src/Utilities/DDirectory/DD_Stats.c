@@ -77,7 +77,7 @@ void Zoltan_DD_Stats (
    int      i;
    DD_NodeIdx nodeidx;
    DD_Node *ptr;
-   char     str[100];      /* used to build message string */
+   char     str[120];      /* used to build message string */
    char    *yo = "Zoltan_DD_Stats";
 
 
@@ -90,6 +90,37 @@ void Zoltan_DD_Stats (
    if (dd->debug_level > 4)
       ZOLTAN_TRACE_IN (dd->my_proc, yo, NULL);
 
+   /* open addressing table: report probe lengths instead of lists */
+   if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  {
+      double probe_sum = 0.0;  /* sum of probe lengths of all Nodes */
+
+      for (nodeidx = 0; nodeidx < dd->nodelistlen; nodeidx++) {
+         ptr = dd->nodelist + nodeidx;
+         if (ptr->free)
+            continue;
+         length = DD_Open_Probe (dd, nodeidx);
+         if (dd->debug_level > 6) {
+            sprintf(str, "GID " ZOLTAN_ID_SPEC ", Owner %d, Slot %d, Probe %d.",
+                    *ptr->gid, ptr->owner, nodeidx, length);
+            ZOLTAN_PRINT_INFO (dd->my_proc, yo, str);
+         }
+         probe_sum += length;
+         node_count++;
+         if (length > maxlength)
+            maxlength = length;     /* save longest probe sequence */
+      }
+
+      sprintf(str, "Open table size %d, %d nodes, "
+                   "mean probe length %.2f, max probe length %d.",
+              dd->nodelistlen, node_count,
+              (node_count > 0) ? probe_sum / node_count : 0.0, maxlength);
+      ZOLTAN_PRINT_INFO (dd->my_proc, yo, str);
+
+      if (dd->debug_level > 4)
+         ZOLTAN_TRACE_OUT (dd->my_proc, yo, NULL);
+      return;
+   }
+
    /* walk down each list in hash table to find every Node */
    for (i = 0; i < dd->table_length; i++) {
       length = 0;                    /* reset length for next count */
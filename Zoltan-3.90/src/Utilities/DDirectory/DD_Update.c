@@ -73,6 +73,7 @@ int Zoltan_DD_Update (
  int count)                /* Number of GIDs in update list            */
 {
    int             *procs = NULL;   /* list of processors to contact   */
+   int             *order = NULL;   /* GIDs packed by processor        */
    DD_Update_Msg   *ptr   = NULL;
    ZOLTAN_COMM_OBJ *plan  = NULL;   /* for efficient MPI communication */
    char            *sbuff = NULL;   /* send buffer                     */
@@ -80,7 +81,7 @@ int Zoltan_DD_Update (
    char            *rbuff = NULL;   /* receive buffer                  */
    char            *rbufftmp = NULL;/* pointer into receive buffer     */
    int              nrec = 0;       /* number of receives to expect    */
-   int              i;
+   int              i, j;
    int              err;
    int              errcount = 0;   /* count of GIDs not found, added  */
    char             str[100];       /* build error message string      */
@@ -98,7 +99,10 @@ int Zoltan_DD_Update (
 
    /* part of initializing the error checking process             */
    /* for each linked list head, walk its list resetting errcheck */
-   if (dd->debug_level)
+   if (dd->debug_level && dd->table_type == ZOLTAN_DD_TABLE_OPEN)
+      for (i = 0; i < dd->nodelistlen; i++)
+         dd->nodelist[i].errcheck = ZOLTAN_DD_NO_PROC;
+   else if (dd->debug_level)
       for (i = 0; i < dd->table_length; i++) {
          DD_NodeIdx nodeidx;
          for (nodeidx = dd->table[i]; nodeidx != -1;
@@ -132,31 +136,40 @@ int Zoltan_DD_Update (
    if (dd->debug_level > 6)
       ZOLTAN_PRINT_INFO(dd->my_proc, yo, "After mallocs");
 
-   /* for each GID given, fill in contact list and then message structure */
-   sbufftmp = sbuff;
-   for (i = 0; i < count; i++)  {
+   /* for each GID given, fill in contact list */
+   for (i = 0; i < count; i++)
       procs[i] = dd->hash(gid + i*dd->gid_length, dd->gid_length, dd->nproc,
                           dd->hashdata, dd->hashfn);
+
+   /* open addressing table: pack update messages by processor */
+   err = DD_Open_Order (dd, procs, count, &order);
+   if (err != ZOLTAN_OK)
+      goto fini;
+
+   /* for each GID given, fill in message structure */
+   sbufftmp = sbuff;
+   for (i = 0; i < count; i++)  {
+      j        = (order) ? order[i] : i;
       ptr      = (DD_Update_Msg*) sbufftmp;
       sbufftmp += dd->update_msg_size;
 
       ptr->lid_flag       = (lid)  ? 1 : 0;
       ptr->user_flag      = (user) ? 1 : 0;
       ptr->partition_flag = (partition) ? 1 : 0;
-      ptr->partition      = (partition) ? *(partition + i) :  -1;
+      ptr->partition      = (partition) ? *(partition + j) :  -1;
       ptr->owner          = dd->my_proc;
 
-      ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid + i * dd->gid_length);
+      ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid + j * dd->gid_length);
       if (lid) {
          ZOLTAN_SET_ID(dd->lid_length, ptr->gid + dd->gid_length,
-                       lid + i * dd->lid_length);
+                       lid + j * dd->lid_length);
       }
       else {
          memset(ptr->gid + dd->gid_length, 0, dd->lid_length);
       }
       if (user) {
          memcpy(ptr->gid + (dd->gid_length + dd->lid_length),
-                user + (size_t)i * (size_t)(dd->user_data_length),
+                user + (size_t)j * (size_t)(dd->user_data_length),
                 dd->user_data_length);
       }
       else {
@@ -182,7 +195,14 @@ int Zoltan_DD_Update (
    /* If dd has no nodes allocated (e.g., first call to DD_Update; 
     * create the nodelist and freelist 
     */
-   if (nrec && dd->nodelistlen == 0) {
+   if (dd->table_type == ZOLTAN_DD_TABLE_OPEN) {
+      /* grow the open table once for the whole batch; as GIDs may be */
+      /* updated rather than added, this is only an upper bound        */
+      err = DD_Open_Alloc (dd, dd->nodecnt + (DD_NodeIdx) nrec);
+      if (err != ZOLTAN_OK)
+         goto fini;
+   }
+   else if (nrec && dd->nodelistlen == 0) {
       DD_Memory_Alloc_Nodelist(dd, (DD_NodeIdx) nrec, 0.); 
                                /* TODO Add overalloc parameter */
    }
@@ -233,6 +253,7 @@ int Zoltan_DD_Update (
 
 fini:
    ZOLTAN_FREE (&procs);
+   ZOLTAN_FREE (&order);
    ZOLTAN_FREE (&sbuff);
    ZOLTAN_FREE (&rbuff);
    Zoltan_Comm_Destroy (&plan);
@@ -281,13 +302,21 @@ static int DD_Update_Local (Zoltan_DD_Directory *dd,
    if (dd->debug_level > 5)
       ZOLTAN_TRACE_IN (dd->my_proc, yo, NULL);
 
-   /* compute offset into hash table to find head of linked list */
-   index = Zoltan_DD_Hash2 (gid, dd->gid_length, dd->table_length,
-                            dd->hashdata, NULL);
+   /* open addressing table: probe for gid from its home slot */
+   if (dd->table_type == ZOLTAN_DD_TABLE_OPEN)  {
+      index   = -1;
+      nodeidx = DD_Open_Find (dd, gid);
+   }
+   else {
+      /* compute offset into hash table to find head of linked list */
+      index = Zoltan_DD_Hash2 (gid, dd->gid_length, dd->table_length,
+                               dd->hashdata, NULL);
+      nodeidx = dd->table[index];
+   }
 
    /* walk linked list until end looking for matching gid */
-   for (nodeidx = dd->table[index]; nodeidx != -1;
-        nodeidx = dd->nodelist[nodeidx].next) {
+   for ( ; nodeidx != -1; nodeidx = (index == -1) ? -1
+                                  : dd->nodelist[nodeidx].next) {
        ptr = dd->nodelist + nodeidx;
        if (ZOLTAN_EQ_ID (dd->gid_length, gid, ptr->gid) == TRUE)  {
           /* found match, update directory information */
@@ -317,10 +346,22 @@ static int DD_Update_Local (Zoltan_DD_Directory *dd,
    }
 
    /* gid not found. Create new DD_Node and fill it in */
-   nodeidx = DD_Memory_Alloc_Node(dd);
-   ptr = dd->nodelist + nodeidx;
+   if (index == -1)  {
+      nodeidx = DD_Open_Insert (dd, gid);  /* stores gid in its slot */
+      if (nodeidx == -1)  {
+         ZOLTAN_PRINT_ERROR (dd->my_proc, yo, "Unable to grow open table");
+         if (dd->debug_level > 5)
+            ZOLTAN_TRACE_OUT (dd->my_proc, yo, NULL);
+         return ZOLTAN_MEMERR;
+      }
+      ptr = dd->nodelist + nodeidx;
+   }
+   else {
+      nodeidx = DD_Memory_Alloc_Node(dd);
+      ptr = dd->nodelist + nodeidx;
 
-   ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid);
+      ZOLTAN_SET_ID (dd->gid_length, ptr->gid, gid);
+   }
 
    if (lid) {
       ZOLTAN_SET_ID(dd->lid_length,ptr->gid + dd->gid_length, lid);
@@ -342,8 +383,10 @@ static int DD_Update_Local (Zoltan_DD_Directory *dd,
    ptr->errcheck = owner;
 
    /* Add node to the linked list */
-   ptr->next = dd->table[index];
-   dd->table[index] = nodeidx;
+   if (index != -1)  {
+      ptr->next = dd->table[index];
+      dd->table[index] = nodeidx;
+   }
 
    if (dd->debug_level > 6)
       ZOLTAN_PRINT_INFO (dd->my_proc, yo, "Created new directory item");
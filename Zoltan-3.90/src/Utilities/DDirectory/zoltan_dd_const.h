@@ -101,7 +101,8 @@ typedef struct DD_Node  {
   int              partition;  /* Optional data                         */
   int              errcheck;   /* Error checking(inconsistent updates) */
   DD_NodeIdx       next;       /* index in nodelist of next DD_Node in 
-                                  linked list or free node list */
+                                  linked list or free node list;
+                                  hash of gid in an open addressing table */
   ZOLTAN_ID_TYPE  *gid;        /* gid used as key for update & lookup   */
                                /* lid starts at gid + dd->gid_length    */
                                /*(user) data starts at                 */
@@ -129,6 +130,8 @@ struct Zoltan_DD_Struct {
   int max_id_length;      /* max(gid_length, lid_length)           */
   int user_data_length;   /* Optional user data length in chars */
   int table_length;       /* # of heads of linked lists             */
+                          /* (open addressing: # of table slots)    */
+  int table_type;         /* ZOLTAN_DD_TABLE_CHAINED or _OPEN       */
   size_t nodedata_size;   /* Malloc for GID & LID & user storage    */
   size_t find_msg_size;   /* Total allocation for DD_FIND_MSG       */
   size_t update_msg_size; /* Total allocation for DD_UPDATE_MSG     */
@@ -149,9 +152,21 @@ struct Zoltan_DD_Struct {
   DD_NodeIdx nextfreenode;/* Index of first free node in nodelist; 
                              -1 if no nodes are free */
   DD_NodeIdx table[1];    /* Hash table heads of the link lists     */
+                          /* (unused by an open addressing table)   */
 };
 
 
+/*************** Open Addressing Table (DD_Open_Table.c) ***************/
+
+int DD_Open_Alloc(Zoltan_DD_Directory *dd, DD_NodeIdx count);
+DD_NodeIdx DD_Open_Find(Zoltan_DD_Directory *dd, ZOLTAN_ID_PTR gid);
+DD_NodeIdx DD_Open_Insert(Zoltan_DD_Directory *dd, ZOLTAN_ID_PTR gid);
+void DD_Open_Remove(Zoltan_DD_Directory *dd, DD_NodeIdx freenode);
+int DD_Open_Probe(Zoltan_DD_Directory *dd, DD_NodeIdx nodeidx);
+int DD_Open_Order(Zoltan_DD_Directory *dd, int *procs, int count,
+                  int **order);
+
+
 /*************** DD Communication Messages *********************/
 
 /* Note: These message structures should become MPI datatypes(KDD)   */
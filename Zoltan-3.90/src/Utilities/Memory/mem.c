@@ -61,6 +61,9 @@ extern "C" {
 #else
 #include <varargs.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 static int DEBUG_MEMORY = 0;	/* Flag for detecting memory leaks */
 static size_t bytes_used = 0;	/* Sum of active allocations */
@@ -93,6 +96,49 @@ static struct malloc_debug_data {
   struct malloc_debug_data *next;	/* pointer to next element */
 } *top = NULL;
 
+/*
+ * Arena mode.  Between Zoltan_Memory_Arena_Begin and Zoltan_Memory_Arena_End,
+ * small requests are carved from large chunks by bumping a pointer instead of
+ * calling malloc.  Every block starts with a header holding its size, so that
+ * Zoltan_Realloc can copy it.  A chunk counts its blocks not yet freed; the
+ * current chunk is rewound as soon as this count drops to zero, and the other
+ * empty chunks of an arena are released or kept for reuse at
+ * Zoltan_Memory_Arena_End.  Blocks that outlive the call (returned lists,
+ * persistent structures) keep their chunk until they are freed, so that the
+ * arena never hands out memory still in use.
+ */
+struct arena_chunk {
+  char     *base;                       /* first byte of the block area */
+  char     *top;                        /* first free byte */
+  char     *end;                        /* end of the block area */
+  int       live;                       /* number of blocks not yet freed */
+  struct Zoltan_Memory_Arena *arena;    /* owner; NULL once arena destroyed */
+  struct arena_chunk *next;             /* pointer to next chunk */
+};
+
+typedef union {                         /* header in front of each block */
+  size_t    size;                       /* size requested */
+  double    align[2];                   /* keep blocks aligned on 16 bytes */
+} arena_head;
+
+#define ARENA_ALIGN(n)  (((n) + sizeof(arena_head) - 1) & \
+                         ~((size_t) sizeof(arena_head) - 1))
+
+struct Zoltan_Memory_Arena {
+  size_t    chunk_size;                 /* size of the block area of chunks */
+  struct arena_chunk *current;          /* chunk in which blocks are carved */
+};
+
+static struct arena_chunk *arena_chunks = NULL;    /* all existing chunks  */
+static struct Zoltan_Memory_Arena *arena_active = NULL; /* arena in use    */
+static int arena_nalloc = 0;            /* number of blocks taken in arenas */
+static int arena_nchunk = 0;            /* number of chunks ever allocated */
+
+static double *arena_alloc(struct Zoltan_Memory_Arena *, size_t);
+static struct arena_chunk *arena_find(void *);
+static void arena_release(struct arena_chunk *);
+static void debug_replace(void *, double *, size_t);
+
 
 /******************************************************************************/
 void Zoltan_Memory_Debug(int new_level) {
@@ -329,7 +375,22 @@ double *Zoltan_Malloc(size_t n, char *filename, int lineno)
   double *pntr;           /* return value */
   char *basefile;
 
-  if (n > 0) {
+  if (n > 0 && arena_active != NULL && n <= arena_active->chunk_size / 4
+#ifdef _OPENMP
+      && !omp_in_parallel()
+#endif
+     ) {
+    pntr = arena_alloc(arena_active, n);
+    if (pntr == NULL) {
+      GET_RANK(&proc);
+      fprintf(stderr, "%s (from %s,%d) No space on proc %d - number of bytes "
+              "requested = %lu\n", yo, filename, lineno, proc,
+              (unsigned long) n);
+      return ((double *) NULL);
+    }
+    nmalloc++;
+  }
+  else if (n > 0) {
 
 #ifdef REALLOC_BUG
     if (n > max_alloc){
@@ -412,9 +473,10 @@ double *Zoltan_Malloc(size_t n, char *filename, int lineno)
 double *Zoltan_Realloc(void *ptr, size_t n, char *filename, int lineno)
 {
   char *yo = "Zoltan_Realloc";
-  struct malloc_debug_data *dbptr;   /* loops through debug list */
   int       proc;             /* processor ID */
   double   *p;                /* returned pointer */
+  struct arena_chunk *chunk;  /* chunk holding an arena block */
+  arena_head *head;           /* header of an arena block */
 #ifdef REALLOC_BUG
   int n_old;
 #endif
@@ -432,6 +494,26 @@ double *Zoltan_Realloc(void *ptr, size_t n, char *filename, int lineno)
       Zoltan_Free((void **) &ptr, filename, lineno);
       p = NULL;
     }
+    else if (arena_chunks != NULL && (chunk = arena_find(ptr)) != NULL) {
+      /* Block taken in an arena: grow in place if it is the last one of */
+      /* its chunk, else move it.                                        */
+      head = (arena_head *) ptr - 1;
+      if ((char *) ptr + ARENA_ALIGN(head->size) == chunk->top &&
+          (char *) ptr + ARENA_ALIGN(n) <= chunk->end) {
+        chunk->top = (char *) ptr + ARENA_ALIGN(n);
+        head->size = n;
+        p = (double *) ptr;
+        if (DEBUG_MEMORY > 1)
+          debug_replace(ptr, p, n);
+      }
+      else {
+        p = Zoltan_Malloc(n, filename, lineno);
+        if (p != NULL) {
+          memcpy(p, ptr, (n < head->size) ? n : head->size);
+          Zoltan_Free((void **) &ptr, filename, lineno);
+        }
+      }
+    }
     else {
 #ifdef REALLOC_BUG
       /* Feb 10, 2010: Several platforms show a realloc bug where realloc
@@ -465,25 +547,8 @@ double *Zoltan_Realloc(void *ptr, size_t n, char *filename, int lineno)
 #else
       p = (double *) realloc((char *) ptr, n);
 
-      if (DEBUG_MEMORY > 1) {
-        /* Need to replace item in allocation list */
-        for (dbptr = top; dbptr != NULL && (void *) (dbptr->ptr) != ptr;
-	   dbptr = dbptr->next);
-	if (dbptr == NULL) {	/* previous allocation not found in list. */
-           GET_RANK(&proc);
-	   fprintf(stderr, "Proc %d: Memory error: "
-	     "In realloc, address not found in debug list (0x%lx)\n",
-	     proc, (long) ptr);
-	}
-	else {	/* Update entry in allocation list */
-	  bytes_used += (n - dbptr->size);
-	  dbptr->size = n;
-	  dbptr->ptr = p;
-	  if (bytes_used > bytes_max) {
-	    bytes_max = bytes_used;
-	  }
-	}
-      }
+      if (DEBUG_MEMORY > 1)
+        debug_replace(ptr, p, n);
 
       if (p == NULL) {
         GET_RANK(&proc);
@@ -498,6 +563,31 @@ double *Zoltan_Realloc(void *ptr, size_t n, char *filename, int lineno)
   return (p);
 } /* Zoltan_Realloc */
 
+/* Replace an item of the allocation list after a reallocation. */
+
+static void debug_replace(void *ptr, double *p, size_t n)
+{
+  struct malloc_debug_data *dbptr;   /* loops through debug list */
+  int       proc;             /* processor ID */
+
+  for (dbptr = top; dbptr != NULL && (void *) (dbptr->ptr) != ptr;
+     dbptr = dbptr->next);
+  if (dbptr == NULL) {	/* previous allocation not found in list. */
+     GET_RANK(&proc);
+     fprintf(stderr, "Proc %d: Memory error: "
+       "In realloc, address not found in debug list (0x%lx)\n",
+       proc, (long) ptr);
+  }
+  else {	/* Update entry in allocation list */
+    bytes_used += (n - dbptr->size);
+    dbptr->size = n;
+    dbptr->ptr = p;
+    if (bytes_used > bytes_max) {
+      bytes_max = bytes_used;
+    }
+  }
+}
+
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -508,6 +598,7 @@ void Zoltan_Free (void **ptr, char *filename, int lineno)
   struct malloc_debug_data *dbptr;   /* loops through debug list */
   struct malloc_debug_data **prev;   /* holds previous pointer */
   int       proc;             /* processor ID */
+  struct arena_chunk *chunk = NULL;  /* chunk holding an arena block */
 
 #ifdef REALLOC_BUG
   double *p=NULL;
@@ -549,6 +640,24 @@ void Zoltan_Free (void **ptr, char *filename, int lineno)
      }
    }
 
+  if (arena_chunks != NULL) {
+    /* Blocks taken in an arena are only counted; their chunk is reused */
+    /* or released once all of them are freed.                          */
+#ifdef _OPENMP
+#pragma omp critical (zoltan_arena)
+#endif
+    {
+      if ((chunk = arena_find(*ptr)) != NULL) {
+        if (-- chunk->live == 0)
+          arena_release(chunk);
+      }
+    }
+    if (chunk != NULL) {
+      *ptr = NULL;
+      return;
+    }
+  }
+
 #ifdef REALLOC_BUG
   p = (double *)*ptr;
   free(p-1);
@@ -617,6 +726,10 @@ void Zoltan_Memory_Stats()
         else if (nfree > nmalloc)
           fprintf(stderr, "Proc %d: Possible memory error: "
                           "# free > # malloc.\n", proc);
+        if (arena_nalloc > 0)
+          fprintf(stderr, "Proc %d: Allocations in arenas = %d, "
+                          "arena chunks = %d\n", proc, arena_nalloc,
+                          arena_nchunk);
     }
     else if (DEBUG_MEMORY > 1) {
         GET_RANK(&proc);
@@ -630,6 +743,10 @@ void Zoltan_Memory_Stats()
         else if (nfree > nmalloc)
           fprintf(stderr, "Proc %d: Possible memory error: "
                           "# free > # malloc.\n", proc);
+        if (arena_nalloc > 0)
+          fprintf(stderr, "Proc %d: Allocations in arenas = %d, "
+                          "arena chunks = %d\n", proc, arena_nalloc,
+                          arena_nchunk);
 	if (top != NULL) {
 	    fprintf(stderr, "Proc %d: Remaining allocations:\n", proc);
 	    for (dbptr = top; dbptr != NULL; dbptr = dbptr->next) {
@@ -672,6 +789,158 @@ void Zoltan_Memory_Reset (int type)
       bytes_max = 0;
 }
 
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Create an arena whose chunks hold chunk_size bytes.  Requests larger */
+/* than a quarter of a chunk are always passed to malloc.              */
+
+struct Zoltan_Memory_Arena *Zoltan_Memory_Arena_Create(size_t chunk_size)
+{
+  struct Zoltan_Memory_Arena *arena;
+
+  arena = (struct Zoltan_Memory_Arena *)
+    malloc(sizeof(struct Zoltan_Memory_Arena));
+  if (arena != NULL) {
+    arena->chunk_size = ARENA_ALIGN(chunk_size);
+    arena->current = NULL;
+  }
+  return arena;
+}
+
+/* Destroy an arena.  Chunks still holding blocks not yet freed are */
+/* released when their last block is freed.                        */
+
+void Zoltan_Memory_Arena_Destroy(struct Zoltan_Memory_Arena **arena)
+{
+  struct arena_chunk **link, *chunk;
+
+  if (arena == NULL || *arena == NULL)
+    return;
+
+  for (link = &arena_chunks; (chunk = *link) != NULL; ) {
+    if (chunk->arena == *arena) {
+      if (chunk->live == 0) {
+        *link = chunk->next;
+        free(chunk);
+        continue;
+      }
+      chunk->arena = NULL;
+    }
+    link = &chunk->next;
+  }
+
+  if (arena_active == *arena)
+    arena_active = NULL;
+  free(*arena);
+  *arena = NULL;
+}
+
+/* Make Zoltan_Malloc take blocks from arena; return the arena */
+/* previously in use, to be given back to Zoltan_Memory_Arena_End. */
+
+struct Zoltan_Memory_Arena *Zoltan_Memory_Arena_Begin(
+  struct Zoltan_Memory_Arena *arena)
+{
+  struct Zoltan_Memory_Arena *prev = arena_active;
+
+  arena_active = arena;
+  return prev;
+}
+
+/* Reset the empty chunks of arena, keeping one spare chunk besides */
+/* the current one, and go back to the arena previously in use.     */
+
+void Zoltan_Memory_Arena_End(struct Zoltan_Memory_Arena *arena,
+                             struct Zoltan_Memory_Arena *prev)
+{
+  struct arena_chunk **link, *chunk;
+  int nspare = 0;
+
+  if (arena != NULL) {
+    for (link = &arena_chunks; (chunk = *link) != NULL; ) {
+      if (chunk->arena == arena && chunk->live == 0) {
+        chunk->top = chunk->base;
+        if (chunk != arena->current && nspare++ > 0) {
+          *link = chunk->next;
+          free(chunk);
+          continue;
+        }
+      }
+      link = &chunk->next;
+    }
+  }
+  arena_active = prev;
+}
+
+/* Take a block of n bytes in the current chunk of arena, switching to */
+/* an empty or new chunk when it is full.                              */
+
+static double *arena_alloc(struct Zoltan_Memory_Arena *arena, size_t n)
+{
+  struct arena_chunk *chunk = arena->current;
+  size_t need = sizeof(arena_head) + ARENA_ALIGN(n);
+  arena_head *head;
+
+  if (chunk == NULL || chunk->top + need > chunk->end) {
+    for (chunk = arena_chunks; chunk != NULL; chunk = chunk->next)
+      if (chunk->arena == arena && chunk->live == 0 &&
+          chunk != arena->current)
+        break;
+
+    if (chunk == NULL) {
+      chunk = (struct arena_chunk *)
+        malloc(ARENA_ALIGN(sizeof(struct arena_chunk)) + arena->chunk_size);
+      if (chunk == NULL)
+        return NULL;
+      chunk->base = (char *) chunk + ARENA_ALIGN(sizeof(struct arena_chunk));
+      chunk->end = chunk->base + arena->chunk_size;
+      chunk->live = 0;
+      chunk->arena = arena;
+      chunk->next = arena_chunks;
+      arena_chunks = chunk;
+      arena_nchunk++;
+    }
+    chunk->top = chunk->base;
+    arena->current = chunk;
+  }
+
+  head = (arena_head *) chunk->top;
+  head->size = n;
+  chunk->top += need;
+  chunk->live++;
+  arena_nalloc++;
+
+  return (double *) (head + 1);
+}
+
+/* Return the chunk holding ptr, or NULL if ptr was not taken in an arena. */
+
+static struct arena_chunk *arena_find(void *ptr)
+{
+  struct arena_chunk *chunk;
+
+  for (chunk = arena_chunks; chunk != NULL; chunk = chunk->next)
+    if ((char *) ptr > chunk->base && (char *) ptr < chunk->end)
+      break;
+  return chunk;
+}
+
+/* Called when the last block of chunk is freed. */
+
+static void arena_release(struct arena_chunk *chunk)
+{
+  struct arena_chunk **link;
+
+  if (chunk->arena == NULL) {           /* arena destroyed: free the chunk */
+    for (link = &arena_chunks; *link != chunk; link = &((*link)->next));
+    *link = chunk->next;
+    free(chunk);
+  }
+  else if (chunk == chunk->arena->current)
+    chunk->top = chunk->base;           /* rewind; others wait for End */
+}
 
 /*****************************************************************************/
 /*                      END of mem.c                                         */
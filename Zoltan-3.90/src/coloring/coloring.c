@@ -60,6 +60,9 @@ extern "C" {
 #include "all_allo_const.h"
 #include "zz_rand.h"
 #include "bucket.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /* when sending new colored vertices to processors,
    sent only the "relevant" ones; i.e., send the color info if the processors has
@@ -77,19 +80,32 @@ extern "C" {
 #define SYNCHRONOUS    21
 #define ASYNCHRONOUS   22
 
+/* Minimum number of vertices colored or ordered with threads */
+#define COLOR_THREAD_MIN 1024
+/* Number of received (gno, color) pairs mapped by a batch hash probe */
+#define COLOR_BATCH    64
+
 /* Function prototypes */
 static int D1coloring(ZZ *zz, char coloring_problem, char coloring_order, char coloring_method, char comm_pattern, int ss,
 		      int nVtx, G2LHash *hash, int *xadj, int *adj, int *adjproc, int *color, int recoloring_permutation,
-                      int recoloring_type, int recoloring_num_of_iterations);
+                      int recoloring_type, int recoloring_num_of_iterations, int num_threads);
 static int D2coloring(ZZ *zz, char coloring_problem, char coloring_order, char coloring_method, char comm_pattern, int ss,
-		      int nVtx, G2LHash *hash, int *xadj, int *adj, int *adjproc, int *color, int *partialD2);
+		      int nVtx, G2LHash *hash, int *xadj, int *adj, int *adjproc, int *color, int *partialD2,
+		      int num_threads);
 
 static int ReorderGraph(ZZ *, char, int, int *, int **, int *,
 			int *, int *, int *, int *, int *partialD2, int *nintvisit, int *nboundvisit);
 static int PickColor(ZZ *, char, int, int, int *, int *);
 static int InternalColoring(ZZ *zz, char coloring_problem, int *nColor,
 			    int nVtx, int *visit, int * xadj, int *adj,
-			    int *color, int *mark, int mark_size, char coloring_method);
+			    int *color, int *mark, int mark_size, char coloring_method,
+			    int num_threads);
+#ifdef _OPENMP
+static int ThreadedInternalColoring(ZZ *zz, char coloring_problem, int *nColor,
+			    int nVtx, int *visit, int * xadj, int *adj,
+			    int *color, int mark_size, int num_threads);
+#endif
+static int ReceiveColors(G2LHash *hash, ZOLTAN_GNO_TYPE *buf, int ss, int *color);
 
 static int D1ParallelColoring (ZZ *zz, int nvtx, int *visit, int *xadj, int *adj,
 			       int *isbound, int ss, int *nColor, int *color,
@@ -129,6 +145,7 @@ static PARAM_VARS Color_params[] = {
                   { "RECOLORING_TYPE", NULL, "STRING", 0},
                   { "RECOLORING_PERMUTATION", NULL, "STRING", 0},
                   { "RECOLORING_NUM_OF_ITERATIONS", NULL, "INT", 0},
+                  { "COLORING_NUM_THREADS", NULL, "INT", 0},
 		  { NULL, NULL, NULL, 0 } };
 
 /*****************************************************************************/
@@ -204,6 +221,8 @@ int Zoltan_Color(
   char recoloring_typeStr[MAX_PARAM_STRING_LEN];
   int recoloring_type; /* ASYNCHRONOUS, SYNCHRONOUS, default is SYNCHRONOUS */
   int recoloring_num_of_iterations; /* must be a positive number, default is 1 if not specified */
+  int num_threads;      /* threads coloring the local vertices; 0 for the
+                           OpenMP default */
   static char *yo = "Zoltan_Color";
   ZOLTAN_GNO_TYPE *vtxdist=NULL, *adjncy=NULL;
   int *itmp, *xadj=NULL;
@@ -252,6 +271,7 @@ int Zoltan_Color(
   Zoltan_Bind_Param(Color_params, "RECOLORING_PERMUTATION", (void *) &recoloring_permutationStr);
   Zoltan_Bind_Param(Color_params, "RECOLORING_TYPE",        (void *) &recoloring_typeStr);
   Zoltan_Bind_Param(Color_params, "RECOLORING_NUM_OF_ITERATIONS", (void *) &recoloring_num_of_iterations);
+  Zoltan_Bind_Param(Color_params, "COLORING_NUM_THREADS", (void *) &num_threads);
 
   /* Set default values */
   strncpy(coloring_problemStr, "distance-1", MAX_PARAM_STRING_LEN);
@@ -265,6 +285,7 @@ int Zoltan_Color(
   recoloring_permutation = NONDECREASING;
   recoloring_type = SYNCHRONOUS;
   recoloring_num_of_iterations = 0;
+  num_threads = 1;
 
   Zoltan_Assign_Param_Vals(zz->Params, Color_params, zz->Debug_Level, zz->Proc,
 			   zz->Debug_Proc);
@@ -454,9 +475,10 @@ int Zoltan_Color(
   /* Select Coloring algorithm and perform the coloring */
   if (coloring_problem == '1')
       D1coloring(zz, coloring_problem, coloring_order, coloring_method, comm_pattern, ss, nvtx, &hash, xadj, (int *)adjncy, adjproc, color,
-		 recoloring_permutation, recoloring_type, recoloring_num_of_iterations);
+		 recoloring_permutation, recoloring_type, recoloring_num_of_iterations, num_threads);
   else if (coloring_problem == '2' || coloring_problem == 'P')
-      D2coloring(zz, coloring_problem, coloring_order, coloring_method, comm_pattern, ss, nvtx, &hash, xadj, (int *)adjncy, adjproc, color, partialD2);
+      D2coloring(zz, coloring_problem, coloring_order, coloring_method, comm_pattern, ss, nvtx, &hash, xadj, (int *)adjncy, adjproc, color, partialD2,
+                 num_threads);
 #ifdef _DEBUG_TIMES    
   times[4] = Zoltan_Time(zz->Timer);
 #endif
@@ -511,19 +533,58 @@ int Zoltan_Color(
 
 /* fills the visit array with the n first vertices of xadj using the
    Largest Degree First ordering. The algorithm used to compute this
-   ordering is a stable count sort. */
+   ordering is a stable count sort. With threads, each thread counts
+   and places a range of vertices, giving the same ordering. */
 static int LargestDegreeFirstOrdering(
     ZZ  *zz, 
     int *visit, /*Out*/
     int *xadj,
     int n,
-    int max_degree) 
+    int max_degree,
+    int num_threads) 
 {	
     static char* yo = "LargestDegreeFirstOrdering";
     int ierr = ZOLTAN_OK;
     int i;
     int *cnt;
-    
+
+#ifdef _OPENMP
+    num_threads = Zoltan_Num_Threads(num_threads);
+    if (num_threads > 1 && n > COLOR_THREAD_MIN) {
+        cnt = (int*) ZOLTAN_MALLOC (sizeof(int)*(max_degree+1)*num_threads);
+        if (!cnt)
+            MEMORY_ERROR;
+
+#pragma omp parallel num_threads(num_threads) private(i)
+        {
+            int t = omp_get_thread_num(), nt = omp_get_num_threads();
+            int lo = (int) (((double) n * t) / nt);
+            int hi = (int) (((double) n * (t+1)) / nt);
+            int *tcnt = cnt + t*(max_degree+1);
+
+            memset(tcnt, 0, sizeof(int)*(max_degree+1));
+            for (i=lo; i<hi; ++i)
+                ++tcnt[xadj[i+1]-xadj[i]];
+#pragma omp barrier
+#pragma omp single
+            {
+                /* first position of the vertices of degree d of each
+                   thread: larger degrees first, then lower threads */
+                int d, tt, c, pos = 0;
+                for (d=max_degree; d>=0; --d)
+                    for (tt=0; tt<nt; ++tt) {
+                        c = cnt[tt*(max_degree+1)+d];
+                        cnt[tt*(max_degree+1)+d] = pos;
+                        pos += c;
+                    }
+            }
+            for (i=lo; i<hi; ++i)
+                visit[tcnt[xadj[i+1]-xadj[i]]++] = i;
+        }
+        goto End;
+    }
+#endif
+
     cnt = (int*) ZOLTAN_MALLOC (sizeof(int)*(max_degree+1));
     if (!cnt)
         MEMORY_ERROR;
@@ -620,7 +681,8 @@ static int D1coloring(
     int recoloring_permutation, /* recoloring permutation type; FORWARD, 
                                      REVERSE, NONDECREASING, NONINCREASING */
     int recoloring_type, /* recoloring type; SYNCHRONOUS or ASYNCHRONOUS */
-    int recoloring_num_of_iterations
+    int recoloring_num_of_iterations,
+    int num_threads    /* threads coloring the local vertices */
 )
 {
     static char *yo = "D1coloring";
@@ -783,16 +845,16 @@ static int D1coloring(
 	      visit[i] = i;
 	  }
 	else if (coloring_order == 'L') /*largest first*/
-	    LargestDegreeFirstOrdering(zz, visit, xadj, nvtx, lmaxdeg);
+	    LargestDegreeFirstOrdering(zz, visit, xadj, nvtx, lmaxdeg, num_threads);
 	else if (coloring_order == 'S') /*smallest last*/
 	    SmallestDegreeLastOrdering(zz, visit, xadj, adj, nvtx, lmaxdeg);
 
 
 	if (zz->Num_Proc==1)
-	    InternalColoring(zz, coloring_problem, &nColor, nvtx, visit, xadj, adj, color, mark, gmaxdeg, coloring_method);
+	    InternalColoring(zz, coloring_problem, &nColor, nvtx, visit, xadj, adj, color, mark, gmaxdeg, coloring_method, num_threads);
     }
     else if (coloring_order == 'I') {
-	InternalColoring(zz, coloring_problem, &nColor, nvtx - nbound, visitIntern, xadj, adj, color, mark, gmaxdeg, coloring_method);
+	InternalColoring(zz, coloring_problem, &nColor, nvtx - nbound, visitIntern, xadj, adj, color, mark, gmaxdeg, coloring_method, num_threads);
 	nConflict = nbound;
     }
     else if (coloring_order == 'B')
@@ -892,7 +954,7 @@ static int D1coloring(
 
     /* Color internal vertices after boundaries if boundary first ordering */
     if (coloring_order == 'B')
-	InternalColoring(zz, coloring_problem, &nColor, nvtx-nbound, visitIntern, xadj, adj, color, mark, gmaxdeg, coloring_method);
+	InternalColoring(zz, coloring_problem, &nColor, nvtx-nbound, visitIntern, xadj, adj, color, mark, gmaxdeg, coloring_method, num_threads);
 
     /* Recoloring is run if enabled,i.e. num of iters is greater than 0 */
     if (recoloring_num_of_iterations > 0) {
@@ -999,7 +1061,8 @@ static int D2coloring(
     int *adjproc,
     int *color,        /* return array to store colors of local and D1
 			  neighbor vertices */
-    int *partialD2     /* binary array showing which vertices will be colored */
+    int *partialD2,    /* binary array showing which vertices will be colored */
+    int num_threads    /* threads coloring the local vertices */
 )
 {
     static char *yo = "D2coloring";
@@ -1273,7 +1336,7 @@ static int D2coloring(
     }
     visitIntern = visit + nbound; /* Start of internal vertex visit order. Used with I and B options below */
     if (coloring_order == 'I') {
-	InternalColoring(zz, coloring_problem, &nColor, nintvisit, visitIntern, xadj, adj, color, mark, gmaxcolor, coloring_method);
+	InternalColoring(zz, coloring_problem, &nColor, nintvisit, visitIntern, xadj, adj, color, mark, gmaxcolor, coloring_method, num_threads);
 	nConflict = nboundvisit;
     }
     else if (coloring_order=='B')
@@ -1285,13 +1348,13 @@ static int D2coloring(
                 visit[i] = i;
         }   
         else if (coloring_order=='L') {
-            LargestDegreeFirstOrdering(zz, visit, xadj, nvtx, lmaxdeg);
+            LargestDegreeFirstOrdering(zz, visit, xadj, nvtx, lmaxdeg, num_threads);
         }
         else if (coloring_order=='S') {            
 	    SmallestDegreeLastOrdering(zz, visit, xadj, adj, nvtx, lmaxdeg);  
         }
         if (zz->Num_Proc==1)
-            InternalColoring(zz, coloring_problem, &nColor, nvtx, visit, xadj, adj, color, mark, gmaxcolor, coloring_method);
+            InternalColoring(zz, coloring_problem, &nColor, nvtx, visit, xadj, adj, color, mark, gmaxcolor, coloring_method, num_threads);
     }
 
 
@@ -1343,7 +1406,7 @@ static int D2coloring(
     if (get_times) times[4] = Zoltan_Time(zz->Timer);
     /* Color internal vertices after boundaries if boundary first ordering */
     if (coloring_order == 'B')
-	InternalColoring(zz, coloring_problem, &nColor, nintvisit, visitIntern, xadj, adj, color, mark, gmaxcolor, coloring_method);
+	InternalColoring(zz, coloring_problem, &nColor, nintvisit, visitIntern, xadj, adj, color, mark, gmaxcolor, coloring_method, num_threads);
 
 
 #if 0
@@ -1533,13 +1596,21 @@ static int InternalColoring(
     int *color,
     int *mark,
     int gmaxdeg,
-    char coloring_method
+    char coloring_method,
+    int num_threads    /* threads coloring the vertices; 0 for the OpenMP
+                          default */
 )
 {
     int i, j, k, c, u, v, w;
     static char *yo = "InternalColoring";
     int ierr = ZOLTAN_OK;
 
+#ifdef _OPENMP
+    num_threads = Zoltan_Num_Threads(num_threads);
+    if (num_threads > 1 && nvtx > COLOR_THREAD_MIN && coloring_method == 'F')
+        return ThreadedInternalColoring(zz, coloring_problem, nColor, nvtx, visit, xadj, adj, color, gmaxdeg, num_threads);
+#endif
+
     memset(mark, 0xff, gmaxdeg * sizeof(int));
     if (coloring_problem == '1') {
 	for (i=0; i<nvtx; ++i) {
@@ -1574,6 +1645,216 @@ static int InternalColoring(
     return ierr;
 }
 
+#ifdef _OPENMP
+/*****************************************************************************/
+/* Threaded first fit coloring of the vertices of visit, in the order of
+   their dependencies: a vertex is colored once all its neighbors (or
+   distance-2 neighbors) earlier in visit are colored. Each vertex then
+   sees the colors it would see in InternalColoring, so that the coloring
+   is the same as the sequential one for any number of threads (provided
+   the graph is symmetric). The vertices ready at the same time are
+   colored in parallel; when one is colored, it decrements the count of
+   uncolored earlier neighbors of its later neighbors. */
+
+static int ThreadedInternalColoring(
+    ZZ *zz,
+    char coloring_problem,
+    int *nColor,
+    int nvtx,
+    int *visit,
+    int * xadj,
+    int *adj,
+    int *color,
+    int mark_size,     /* size of the mark array of a thread */
+    int num_threads
+)
+{
+    static char *yo = "ThreadedInternalColoring";
+    int ierr = ZOLTAN_OK;
+    int i, j, k, c, u, v, w, ncur, nnext, maxu = -1, maxc = 0;
+    int *pos = NULL;             /* position of the vertices in visit, -1 for
+				    the vertices not in visit */
+    int *dep = NULL;             /* number of uncolored earlier neighbors */
+    int *buf = NULL;             /* vertices to color now (cur) and next */
+    int *cur, *next, *tp;
+    int *marks = NULL;           /* mark arrays of the threads */
+
+    if (coloring_problem != '1' && coloring_problem != '2' && coloring_problem != 'P')
+	ZOLTAN_COLOR_ERROR(ZOLTAN_FATAL, "Unknown coloring problem");
+
+    for (i=0; i<nvtx; ++i)
+	if (maxu < visit[i])
+	    maxu = visit[i];
+    pos = (int *) ZOLTAN_MALLOC((maxu+1) * sizeof(int));
+    dep = (int *) ZOLTAN_MALLOC((maxu+1) * sizeof(int));
+    buf = (int *) ZOLTAN_MALLOC(2 * nvtx * sizeof(int));
+    marks = (int *) ZOLTAN_MALLOC((size_t) num_threads * mark_size * sizeof(int));
+    if (!pos || !dep || !buf || !marks)
+	MEMORY_ERROR;
+    cur = buf;
+    next = buf + nvtx;
+    memset(pos, 0xff, (maxu+1) * sizeof(int));
+    /* each vertex is colored once, so the marks need no reset */
+    memset(marks, 0xff, (size_t) num_threads * mark_size * sizeof(int));
+
+/* x is in visit, before (after) position p */
+#define BEFORE(x, p) ((x) <= maxu && pos[x] >= 0 && pos[x] < (p))
+#define AFTER(x, p)  ((x) <= maxu && pos[x] > (p))
+
+#pragma omp parallel for num_threads(num_threads)
+    for (i=0; i<nvtx; ++i)
+	pos[visit[i]] = i;
+
+#pragma omp parallel for num_threads(num_threads) private(j, k, u, v, w)
+    for (i=0; i<nvtx; ++i) {
+	int n = 0;
+	u = visit[i];
+	for (j = xadj[u]; j < xadj[u+1]; ++j) {
+	    v = adj[j];
+	    if (BEFORE(v, i))
+		++n;
+	    if (coloring_problem == '1')
+		continue;
+	    for (k = xadj[v]; k < xadj[v+1]; ++k) {
+		w = adj[k];
+		if (w != u && BEFORE(w, i))
+		    ++n;
+	    }
+	}
+	dep[u] = n;
+    }
+
+    for (ncur = i = 0; i<nvtx; ++i)
+	if (!dep[visit[i]])
+	    cur[ncur++] = visit[i];
+
+    while (ncur) {
+	nnext = 0;
+#pragma omp parallel num_threads(num_threads) private(i, j, k, c, u, v, w)
+	{
+	    int *mark = marks + (size_t) omp_get_thread_num() * mark_size;
+	    int p, d, slot;
+
+#pragma omp for
+	    for (i=0; i<ncur; ++i) {
+		u = cur[i];
+		p = pos[u];
+		/* mark the forbidden colors as in InternalColoring; the
+		   later neighbors are not colored before u */
+		for (j = xadj[u]; j < xadj[u+1]; ++j) {
+		    v = adj[j];
+		    if ((c = color[v]) != 0)
+			mark[c] = u;
+		    if (coloring_problem == '1')
+			continue;
+		    for (k = xadj[v]; k < xadj[v+1]; ++k) {
+			w = adj[k];
+			if ((c = color[w]) != 0)
+			    mark[c] = u;
+		    }
+		}
+		for (c = 1; mark[c] == u; ++c) ;
+		color[u] = c;
+
+		/* u is colored: the later neighbors having no other
+		   uncolored earlier neighbor can be colored next */
+		for (j = xadj[u]; j < xadj[u+1]; ++j) {
+		    v = adj[j];
+		    if (AFTER(v, p)) {
+#pragma omp atomic capture
+			d = --dep[v];
+			if (!d) {
+#pragma omp atomic capture
+			    slot = nnext++;
+			    next[slot] = v;
+			}
+		    }
+		    if (coloring_problem == '1')
+			continue;
+		    for (k = xadj[v]; k < xadj[v+1]; ++k) {
+			w = adj[k];
+			if (w != u && AFTER(w, p)) {
+#pragma omp atomic capture
+			    d = --dep[w];
+			    if (!d) {
+#pragma omp atomic capture
+				slot = nnext++;
+				next[slot] = w;
+			    }
+			}
+		    }
+		}
+	    }
+	}
+	tp = cur;
+	cur = next;
+	next = tp;
+	ncur = nnext;
+    }
+
+#undef BEFORE
+#undef AFTER
+
+    /* With a nonsymmetric graph, some vertices may never get ready; color
+       them sequentially */
+    for (i=0; i<nvtx; ++i) {
+	u = visit[i];
+	if (dep[u] > 0) {
+	    for (j = xadj[u]; j < xadj[u+1]; ++j) {
+		v = adj[j];
+		if ((c = color[v]) != 0)
+		    marks[c] = u;
+		if (coloring_problem == '1')
+		    continue;
+		for (k = xadj[v]; k < xadj[v+1]; ++k) {
+		    w = adj[k];
+		    if ((c = color[w]) != 0)
+			marks[c] = u;
+		}
+	    }
+	    for (c = 1; marks[c] == u; ++c) ;
+	    color[u] = c;
+	}
+	if (maxc < color[u])
+	    maxc = color[u];
+    }
+
+    if (*nColor < maxc)
+	*nColor = maxc;
+
+ End:
+    Zoltan_Multifree(__FILE__, __LINE__, 4, &pos, &dep, &buf, &marks);
+
+    return ierr;
+}
+#endif
+
+/*****************************************************************************/
+/* Sets the colors of the (gno, color) pairs of buf received from another
+   processor, mapping the gnos by batches. Stops after ss pairs or at a
+   negative gno; returns the number of pairs read. */
+
+static int ReceiveColors(
+    G2LHash *hash,
+    ZOLTAN_GNO_TYPE *buf,
+    int ss,
+    int *color
+)
+{
+    int lno[COLOR_BATCH];
+    int i, k, n, nb;
+
+    for (n = 0; n < ss && buf[2*n] >= 0; ++n) ;
+    for (i = 0; i < n; i += nb) {
+	nb = (n - i < COLOR_BATCH) ? n - i : COLOR_BATCH;
+	Zoltan_G2LHash_G2L_Batch(hash, nb, buf + 2*i, 2, lno);
+	for (k = 0; k < nb; ++k)
+	    if (lno[k] != -1)
+		color[lno[k]] = (int) buf[2*(i+k)+1];
+    }
+    return n;
+}
+
 /*****************************************************************************/
 /* Parallel coloring of boundary vertices */
 static int D1ParallelColoring (
@@ -1699,17 +1980,8 @@ static int D1ParallelColoring (
 		p = rreqfrom[q];
 
 		/* Read received color list from p */
-		for (j = 0; j < 2*ss; ) {
-		    int c, hv;
-		    v  = newcolored[p][j++];
-		    if (v < 0)
-			break;
-		    if ((hv = Zoltan_G2LHash_G2L(hash, v)) != -1) {
-			c = (int)newcolored[p][j++];
-			color[hv] = c;
-		    } else
-			++j;
-		}
+		j = ReceiveColors(hash, newcolored[p], ss, color);
+		v = (j < ss) ? newcolored[p][2*j] : 0;
 		/* If p hasn't finished coloring, issue new color request */
 		if (v!=-1) {
 		    if (MPI_Irecv(newcolored[p], 2*ss, gno_mpi_type, p, colortag, zz->Communicator, &rreqs[q]))
@@ -1757,17 +2029,8 @@ static int D1ParallelColoring (
 	    p = rreqfrom[q];
 
 	    /* Read received color list from p */
-	    for (j = 0; j < 2*ss; ) {
-		int c, hv;
-		v  = newcolored[p][j++];
-		if (v < 0)
-		    break;
-		if ((hv = Zoltan_G2LHash_G2L(hash, v)) != -1) {
-		    c = (int)newcolored[p][j++];
-		    color[hv] = c;
-		} else
-		    ++j;
-	    }
+	    j = ReceiveColors(hash, newcolored[p], ss, color);
+	    v = (j < ss) ? newcolored[p][2*j] : 0;
 
 	    /* If p hasn't finished coloring, issue new color request */
 	    if (v!=-1) {
@@ -2104,19 +2367,9 @@ static int D2ParallelColoring (
 	    for (l = 0; l < rreqcntC; ++l) {
 		p = rreqfromC[l];
 		/* update non-local vertex colors according to the received color update message content */
-		for (j = 0; j < 2*ss; ) {
-		    ZOLTAN_GNO_TYPE v = newcolored[p][j++];
-		    int c, hv;
-		    if (v < 0)
-			break;
-		    if ((hv = Zoltan_G2LHash_G2L(hash, v)) != -1) {
-			c = (int)newcolored[p][j++];
-			color[hv] = c;
-		    } else
-			++j;
-		}
+		j = ReceiveColors(hash, newcolored[p], ss, color);
 		/* if round is not finished on proc p */
-		if (j >= 2*ss)
+		if (j >= ss)
 		    rreqfromC[fp++] = p;
 	    }
 
@@ -2150,19 +2403,9 @@ static int D2ParallelColoring (
 	for (l = 0; l < rreqcntC; ++l) {
 	    p = rreqfromC[l];
 	    /* update non-local vertex colors according to the received color update message content */
-	    for (j = 0; j < 2*ss; ) {
-		ZOLTAN_GNO_TYPE v = newcolored[p][j++];
-		int c, hv;
-		if (v < 0)
-		    break;
-		if ((hv = Zoltan_G2LHash_G2L(hash, v)) != -1) {
-		    c = (int)newcolored[p][j++];
-		    color[hv] = c;
-		} else
-		    ++j;
-	    }
+	    j = ReceiveColors(hash, newcolored[p], ss, color);
 	    /* if round is not finished on proc p */
-	    if (j >= 2*ss)
+	    if (j >= ss)
 		rreqfromC[fp++] = p;
 	}
 	/* send forbidden colors to requesting processors */
@@ -2546,7 +2789,9 @@ static int Recoloring(ZZ *zz, int recoloring_permutation, int recoloring_type,
               for (i=0; i<nvtx; i++)
                   visit[i] = dummyvisit[i];
           }  
-          InternalColoring(zz, '1', nColor, nvtx, visit, xadj, adj, color, mark, gmaxdeg, coloring_method);
+          /* sequential, so that recoloring by color classes cannot
+             increase the number of colors */
+          InternalColoring(zz, '1', nColor, nvtx, visit, xadj, adj, color, mark, gmaxdeg, coloring_method, 1);
       }
   }
   
@@ -111,34 +111,73 @@ int Zoltan_GenPrime(int stopafter, int *prime_num)
 #undef MAX_PRIME
     
 
-int Zoltan_G2LHash_Create(G2LHash *hash, int maxsize, ZOLTAN_GNO_TYPE base, int nlvtx)
+/* Number of gnos whose slots are computed together in
+   Zoltan_G2LHash_G2L_Batch */
+#define G2L_BATCH 16
+
+/* Multiplicative (Fibonacci) hashing of gno, keeping the high bits */
+static int G2LHash_Slot(G2LHash *hash, ZOLTAN_GNO_TYPE gno)
+{
+    unsigned int k = (unsigned int) gno;
+
+    if (sizeof(ZOLTAN_GNO_TYPE) > sizeof(unsigned int))
+        k ^= (unsigned int) (((size_t) gno >> 16) >> 16);
+    return (int) (((k * 2654435761U) & 0xffffffffU) >> hash->shift);
+}
+
+/* Allocates room for maxsize keys, with at most 2/3 of the slots used */
+static int G2LHash_Alloc(G2LHash *hash, int maxsize, int withgnos)
 {
+    size_t nslots = 2;
+    int lg = 1;
+
     if (maxsize == 0) /* to avoid memory allocation errors */
         maxsize = 1;
+    while (nslots < (size_t) maxsize + (size_t) maxsize / 2 + 1) {
+        nslots *= 2;
+        ++lg;
+    }
 
-    if (Zoltan_GenPrime(maxsize , &(hash->maxsize))==ZOLTAN_MEMERR)
-      return ZOLTAN_MEMERR;
-
-    hash->table = NULL;
-    hash->nodes = NULL;
-    hash->base = base;
-    hash->baseend = base+nlvtx-1;
-    hash->nlvtx = nlvtx;
+    hash->maxsize = maxsize;
     hash->size = 0;
     hash->num_gid_entries = sizeof(ZOLTAN_GNO_TYPE) / sizeof(ZOLTAN_ID_TYPE);
-    hash->table = (G2LHashNode **) ZOLTAN_CALLOC((size_t) hash->maxsize, sizeof(G2LHashNode *));
-    hash->nodes = (G2LHashNode *) ZOLTAN_MALLOC((size_t) hash->maxsize * (size_t) sizeof(G2LHashNode));
-    if (!hash->table || !hash->nodes) {
+    hash->mask = (int) (nslots - 1);
+    hash->shift = 32 - lg;
+    hash->vals = NULL;
+    hash->gnos = NULL;
+    hash->keys = (ZOLTAN_GNO_TYPE *) ZOLTAN_MALLOC(nslots * sizeof(ZOLTAN_GNO_TYPE));
+    hash->vals = (int *) ZOLTAN_MALLOC(nslots * sizeof(int));
+    if (withgnos)
+        hash->gnos = (ZOLTAN_GNO_TYPE *) ZOLTAN_MALLOC((size_t) maxsize * sizeof(ZOLTAN_GNO_TYPE));
+    if (!hash->keys || !hash->vals || (withgnos && !hash->gnos)) {
         Zoltan_G2LHash_Destroy(hash);
         return ZOLTAN_MEMERR;
     }
+    memset(hash->keys, 0xff, nslots * sizeof(ZOLTAN_GNO_TYPE)); /* all -1 */
     return ZOLTAN_OK;
 }
 
+/* Returns the slot of key, or the empty slot where it would be inserted */
+static int G2LHash_Find(G2LHash *hash, ZOLTAN_GNO_TYPE key, int i)
+{
+    while (hash->keys[i] != key && hash->keys[i] != -1)
+        i = (i + 1) & hash->mask;
+    return i;
+}
+
+int Zoltan_G2LHash_Create(G2LHash *hash, int maxsize, ZOLTAN_GNO_TYPE base, int nlvtx)
+{
+    hash->base = base;
+    hash->baseend = base+nlvtx-1;
+    hash->nlvtx = nlvtx;
+    return G2LHash_Alloc(hash, maxsize, 1);
+}
+
 int Zoltan_G2LHash_Destroy(G2LHash *hash)
 {
-    ZOLTAN_FREE(&hash->table);
-    ZOLTAN_FREE(&hash->nodes);
+    ZOLTAN_FREE(&hash->keys);
+    ZOLTAN_FREE(&hash->vals);
+    ZOLTAN_FREE(&hash->gnos);
 
     return ZOLTAN_OK;
 }
@@ -146,26 +185,22 @@ int Zoltan_G2LHash_Destroy(G2LHash *hash)
 int Zoltan_G2LHash_Insert(G2LHash *hash, ZOLTAN_GNO_TYPE gno)
 {
     int i, lno;
-    G2LHashNode *ptr;
 
     if (gno<hash->base || gno>hash->baseend) {
-        i = Zoltan_Hash((ZOLTAN_ID_PTR) (void *)&gno, hash->num_gid_entries, (unsigned int) hash->maxsize);
-        for (ptr=hash->table[i]; ptr && ptr->gno!=gno; ptr = ptr->next);
-        if (!ptr) {
+        i = G2LHash_Find(hash, gno, G2LHash_Slot(hash, gno));
+        if (hash->keys[i] == -1) {
             if (hash->size >= hash->maxsize) {
                 char st[2048];
                 sprintf(st, "Hash is full! #entries=%d  maxsize=%d", hash->size, hash->maxsize);
                 ZOLTAN_PRINT_ERROR(-1, "Zoltan_G2LHash_G2L", st);
                 return -1;
             }
-            ptr = &(hash->nodes[hash->size]);
-            ptr->gno = gno;
-            lno = ptr->lno = hash->nlvtx + hash->size;
-            ptr->next = hash->table[i];
-            hash->table[i] = ptr;
+            hash->keys[i] = gno;
+            lno = hash->vals[i] = hash->nlvtx + hash->size;
+            hash->gnos[hash->size] = gno;
             ++hash->size;
         } else
-            lno = ptr->lno;
+            lno = hash->vals[i];
     } else
         return gno-hash->base;
 
@@ -175,73 +210,73 @@ int Zoltan_G2LHash_Insert(G2LHash *hash, ZOLTAN_GNO_TYPE gno)
 int Zoltan_G2LHash_G2L(G2LHash *hash, ZOLTAN_GNO_TYPE gno)
 {
     int i;
-    G2LHashNode *ptr;
 
     if (gno<hash->base || gno>hash->baseend) {
-        i = Zoltan_Hash((ZOLTAN_ID_PTR) (void *)&gno, hash->num_gid_entries, (unsigned int) hash->maxsize);
-        for (ptr=hash->table[i]; ptr && ptr->gno!=gno; ptr = ptr->next);
-        if (!ptr)
-            return -1;
-        else
-            return ptr->lno;
+        i = G2LHash_Find(hash, gno, G2LHash_Slot(hash, gno));
+        return (hash->keys[i] == -1) ? -1 : hash->vals[i];
     } else
         return gno-hash->base;
 }
 
+int Zoltan_G2LHash_G2L_Batch(G2LHash *hash, int n, ZOLTAN_GNO_TYPE *gno, int stride, int *lno)
+{
+    int slot[G2L_BATCH];
+    int i, j, k, nb;
+    ZOLTAN_GNO_TYPE g;
+
+    for (i = 0; i < n; i += nb) {
+        nb = (n - i < G2L_BATCH) ? n - i : G2L_BATCH;
+        /* local gnos are mapped directly; compute the slots of the others */
+        for (k = 0; k < nb; ++k) {
+            g = gno[(size_t) (i + k) * stride];
+            if (g<hash->base || g>hash->baseend)
+                slot[k] = G2LHash_Slot(hash, g);
+            else {
+                slot[k] = -1;
+                lno[i + k] = (int) (g - hash->base);
+            }
+        }
+        for (k = 0; k < nb; ++k)
+            if (slot[k] >= 0) {
+                j = G2LHash_Find(hash, gno[(size_t) (i + k) * stride], slot[k]);
+                lno[i + k] = (hash->keys[j] == -1) ? -1 : hash->vals[j];
+            }
+    }
+
+    return ZOLTAN_OK;
+}
+
 
 /* --------------------------- KVHash -------------------------------- */
 
 int Zoltan_KVHash_Create(KVHash *hash, int maxsize)
 {
-    if (maxsize == 0) /* to avoid memory allocation errors */
-        maxsize = 1;
-
-    if (Zoltan_GenPrime(maxsize , &(hash->maxsize))==ZOLTAN_MEMERR)
-      return ZOLTAN_MEMERR;
-    
-    hash->table = NULL;
-    hash->nodes = NULL;
-    hash->size = 0;
-    hash->num_gid_entries = sizeof(ZOLTAN_GNO_TYPE) / sizeof(ZOLTAN_ID_TYPE);
-    hash->table = (G2LHashNode **) ZOLTAN_CALLOC(hash->maxsize, sizeof(G2LHashNode *));
-    hash->nodes = (G2LHashNode *) ZOLTAN_MALLOC(hash->maxsize * sizeof(G2LHashNode));
-    if (!hash->table || !hash->nodes) {
-        Zoltan_G2LHash_Destroy(hash);
-        return ZOLTAN_MEMERR;
-    }
-    return ZOLTAN_OK;
+    hash->base = 0;
+    hash->baseend = -1;
+    hash->nlvtx = 0;
+    return G2LHash_Alloc(hash, maxsize, 0);
 }
 
 int Zoltan_KVHash_Destroy(KVHash *hash)
 {
-    ZOLTAN_FREE(&hash->table);
-    ZOLTAN_FREE(&hash->nodes);
-
-    return ZOLTAN_OK;
+    return Zoltan_G2LHash_Destroy(hash);
 }    
 
 int Zoltan_KVHash_Insert(KVHash *hash, ZOLTAN_GNO_TYPE key, int value)
 {
     int i;
-    
-    G2LHashNode *ptr;
 
-    i = Zoltan_Hash((ZOLTAN_ID_PTR) (void *)&key, hash->num_gid_entries, (unsigned int) hash->maxsize);
-    for (ptr=hash->table[i]; ptr && ptr->gno!=key; ptr = ptr->next);
-    if (!ptr) {
+    i = G2LHash_Find(hash, key, G2LHash_Slot(hash, key));
+    if (hash->keys[i] == -1) {
         if (hash->size >= hash->maxsize) {
             ZOLTAN_PRINT_ERROR(-1, "Zoltan_KVHash_Insert", "Hash is full!");
             return -1;
         }
-        
-        ptr = &(hash->nodes[hash->size]);
-        ptr->gno = key;
-        ptr->lno = value;
-        ptr->next = hash->table[i];
-        hash->table[i] = ptr;
+        hash->keys[i] = key;
+        hash->vals[i] = value;
         ++hash->size;
     } else
-        value = ptr->lno;
+        value = hash->vals[i];
 
     return value;   
 }
@@ -250,16 +285,12 @@ int Zoltan_KVHash_Insert(KVHash *hash, ZOLTAN_GNO_TYPE key, int value)
 int Zoltan_KVHash_GetValue(KVHash *hash, ZOLTAN_GNO_TYPE key)    
 {
     int i;
-    G2LHashNode *ptr;
-
-    i = Zoltan_Hash((ZOLTAN_ID_PTR) (void *) &key, hash->num_gid_entries, (unsigned int) hash->maxsize);
-    for (ptr=hash->table[i]; ptr && ptr->gno!=key; ptr = ptr->next);
-    if (!ptr)
-        return -1;
-    else
-        return ptr->lno;
+
+    i = G2LHash_Find(hash, key, G2LHash_Slot(hash, key));
+    return (hash->keys[i] == -1) ? -1 : hash->vals[i];
 }
     
+#undef G2L_BATCH
 
 
 #ifdef __cplusplus
@@ -51,24 +51,21 @@
 extern "C" {
 #endif
 
-/* Structure used for hashing */
-struct G2L_Hash_Node {
-    ZOLTAN_GNO_TYPE gno;           /* Global number */
-    int lno;           /* Mapped id of gno*/
-    struct G2L_Hash_Node * next;
-};
-
-typedef struct G2L_Hash_Node G2LHashNode;
-
+/* Structure used for hashing: a flat open addressing table with linear
+   probing. keys[i] is the gno stored in slot i (-1 if empty) and vals[i]
+   its lno; gnos lists the inserted gnos in lno order. */
 struct G2L_Hash {
-    int   maxsize;
+    int   maxsize;       /* max number of ids stored in the hash */
     int   size;          /* number of ids stored in the hash */
     ZOLTAN_GNO_TYPE base, baseend; /* base and baseend are inclusive gno's of local vertices */
     int   nlvtx;         /* it is #localy owened vertices: simply equal to "baseend-base+1" */
     int   num_gid_entries;   /* multiple of ZOLTAN_ID_TYPEs in a key */
-    
-    G2LHashNode **table;
-    G2LHashNode *nodes;
+
+    int   mask;          /* number of slots - 1; the number of slots is a power of 2 */
+    int   shift;         /* 32 - log2(number of slots) */
+    ZOLTAN_GNO_TYPE *keys;
+    int  *vals;
+    ZOLTAN_GNO_TYPE *gnos;
 };
 
 typedef struct G2L_Hash G2LHash;
@@ -76,12 +73,16 @@ typedef struct G2L_Hash G2LHash;
 int Zoltan_G2LHash_Create(G2LHash *hash, int maxsize, ZOLTAN_GNO_TYPE base, int nlvtx);
 int Zoltan_G2LHash_Destroy(G2LHash *hash);
 int Zoltan_G2LHash_G2L(G2LHash *hash, ZOLTAN_GNO_TYPE gno);
+/* maps the n gnos gno[0], gno[stride], ..., gno[(n-1)*stride] to lno[0..n-1],
+   -1 for the gnos not in the hash; the slots of a batch are computed
+   before probing them */
+int Zoltan_G2LHash_G2L_Batch(G2LHash *hash, int n, ZOLTAN_GNO_TYPE *gno, int stride, int *lno);
 /*
   if gno exist it returns lno, if it does not exist,
   it inserts andr returns newly assigned lno */
 int Zoltan_G2LHash_Insert(G2LHash *hash, ZOLTAN_GNO_TYPE gno);
     
-#define Zoltan_G2LHash_L2G(hash, lno) ((lno<(hash)->nlvtx) ? (hash)->base+lno : (hash)->nodes[lno-(hash)->nlvtx].gno)
+#define Zoltan_G2LHash_L2G(hash, lno) ((lno<(hash)->nlvtx) ? (hash)->base+lno : (hash)->gnos[lno-(hash)->nlvtx])
 
 
 /* Key&Value hash functions using same data structure above
@@ -134,6 +134,10 @@ int Zoltan_HSFC(
    int        idummy;
    double     ddummy;
    int        dim;
+   int        split;              /* HSFC_SPLIT_BINNING or HSFC_SPLIT_SORT */
+   char       split_method[MAX_PARAM_STRING_LEN];
+   double     batch[HSFC_BATCH * 3]; /* scaled coordinates of a batch of dots*/
+   double     fsfc[HSFC_BATCH];
    char      *yo = "Zoltan_HSFC";
 
    /* begin program with trace, timing, and initializations */
@@ -147,11 +151,20 @@ int Zoltan_HSFC(
    Zoltan_Bind_Param (HSFC_params, "KEEP_CUTS", (void*) &param);
    Zoltan_Bind_Param (HSFC_params, "REDUCE_DIMENSIONS", (void*) &idummy);
    Zoltan_Bind_Param (HSFC_params, "DEGENERATE_RATIO", (void*) &ddummy);
+   Zoltan_Bind_Param (HSFC_params, "HSFC_SPLIT_METHOD", (void*) split_method);
    param = idummy = final_output = 0;
    ddummy = 0.0;
+   strcpy (split_method, "BINNING");
    Zoltan_Assign_Param_Vals (zz->Params, HSFC_params, zz->Debug_Level, zz->Proc,
     zz->Debug_Proc);
 
+   if      (strcasecmp (split_method, "BINNING") == 0)
+      split = HSFC_SPLIT_BINNING;
+   else if (strcasecmp (split_method, "SORT") == 0)
+      split = HSFC_SPLIT_SORT;
+   else
+      ZOLTAN_HSFC_ERROR (ZOLTAN_FATAL, "Invalid HSFC_SPLIT_METHOD");
+
    if (sizeof (int) != 4) {
      ZOLTAN_HSFC_ERROR(ZOLTAN_FATAL,
                        "HSFC implemented only for 32-bit integers");
@@ -293,11 +306,30 @@ int Zoltan_HSFC(
    else if (dim== 2)  d->fhsfc = Zoltan_HSFC_InvHilbert2d;
    else if (dim== 3)  d->fhsfc = Zoltan_HSFC_InvHilbert3d;
 
-   /* Scale coordinates to bounding box, compute HSFC */
-   for (i = 0; i < ndots; i++) {
-      for (j = 0; j < dim; j++)
-         out[j] = (dots[i].x[j] - d->bbox_lo[j]) / d->bbox_extent[j];
-      dots[i].fsfc = d->fhsfc (zz, out);      /* Note, this is a function call */
+   /* Scale coordinates to bounding box, compute HSFC a batch at a time */
+   for (i = 0; i < ndots; i += HSFC_BATCH) {
+      tmp = (ndots - i < HSFC_BATCH) ? ndots - i : HSFC_BATCH;
+      for (k = 0; k < tmp; k++)
+         for (j = 0; j < dim; j++)
+            batch[k*dim+j] = (dots[i+k].x[j] - d->bbox_lo[j])
+             / d->bbox_extent[j];
+      Zoltan_HSFC_InvHilbert_Batch (zz, dim, tmp, batch, fsfc);
+      for (k = 0; k < tmp; k++)
+         dots[i+k].fsfc = fsfc[k];
+      }
+
+   /* Sort based splitter replaces the binning loop and final partition below */
+   if (split == HSFC_SPLIT_SORT) {
+      d->final_partition = (Partition*) ZOLTAN_MALLOC(sizeof(Partition)
+       * zz->LB.Num_Global_Parts);
+      if (d->final_partition == NULL)
+         ZOLTAN_HSFC_ERROR (ZOLTAN_MEMERR, "Unable to malloc final_partition");
+      err = Zoltan_HSFC_Sort_Partition (zz, ndots, dots, work_fraction, target,
+       tsum, d->final_partition);
+      if (err != ZOLTAN_OK)
+         goto End;
+      ZOLTAN_TRACE_DETAIL (zz, yo, "Sorted dots along HSFC");
+      goto Tolerance;
       }
 
    /* Initialize grand partition to equally spaced intervals on [0,1] */
@@ -494,6 +526,7 @@ int Zoltan_HSFC(
       d->final_partition[i].l = 1.0 + (2.0 * FLT_EPSILON);
       }
 
+Tolerance:
    out_of_tolerance = 0;
    for (k = 0; k < zz->LB.Num_Global_Parts; k++)
       if (tsum[k] > target[k] * zz->LB.Imbalance_Tol[0])
@@ -91,6 +91,14 @@ static const double  DEFAULT_BIN_MAX = -2.0;
 static const double  DEFAULT_BIN_MIN =  2.0;
 
 
+/* number of points handled at once by the batched Hilbert key routines */
+#define HSFC_BATCH 64
+
+/* values of the HSFC_SPLIT_METHOD parameter */
+#define HSFC_SPLIT_BINNING 0   /* iterative binning of [0,1] (default) */
+#define HSFC_SPLIT_SORT    1   /* local sort and sampled global splitters */
+
+
 #define ZOLTAN_HSFC_ERROR(error,str) {err = error; \
  ZOLTAN_PRINT_ERROR(zz->Proc, yo, str); goto End;}
 
@@ -124,6 +132,8 @@ typedef struct Dots {
 
 
 extern int  Zoltan_HSFC_compare (const void *key, const void *arg);
+extern int  Zoltan_HSFC_Sort_Partition (ZZ *zz, int ndots, Dots *dots,
+ float *work_fraction, float *target, double *tsum, Partition *final_partition);
 
 #ifdef __cplusplus
 } /* closing bracket for extern "C" */
@@ -168,6 +168,116 @@ double Zoltan_HSFC_InvHilbert3d (ZZ *zz, double *coord)
    }
 
 
+
+
+/* Batched versions of the above routines. Points are processed by blocks of
+   HSFC_BATCH, level by level, so that the inner loops over the points of a
+   block carry no dependency and can be vectorized. The integer keys are the
+   full 56 (2d) or 57 (3d) bit shift registers built by the routines above,
+   and the double keys are bitwise identical to the ones they return. */
+
+/* Given n pairs of x,y coordinates in [0,1]x[0,1], returns the integer keys */
+void Zoltan_HSFC_InvHilbert2d_Keys (int n, double *coord, uint64_t *key)
+   {
+   unsigned int c[2][HSFC_BATCH], state[HSFC_BATCH], temp;
+   uint64_t *k;
+   int i, m, start, level;
+   const int MAXLEVEL = 28; /* 56 bits of significance, 28 per dimension */
+
+   for (start = 0; start < n; start += HSFC_BATCH) {
+      m = ((n - start) < HSFC_BATCH) ? (n - start) : HSFC_BATCH;
+      k = key + start;
+
+      for (i = 0; i < m; i++) {
+         c[0][i] = (unsigned int) (coord[2*(start+i)]   * (double) IMAX);  /* x */
+         c[1][i] = (unsigned int) (coord[2*(start+i)+1] * (double) IMAX);  /* y */
+         state[i] = 0;
+         k[i]     = 0;
+         }
+
+      for (level = 0; level < MAXLEVEL; level++)
+         for (i = 0; i < m; i++) {
+            temp = ((c[0][i] >> (30-level)) & 2)
+                 | ((c[1][i] >> (31-level)) & 1);
+            k[i]     = (k[i] << 2) | idata2d[4*state[i] + temp];
+            state[i] = istate2d[4*state[i] + temp];
+            }
+      }
+   }
+
+
+
+/* Given n triples of x,y,z coordinates in [0,1]^3, returns the integer keys */
+void Zoltan_HSFC_InvHilbert3d_Keys (int n, double *coord, uint64_t *key)
+   {
+   unsigned int c[3][HSFC_BATCH], state[HSFC_BATCH], temp;
+   uint64_t *k;
+   int i, m, start, level;
+   const int MAXLEVEL = 19; /* 56 bits of significance, 18+ per dimension */
+
+   for (start = 0; start < n; start += HSFC_BATCH) {
+      m = ((n - start) < HSFC_BATCH) ? (n - start) : HSFC_BATCH;
+      k = key + start;
+
+      for (i = 0; i < m; i++) {
+         c[0][i] = (unsigned int) (coord[3*(start+i)]   * (double) IMAX);  /* x */
+         c[1][i] = (unsigned int) (coord[3*(start+i)+1] * (double) IMAX);  /* y */
+         c[2][i] = (unsigned int) (coord[3*(start+i)+2] * (double) IMAX);  /* z */
+         state[i] = 0;
+         k[i]     = 0;
+         }
+
+      for (level = 0; level < MAXLEVEL; level++)
+         for (i = 0; i < m; i++) {
+            temp = ((c[0][i] >> (29-level)) & 4)
+                 | ((c[1][i] >> (30-level)) & 2)
+                 | ((c[2][i] >> (31-level)) & 1);
+            k[i]     = (k[i] << 3) | idata3d[8*state[i] + temp];
+            state[i] = istate3d[8*state[i] + temp];
+            }
+      }
+   }
+
+
+
+/* Given n points of dim coordinates in [0,1], stored consecutively, returns
+   their Hilbert keys in [0,1] as Zoltan_HSFC_InvHilbertxd would */
+void Zoltan_HSFC_InvHilbert_Batch (ZZ *zz, int dim, int n, double *coord,
+ double *fsfc)
+   {
+   uint64_t key[HSFC_BATCH];
+   int i, m, start;
+   char *yo = "Zoltan_HSFC_InvHilbert_Batch";
+
+   /* sanity check for input arguments, once per batch */
+   for (i = 0; i < dim * n; i++)
+      if ((coord[i] < 0.0) || (coord[i] > 1.0)) {
+         ZOLTAN_PRINT_ERROR (zz->Proc, yo, "Spatial Coordinates out of range.");
+         break;
+         }
+
+   if (dim == 1) {
+      for (i = 0; i < n; i++)
+         fsfc[i] = coord[i];
+      return;
+      }
+
+   for (start = 0; start < n; start += HSFC_BATCH) {
+      m = ((n - start) < HSFC_BATCH) ? (n - start) : HSFC_BATCH;
+      if (dim == 2) {
+         Zoltan_HSFC_InvHilbert2d_Keys (m, coord + 2*start, key);
+         for (i = 0; i < m; i++)
+            fsfc[start+i] = ldexp ((double) key[i], -56);
+         }
+      else {
+         Zoltan_HSFC_InvHilbert3d_Keys (m, coord + 3*start, key);
+         for (i = 0; i < m; i++)
+            fsfc[start+i] = ldexp ((double) key[i], -57);
+         }
+      }
+   }
+
+
    
 /* Note: the following code has been tested and is fine.  It was necessary
 during the testing for the new box assign algorithm.  Since it is potentially
@@ -233,6 +233,11 @@ double Zoltan_HSFC_InvHilbert1d (ZZ*, double *coord);
 double Zoltan_HSFC_InvHilbert2d (ZZ*, double *coord);
 double Zoltan_HSFC_InvHilbert3d (ZZ*, double *coord);
 
+void Zoltan_HSFC_InvHilbert2d_Keys (int n, double *coord, uint64_t *key);
+void Zoltan_HSFC_InvHilbert3d_Keys (int n, double *coord, uint64_t *key);
+void Zoltan_HSFC_InvHilbert_Batch (ZZ*, int dim, int n, double *coord,
+ double *fsfc);
+
 void Zoltan_HSFC_Hilbert1d (ZZ*, double *coord, double key);
 void Zoltan_HSFC_Hilbert2d (ZZ*, double *coord, double key);
 void Zoltan_HSFC_Hilbert3d (ZZ*, double *coord, double key);
@@ -60,6 +60,7 @@ static PARAM_VARS HSFC_params[] =
     { "REDUCE_DIMENSIONS", NULL, "INT", 0 },
     { "DEGENERATE_RATIO", NULL, "DOUBLE", 0 },
     {"FINAL_OUTPUT",  NULL,  "INT",    0},
+    {"HSFC_SPLIT_METHOD", NULL, "STRING", 0},
     {NULL,        NULL,  NULL, 0}};
 
 
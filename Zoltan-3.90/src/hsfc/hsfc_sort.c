@@ -0,0 +1,442 @@
+/* 
+ * @HEADER
+ *
+ * ***********************************************************************
+ *
+ *  Zoltan Toolkit for Load-balancing, Partitioning, Ordering and Coloring
+ *                  Copyright 2012 Sandia Corporation
+ *
+ * Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+ * the U.S. Government retains certain rights in this software.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the Corporation nor the names of the
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Questions? Contact Karen Devine	kddevin@sandia.gov
+ *                    Erik Boman	egboman@sandia.gov
+ *
+ * ***********************************************************************
+ *
+ * @HEADER
+ */
+
+#ifdef __cplusplus
+/* if C++, define the rest of this header file as extern C */
+extern "C" {
+#endif
+
+/* Sort based splitter for HSFC, selected by HSFC_SPLIT_METHOD = SORT.
+
+   Instead of iteratively binning all dots on a refined partition of [0,1],
+   each processor sorts its dots by Hilbert key once, and part boundaries are
+   chosen among keys sampled from the sorted dots.  All processors receive the
+   same samples and their exact global prefix weights, so that they all select
+   the same boundaries without further communication.  The first pass samples
+   the whole curve; the following passes, only if needed, sample the dots
+   lying between the two candidates bracketing each boundary.  Each pass costs
+   one MPI_Allgather and one MPI_Allreduce.
+
+   Hilbert keys are doubles in [0,1].  The bit patterns of non-negative doubles
+   sort as unsigned 64 bit integers, so dots are radix sorted on these patterns
+   and candidate boundaries are exchanged as doubles.
+*/
+
+
+#include "hsfc.h"
+#include "zz_const.h"
+
+/* samples per part, over all processors, in the first pass */
+static const int SORT_OVERSAMPLE = 8;
+
+/* samples per boundary, over all processors, in the refinement passes */
+static const int SORT_REFINE = 32;
+
+/* maximum number of passes, including the first one */
+static const int SORT_MAX_PASSES = 4;
+
+/* fraction of the allowed imbalance within which a boundary is settled */
+static const double SORT_TOLERANCE = 0.1;
+
+/****************************************************************************/
+
+static uint64_t sort_key (double x)
+   {
+   uint64_t k;
+   memcpy (&k, &x, sizeof (uint64_t));
+   return k;
+   }
+
+
+
+static double sort_value (uint64_t k)
+   {
+   double x;
+   memcpy (&x, &k, sizeof (double));
+   return x;
+   }
+
+
+
+/* routine for qsort ordering keys */
+static int sort_compare (const void *a, const void *b)
+   {
+   uint64_t ka = *(const uint64_t*) a, kb = *(const uint64_t*) b;
+   return (ka > kb) - (ka < kb);
+   }
+
+
+
+/* LSD radix sort of keys and their permutation, 8 bits per pass.  Passes on
+   digits shared by all keys (such as the exponent bits of most keys) are
+   skipped. */
+static void sort_radix (int n, uint64_t *key, int *perm, uint64_t *ktmp,
+ int *ptmp)
+   {
+   int       count[256];
+   int       shift, i, d, sum, t;
+   uint64_t *ks = key,  *kd = ktmp, *kx;
+   int      *ps = perm, *pd = ptmp, *px;
+
+   if (n < 2)
+      return;
+
+   for (shift = 0; shift < 64; shift += 8) {
+      memset (count, 0, sizeof (count));
+      for (i = 0; i < n; i++)
+         count[(ks[i] >> shift) & 255]++;
+      if (count[(ks[0] >> shift) & 255] == n)
+         continue;                               /* same digit for all keys */
+
+      for (i = sum = 0; i < 256; i++) {
+         t        = count[i];
+         count[i] = sum;
+         sum     += t;
+         }
+      for (i = 0; i < n; i++) {
+         d     = count[(ks[i] >> shift) & 255]++;
+         kd[d] = ks[i];
+         pd[d] = ps[i];
+         }
+      kx = ks; ks = kd; kd = kx;
+      px = ps; ps = pd; pd = px;
+      }
+
+   if (ks != key) {
+      memcpy (key,  ks, n * sizeof (uint64_t));
+      memcpy (perm, ps, n * sizeof (int));
+      }
+   }
+
+
+
+/* index of first sorted key not less than k */
+static int sort_lower (int n, uint64_t *key, uint64_t k)
+   {
+   int lo = 0, hi = n, mid;
+
+   while (lo < hi) {
+      mid = lo + (hi - lo) / 2;
+      if (key[mid] < k)
+         lo = mid + 1;
+      else
+         hi = mid;
+      }
+   return lo;
+   }
+
+
+
+/* s keys of the local dots within [lo,hi), evenly spaced in weight; when
+   there are none, returns lo, which is discarded by the receivers */
+static void sort_sample (int n, uint64_t *key, double *wsum, uint64_t lo,
+ uint64_t hi, int s, double *out)
+   {
+   int    a, b, i, j;
+   double w, t;
+
+   a = sort_lower (n, key, lo);
+   b = sort_lower (n, key, hi);
+   if (a == b) {
+      for (i = 0; i < s; i++)
+         out[i] = sort_value (lo);
+      return;
+      }
+
+   w = wsum[b] - wsum[a];
+   for (i = 0, j = a; i < s; i++) {
+      if (w > 0.0) {
+         t = wsum[a] + w * (i + 1) / (s + 1);
+         while (j < b - 1  &&  wsum[j+1] <= t)
+            j++;
+         }
+      else
+         j = a + (int) ((double) (b - a) * (i + 1) / (s + 1));
+      out[i] = sort_value (key[j]);
+      }
+   }
+
+
+
+/* sorts, removes duplicates and keys outside of (lo,hi) from the n keys of
+   cand, returning their number */
+static int sort_candidates (int n, uint64_t *cand, uint64_t lo, uint64_t hi)
+   {
+   int i, m;
+
+   qsort (cand, n, sizeof (uint64_t), sort_compare);
+   for (i = m = 0; i < n; i++)
+      if (cand[i] > lo  &&  cand[i] < hi  &&  (m == 0 || cand[i] != cand[m-1]))
+         cand[m++] = cand[i];
+   return m;
+   }
+
+/****************************************************************************/
+
+/* Computes final_partition, the global weight tsum and the target weight
+   of each part, and sets the part of every dot */
+int Zoltan_HSFC_Sort_Partition (
+ ZZ        *zz,
+ int        ndots,
+ Dots      *dots,
+ float     *work_fraction,    /* Input: fraction of the weight of each part */
+ float     *target,           /* Output: target weight of each part */
+ double    *tsum,             /* Output: global weight of each part */
+ Partition *final_partition)  /* Output: [l,r) interval of each part */
+   {
+   uint64_t *key   = NULL;    /* keys of local dots, sorted */
+   uint64_t *ktmp  = NULL;
+   int      *perm  = NULL;    /* local dots in key order */
+   int      *ptmp  = NULL;
+   double   *wsum  = NULL;    /* prefix sums of weights in key order */
+   double   *goal  = NULL;    /* cumulative target weight at each boundary */
+   uint64_t *lo    = NULL;    /* largest candidate known to be left of goal */
+   uint64_t *hi    = NULL;    /* smallest candidate known to be right of goal */
+   double   *plo   = NULL;    /* global weight of dots left of lo */
+   double   *phi   = NULL;    /* global weight of dots left of hi */
+   int      *open  = NULL;    /* boundaries still being refined */
+   int      *ncand = NULL;    /* number of candidates of each open boundary */
+   double   *mine  = NULL;    /* local samples */
+   double   *all   = NULL;    /* samples of all processors */
+   uint64_t *cand  = NULL;    /* candidate boundaries */
+   double   *lsum  = NULL;    /* local weights left of candidates */
+   double   *gsum  = NULL;    /* global weights left of candidates */
+
+   int      nparts = zz->LB.Num_Global_Parts;
+   int      ncuts  = nparts - 1;
+   int      nprocs = zz->Num_Proc;
+   uint64_t keyend = sort_key (1.0 + (2.0 * FLT_EPSILON)); /* past all keys */
+   double   total, tol;
+   int      i, j, k, m, p, s, o, nopen, pass;
+   int      err = ZOLTAN_OK;
+   char    *yo = "Zoltan_HSFC_Sort_Partition";
+
+   ZOLTAN_TRACE_ENTER (zz, yo);
+
+   /* sort local dots by key, and sum their weights in this order */
+   key  = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * (ndots + 1));
+   ktmp = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * (ndots + 1));
+   perm = (int*)      ZOLTAN_MALLOC (sizeof (int)      * (ndots + 1));
+   ptmp = (int*)      ZOLTAN_MALLOC (sizeof (int)      * (ndots + 1));
+   wsum = (double*)   ZOLTAN_MALLOC (sizeof (double)   * (ndots + 1));
+   goal = (double*)   ZOLTAN_MALLOC (sizeof (double)   * nparts);
+   lo   = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * nparts);
+   hi   = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * nparts);
+   plo  = (double*)   ZOLTAN_MALLOC (sizeof (double)   * nparts);
+   phi  = (double*)   ZOLTAN_MALLOC (sizeof (double)   * nparts);
+   open = (int*)      ZOLTAN_MALLOC (sizeof (int)      * 2 * nparts);
+   if (key == NULL  ||  ktmp == NULL  ||  perm == NULL  ||  ptmp == NULL
+    || wsum == NULL  ||  goal == NULL  ||  lo == NULL  ||  hi == NULL
+    || plo == NULL  ||  phi == NULL  ||  open == NULL)
+      ZOLTAN_HSFC_ERROR (ZOLTAN_MEMERR, "Malloc error for sorted keys");
+   ncand = open + nparts;
+
+   for (i = 0; i < ndots; i++) {
+      key[i]  = sort_key (dots[i].fsfc);
+      perm[i] = i;
+      }
+   sort_radix (ndots, key, perm, ktmp, ptmp);
+   ZOLTAN_FREE (&ktmp);
+   ZOLTAN_FREE (&ptmp);
+
+   wsum[0] = 0.0;
+   for (i = 0; i < ndots; i++)
+      wsum[i+1] = wsum[i] + dots[perm[i]].weight;
+
+   /* first pass: regular samples of the whole curve, as in sample sort */
+   s = (SORT_OVERSAMPLE * nparts + nprocs - 1) / nprocs;
+   mine = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s);
+   all  = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s * nprocs);
+   cand = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * s * nprocs);
+   lsum = (double*)   ZOLTAN_MALLOC (sizeof (double)   * (s * nprocs + 1));
+   gsum = (double*)   ZOLTAN_MALLOC (sizeof (double)   * (s * nprocs + 1));
+   if (mine == NULL  ||  all == NULL  ||  cand == NULL  ||  lsum == NULL
+    || gsum == NULL)
+      ZOLTAN_HSFC_ERROR (ZOLTAN_MEMERR, "Malloc error for samples");
+
+   sort_sample (ndots, key, wsum, 0, keyend, s, mine);
+   if (MPI_Allgather (mine, s, MPI_DOUBLE, all, s, MPI_DOUBLE,
+    zz->Communicator) != MPI_SUCCESS)
+      ZOLTAN_HSFC_ERROR (ZOLTAN_FATAL, "Sample MPI_Allgather error");
+
+   for (i = 0; i < s * nprocs; i++)
+      cand[i] = sort_key (all[i]);
+   m = sort_candidates (s * nprocs, cand, 0, keyend);
+   for (i = 0; i < m; i++)
+      lsum[i] = wsum[sort_lower (ndots, key, cand[i])];
+   lsum[m] = wsum[ndots];                /* total weight rides along */
+   if (MPI_Allreduce (lsum, gsum, m + 1, MPI_DOUBLE, MPI_SUM,
+    zz->Communicator) != MPI_SUCCESS)
+      ZOLTAN_HSFC_ERROR (ZOLTAN_FATAL, "Sample MPI_Allreduce error");
+
+   total = gsum[m];
+   for (k = 0, tol = 0.0; k < nparts; k++) {
+      target[k] = work_fraction[k] * total;
+      tol      += work_fraction[k] * total;
+      goal[k]   = tol;
+      }
+
+   /* bracket each boundary between the candidates around its goal */
+   for (k = j = 0; k < ncuts; k++) {
+      while (j < m  &&  gsum[j] <= goal[k])
+         j++;
+      lo[k]  = (j > 0) ? cand[j-1] : 0;
+      plo[k] = (j > 0) ? gsum[j-1] : 0.0;
+      hi[k]  = (j < m) ? cand[j]   : keyend;
+      phi[k] = (j < m) ? gsum[j]   : total;
+      }
+
+   /* refinement passes: samples of the dots within each open bracket */
+   for (pass = 1; pass < SORT_MAX_PASSES; pass++) {
+      for (k = nopen = 0; k < ncuts; k++) {
+         tol = SORT_TOLERANCE * (zz->LB.Imbalance_Tol[0] - 1.0)
+             * ((target[k] < target[k+1]) ? target[k] : target[k+1]);
+         open[k] = (pass == 1  ||  ncand[k] > 0)
+          && (phi[k] - plo[k] > tol)  &&  (goal[k] > plo[k])
+          && (goal[k] < phi[k]);
+         nopen += open[k];
+         }
+      if (nopen == 0)
+         break;
+
+      Zoltan_Multifree (__FILE__, __LINE__, 5, &mine, &all, &cand, &lsum,
+       &gsum);
+      s = (SORT_REFINE + nprocs - 1) / nprocs;
+      mine = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s * nopen);
+      all  = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s * nopen * nprocs);
+      cand = (uint64_t*) ZOLTAN_MALLOC (sizeof (uint64_t) * s * nopen * nprocs);
+      lsum = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s * nopen * nprocs);
+      gsum = (double*)   ZOLTAN_MALLOC (sizeof (double)   * s * nopen * nprocs);
+      if (mine == NULL  ||  all == NULL  ||  cand == NULL  ||  lsum == NULL
+       || gsum == NULL)
+         ZOLTAN_HSFC_ERROR (ZOLTAN_MEMERR, "Malloc error for samples");
+
+      for (k = o = 0; k < ncuts; k++)
+         if (open[k])
+            sort_sample (ndots, key, wsum, lo[k], hi[k], s, mine + s * o++);
+      if (MPI_Allgather (mine, s * nopen, MPI_DOUBLE, all, s * nopen,
+       MPI_DOUBLE, zz->Communicator) != MPI_SUCCESS)
+         ZOLTAN_HSFC_ERROR (ZOLTAN_FATAL, "Sample MPI_Allgather error");
+
+      /* gather candidates of each open boundary, from all processors */
+      for (k = o = m = 0; k < ncuts; k++) {
+         if (!open[k])
+            continue;
+         for (p = 0; p < nprocs; p++)
+            for (i = 0; i < s; i++)
+               cand[m + p * s + i] = sort_key (all[(p * nopen + o) * s + i]);
+         ncand[k] = sort_candidates (s * nprocs, cand + m, lo[k], hi[k]);
+         m += ncand[k];
+         o++;
+         }
+      for (i = 0; i < m; i++)
+         lsum[i] = wsum[sort_lower (ndots, key, cand[i])];
+      if (MPI_Allreduce (lsum, gsum, m, MPI_DOUBLE, MPI_SUM,
+       zz->Communicator) != MPI_SUCCESS)
+         ZOLTAN_HSFC_ERROR (ZOLTAN_FATAL, "Sample MPI_Allreduce error");
+
+      /* narrow brackets; a bracket with no candidate cannot be refined */
+      for (k = o = 0; k < ncuts; k++) {
+         if (!open[k]) {
+            ncand[k] = 0;
+            continue;
+            }
+         for (j = o; j < o + ncand[k]; j++) {
+            if (gsum[j] <= goal[k]) {
+               lo[k]  = cand[j];
+               plo[k] = gsum[j];
+               }
+            else {
+               hi[k]  = cand[j];
+               phi[k] = gsum[j];
+               break;
+               }
+            }
+         o += ncand[k];
+         }
+      }
+
+   if (zz->Debug_Level >= ZOLTAN_DEBUG_ALL  &&  zz->Proc == 0)
+      printf ("<%d> Number of sort passes = %d\n", zz->Proc, pass);
+
+   /* each boundary is the closest of its bracket ends, kept non decreasing */
+   for (k = 0; k < ncuts; k++) {
+      if (phi[k] - goal[k] < goal[k] - plo[k]) {
+         lo[k]  = hi[k];
+         plo[k] = phi[k];
+         }
+      if (k > 0  &&  lo[k] < lo[k-1]) {
+         lo[k]  = lo[k-1];
+         plo[k] = plo[k-1];
+         }
+      }
+   lo[ncuts]  = keyend;
+   plo[ncuts] = total;
+
+   for (k = 0; k < nparts; k++) {
+      final_partition[k].index = k;
+      final_partition[k].l     = (k > 0) ? sort_value (lo[k-1]) : 0.0;
+      final_partition[k].r     = sort_value (lo[k]);
+      tsum[k]                  = plo[k] - ((k > 0) ? plo[k-1] : 0.0);
+      }
+
+   /* set part of dots; "part" is in grand partition units, N per part */
+   for (i = k = 0; i < ndots; i++) {
+      while (key[i] >= lo[k])
+         k++;
+      dots[perm[i]].part = k * N;
+      }
+
+End:
+   Zoltan_Multifree (__FILE__, __LINE__, 16, &key, &ktmp, &perm, &ptmp, &wsum,
+    &goal, &lo, &hi, &plo, &phi, &open, &mine, &all, &cand, &lsum, &gsum);
+   ZOLTAN_TRACE_EXIT (zz, yo);
+   return err;
+   }
+
+#ifdef __cplusplus
+} /* closing bracket for extern "C" */
+#endif
@@ -3118,6 +3118,44 @@ extern int Zoltan_Migrate(
   int *export_procs, 
   int *export_to_part);
 
+/*****************************************************************************/
+/*
+ *  Routine to register a field moved by Zoltan_Migrate without size, pack
+ *  and unpack functions.  A field is a column-oriented array indexed by
+ *  local ID (NUM_LID_ENTRIES must be 1).  When any field is registered,
+ *  Zoltan_Migrate sends the fields of the exported objects directly from
+ *  the source arrays, and writes the fields of the i-th imported object in
+ *  row i of the destination arrays; rows are in the same order for all
+ *  fields, so applications register the global IDs as a field to identify
+ *  the imported objects.  No pack or receive buffer is allocated.
+ *  The pre-, mid- and post-migration functions are still called.
+ *  All processors must register fields, or none.
+ *
+ *  Input:
+ *    zz                  --  Zoltan structure.
+ *    field               --  Field number, from 0.
+ *    size                --  Number of bytes of the field per object;
+ *                            0 unregisters the field.
+ *    src                 --  Field of the object with local ID k is at
+ *                            (char *) src + k * src_stride.  May be NULL
+ *                            on a processor which exports no object.
+ *    src_stride          --  Bytes between two rows of src; 0 means size.
+ *    dest                --  Destination array of the imported objects.
+ *    dest_stride         --  Bytes between two rows of dest; 0 means size.
+ *    dest_len            --  Number of rows available in dest.
+ *  Returned value:       --  Error code
+ */
+
+extern int Zoltan_Set_Migrate_Field(
+  struct Zoltan_Struct *zz,
+  int field,
+  int size,
+  void *src,
+  int src_stride,
+  void *dest,
+  int dest_stride,
+  int dest_len);
+
 /*****************************************************************************/
 /*
  *  Routine to help perform migration.  Can be used instead of Zoltan_Migrate
@@ -62,6 +62,16 @@ extern "C" {
 struct Zoltan_Comm_Obj;
 typedef struct Zoltan_Comm_Obj ZOLTAN_COMM_OBJ;
 
+/* Column of data moved by Zoltan_Comm_Do_Fields: item k is the size bytes */
+/* at send + k * send_stride, and is received at recv + k * recv_stride.   */
+typedef struct Zoltan_Comm_Field {
+  char *send;                   /* first item sent */
+  int send_stride;              /* bytes between two items sent */
+  char *recv;                   /* first item received */
+  int recv_stride;              /* bytes between two items received */
+  int size;                     /* bytes of one item */
+} ZOLTAN_COMM_FIELD;
+
 /* function prototypes */
 
 int Zoltan_Comm_Create(ZOLTAN_COMM_OBJ**, int, int*, MPI_Comm, int, int*);
@@ -86,6 +96,8 @@ int Zoltan_Comm_Do     (ZOLTAN_COMM_OBJ*, int, char*, int, char*);
 int Zoltan_Comm_Do_Post(ZOLTAN_COMM_OBJ*, int, char*, int, char*);
 int Zoltan_Comm_Do_Wait(ZOLTAN_COMM_OBJ*, int, char*, int, char*);
 int Zoltan_Comm_Do_AlltoAll(ZOLTAN_COMM_OBJ*, char*, int, char*);
+int Zoltan_Comm_Do_Replay(ZOLTAN_COMM_OBJ*, int, char*, int, char*);
+int Zoltan_Comm_Do_Fields(ZOLTAN_COMM_OBJ*, int, int, ZOLTAN_COMM_FIELD*, int*);
 
 int Zoltan_Comm_Do_Reverse     (ZOLTAN_COMM_OBJ*, int, char*, int, int*, char*);
 int Zoltan_Comm_Do_Reverse_Post(ZOLTAN_COMM_OBJ*, int, char*, int, int*, char*);
@@ -634,6 +634,19 @@ public:
                            export_procs, export_to_part );
   }
 
+  ///--------------------------
+  int Set_Migrate_Field ( const int &field,
+                          const int &size,
+                          void * const src,
+                          const int &src_stride,
+                          void * const dest,
+                          const int &dest_stride,
+                          const int &dest_len )
+  {
+    return Zoltan_Set_Migrate_Field( ZZ_Ptr, field, size, src, src_stride,
+                                     dest, dest_stride, dest_len );
+  }
+
   ///--------------------------
   int Generate_Files( std::string & fname,
                       const int &base_index,
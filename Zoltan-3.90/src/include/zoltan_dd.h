@@ -65,6 +65,10 @@ struct Zoltan_DD_Struct;
 
 typedef struct Zoltan_DD_Struct Zoltan_DD_Directory;
 
+/* Local storage of the directory, selected by Zoltan_DD_Create_Table() */
+#define ZOLTAN_DD_TABLE_CHAINED  0  /* hash table of linked lists (default) */
+#define ZOLTAN_DD_TABLE_OPEN     1  /* flat open addressing table           */
+
 
 /***********  Distributed Directory Function Prototypes ************/
 
@@ -72,6 +76,11 @@ int Zoltan_DD_Create(Zoltan_DD_Directory **dd, MPI_Comm comm,
                      int num_gid, int num_lid, int user_length,
                      int table_length, int debug_level);
 
+int Zoltan_DD_Create_Table(Zoltan_DD_Directory **dd, MPI_Comm comm,
+                           int num_gid, int num_lid, int user_length,
+                           int table_length, int table_type,
+                           int debug_level);
+
 int Zoltan_DD_Copy_To(Zoltan_DD_Directory **toptr, Zoltan_DD_Directory *from);
 
 Zoltan_DD_Directory *Zoltan_DD_Copy(Zoltan_DD_Directory *from);
@@ -96,6 +96,14 @@ extern void    Zoltan_Memory_Stats(void);
 extern size_t  Zoltan_Memory_Usage(int);
 extern void    Zoltan_Memory_Reset(int);
 
+struct Zoltan_Memory_Arena;
+extern struct Zoltan_Memory_Arena *Zoltan_Memory_Arena_Create(size_t);
+extern void    Zoltan_Memory_Arena_Destroy(struct Zoltan_Memory_Arena **);
+extern struct Zoltan_Memory_Arena *Zoltan_Memory_Arena_Begin(
+                                     struct Zoltan_Memory_Arena *);
+extern void    Zoltan_Memory_Arena_End(struct Zoltan_Memory_Arena *,
+                                       struct Zoltan_Memory_Arena *);
+
 #ifdef __STDC__
 extern void Zoltan_Multifree(char *, int, int n, ...);
 #else
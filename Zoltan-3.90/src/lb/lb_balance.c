@@ -309,12 +309,21 @@ float *part_sizes = NULL, *fdummy = NULL;
 int wgt_dim = zz->Obj_Weight_Dim;
 int part_dim;
 int i;
+struct Zoltan_Memory_Arena *prev_arena = NULL;
 #ifdef ZOLTAN_OVIS
 struct OVIS_parameters ovisParameters;
 #endif
 
   ZOLTAN_TRACE_ENTER(zz, yo);
 
+  if (zz->Memory_Arena_Size > 0) {
+    /* Take temporary memory from the arena of zz; it is reset at End. */
+    if (zz->Memory_Arena == NULL)
+      zz->Memory_Arena =
+        Zoltan_Memory_Arena_Create((size_t) zz->Memory_Arena_Size * 1024);
+    prev_arena = Zoltan_Memory_Arena_Begin(zz->Memory_Arena);
+  }
+
   if (zz->Proc == zz->Debug_Proc && zz->Debug_Level >= ZOLTAN_DEBUG_PARAMS){
     Zoltan_Print_Configuration("  ");
     Zoltan_Print_Key_Params(zz);
@@ -828,6 +837,9 @@ struct OVIS_parameters ovisParameters;
   *changes = 1;
 
 End:
+  if (zz->Memory_Arena_Size > 0)
+    Zoltan_Memory_Arena_End(zz->Memory_Arena, prev_arena);
+
   ZOLTAN_TRACE_EXIT(zz, yo);
   return (error);
 }
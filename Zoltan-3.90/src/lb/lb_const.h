@@ -50,6 +50,7 @@
 
 #include "zoltan.h"
 #include "zoltan_dd.h"
+#include "zoltan_comm.h"
 #include "params_const.h"
 
 #ifdef __cplusplus
@@ -297,6 +298,17 @@ struct Zoltan_Migrate_Struct {
                                        /* Fortran version             */
   void *Post_Migrate_Data;             /* Ptr to user defined data to be
                                           passed to Post_Migrate()           */
+  /*
+   *  Fields registered with Zoltan_Set_Migrate_Field.  When any is set,
+   *  Zoltan_Migrate moves them directly from the source to the destination
+   *  arrays instead of calling the size, pack and unpack functions.
+   */
+  int Num_Fields;                      /* Length of Fields and Field_Len;
+                                          unset fields have size 0.      */
+  ZOLTAN_COMM_FIELD *Fields;           /* Source and destination arrays
+                                          of each field.                 */
+  int *Field_Len;                      /* Number of rows available in each
+                                          destination array.             */
 };
 
 /*****************************************************************************/
@@ -308,6 +320,9 @@ extern int Zoltan_LB_Part_To_Proc(struct Zoltan_Struct *, int, ZOLTAN_ID_PTR);
 extern int Zoltan_LB_Proc_To_Part(struct Zoltan_Struct *, int, int *, int *);
 extern int Zoltan_LB_Get_Part_Sizes(struct Zoltan_Struct *, int, float *);
 extern int Zoltan_LB_Build_PartDist(struct Zoltan_Struct *);
+extern int Zoltan_Migrate_Copy_Fields(struct Zoltan_Migrate_Struct *,
+  struct Zoltan_Migrate_Struct const *);
+extern void Zoltan_Migrate_Free_Fields(struct Zoltan_Migrate_Struct *);
 extern int Zoltan_LB_Remap(struct Zoltan_Struct *, int *, int, int *, int *,
   int *, int);
 
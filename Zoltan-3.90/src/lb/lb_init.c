@@ -80,6 +80,9 @@ void Zoltan_Migrate_Init(struct Zoltan_Migrate_Struct *mig)
   mig->Pre_Migrate_Data = NULL;
   mig->Mid_Migrate_Data = NULL;
   mig->Post_Migrate_Data = NULL;
+  mig->Num_Fields = 0;
+  mig->Fields = NULL;
+  mig->Field_Len = NULL;
 }
 
 void Zoltan_LB_Init(struct Zoltan_LB_Struct *lb, int num_proc)
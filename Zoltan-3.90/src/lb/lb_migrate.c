@@ -67,6 +67,7 @@ extern "C" {
 static int check_input(ZZ *, int, int *);
 static int actual_arrays(ZZ *, int, int, int, ZOLTAN_ID_PTR, ZOLTAN_ID_PTR,
   int *, int *, int *, ZOLTAN_ID_PTR *, ZOLTAN_ID_PTR *, int **, int **, int *);
+static int migrate_fields(ZZ *, ZOLTAN_COMM_OBJ *, int, ZOLTAN_ID_PTR, int);
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -122,9 +123,9 @@ int Zoltan_Migrate(
 char *yo = "Zoltan_Migrate";
 int num_gid_entries, num_lid_entries;  /* lengths of global & local ids */
 int *sizes = NULL;       /* sizes (in bytes) of the object data for export. */
-int id_size;             /* size (in bytes) of ZOLTAN_GID + padding for 
+int id_size = 0;         /* size (in bytes) of ZOLTAN_GID + padding for 
                             alignment                                       */
-int tag_size;            /* size (in bytes) of ZOLTAN_GID + one int 
+int tag_size = 0;        /* size (in bytes) of ZOLTAN_GID + one int 
                             (for message size) */
 char *export_buf = NULL; /* buffer for packing export data.                 */
 char *import_buf = NULL; /* buffer for receiving imported data.             */
@@ -142,7 +143,7 @@ ZOLTAN_COMM_OBJ *exp_plan = NULL; /* Comm obj built from export lists. */
 int msgtag, msgtag2;     /* Tags for communication routines                 */
 size_t total_send_size;  /* Total size of outcoming message (in #items)     */
 int total_recv_size;     /* Total size of incoming message (in #items)      */
-int aligned_int;         /* size of an int padded for alignment             */
+int aligned_int = 0;     /* size of an int padded for alignment             */
 int dest;                /* temporary destination partition.                */
 int include_parts = 0;   /* flag indicating whether partition info is
                             provided */
@@ -159,6 +160,8 @@ ZOLTAN_ID_PTR actual_imp_gids = NULL;    /* Arrays containing only objs to  */
 ZOLTAN_ID_PTR actual_imp_lids = NULL;    /* actually be imported. Objs that  */
 int *actual_imp_procs = NULL;            /* are changing partition but not  */
 int *actual_imp_to_part = NULL;          /* processor may not be included.  */
+int use_fields = 0;      /* flag indicating whether fields are registered   */
+int sum_fields;          /* number of procs with registered fields          */
 
   ZOLTAN_TRACE_ENTER(zz, yo);
 
@@ -187,9 +190,31 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
 
   /*
    *  Check that all necessary query functions are available.
+   *  Registered fields replace the size, pack and unpack functions.
    */
 
-  if (zz->Get_Obj_Size == NULL && zz->Get_Obj_Size_Multi == NULL) {
+  for (i = 0; i < zz->Migrate.Num_Fields; i++)
+    if (zz->Migrate.Fields[i].size > 0)
+      use_fields = 1;
+
+  MPI_Allreduce(&use_fields, &sum_fields, 1, MPI_INT, MPI_SUM,
+                zz->Communicator);
+  if (sum_fields != 0 && sum_fields != zz->Num_Proc) {
+    ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Fields registered with "
+           "Zoltan_Set_Migrate_Field on some processors only.");
+    ierr = ZOLTAN_FATAL;
+    goto End;
+  }
+
+  if (use_fields && num_lid_entries != 1) {
+    ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Migration of fields registered with "
+           "Zoltan_Set_Migrate_Field requires NUM_LID_ENTRIES = 1.");
+    ierr = ZOLTAN_FATAL;
+    goto End;
+  }
+
+  if (!use_fields &&
+      zz->Get_Obj_Size == NULL && zz->Get_Obj_Size_Multi == NULL) {
     ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Must register a "
            "ZOLTAN_OBJ_SIZE_FN or ZOLTAN_OBJ_SIZE_MULTI_FN function "
            "to use the migration-help tools.");
@@ -197,7 +222,7 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
     goto End;
   }
 
-  if (zz->Pack_Obj == NULL && zz->Pack_Obj_Multi == NULL) {
+  if (!use_fields && zz->Pack_Obj == NULL && zz->Pack_Obj_Multi == NULL) {
     ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Must register a "
            "ZOLTAN_PACK_OBJ_FN or ZOLTAN_PACK_OBJ_MULTI_FN function "
            "to use the migration-help tools.");
@@ -205,7 +230,8 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
     goto End;
   }
 
-  if (zz->Unpack_Obj == NULL && zz->Unpack_Obj_Multi == NULL) {
+  if (!use_fields &&
+      zz->Unpack_Obj == NULL && zz->Unpack_Obj_Multi == NULL) {
     ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Must register a "
          "ZOLTAN_UNPACK_OBJ_FN or ZOLTAN_UNPACK_OBJ_MULTI_FN function "
          "to use the migration-help tools.");
@@ -358,6 +384,23 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
 
   ZOLTAN_TRACE_DETAIL(zz, yo, "Done pre-migration processing");
 
+  if (use_fields) {
+    /*
+     *  Send the fields straight from the source arrays into the
+     *  destination arrays; object sizes are fixed by the fields, so
+     *  neither sizes nor packing buffers are needed.
+     */
+    ierr = migrate_fields(zz, exp_plan, actual_num_exp, actual_exp_lids,
+                          actual_num_imp);
+    if (ierr < 0) {
+      ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Error returned from migrate_fields.");
+      goto End;
+    }
+    Zoltan_Comm_Destroy(&exp_plan);
+    ZOLTAN_TRACE_DETAIL(zz, yo, "Done communication of fields");
+    goto Mid_Migrate;
+  }
+
   id_size = Zoltan_Align(num_gid_entries * sizeof(ZOLTAN_ID_TYPE));
   /* Note that alignment is not strictly necessary 
      when ZOLTAN_ID_TYPE is int or unsigned int. */
@@ -547,6 +590,7 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
 
   ZOLTAN_TRACE_DETAIL(zz, yo, "Done communication");
 
+Mid_Migrate:
   /* 
    *  Perform application-specified processing before unpacking the data.
    */
@@ -584,7 +628,7 @@ int *actual_imp_to_part = NULL;          /* processor may not be included.  */
    *  Unpack the object data.
    */
 
-  if (actual_num_imp > 0) {
+  if (actual_num_imp > 0 && !use_fields) {
 
     if (zz->Unpack_Obj_Multi != NULL) {
 
@@ -922,6 +966,184 @@ int i, j;
   return ZOLTAN_OK;
 }
 
+/****************************************************************************/
+/****************************************************************************/
+/****************************************************************************/
+
+int Zoltan_Set_Migrate_Field(
+  ZZ *zz,
+  int field,               /* Field number, from 0.                          */
+  int size,                /* Bytes of the field per object; 0 unsets it.    */
+  void *src,               /* Field of the object with local ID k is at
+                              src + k * src_stride.                          */
+  int src_stride,          /* Bytes between two rows of src; 0 means size.   */
+  void *dest,              /* Field of the i-th imported object is written
+                              at dest + i * dest_stride.                     */
+  int dest_stride,         /* Bytes between two rows of dest; 0 means size.  */
+  int dest_len             /* Number of rows available in dest.              */
+)
+{
+/*
+ *  Register a field to be moved by Zoltan_Migrate without pack and unpack
+ *  functions.  Fields are column-oriented arrays indexed by local ID; 
+ *  imported objects are stored in rows 0 to (number of imports - 1) of the
+ *  destination arrays, in the same order for all fields.  Register the
+ *  global IDs as a field to identify the imported objects.
+ */
+
+char *yo = "Zoltan_Set_Migrate_Field";
+struct Zoltan_Migrate_Struct *mig = &(zz->Migrate);
+ZOLTAN_COMM_FIELD *fields;
+int *lens;
+int i;
+
+  if (field < 0 || size < 0 || src_stride < 0 || dest_stride < 0 ||
+      dest_len < 0) {
+    ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Invalid field description.");
+    return ZOLTAN_FATAL;
+  }
+
+  if (size == 0) {
+    if (field < mig->Num_Fields) 
+      mig->Fields[field].size = 0;
+    return ZOLTAN_OK;
+  }
+
+  if (src_stride == 0) src_stride = size;
+  if (dest_stride == 0) dest_stride = size;
+  if (src_stride < size || dest_stride < size || 
+      (dest == NULL && dest_len > 0)) {
+    ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Invalid field description.");
+    return ZOLTAN_FATAL;
+  }
+
+  if (field >= mig->Num_Fields) {
+    fields = (ZOLTAN_COMM_FIELD *) ZOLTAN_REALLOC(mig->Fields,
+                                     (field + 1) * sizeof(ZOLTAN_COMM_FIELD));
+    if (fields == NULL) {
+      ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Memory error.");
+      return ZOLTAN_MEMERR;
+    }
+    mig->Fields = fields;
+    lens = (int *) ZOLTAN_REALLOC(mig->Field_Len, (field + 1) * sizeof(int));
+    if (lens == NULL) {
+      ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Memory error.");
+      return ZOLTAN_MEMERR;
+    }
+    mig->Field_Len = lens;
+    for (i = mig->Num_Fields; i <= field; i++) {
+      memset(&(mig->Fields[i]), 0, sizeof(ZOLTAN_COMM_FIELD));
+      mig->Field_Len[i] = 0;
+    }
+    mig->Num_Fields = field + 1;
+  }
+
+  mig->Fields[field].send = (char *) src;
+  mig->Fields[field].send_stride = src_stride;
+  mig->Fields[field].recv = (char *) dest;
+  mig->Fields[field].recv_stride = dest_stride;
+  mig->Fields[field].size = size;
+  mig->Field_Len[field] = dest_len;
+
+  return ZOLTAN_OK;
+}
+
+/****************************************************************************/
+
+int Zoltan_Migrate_Copy_Fields(
+  struct Zoltan_Migrate_Struct *to,
+  struct Zoltan_Migrate_Struct const *from
+)
+{
+/* 
+ * Copy the registered fields of from into to; the other members of 
+ * to are already a copy of from's.
+ */
+
+  to->Num_Fields = 0;
+  to->Fields = NULL;
+  to->Field_Len = NULL;
+
+  if (from->Num_Fields > 0) {
+    to->Fields = (ZOLTAN_COMM_FIELD *) ZOLTAN_MALLOC(from->Num_Fields *
+                                                     sizeof(ZOLTAN_COMM_FIELD));
+    to->Field_Len = (int *) ZOLTAN_MALLOC(from->Num_Fields * sizeof(int));
+    if (to->Fields == NULL || to->Field_Len == NULL) {
+      Zoltan_Migrate_Free_Fields(to);
+      return ZOLTAN_MEMERR;
+    }
+    memcpy(to->Fields, from->Fields, 
+           from->Num_Fields * sizeof(ZOLTAN_COMM_FIELD));
+    memcpy(to->Field_Len, from->Field_Len, from->Num_Fields * sizeof(int));
+    to->Num_Fields = from->Num_Fields;
+  }
+
+  return ZOLTAN_OK;
+}
+
+/****************************************************************************/
+
+void Zoltan_Migrate_Free_Fields(struct Zoltan_Migrate_Struct *mig)
+{
+  ZOLTAN_FREE(&(mig->Fields));
+  ZOLTAN_FREE(&(mig->Field_Len));
+  mig->Num_Fields = 0;
+}
+
+/****************************************************************************/
+
+static int migrate_fields(
+  ZZ *zz,
+  ZOLTAN_COMM_OBJ *plan,   /* Plan built from the actual exports.           */
+  int num_exp,             /* Number of objects actually exported.          */
+  ZOLTAN_ID_PTR exp_lids,  /* Their local IDs, i.e., rows in the sources.   */
+  int num_imp              /* Number of objects actually imported.          */
+)
+{
+/*
+ *  Move the registered fields along the plan.  All processors return the
+ *  same error code.
+ */
+
+char *yo = "migrate_fields";
+struct Zoltan_Migrate_Struct *mig = &(zz->Migrate);
+int *rows = NULL;        /* source rows of the exported objects */
+int loc_err = ZOLTAN_OK, glob_err;
+int i;
+int ierr;
+
+  for (i = 0; i < mig->Num_Fields; i++) {
+    if (mig->Fields[i].size > 0 && mig->Field_Len[i] < num_imp) {
+      ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Destination array of a field is "
+                         "too short for the imported objects.");
+      loc_err = ZOLTAN_FATAL;
+    }
+  }
+
+  if (num_exp > 0) {
+    rows = (int *) ZOLTAN_MALLOC(num_exp * sizeof(int));
+    if (rows == NULL) {
+      ZOLTAN_PRINT_ERROR(zz->Proc, yo, "Memory error.");
+      loc_err = ZOLTAN_MEMERR;
+    }
+    else
+      for (i = 0; i < num_exp; i++)
+        rows[i] = (int) exp_lids[i];
+  }
+
+  /* Errors are negative; agree on the worst one before communicating */
+  MPI_Allreduce(&loc_err, &glob_err, 1, MPI_INT, MPI_MIN, zz->Communicator);
+  if (glob_err < 0) {
+    ZOLTAN_FREE(&rows);
+    return glob_err;
+  }
+
+  ierr = Zoltan_Comm_Do_Fields(plan, 32765, mig->Num_Fields, mig->Fields,
+                               rows);
+  ZOLTAN_FREE(&rows);
+  return ierr;
+}
+
 /****************************************************************************/
 #ifdef __cplusplus
 } /* closing bracket for extern "C" */
@@ -60,9 +60,18 @@ extern "C" {
 #include "par_average_const.h"
 #include "zoltan_timer.h"
 #include "zz_const.h"
+#include "zz_util_const.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define TINY   1.0e-6
 
+/* Number of active dots scanned by each thread task.  The sums of a threaded
+   scan are merged block by block, so with non-integer weights they may differ
+   in the last bits from the sums of the serial scan, and cuts may move. */
+#define MEDIAN_BLOCK 8192
+
 /*#define WATCH_MEDIAN_FIND*/
 
 /* Data structure for parallel find median routine */
@@ -75,6 +84,13 @@ struct median {          /* median cut info */
   int       proclo, prochi;     /* unique proc who owns a nearest dot */
 };
 
+static void median_scan(int, double *, double *, int *, int *, double,
+  struct median *, int *, int *);
+#ifdef _OPENMP
+static void median_scan_merge(struct median *, int, int, struct median *,
+  int *, int *);
+#endif
+
 
 /************ R O U T I N E S   I N   T H I S   F I L E  **********************
 
@@ -120,10 +136,13 @@ int Zoltan_RB_find_median(
   double *wgthi,        /* weight of upper partition (output) */
   int    *dotlist,      /* list of active dots */
   int rectilinear_blocks,/*if set all dots with same value on same side of cut*/
-  int average_cuts      /* force cut to be halfway between two closest dots. */
+  int average_cuts,     /* force cut to be halfway between two closest dots. */
+  int num_threads       /* threads scanning local dots (OpenMP builds);
+                           0 for the OpenMP default                          */
 )
 {
 /* Local declarations. */
+  char   *yo = "Zoltan_RB_find_median";
   struct median med, medme;          /* median data */
 
 
@@ -134,6 +153,13 @@ int Zoltan_RB_find_median(
   double  tmp_half = 0.0;
   double  tmp_wgt;
   double *w;
+  double *val = NULL;                /* coordinates of active dots */
+  double *wgt = NULL;                /* weights of active dots */
+  struct median *blockmed = NULL;    /* median data of each block of dots */
+  int    *blockidx = NULL;           /* indexlo/hi of each block of dots */
+#ifdef _OPENMP
+  int     b, nblocks;
+#endif
 
   int     i, j, k, numlist;
   int     first_iteration;
@@ -166,6 +192,31 @@ int Zoltan_RB_find_median(
 
 /***************************** BEGIN EXECUTION ******************************/
 
+  /* active dots are kept packed, in the order of dotlist, so that each
+     iteration scans contiguous arrays */
+  if (dotnum > 0) {
+    val = (double *) ZOLTAN_MALLOC(2 * dotnum * sizeof(double));
+    if (val == NULL) {
+      ZOLTAN_PRINT_ERROR(proc, yo, "Insufficient memory.");
+      return 0;
+    }
+    wgt = val + dotnum;
+  }
+
+#ifdef _OPENMP
+  num_threads = Zoltan_Num_Threads(num_threads);
+  if (num_threads > 1 && dotnum > MEDIAN_BLOCK) {
+    nblocks = (dotnum + MEDIAN_BLOCK - 1) / MEDIAN_BLOCK;
+    blockmed = (struct median *) ZOLTAN_MALLOC(nblocks * sizeof(struct median));
+    blockidx = (int *) ZOLTAN_MALLOC(2 * nblocks * sizeof(int));
+    if (blockmed == NULL || blockidx == NULL) {
+      ZOLTAN_PRINT_ERROR(proc, yo, "Insufficient memory.");
+      Zoltan_Multifree(__FILE__, __LINE__, 3, &val, &blockmed, &blockidx);
+      return 0;
+    }
+  }
+#endif
+
   /* create MPI data and function types for box and median */
 
   MPI_Type_contiguous(sizeof(struct median),MPI_CHAR,&med_type);
@@ -189,6 +240,8 @@ int Zoltan_RB_find_median(
   w = wgts;                     /* we use 1st weight only */
   for (i = 0; i < dotnum;i++) {
     dotlist[i] = i;
+    val[i] = dots[i];
+    wgt[i] = (wgts ? wgts[i*wgtflag] : uniformWeight);
     if (wgtflag){
       if (*w > wtmax) wtmax = *w;
       w += wgtflag;
@@ -288,38 +341,26 @@ int Zoltan_RB_find_median(
       /* also set all fields in median data struct */
       /* save indices of closest dots on either side */
 
-      for (j = 0; j < numlist; j++) {
-        i = dotlist[j];
-        tmp_wgt = (wgts ? wgts[i*wgtflag] : uniformWeight);
-        if (dots[i] <= tmp_half) {            /* in lower part */
-          medme.totallo += tmp_wgt;
-          dotmark[i] = 0;
-          if (dots[i] > medme.valuelo) {       /* my closest dot */
-            medme.valuelo = dots[i];
-            medme.wtlo = tmp_wgt;
-            medme.countlo = 1;
-            indexlo = i;
-          }                                            /* tied for closest */
-          else if (dots[i] == medme.valuelo) {
-            medme.wtlo += tmp_wgt;
-            medme.countlo++;
-          }
-        }
-        else {                                         /* in upper part */
-          medme.totalhi += tmp_wgt;
-          dotmark[i] = 1;
-          if (dots[i] < medme.valuehi) {       /* my closest dot */
-            medme.valuehi = dots[i];
-            medme.wthi = tmp_wgt;
-            medme.counthi = 1;
-            indexhi = i;
-          }                                            /* tied for closest */
-          else if (dots[i] == medme.valuehi) {
-            medme.wthi += tmp_wgt;
-            medme.counthi++;
-          }
+#ifdef _OPENMP
+      if (blockmed != NULL && numlist > MEDIAN_BLOCK) {
+        nblocks = (numlist + MEDIAN_BLOCK - 1) / MEDIAN_BLOCK;
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+        for (b = 0; b < nblocks; b++) {
+          int first = b * MEDIAN_BLOCK;
+          int n = (numlist - first < MEDIAN_BLOCK) ? numlist - first
+                                                   : MEDIAN_BLOCK;
+          median_scan(n, val + first, wgt + first, dotlist + first, dotmark,
+                      tmp_half, &blockmed[b], &blockidx[2*b],
+                      &blockidx[2*b+1]);
         }
+        for (b = 0; b < nblocks; b++)
+          median_scan_merge(&blockmed[b], blockidx[2*b], blockidx[2*b+1],
+                            &medme, &indexlo, &indexhi);
       }
+      else
+#endif
+        median_scan(numlist, val, wgt, dotlist, dotmark, tmp_half,
+                    &medme, &indexlo, &indexhi);
 
       med.totallo = med.totalhi = 0.0;
       med.valuelo = -DBL_MAX;
@@ -526,7 +567,12 @@ if (proc==0) printf("%d tmp_half %.20f weightlo/hi %.0f %.0f valuemin/max %.20f
       k = 0;
       for (j = 0; j < numlist; j++) {
         i = dotlist[j];
-        if (dotmark[i] == markactive) dotlist[k++] = i;
+        if (dotmark[i] == markactive) {
+          dotlist[k] = i;
+          val[k] = val[j];
+          wgt[k] = wgt[j];
+          k++;
+        }
       }
       numlist = k;
     }
@@ -557,6 +603,8 @@ if (proc==0) printf("FINAL tmp_half %.20f weightlo/hi %.0f %.0f valuemin/max %.2
   if (!Tflops_Special)
      MPI_Op_free(&med_op);
 
+  Zoltan_Multifree(__FILE__, __LINE__, 3, &val, &blockmed, &blockidx);
+
 #ifdef WATCH_MEDIAN_FIND
   if ((num_procs>1) && (rank==0)){
     fprintf(stderr,"%s loop count %d interval size %d median (%lf - %lf) %lf\n",
@@ -569,6 +617,97 @@ if (proc==0) printf("FINAL tmp_half %.20f weightlo/hi %.0f %.0f valuemin/max %.2
   return 1;
 }
 
+/* scan n active dots with coordinates val and weights wgt against cut:
+   mark them in dotmark, and set the fields of med other than proclo/prochi,
+   with indexlo/hi the first of the nearest dots on either side.
+   The first loop has no branches so that compilers can vectorize the
+   comparisons; sums are accumulated in the order of the dots.             */
+static void median_scan(
+  int n,
+  double *val,
+  double *wgt,
+  int *list,
+  int *dotmark,
+  double cut,
+  struct median *med,
+  int *indexlo,
+  int *indexhi
+)
+{
+  double totallo = 0.0, totalhi = 0.0;
+  double valuelo = -DBL_MAX, valuehi = DBL_MAX;
+  double wtlo = 0.0, wthi = 0.0;
+  ZOLTAN_GNO_TYPE countlo = 0, counthi = 0;
+  int j, lo;
+
+  for (j = 0; j < n; j++) {
+    lo = (val[j] <= cut);
+    dotmark[list[j]] = !lo;
+    totallo += (lo ? wgt[j] : 0.0);
+    totalhi += (lo ? 0.0 : wgt[j]);
+    valuelo = ((lo && val[j] > valuelo) ? val[j] : valuelo);
+    valuehi = ((!lo && val[j] < valuehi) ? val[j] : valuehi);
+  }
+
+  for (j = 0; j < n; j++) {
+    if (val[j] == valuelo) {
+      if (countlo++ == 0) *indexlo = list[j];
+      wtlo += wgt[j];
+    }
+    else if (val[j] == valuehi) {
+      if (counthi++ == 0) *indexhi = list[j];
+      wthi += wgt[j];
+    }
+  }
+
+  med->totallo = totallo;
+  med->totalhi = totalhi;
+  med->valuelo = valuelo;
+  med->valuehi = valuehi;
+  med->wtlo = wtlo;
+  med->wthi = wthi;
+  med->countlo = countlo;
+  med->counthi = counthi;
+}
+
+#ifdef _OPENMP
+/* merge the median data of a block of dots into that of the previous blocks,
+   keeping the indices of the first nearest dots as the serial scan does */
+static void median_scan_merge(
+  struct median *in,
+  int inlo,
+  int inhi,
+  struct median *inout,
+  int *indexlo,
+  int *indexhi
+)
+{
+  inout->totallo += in->totallo;
+  if (in->valuelo > inout->valuelo) {
+    inout->valuelo = in->valuelo;
+    inout->wtlo = in->wtlo;
+    inout->countlo = in->countlo;
+    *indexlo = inlo;
+  }
+  else if (in->valuelo == inout->valuelo) {
+    inout->wtlo += in->wtlo;
+    inout->countlo += in->countlo;
+  }
+
+  inout->totalhi += in->totalhi;
+  if (in->valuehi < inout->valuehi) {
+    inout->valuehi = in->valuehi;
+    inout->wthi = in->wthi;
+    inout->counthi = in->counthi;
+    *indexhi = inhi;
+  }
+  else if (in->valuehi == inout->valuehi) {
+    inout->wthi += in->wthi;
+    inout->counthi += in->counthi;
+  }
+}
+#endif /* _OPENMP */
+
 /* merge median data structure */
 /* on input:
    in,inout->totallo, totalhi = weight in both partitions on this proc
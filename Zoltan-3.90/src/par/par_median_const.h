@@ -59,7 +59,7 @@ extern int Zoltan_RB_find_median(int, double *, double *, double, int *,
   int, int, double*, MPI_Comm,
   double *, int, int, int,
   int, int, int, double, double, double,
-  double *, double *, int *, int, int);
+  double *, double *, int *, int, int, int);
 
 extern int Zoltan_RB_find_median_randomized(int, double *, double *, double, int *,
   int, int, double*, MPI_Comm,
@@ -86,6 +86,7 @@ static PARAM_VARS Key_params[] = {
   { "REMAP", NULL, "INT", 0 },
   { "SEED", NULL, "INT", 0 },
   { "LB_APPROACH", NULL, "STRING", 0 },
+  { "MEMORY_ARENA", NULL, "INT", 0 },
   { NULL, NULL, NULL, 0 } };
 /*****************************************************************************/
 /*****************************************************************************/
@@ -370,6 +371,22 @@ int  idx 			/* index of vector param, -1 if scalar */
         status = 3;
         break;
 
+      case 22:          /* Memory_Arena */
+        if (result.def)
+            result.ival = ZOLTAN_MEMORY_ARENA_DEF;
+        if (result.ival < 0) {
+            sprintf(msg, "Invalid Memory_Arena value (%d) "
+                "being set to %d.", result.ival, ZOLTAN_MEMORY_ARENA_DEF);
+            ZOLTAN_PRINT_WARN(zz->Proc, yo, msg);
+            result.ival = ZOLTAN_MEMORY_ARENA_DEF;
+        }
+        if (result.ival != zz->Memory_Arena_Size)
+            /* New chunk size; chunks in use are released once freed. */
+            Zoltan_Memory_Arena_Destroy(&(zz->Memory_Arena));
+        zz->Memory_Arena_Size = result.ival;
+        status = 3;
+        break;
+
       }  /* end switch (index) */
     }
 
@@ -444,6 +461,9 @@ void Zoltan_Print_Key_Params(ZZ const *zz)
          Zoltan_Seed(), Zoltan_Seed());
   printf("ZOLTAN Parameter %s = %s\n", Key_params[21].name, 
          zz->LB.Approach);
+  if (zz->Memory_Arena_Size)   /* print only if set */
+     printf("ZOLTAN Parameter %s = %d\n", Key_params[22].name,
+            zz->Memory_Arena_Size);
 }
 /*****************************************************************************/
 /*****************************************************************************/
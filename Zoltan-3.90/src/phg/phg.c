@@ -694,6 +694,8 @@ int Zoltan_PHG_Initialize_Params(
                                 &hgp->refinement_quality);  
   Zoltan_Bind_Param(PHG_params, "PHG_COARSEPARTITION_METHOD", 
                                  hgp->coarsepartition_str);
+  Zoltan_Bind_Param(PHG_params, "PHG_COARSEPARTITION_TRIES", 
+                                 (void*) &hgp->CoarsePartitionTries);
   Zoltan_Bind_Param(PHG_params, "PHG_USE_TIMERS",
                                  (void*) &hgp->use_timers);  
   Zoltan_Bind_Param(PHG_params, "USE_TIMERS",
@@ -702,6 +704,10 @@ int Zoltan_PHG_Initialize_Params(
                                  (void*) &hgp->EdgeSizeThreshold);  
   Zoltan_Bind_Param(PHG_params, "PHG_MATCH_EDGE_SIZE_THRESHOLD",
                                  (void*) &hgp->MatchEdgeSizeThreshold);  
+  Zoltan_Bind_Param(PHG_params, "PHG_MATCH_COMPACT_LAYOUT",
+                                 (void*) &hgp->MatchCompactLayout);  
+  Zoltan_Bind_Param(PHG_params, "PHG_NUM_THREADS",
+                                 (void*) &hgp->nThreads);  
   Zoltan_Bind_Param(PHG_params, "PHG_BAL_TOL_ADJUSTMENT",
                                  (void*) &hgp->bal_tol_adjustment);  
   Zoltan_Bind_Param(PHG_params, "PARKWAY_SERPART",
@@ -749,6 +755,7 @@ int Zoltan_PHG_Initialize_Params(
 
   hgp->use_timers = 0;
   hgp->LocalCoarsePartition = 0;
+  hgp->CoarsePartitionTries = 0;
   hgp->edge_scaling = 0;
   hgp->vtx_scaling = 0;
   hgp->vtx_scal_size = 0;
@@ -775,6 +782,8 @@ int Zoltan_PHG_Initialize_Params(
   hgp->RandomizeInitDist = 0;
   hgp->EdgeSizeThreshold = 0.25;
   hgp->MatchEdgeSizeThreshold = 500;  
+  hgp->MatchCompactLayout = 0;
+  hgp->nThreads = 1;
   hgp->hybrid_keep_factor = 0.;
   hgp->ProRedL = 0.0; /* UVCUVC: CHECK default set to 0 until we run more experiments */
   hgp->RepartMultiplier = 100.;
@@ -129,6 +129,9 @@ struct PHGPartParamsStruct {
                                          /* Coarse partitioning string */
   ZOLTAN_PHG_COARSEPARTITION_FN *CoarsePartition;
                                          /* pointer to coarse partitioning fn */
+  int CoarsePartitionTries;            /* Total no. of coarse partitioning
+                                          tries spread over the processors;
+                                          0 -> 1 + 9/p tries per processor. */
   char refinement_str[MAX_PARAM_STRING_LEN]; /* Refinement string and */
   ZOLTAN_PHG_REFINEMENT_FN *Refinement;      /* pointer to refinement fn */
 
@@ -165,6 +168,10 @@ struct PHGPartParamsStruct {
                                considered to be dense. */
   ZOLTAN_GNO_TYPE MatchEdgeSizeThreshold;  /* Edges with sizes bigger than this threshold
                                considered to be dense for matching and ignored. */
+  int MatchCompactLayout;   /* Use compact local hypergraph layout in ipm
+                               inner products (PHG_MATCH_COMPACT_LAYOUT). */
+  int nThreads;             /* Threads per process in ipm matching and
+                               coarsening; 0 for OpenMP default. */
   float hybrid_keep_factor; /* h-ipm only: keep matches with i.p. values
                                greater than this factor times the mean */
   char parkway_serpart[MAX_PARAM_STRING_LEN];  /* SerialPartitioner for parKway. */
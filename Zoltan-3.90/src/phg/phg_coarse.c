@@ -52,6 +52,9 @@ extern "C" {
 #include "phg.h"
 #include "zoltan_comm.h"
 #include "zz_util_const.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 #define PLAN_TAG 32010      /* tag for comm plan */ 
@@ -113,7 +116,7 @@ int Zoltan_PHG_Coarsening
   char     *yo = "Zoltan_PHG_Coarsening";
   PHGComm  *hgc = hg->comm;
   int   ierr=ZOLTAN_OK, i, j, count, size, me=hgc->myProc_x, idx, ni;
-  int   *vmark=NULL, *listlno=NULL, *listproc=NULL, *ip=NULL;
+  int   *vmark=NULL, *tmark=NULL, nthreads=1, *listlno=NULL, *listproc=NULL, *ip=NULL;
   int   *ahindex=NULL, *hlsize=NULL, *hsize=NULL, *ids=NULL, *iden;
   int   *emptynets=NULL, emptynetsize, *idennets=NULL, *allemptynets=NULL, *allidennets=NULL,
 #ifdef _DEBUG1
@@ -561,31 +564,86 @@ int Zoltan_PHG_Coarsening
   if (c_hg->nPins>0 && !(c_hg->hvertex = (int*)ZOLTAN_MALLOC (c_hg->nPins*sizeof(int))))
       MEMORY_ERROR;
 
-  memset(vmark, 0xff, sizeof(int)*c_hg->nVtx);
-  idx = 0;
-  for (i=0; i < hg->nEdge; ++i) { /* loop over edges */
-      int sidx=idx;
-      c_hg->hindex[i] = idx;
-      /* first go over local vertices */
-      for (j=hg->hindex[i]; j<hg->hindex[i+1]; ++j) {
-          int nvno=(int)LevelMap[hg->hvertex[j]];
-          if (nvno>=0 && vmark[nvno]!=i) {
-              c_hg->hvertex[idx++] = (int)nvno;
-              vmark[nvno] = i;
+  nthreads = (hg->nEdge > 1) ? Zoltan_Num_Threads(hgp->nThreads) : 1;
+  if (nthreads > 1 && c_hg->nVtx > 0
+   && !(tmark = (int*) ZOLTAN_MALLOC((nthreads-1) * c_hg->nVtx * sizeof(int))))
+      nthreads = 1;     /* not enough memory for the thread marks; go serial */
+
+  if (nthreads > 1) {
+      /* Each edge is merged in place at its upper bound slot
+         hg->hindex[i]+ahindex[i], so threads never overlap; the edges are
+         then compacted serially. Same pins and order as the serial code. */
+      memset(vmark, 0xff, sizeof(int)*c_hg->nVtx);
+      if (tmark)
+          memset(tmark, 0xff, (nthreads-1) * c_hg->nVtx * sizeof(int));
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) private(i, j, idx)
+#endif
+      {
+      int *mark = vmark;
+#ifdef _OPENMP
+      if (omp_get_thread_num() > 0)
+          mark = tmark + (omp_get_thread_num()-1) * c_hg->nVtx;
+#pragma omp for schedule(dynamic, 64)
+#endif
+      for (i=0; i < hg->nEdge; ++i) {
+          int sidx = idx = hg->hindex[i] + ahindex[i];
+          for (j=hg->hindex[i]; j<hg->hindex[i+1]; ++j) {
+              int nvno=(int)LevelMap[hg->hvertex[j]];
+              if (nvno>=0 && mark[nvno]!=i) {
+                  c_hg->hvertex[idx++] = (int)nvno;
+                  mark[nvno] = i;
+              }
           }
-      }
-      /* now go over the received vertices */
-      for (j=ahindex[i]; j<ahindex[i+1]; ++j) {
-          int nvno= (int)LevelMap[ahvertex[j]];
-          if (nvno>=0 && vmark[nvno]!=i) {
-              c_hg->hvertex[idx++] = (int)nvno; 
-              vmark[nvno] = i;
+          for (j=ahindex[i]; j<ahindex[i+1]; ++j) {
+              int nvno= (int)LevelMap[ahvertex[j]];
+              if (nvno>=0 && mark[nvno]!=i) {
+                  c_hg->hvertex[idx++] = (int)nvno;
+                  mark[nvno] = i;
+              }
           }
-      }          
-      /* in qsort start and end indices are inclusive */
-      Zoltan_quicksort_list_inc_one_int(&c_hg->hvertex[sidx], 0, idx-sidx-1);
+          Zoltan_quicksort_list_inc_one_int(&c_hg->hvertex[sidx], 0, idx-sidx-1);
+          c_hg->hindex[i] = idx - sidx;  /* size for now */
+      }
+      }
+      idx = 0;
+      for (i=0; i < hg->nEdge; ++i) {
+          int n = c_hg->hindex[i], sidx = hg->hindex[i] + ahindex[i];
+          if (n && sidx != idx)
+              memmove(&c_hg->hvertex[idx], &c_hg->hvertex[sidx], n * sizeof(int));
+          c_hg->hindex[i] = idx;
+          idx += n;
+      }
+      c_hg->hindex[hg->nEdge] = c_hg->nPins = idx;
+      ZOLTAN_FREE(&tmark);
+  }
+  else {
+    memset(vmark, 0xff, sizeof(int)*c_hg->nVtx);
+    idx = 0;
+    for (i=0; i < hg->nEdge; ++i) { /* loop over edges */
+        int sidx=idx;
+        c_hg->hindex[i] = idx;
+        /* first go over local vertices */
+        for (j=hg->hindex[i]; j<hg->hindex[i+1]; ++j) {
+            int nvno=(int)LevelMap[hg->hvertex[j]];
+            if (nvno>=0 && vmark[nvno]!=i) {
+                c_hg->hvertex[idx++] = (int)nvno;
+                vmark[nvno] = i;
+            }
+        }
+        /* now go over the received vertices */
+        for (j=ahindex[i]; j<ahindex[i+1]; ++j) {
+            int nvno= (int)LevelMap[ahvertex[j]];
+            if (nvno>=0 && vmark[nvno]!=i) {
+                c_hg->hvertex[idx++] = (int)nvno; 
+                vmark[nvno] = i;
+            }
+        }          
+        /* in qsort start and end indices are inclusive */
+        Zoltan_quicksort_list_inc_one_int(&c_hg->hvertex[sidx], 0, idx-sidx-1);
+    }
+    c_hg->hindex[hg->nEdge] = c_hg->nPins = idx;
   }
-  c_hg->hindex[hg->nEdge] = c_hg->nPins = idx;
 
   if (time_details) {
     ZOLTAN_TIMER_STOP(zz->ZTime, timer->comerge, hgc->Communicator);
@@ -598,6 +656,9 @@ int Zoltan_PHG_Coarsening
   t_redhash = -t_cur;
 #endif
 
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static) if (nthreads > 1)
+#endif
   for (i=0; i < c_hg->nEdge; ++i) { /* compute size and hashvalue */
     hlsize[i] = c_hg->hindex[i+1]-c_hg->hindex[i];
     lhash[i] = hashValue(hg, hlsize[i], (int *)&c_hg->hvertex[c_hg->hindex[i]]);
@@ -51,6 +51,9 @@ extern "C" {
 #endif
 
 #include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "phg.h"
 #include "g2l_hash.h"
 #include "zz_util_const.h"
@@ -640,6 +643,326 @@ static int communication_by_plan (ZZ* zz, int sendcnt, int* dest, int* size,
 
 
 
+/* Compact layout of the local hypergraph for the inner products of
+ * pmatching_ipm, used if PHG_MATCH_COMPACT_LAYOUT is set. Hyperedges ignored
+ * by matching (too large, or not positive weight) are dropped, the pin lists
+ * of the others are packed in the order their edges are first reached from
+ * the vertices, and the weights the kernel needs are kept in flat arrays.
+ * Locked (already or pending matched) vertices have a zero scale, so that
+ * the kernel does not test cmatch[]. Edges are numbered as in hg, and pins
+ * stay in hvertex order, so inner products and matches are unchanged.     */
+typedef struct {
+  int   *start;   /* nEdge long, offset of edge pins in pin[] */
+  int   *len;     /* nEdge long, no. of pins; 0 if edge ignored by matching */
+  float *wgt;     /* nEdge long, edge weight used in inner products */
+  float *vscal;   /* nVtx long, vertex scale; 0.0 if vertex is locked */
+  int   *pin;     /* pins of the edges not ignored by matching */
+} PHGIpmLayout;
+
+static void ipm_layout_free (PHGIpmLayout *lay)
+{
+  Zoltan_Multifree (__FILE__, __LINE__, 5, &lay->start, &lay->len, &lay->wgt,
+   &lay->vscal, &lay->pin);
+}
+
+static int ipm_layout_build (ZZ *zz, HGraph *hg, PHGPartParams *hgp,
+  PHGIpmLayout *lay)
+{
+  int i, j, edge, npin;
+  int ierr = ZOLTAN_OK;
+  char *yo = "ipm_layout_build";
+
+  lay->start = lay->len = lay->pin = NULL;
+  lay->wgt = lay->vscal = NULL;
+  if ((hg->nEdge && (!(lay->start = (int*)   ZOLTAN_MALLOC (hg->nEdge * sizeof(int)))
+                  || !(lay->len   = (int*)   ZOLTAN_MALLOC (hg->nEdge * sizeof(int)))
+                  || !(lay->wgt   = (float*) ZOLTAN_MALLOC (hg->nEdge * sizeof(float)))))
+   || (hg->nVtx  &&  !(lay->vscal = (float*) ZOLTAN_MALLOC (hg->nVtx  * sizeof(float))))
+   || (hg->nPins &&  !(lay->pin   = (int*)   ZOLTAN_MALLOC (hg->nPins * sizeof(int)))))
+      MEMORY_ERROR;
+
+  for (edge = 0; edge < hg->nEdge; edge++) {
+    lay->wgt[edge] = (hg->ewgt != NULL) ? hg->ewgt[edge] : 1.0;
+    lay->len[edge] = -1;                              /* not yet packed */
+    if ((lay->wgt[edge] <= 0.0)
+     || (hg->esize[edge] >= hgp->MatchEdgeSizeThreshold))
+      lay->len[edge] = lay->start[edge] = 0;          /* ignored edge */
+  }
+
+  /* pack pins, edges of the same vertex being stored next to each other */
+  npin = 0;
+  for (i = 0; i < hg->nVtx; i++)
+    for (j = hg->vindex[i]; j < hg->vindex[i+1]; j++) {
+      edge = hg->vedge[j];
+      if (lay->len[edge] == -1) {
+        lay->start[edge] = npin;
+        lay->len[edge]   = hg->hindex[edge+1] - hg->hindex[edge];
+        memcpy (lay->pin + npin, hg->hvertex + hg->hindex[edge],
+         lay->len[edge] * sizeof(int));
+        npin += lay->len[edge];
+      }
+    }
+  for (edge = 0; edge < hg->nEdge; edge++)    /* edges without local pins */
+    if (lay->len[edge] == -1)
+      lay->len[edge] = lay->start[edge] = 0;
+
+End:
+  if (ierr != ZOLTAN_OK)
+    ipm_layout_free (lay);
+  return ierr;
+}
+
+/* Set vertex scales from the current locks in cmatch */
+static void ipm_layout_lock (HGraph *hg, PHGPartParams *hgp, PHGIpmLayout *lay,
+  ZOLTAN_GNO_TYPE *cmatch)
+{
+  int i;
+
+  for (i = 0; i < hg->nVtx; i++)
+    if (cmatch[i] != i)
+      lay->vscal[i] = 0.0;
+    else
+      lay->vscal[i] = (hgp->vtx_scal != NULL) ? hgp->vtx_scal[i] : 1.0;
+}
+
+/* Inner products of one candidate, whose count edges are in edges[], with
+ * all local vertices. Same as INNER_PRODUCT1 and INNER_PRODUCT2, but the
+ * pin loop has no branch: locked vertices add 0.0 and are not indexed.   */
+static int ipm_layout_products (PHGIpmLayout *lay, int *edges, int count,
+  float *sums, int *index, int m)
+{
+  int i, vtx, *pin, *pinend;
+  float w, f;
+
+  for (i = 0; i < count; i++) {
+    w      = lay->wgt[edges[i]];
+    pin    = lay->pin + lay->start[edges[i]];
+    pinend = pin + lay->len[edges[i]];
+    for (; pin < pinend; pin++) {
+      vtx = *pin;
+      f   = lay->vscal[vtx];
+      index[m] = vtx;
+      m += (sums[vtx] == 0.0) & (f > 0.0);
+      sums[vtx] += w * f;
+    }
+  }
+  return m;
+}
+
+
+/* Local inner products of one candidate with all local vertices, into
+ * sums[]; the m vertices with a nonzero product are listed in index[]. For
+ * c-ipm candidate_gno is a local vertex, else intptr lists its count edges. */
+static int ipm_products (HGraph *hg, PHGPartParams *hgp, PHGIpmLayout *lay,
+  ZOLTAN_GNO_TYPE *cmatch, int cFLAG, ZOLTAN_GNO_TYPE candidate_gno,
+  int *intptr, int count, float *sums, int *index)
+{
+  int i, j = 0, m = 0, edge;
+
+  if (lay != NULL) {
+    if (!cFLAG)
+      m = ipm_layout_products (lay, intptr, count, sums, index, m);
+    else
+      m = ipm_layout_products (lay, hg->vedge + hg->vindex[candidate_gno],
+       hg->vindex[candidate_gno+1] - hg->vindex[candidate_gno],
+       sums, index, m);
+  }
+  else if (!cFLAG) {
+    if ((hg->ewgt != NULL) && (hgp->vtx_scal == NULL)){
+      INNER_PRODUCT1(hg->ewgt[*intptr])
+    }
+    else if ((hg->ewgt == NULL) && (hgp->vtx_scal == NULL)){
+      INNER_PRODUCT1(1.0)
+    }
+    else if ((hg->ewgt != NULL) && (hgp->vtx_scal != NULL)){
+      INNER_PRODUCT1(hgp->vtx_scal[hg->hvertex[j]] * hg->ewgt[*intptr])
+    }
+    else {/* UVC: no need: if ((hg->ewgt == NULL) && (hgp->vtx_scal != NULL)) */
+      INNER_PRODUCT1(hgp->vtx_scal[hg->hvertex[j]])
+    }
+  } else   {                                            /* cFLAG */
+    if      ((hg->ewgt == NULL) && (hgp->vtx_scal == NULL))
+      INNER_PRODUCT2(1.0)
+    else if ((hg->ewgt == NULL) && (hgp->vtx_scal != NULL))
+      INNER_PRODUCT2(hgp->vtx_scal[hg->hvertex[j]])
+    else if ((hg->ewgt != NULL) && (hgp->vtx_scal == NULL))
+      INNER_PRODUCT2(hg->ewgt[edge])
+    else if ((hg->ewgt != NULL) && (hgp->vtx_scal != NULL))
+      INNER_PRODUCT2(hgp->vtx_scal[hg->hvertex[j]] * hg->ewgt[edge])
+  }
+  return m;
+}
+
+/* Keep the partial sums of one candidate worth sending: copies them to
+ * lno[] and psum[], returns their count and clears sums[].               */
+static int ipm_keep_products (HGraph *hg, PHGPartParams *hgp, int cFLAG,
+  ZOLTAN_GNO_TYPE candidate_gno, int pref, int m, float *sums, int *index,
+  int *lno, float *psum)
+{
+  int i, count = 0;
+
+  /* if local vtx, remove self inner product (useless maximum) */
+  if (cFLAG)
+    sums[candidate_gno] = 0.0;     /* since candidate_gno is really lno */
+  else if (VTX_TO_PROC_X(hg, candidate_gno) == hg->comm->myProc_x)
+    sums[VTX_GNO_TO_LNO(hg, candidate_gno)] = 0.0;
+
+  /* count partial sums exceeding PSUM_THRESHOLD */   
+  for (i = 0; i < m; i++)  {
+    if (sums[index[i]] > PSUM_THRESHOLD
+        && MATCH_OK(hgp, hg, hg->pref_part[index[i]], pref))  {
+      lno[count]    = index[i];    /* save lno for significant partial sum */
+      psum[count++] = sums[index[i]];
+    }
+    sums[index[i]] = 0.0;          /* clear all entries */
+  }
+  return count;
+}
+
+/* Candidate data from Phase 1: sets candidate_gno, candidate_index, pref
+ * and count, and returns the list of its count edges (not for c-ipm).    */
+static int *ipm_candidate (HGraph *hg, PHGPartParams *hgp, int cFLAG, int k,
+  int n, int *permute, char *edgebuf, intptr_t *gno_locs,
+  ZOLTAN_GNO_TYPE *candidate_gno, int *candidate_index, int *pref, int *count)
+{
+  ZOLTAN_GNO_TYPE *gnoptr;
+  int *intptr = NULL;
+
+  if (!cFLAG)  {
+    gnoptr = (ZOLTAN_GNO_TYPE *)(edgebuf + gno_locs[n]);
+    intptr = (int *)(gnoptr + 1);
+
+    *candidate_gno = *gnoptr;
+
+    *candidate_index = *intptr++;         /* candidate_index of vertex */
+    if (hgp->UsePrefPart)          
+        *pref = *intptr++;                /* pref vertex information */          
+    *count = *intptr++;                   /* count of following hyperedges */
+  }
+  else  {
+    *candidate_index = k;
+    *candidate_gno   = permute[k];  /* need to use next local vertex */
+
+    if (hgp->UsePrefPart)          
+        *pref = hg->pref_part[*candidate_gno];          
+  }                          /* here candidate_gno is really a local id */
+  return intptr;
+}
+
+
+/* Thread-parallel inner products (PHG_NUM_THREADS > 1). Batches of candidates
+ * are shared among threads, each with its own sums and index arrays, and the
+ * kept partial sums of each candidate are stored. Messages are then built in
+ * candidate order as in the serial code, so results do not depend on the
+ * number of threads. A candidate whose partial sums do not fit in its
+ * thread's store is left for the serial code.                              */
+#define IPM_THREAD_CHUNK 32   /* candidates per thread in a batch */
+
+typedef struct {
+  int    nthreads;
+  int    cap;      /* capacity of lno and psum per thread */
+  float *sums;     /* nthreads * nVtx long, zero outside products */
+  int   *index;    /* nthreads * (nVtx+1) long */
+  int   *lno;      /* nthreads * cap long, kept lnos of batch */
+  float *psum;     /* nthreads * cap long, kept partial sums of batch */
+  int   *cnt;      /* per candidate of batch: no. kept, -1 if not computed */
+  int   *off;      /* per candidate of batch: offset in lno and psum */
+  int    kb, nb;   /* batch is candidates kb to kb+nb-1 */
+} PHGIpmThreads;
+
+static int ipm_threads_init (ZZ *zz, HGraph *hg, int nthreads,
+  PHGIpmThreads *thr)
+{
+  int nb = nthreads * IPM_THREAD_CHUNK;
+  int ierr = ZOLTAN_OK;
+  char *yo = "ipm_threads_init";
+
+  thr->nthreads = nthreads;
+  thr->cap      = MAX (hg->nVtx, 1024);
+  thr->kb = thr->nb = 0;
+  thr->index = thr->lno = thr->cnt = thr->off = NULL;
+  thr->sums = thr->psum = NULL;
+  if (!(thr->sums  = (float*) ZOLTAN_CALLOC ((size_t) nthreads * hg->nVtx + 1,
+                                                            sizeof(float)))
+   || !(thr->index = (int*)   ZOLTAN_MALLOC ((size_t) nthreads * (hg->nVtx + 1)
+                                                          * sizeof(int)))
+   || !(thr->lno   = (int*)   ZOLTAN_MALLOC ((size_t) nthreads * thr->cap
+                                                          * sizeof(int)))
+   || !(thr->psum  = (float*) ZOLTAN_MALLOC ((size_t) nthreads * thr->cap
+                                                          * sizeof(float)))
+   || !(thr->cnt   = (int*)   ZOLTAN_MALLOC (nb * sizeof(int)))
+   || !(thr->off   = (int*)   ZOLTAN_MALLOC (nb * sizeof(int))))  {
+    Zoltan_Multifree (__FILE__, __LINE__, 6, &thr->sums, &thr->index,
+     &thr->lno, &thr->psum, &thr->cnt, &thr->off);
+    MEMORY_ERROR;
+  }
+
+End:
+  return ierr;
+}
+
+static void ipm_threads_free (PHGIpmThreads *thr)
+{
+  Zoltan_Multifree (__FILE__, __LINE__, 6, &thr->sums, &thr->index,
+   &thr->lno, &thr->psum, &thr->cnt, &thr->off);
+}
+
+/* Compute kept partial sums of candidates kb to kb+nb-1 */
+static void ipm_threads_products (HGraph *hg, PHGPartParams *hgp,
+  PHGIpmLayout *lay, ZOLTAN_GNO_TYPE *cmatch, int cFLAG, int *permute,
+  int *select, char *edgebuf, intptr_t *gno_locs, int kb, int nb,
+  PHGIpmThreads *thr)
+{
+  thr->kb = kb;
+  thr->nb = nb;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(thr->nthreads)
+#endif
+  {
+    ZOLTAN_GNO_TYPE candidate_gno = 0;
+    int candidate_index, pref = 0, count = 0, m, n, b, bend, used;
+    int t = 0, nt = 1, per;
+    int *edges;
+    float *sums;
+    int *index;
+
+#ifdef _OPENMP
+    t  = omp_get_thread_num();
+    nt = omp_get_num_threads();    /* may be less than thr->nthreads */
+#endif
+    sums  = thr->sums  + (size_t) t * hg->nVtx;
+    index = thr->index + (size_t) t * (hg->nVtx + 1);
+    used  = 0;
+    per   = (nb + nt - 1) / nt;
+    bend  = MIN (nb, (t + 1) * per);
+    for (b = t * per; b < bend; b++)  {
+      thr->cnt[b] = 0;
+      n = permute[select[kb + b]];
+      if (n == -1)
+        continue;                /* don't have this sparse candidate locally */
+
+      edges = ipm_candidate (hg, hgp, cFLAG, kb + b, n, permute, edgebuf,
+       gno_locs, &candidate_gno, &candidate_index, &pref, &count);
+      m = ipm_products (hg, hgp, lay, cmatch, cFLAG, candidate_gno, edges,
+       count, sums, index);
+
+      if (m > thr->cap - used)  {       /* may not fit, leave it to caller */
+        while (m > 0)
+          sums[index[--m]] = 0.0;
+        thr->cnt[b] = -1;
+        continue;
+      }
+      thr->off[b] = (int) ((size_t) t * thr->cap + used);
+      thr->cnt[b] = ipm_keep_products (hg, hgp, cFLAG, candidate_gno, pref, m,
+       sums, index, thr->lno + thr->off[b], thr->psum + thr->off[b]);
+      used += thr->cnt[b];
+    }
+  }
+}
+
+
+
 /* simple macro to start timer */
 #define MACRO_TIMER_START(arg, message, sync) \
   if (hgp->use_timers > 3)  {\
@@ -688,7 +1011,7 @@ static int pmatching_ipm (ZZ *zz,
   ZOLTAN_GNO_TYPE *match,
   PHGPartParams *hgp)
 {
-  int k, kstart, old_kstart, edge;
+  int k, kstart, old_kstart;
   int i, j = 0, n, m, round, vindex;                    /* loop counters  */
   int lno, bestlno, count = 0;                        /* temp variables */
   int nRounds;                /* # of matching rounds to be performed;       */
@@ -745,6 +1068,10 @@ static int pmatching_ipm (ZZ *zz,
   MPI_Datatype phasethreetype;
   int pref = 0, num_matches_considered = 0;
   double ipsum = 0.;
+  PHGIpmLayout layout, *lay = NULL;  /* compact layout, if requested */
+  PHGIpmThreads threads, *thr = NULL;  /* thread work space, if any */
+  int *klno;                  /* kept lnos of current candidate */
+  float *kpsum, *psum = NULL; /* kept partial sums of current candidate */
   struct phg_timer_indices *timer = Zoltan_PHG_LB_Data_timers(zz);
   char *yo = "pmatching_ipm";
   
@@ -799,7 +1126,8 @@ static int pmatching_ipm (ZZ *zz,
     if (!(cmatch = (ZOLTAN_GNO_TYPE*)   ZOLTAN_MALLOC (hg->nVtx * sizeof(ZOLTAN_GNO_TYPE)))
      || !(visit  = (int*)   ZOLTAN_MALLOC (hg->nVtx * sizeof(int)))
      || !(aux    = (int*)   ZOLTAN_MALLOC (hg->nVtx * sizeof(int)))     
-     || !(sums   = (float*) ZOLTAN_CALLOC (hg->nVtx,  sizeof(float))))
+     || !(sums   = (float*) ZOLTAN_CALLOC (hg->nVtx,  sizeof(float)))
+     || !(psum   = (float*) ZOLTAN_MALLOC (hg->nVtx * sizeof(float))))
         MEMORY_ERROR;
 
   if (!cFLAG && total_nCandidates && (hgc->myProc_y == 0)) {  /* Master row */
@@ -832,6 +1160,21 @@ static int pmatching_ipm (ZZ *zz,
   /* Compute candidates' vertex visit order (selection). Random is default. */
   Zoltan_PHG_Vertex_Visit_Order (zz, hg, hgp, visit);
 
+  if (hgp->MatchCompactLayout) {
+    lay = &layout;
+    if ((ierr = ipm_layout_build (zz, hg, hgp, lay)) != ZOLTAN_OK) {
+      lay = NULL;
+      goto End;
+    }
+  }
+  if (Zoltan_Num_Threads (hgp->nThreads) > 1 && hg->nVtx) {
+    thr = &threads;
+    if ((ierr = ipm_threads_init (zz, hg, Zoltan_Num_Threads
+     (hgp->nThreads), thr)) != ZOLTAN_OK) {
+      thr = NULL;
+      goto End;
+    }
+  }
   
   /* Loop processing ncandidates vertices per column each round.
    * Each loop has 3 phases, phase 3 may be repeated as necessary
@@ -967,6 +1310,9 @@ static int pmatching_ipm (ZZ *zz,
       }
     }            /* DONE:  if (cFLAG) else ...  */                          
 
+    if (lay != NULL)
+      ipm_layout_lock (hg, hgp, lay, cmatch);
+
 
     MACRO_TIMER_STOP (1);
     
@@ -985,78 +1331,38 @@ static int pmatching_ipm (ZZ *zz,
       sendcnt  = 0;                    /* count of messages in send buffer */
       s = sendbuf;
 
+      if (thr != NULL)
+        thr->kb = thr->nb = 0;       /* locks changed, drop computed batch */
+
       for (k = kstart; k < total_nCandidates; k++)  {
 
+        if (thr != NULL && k >= thr->kb + thr->nb)
+          ipm_threads_products (hg, hgp, lay, cmatch, cFLAG, permute, select,
+           edgebuf, gno_locs, k, MIN (total_nCandidates - k,
+           thr->nthreads * IPM_THREAD_CHUNK), thr);
+
         n = permute[select[k]];
 
         if (n == -1) 
           continue;                /* don't have this sparse candidate locally */
         
-        if (!cFLAG)  {
-
-          gnoptr = (ZOLTAN_GNO_TYPE *)(edgebuf + gno_locs[n]);
-          intptr = (int *)(gnoptr + 1);
-
-          candidate_gno = *gnoptr;
-
-          candidate_index = *intptr++;          /* candidate_index of vertex */
-          if (hgp->UsePrefPart)          
-              pref = *intptr++;                 /* pref vertex information */          
-          count           = *intptr++;          /* count of following hyperedges */
+        intptr = ipm_candidate (hg, hgp, cFLAG, k, n, permute, edgebuf,
+         gno_locs, &candidate_gno, &candidate_index, &pref, &count);
 
+        if (thr != NULL && thr->cnt[k - thr->kb] >= 0)  {
+          count = thr->cnt[k - thr->kb];     /* computed by threads */
+          klno  = thr->lno  + thr->off[k - thr->kb];
+          kpsum = thr->psum + thr->off[k - thr->kb];
         }
         else  {
-          candidate_index = k;
-          candidate_gno   = permute[k];  /* need to use next local vertex */
-
-          if (hgp->UsePrefPart)          
-              pref = hg->pref_part[candidate_gno];          
-        }                          /* here candidate_gno is really a local id */
-
-                  
-        /* now compute the row's nVtx inner products for kth candidate */
-        m = 0;
-        if (!cFLAG) {
-          if ((hg->ewgt != NULL) && (hgp->vtx_scal == NULL)){
-            INNER_PRODUCT1(hg->ewgt[*intptr])
-
-          }
-          else if ((hg->ewgt == NULL) && (hgp->vtx_scal == NULL)){
-            INNER_PRODUCT1(1.0)
-          }
-          else if ((hg->ewgt != NULL) && (hgp->vtx_scal != NULL)){
-            INNER_PRODUCT1(hgp->vtx_scal[hg->hvertex[j]] * hg->ewgt[*intptr])
-          }
-          else {/* UVC: no need: if ((hg->ewgt == NULL) && (hgp->vtx_scal != NULL)) */
-            INNER_PRODUCT1(hgp->vtx_scal[hg->hvertex[j]])
-          }
-        } else   {                                            /* cFLAG */
-          if      ((hg->ewgt == NULL) && (hgp->vtx_scal == NULL))
-            INNER_PRODUCT2(1.0)
-          else if ((hg->ewgt == NULL) && (hgp->vtx_scal != NULL))
-            INNER_PRODUCT2(hgp->vtx_scal[hg->hvertex[j]])
-          else if ((hg->ewgt != NULL) && (hgp->vtx_scal == NULL))
-            INNER_PRODUCT2(hg->ewgt[edge])
-          else if ((hg->ewgt != NULL) && (hgp->vtx_scal != NULL))
-            INNER_PRODUCT2(hgp->vtx_scal[hg->hvertex[j]] * hg->ewgt[edge])
+          /* now compute the row's nVtx inner products for kth candidate */
+          m = ipm_products (hg, hgp, lay, cmatch, cFLAG, candidate_gno, intptr,
+           count, sums, index);
+          count = ipm_keep_products (hg, hgp, cFLAG, candidate_gno, pref, m,
+           sums, index, aux, psum);
+          klno  = aux;
+          kpsum = psum;
         }
-          
-        /* if local vtx, remove self inner product (useless maximum) */
-        if (cFLAG)
-          sums[candidate_gno] = 0.0;     /* since candidate_gno is really lno */
-        else if (VTX_TO_PROC_X(hg, candidate_gno) == hgc->myProc_x)
-          sums[VTX_GNO_TO_LNO(hg, candidate_gno)] = 0.0;
-         
-        /* count partial sums exceeding PSUM_THRESHOLD */   
-        count = 0;
-        for (i = 0; i < m; i++)  {
-          lno = index[i];
-          if (sums[lno] > PSUM_THRESHOLD
-              && MATCH_OK(hgp, hg, hg->pref_part[lno], pref))
-            aux[count++] = lno;      /* save lno for significant partial sum */
-          else
-            sums[lno] = 0.0;         /* clear unwanted entries */  
-        }     
         if (count == 0)
           continue;         /* no partial sums to append to message */       
 
@@ -1096,19 +1402,15 @@ static int pmatching_ipm (ZZ *zz,
           *intptr++ = candidate_index;        
           *intptr++ = count;
           for (i = 0; i < count; i++)  {          
-            *intptr++ = aux[i];                   /* lno of partial sum */
+            *intptr++ = klno[i];                  /* lno of partial sum */
           }
           for (i = 0; i < count; i++)  {          
-            *floatptr++ = sums[aux[i]];           /* partial sum */
-            sums[aux[i]] = 0.0;
+            *floatptr++ = kpsum[i];               /* partial sum */
           }
           sendsize       += msgsize;          /* cummulative size of message */
         }
-        else  {           /* psum message doesn't fit into buffer */
-          for (i = 0; i < count; i++)              
-            sums[aux[i]] = 0.0;
+        else               /* psum message doesn't fit into buffer */
           break;   
-        }  
       }                  /* DONE: loop over k */                    
 
       MACRO_TIMER_STOP (2);
@@ -1266,12 +1568,16 @@ static int pmatching_ipm (ZZ *zz,
           if (cFLAG && bestsum > MAX(TSUM_THRESHOLD, 
               hgp->hybrid_keep_factor*ipsum/num_matches_considered))  {            
             cmatch[bestlno] = -1;                   
+            if (lay != NULL)
+              lay->vscal[bestlno] = 0.0;
             match[bestlno]       = candidate_gno;
             match[candidate_gno] = bestlno;
           }
                         
           if (!cFLAG && bestsum > TSUM_THRESHOLD)  {
             cmatch[bestlno] = -1;  /* mark pending match to avoid conflicts */
+            if (lay != NULL)
+              lay->vscal[bestlno] = 0.0;
             master_data[candidate_index].candidate = candidate_gno;
             master_data[candidate_index].partner = VTX_LNO_TO_GNO (hg, bestlno);
             master_data[candidate_index].ip = bestsum;
@@ -1425,8 +1731,12 @@ End:
     ZOLTAN_FREE(&global_best);
     ZOLTAN_FREE(&master_data);
   }
+  if (lay != NULL)
+    ipm_layout_free (lay);
+  if (thr != NULL)
+    ipm_threads_free (thr);
 
-  Zoltan_Multifree (__FILE__, __LINE__, 15, &cmatch, &visit, &sums, &sendbuf,
+  Zoltan_Multifree (__FILE__, __LINE__, 16, &cmatch, &visit, &sums, &psum, &sendbuf,
    &dest, &size, &recvbuf, &index, &aux, &permute, &edgebuf, &select, &rows,
    &gno_locs, &master_procs);
   ZOLTAN_TRACE_EXIT(zz, yo);
@@ -2577,6 +2887,7 @@ static void geometric_get_geom_multi(void *data, int num_obj, int num_gid,
 #undef MACRO_TIMER_STOP
 #undef INNER_PRODUCT
 #undef INNER_PRODUCT2
+#undef IPM_THREAD_CHUNK
 #undef ROUNDS_CONSTANT
 #undef IPM_TAG
 #undef HEADER_SIZE
@@ -92,6 +92,8 @@ static PARAM_VARS PHG_params[] = {
     /* Vertex scaling schemes to tweak inner product similarity in matching */
   {"PHG_COARSEPARTITION_METHOD",      NULL,  "STRING", 0},
     /* Coarse partitioning method: linear, random, greedy, auto */
+  {"PHG_COARSEPARTITION_TRIES",       NULL,  "INT",    0},
+    /* Total no. of coarse partitioning tries, spread over all processors */
   {"PHG_REFINEMENT_METHOD",           NULL,  "STRING", 0},
     /* Only 2-way FM (fm2) for now */
   {"PHG_DIRECT_KWAY",                 NULL,  "INT",    0},
@@ -111,6 +113,10 @@ static PARAM_VARS PHG_params[] = {
     /* If PHG_EDGE_SIZE_THRESHOLD>1, interpret it as absolute value. */
   {"PHG_MATCH_EDGE_SIZE_THRESHOLD",   NULL,  "INT",    0},
     /* Ignore hyperedges larger than this threshold, in local processor, during matching */
+  {"PHG_MATCH_COMPACT_LAYOUT",        NULL,  "INT",    0},
+    /* Compact local hypergraph layout for ipm inner products (1/0) */
+  {"PHG_NUM_THREADS",                 NULL,  "INT",    0},
+    /* Threads per process in ipm matching and coarsening (OpenMP builds) */
   {"PHG_BAL_TOL_ADJUSTMENT",          NULL,  "FLOAT",  0},  
     /* Adjustment factor for balance in recursive bisection. */
   {"PHG_EDGE_WEIGHT_OPERATION",       NULL,  "STRING",  0},
@@ -49,6 +49,7 @@
 extern "C" {
 #endif
 
+#include <float.h>
 #include "zz_sort.h"
 #include "zz_heap.h"
 #include "phg.h"
@@ -70,10 +71,16 @@ static ZOLTAN_PHG_COARSEPARTITION_FN* CoarsePartitionFns[] =
                                        &coarse_part_linear,
                                       };
 
+/* Coarse partitioners that use random numbers; these come first in
+ * CoarsePartitionFns, so repeated tries (with different seeds) only
+ * rotate through these. */
+#define NUM_RANDOMIZED_COARSEPARTITION_FNS 2
+
 static int local_coarse_partitioner(ZZ *, HGraph *, int, float *, Partition,
   PHGPartParams *, ZOLTAN_PHG_COARSEPARTITION_FN *);
 
 static int pick_best(ZZ*, PHGPartParams*, PHGComm*, HGraph*, int, int, int*, float*);
+static unsigned int coarse_try_seed(unsigned int, int);
 
 /****************************************************************************/
 
@@ -136,6 +143,9 @@ int Zoltan_PHG_CoarsePartition(
  * It computes a different partition on each processor
  * using different random numbers (and possibly also
  * different algorithms) and selects the best.
+ * If PHG_COARSEPARTITION_TRIES > 0, that many tries are spread
+ * round-robin over the processors; try g gets its own seed and
+ * (for "auto") its own method, independent of the no. of processors.
  */
 char *yo = "Zoltan_PHG_CoarsePartition";
 int ierr = ZOLTAN_OK;
@@ -151,10 +161,13 @@ float bal, cut, worst_cut;
 int fine_timing = (hgp->use_timers > 2);
 struct phg_timer_indices *timer = Zoltan_PHG_LB_Data_timers(zz);
 int local_coarse_part = hgp->LocalCoarsePartition;
+int try_base = 0;              /* Global index of first try on this proc */
+int try_stride = 0;            /* Global stride between tries on this proc */
+unsigned int try_seed = 0;     /* Seed of try 0; same on all procs */
 
 /* Number of iterations to try coarse partitioning on each proc. */
 /* 10 when p=1, and 1 when p is large. */
-const int num_coarse_iter = 1 + 9/zz->Num_Proc; 
+int num_coarse_iter = 1 + 9/zz->Num_Proc; 
 
   ZOLTAN_TRACE_ENTER(zz, yo);
 
@@ -310,14 +323,37 @@ const int num_coarse_iter = 1 + 9/zz->Num_Proc;
     /* Keep the NUM_PART_KEEP best ones around. */
     /* Currently, only the best one is used. */
 
-    /* Set RNG so different procs compute different parts. */
-    Zoltan_Srand(Zoltan_Rand(NULL) + zz->Proc, NULL);
+    if (hgp->CoarsePartitionTries > 0) {
+      /* Deal the tries round-robin over the procs; proc q does tries
+       * q, q+p, q+2p, ...  Seeds are derived from the try number so the
+       * set of candidates does not depend on p. */
+      try_seed = Zoltan_Rand(NULL);
+      MPI_Bcast(&try_seed, 1, MPI_UNSIGNED, 0, phg->comm->Communicator);
+      try_base = phg->comm->myProc;
+      try_stride = phg->comm->nProc;
+      num_coarse_iter = (try_base < hgp->CoarsePartitionTries)
+           ? (hgp->CoarsePartitionTries - try_base - 1) / try_stride + 1 : 0;
+    }
+    else
+      /* Set RNG so different procs compute different parts. */
+      Zoltan_Srand(Zoltan_Rand(NULL) + zz->Proc, NULL);
 
     new_cand = 0;
     new_part = spart;
 
     for (i=0; i< num_coarse_iter; i++){
       int savefmlooplimit=hgp->fm_loop_limit;
+
+      if (try_stride) {
+        int g = try_base + i*try_stride;
+        Zoltan_Srand(coarse_try_seed(try_seed, g), NULL);
+        if (hgp->CoarsePartition == NULL) { /* auto */
+          /* Try each method once; linear is deterministic, so later
+           * tries only alternate between the randomized methods. */
+          CoarsePartition = CoarsePartitionFns[(g < NUM_COARSEPARTITION_FNS)
+               ? g : g % NUM_RANDOMIZED_COARSEPARTITION_FNS];
+        }
+      }
         
       /* Overwrite worst partition with new candidate. */
       ierr = CoarsePartition(zz, shg, numPart, part_sizes, 
@@ -384,6 +420,8 @@ const int num_coarse_iter = 1 + 9/zz->Num_Proc;
     }
     /* Also update bestvals */
     bestvals[new_cand] = bestvals[NUM_PART_KEEP];
+    if (num_coarse_iter == 0)
+      bestvals[0] = FLT_MAX;   /* No tries on this proc; never pick it. */
 
     /* Evaluate and select the best. */
     /* For now, only pick the best one, in the future we pick the k best. */
@@ -973,6 +1011,26 @@ End:
   return err;
 }
 
+/*****************************************************************************/
+static unsigned int coarse_try_seed(
+  unsigned int seed,  /* Base seed, the same on all processors */
+  int g               /* Global number of the try */
+)
+{
+/* Derive the seed of coarse partitioning try g.  Consecutive seeds give
+ * correlated Zoltan_Srand streams, so the try number is spread with the
+ * golden ratio and the bits are mixed (MurmurHash3 finalizer).
+ */
+unsigned int h = seed + 0x9E3779B9U * (unsigned int) (g + 1);
+
+  h ^= h >> 16;
+  h *= 0x85EBCA6BU;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35U;
+  h ^= h >> 16;
+  return h;
+}
+
 #ifdef __cplusplus
 } /* closing bracket for extern "C" */
 #endif
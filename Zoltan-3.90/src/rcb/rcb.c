@@ -127,7 +127,7 @@ extern "C" {
 static int rcb_fn(ZZ *, int *, ZOLTAN_ID_PTR *, ZOLTAN_ID_PTR *, int **, int **,
   int *, ZOLTAN_ID_PTR *,
   double, int, int, int, int, int, int, int, int, int, int, double, int, int,
-  int, float *);
+  int, int, float *);
 static void print_rcb_tree(ZZ *, int, int, struct rcb_tree *);
 static int cut_dimension(int, struct rcb_tree *, int, int, int *, int *, 
   struct rcb_box *);
@@ -135,7 +135,7 @@ static int set_preset_dir(int, int, int, struct rcb_box *, int **);
 static int serial_rcb(ZZ *, struct Dot_Struct *, int *, int *, int, int,
   struct rcb_box *, double *, int, int, int *, int *, int, int, int, int,
   int, int, int, int, int, int, int, int, MPI_Op, MPI_Datatype,
-  int, ZOLTAN_GNO_TYPE *, struct rcb_tree *, int *, int, double *, double *,
+  int, int, ZOLTAN_GNO_TYPE *, struct rcb_tree *, int *, int, double *, double *,
   float *, double *, int, int, double, double *);
 static void compute_RCB_box(struct rcb_box *, int, struct Dot_Struct *, int *,
   MPI_Op, MPI_Datatype, MPI_Comm, int, int, int, int);
@@ -217,6 +217,7 @@ int Zoltan_RCB(
     int average_cuts;         /* Flag forcing median line to be drawn halfway
                                  between two closest objects. */
     int pivot_choice;
+    int num_threads;          /* threads scanning dots in find_median */
     int idummy;
     int final_output;
     int ierr=ZOLTAN_OK;
@@ -249,6 +250,8 @@ int Zoltan_RCB(
                               (void *) &average_cuts);
     Zoltan_Bind_Param(RCB_params, "RANDOM_PIVOTS",
                               (void *) &pivot_choice);
+    Zoltan_Bind_Param(RCB_params, "RCB_NUM_THREADS",
+                              (void *) &num_threads);
 
     /* Set default values. */
     overalloc = RCB_DEFAULT_OVERALLOC;
@@ -269,6 +272,7 @@ int Zoltan_RCB(
     ddummy = 0.0;
     average_cuts = 0;
     pivot_choice = 0;
+    num_threads = 1;
 
     Zoltan_Assign_Param_Vals(zz->Params, RCB_params, zz->Debug_Level, zz->Proc,
                          zz->Debug_Proc);
@@ -297,8 +301,8 @@ int Zoltan_RCB(
                  overalloc, reuse, wgtflag,
                  check_geom, stats, gen_tree, reuse_dir, preset_dir,
                  rectilinear_blocks, obj_wgt_comp, mcnorm, 
-                 max_aspect_ratio, recompute_box, average_cuts, pivot_choice,
-                 part_sizes);
+                 max_aspect_ratio, recompute_box, average_cuts, num_threads,
+                 pivot_choice, part_sizes);
 
     return(ierr);
 }
@@ -365,6 +369,8 @@ static int rcb_fn(
                                    partition sets at each level of recursion */
   int average_cuts,             /* Flag forcing median line to be drawn halfway
                                    between two closest objects. */
+  int num_threads,              /* Threads scanning dots in find_median;
+                                   0 for the OpenMP default. */
   int pivot_choice, 
   float *part_sizes             /* Input: Array of size 
                                    zz->LB.Num_Global_Parts * wgtflag 
@@ -912,7 +918,7 @@ static int rcb_fn(
                nprocs, old_nprocs, proclower, old_nparts, 
                wgtflag, rcbbox->lo[dim], rcbbox->hi[dim], 
                weight[0], weightlo, weighthi,
-               dotlist, rectilinear_blocks, average_cuts)) {
+               dotlist, rectilinear_blocks, average_cuts, num_threads)) {
             ZOLTAN_PRINT_ERROR(proc, yo,
                "Error returned from Zoltan_RB_find_median.");
             ierr = ZOLTAN_FATAL;
@@ -1146,7 +1152,7 @@ static int rcb_fn(
                preset_dir, 
                rectilinear_blocks, obj_wgt_comp, mcnorm, 
                recompute_box,
-               box_op, box_type, average_cuts, 
+               box_op, box_type, average_cuts, num_threads, 
                counters, treept, dim_spec, level,
                coord, wgts, part_sizes, wgtscale, rcb->Num_Dim, pivot_choice, 
                max_aspect_ratio, timers);
@@ -1552,6 +1558,7 @@ static int serial_rcb(
   MPI_Datatype box_type,     /* Data type needed if recompute_box */
   int average_cuts,          /* Flag forcing median line to be drawn halfway
                                 between two closest objects. */
+  int num_threads,           /* Threads scanning dots in find_median */
   ZOLTAN_GNO_TYPE counters[],            /* diagnostic counts */
   struct rcb_tree *treept,   /* tree of RCB cuts */
   int *dim_spec,             /* specified direction for preset_dir */
@@ -1698,7 +1705,7 @@ static int serial_rcb(
                  first_guess, zz->Num_Proc, 1, zz->Proc, num_parts,
                  wgtflag, rcbbox->lo[dim], rcbbox->hi[dim], 
                  weight[0], weightlo, weighthi,
-                 dotlist, rectilinear_blocks, average_cuts)) {
+                 dotlist, rectilinear_blocks, average_cuts, num_threads)) {
             ZOLTAN_PRINT_ERROR(proc, yo,"Error returned from Zoltan_RB_find_median.");
             ierr = ZOLTAN_FATAL;
             goto End;
@@ -1829,7 +1836,7 @@ static int serial_rcb(
                         preset_dir, 
                         rectilinear_blocks, obj_wgt_comp, mcnorm, 
                         recompute_box,
-                        box_op, box_type, average_cuts, 
+                        box_op, box_type, average_cuts, num_threads, 
                         counters, treept, dim_spec, level,
                         coord, wgts, part_sizes, wgtscale, ndim, pivot_choice,
                         max_aspect_ratio, timers);
@@ -1850,7 +1857,7 @@ static int serial_rcb(
                         proc, wgtflag, lock_direction, reuse, stats, gen_tree, 
                         preset_dir, rectilinear_blocks, obj_wgt_comp, mcnorm,
                         recompute_box,
-                        box_op, box_type, average_cuts,
+                        box_op, box_type, average_cuts, num_threads,
                         counters, treept, dim_spec, level,
                         coord, wgts, part_sizes, wgtscale, ndim, pivot_choice,
                         max_aspect_ratio, timers);
@@ -83,14 +83,14 @@ extern "C" {
 /*---------------------------------------------------------------------------*/
 static int rib_fn(ZZ *, int *, ZOLTAN_ID_PTR *, ZOLTAN_ID_PTR *, int **, int **,
                   int *, ZOLTAN_ID_PTR *,
-                  double, int, int, int, int, int, float *);
+                  double, int, int, int, int, int, int, float *);
 static void print_rib_tree(ZZ *, int, int, struct rib_tree *);
 static int compute_rib_direction(ZZ *, int, int, double *, double *,
   struct Dot_Struct *, int *, int, int, double *, double *, double *,
   MPI_Comm, int, int, int);
 static int serial_rib(ZZ *, struct Dot_Struct *, int *, int *, int, int,
   int, double, int, int, int *, int *, int, int, int, int, int, int, int,
-  struct rib_tree *, double *, double *, float *, double *);
+  int, struct rib_tree *, double *, double *, float *, double *);
 
 /*---------------------------------------------------------------------------*/
 
@@ -149,6 +149,7 @@ int Zoltan_RIB(
                               later for point and box drop. */
   int average_cuts;           /* (0) don't (1) compute the cut to be the
                               average of the closest dots. */
+  int num_threads;            /* threads scanning dots in find_median */
   int idummy;
   int final_output;
   double ddummy;
@@ -162,6 +163,7 @@ int Zoltan_RIB(
   Zoltan_Bind_Param(RIB_params, "REDUCE_DIMENSIONS", (void *) &idummy);
   Zoltan_Bind_Param(RIB_params, "DEGENERATE_RATIO", (void *) &ddummy);
   Zoltan_Bind_Param(RIB_params, "FINAL_OUTPUT", (void *) &final_output);
+  Zoltan_Bind_Param(RIB_params, "RIB_NUM_THREADS", (void *) &num_threads);
 
   overalloc = RIB_DEFAULT_OVERALLOC;
   check_geom = DEFAULT_CHECK_GEOM;
@@ -169,6 +171,7 @@ int Zoltan_RIB(
   gen_tree = 0;
   final_output = 0;
   average_cuts = 0;
+  num_threads = 1;
   wgtflag = zz->Obj_Weight_Dim;
   idummy = 0;
   ddummy = 0.0;
@@ -188,7 +191,7 @@ int Zoltan_RIB(
   ierr = rib_fn(zz, num_import, import_global_ids, import_local_ids,
                 import_procs, import_to_part, num_export, export_global_ids,
                 overalloc, wgtflag, check_geom, stats, gen_tree, average_cuts,
-                part_sizes);
+                num_threads, part_sizes);
 
   return(ierr);
 
@@ -242,6 +245,8 @@ static int rib_fn(
   int gen_tree,                 /* (0) do not (1) do generate full treept */
   int average_cuts,             /* (0) don't (1) compute the cut to be the
                                 average of the closest dots. */
+  int num_threads,              /* Threads scanning dots in find_median;
+                                0 for the OpenMP default. */
   float *part_sizes            /* Input:  Array of size
                                 zz->Num_Global_Parts * max(zz->Obj_Weight_Dim, 1)
                                 containing the percentage of work to be
@@ -570,7 +575,8 @@ static int rib_fn(
                    fractionlo, local_comm, &valuehalf, first_guess,
                    nprocs, old_nprocs, proclower, old_nparts,
                    wgtflag, valuelo, valuehi, weight[0], weightlo,
-                   weighthi, dotlist, rectilinear_blocks, average_cuts)) {
+                   weighthi, dotlist, rectilinear_blocks, average_cuts,
+                   num_threads)) {
       ZOLTAN_PRINT_ERROR(proc, yo,
         "Error returned from Zoltan_RB_find_median.");
       ierr = ZOLTAN_FATAL;
@@ -711,7 +717,7 @@ static int rib_fn(
                       rib->Num_Geom, weight[0], dotnum, num_parts,
                       &(dindx[0]), &(tmpdindx[0]), partlower,
                       proc, wgtflag, stats, gen_tree,
-                      rectilinear_blocks, average_cuts,
+                      rectilinear_blocks, average_cuts, num_threads,
                       treept, value, wgts, part_sizes, timers);
     if (ierr < 0) {
       ZOLTAN_PRINT_ERROR(proc, yo, "Error returned from serial_rib");
@@ -1075,6 +1081,7 @@ static int serial_rib(
   int rectilinear_blocks,    /* parameter for find_median (not used by rib) */
   int average_cuts,          /* (0) don't (1) compute the cut to be the
                                 average of the closest dots. */
+  int num_threads,           /* Threads scanning dots in find_median */
   struct rib_tree *treept,   /* tree of RCB cuts */
   double *value,             /* temp array for median_find */
   double *wgts,              /* temp array for serial_rib */
@@ -1140,7 +1147,7 @@ double start_time=0., end_time;
                                0, zz->Num_Proc, 1, proc, num_parts,
                                wgtflag, valuelo, valuehi, weight, &weightlo,
                                &weighthi, dotlist, rectilinear_blocks, 
-                               average_cuts)) {
+                               average_cuts, num_threads)) {
       ZOLTAN_PRINT_ERROR(proc, yo, 
         "Error returned from Zoltan_RB_find_median.");
       ierr = ZOLTAN_FATAL;
@@ -1184,7 +1191,7 @@ double start_time=0., end_time;
                         weightlo, set0, new_nparts,
                         &(dindx[0]), &(tmpdindx[0]), partlower,
                         proc, wgtflag, stats, gen_tree, 
-                        rectilinear_blocks, average_cuts,
+                        rectilinear_blocks, average_cuts, num_threads,
                         treept, value, wgts, part_sizes, timers);
       if (ierr < 0) {
         goto End;
@@ -1199,7 +1206,7 @@ double start_time=0., end_time;
                         weighthi, dotnum-set0, new_nparts,
                         &(dindx[set1]), &(tmpdindx[set1]), partmid,
                         proc, wgtflag, stats, gen_tree,
-                        rectilinear_blocks, average_cuts,
+                        rectilinear_blocks, average_cuts, num_threads,
                         treept, value, wgts, part_sizes, timers);
       if (ierr < 0) {
         goto End;
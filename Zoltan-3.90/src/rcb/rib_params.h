@@ -68,6 +68,7 @@ static PARAM_VARS RIB_params[] = {
                { "REDUCE_DIMENSIONS", NULL, "INT", 0 },
                { "DEGENERATE_RATIO", NULL, "DOUBLE", 0 },
                { "FINAL_OUTPUT", NULL,  "INT",    0},
+               { "RIB_NUM_THREADS", NULL, "INT", 0 },
                { NULL, NULL, NULL, 0 } };
 
 
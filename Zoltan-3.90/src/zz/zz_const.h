@@ -138,6 +138,7 @@ struct Param_List;
 #define ZOLTAN_NUM_ID_ENTRIES_DEF 1
 #define ZOLTAN_TIMER_DEF          ZOLTAN_TIME_WALL
 #define ZOLTAN_TFLOPS_SPECIAL_DEF FALSE
+#define ZOLTAN_MEMORY_ARENA_DEF   0
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -251,6 +252,12 @@ struct Zoltan_Struct {
                                       usually 0 (no weights) or 1            */
   int Timer;                      /*  Timer type that is currently active */
   struct Zoltan_Timer *ZTime;     /*  Timer structure for persistent timing. */
+  int Memory_Arena_Size;          /*  Size in KB of the chunks of the
+                                      memory arena used during partitioning;
+                                      0 if the arena is not used.            */
+  struct Zoltan_Memory_Arena *Memory_Arena;
+                                  /*  Arena in which Zoltan_Malloc takes
+                                      temporary memory during partitioning. */
   /***************************************************************************/
   ZOLTAN_PART_MULTI_FN *Get_Part_Multi;/* Fn ptr to get objects'
                                           part assignments.     */
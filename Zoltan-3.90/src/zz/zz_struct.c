@@ -180,10 +180,13 @@ int Zoltan_Copy_To(ZZ *to, ZZ const *from)
   Zoltan_Copy_Params(&(to->Params), from->Params);
 
   to->ZTime = Zoltan_Timer_Copy(from->ZTime);
+  to->Memory_Arena = NULL;
 
   memset(&(to->LB), 0, sizeof(struct Zoltan_LB_Struct));
   Zoltan_LB_Copy_Struct(to, from);
 
+  Zoltan_Migrate_Copy_Fields(&(to->Migrate), &(from->Migrate));
+
   return 0;
 }
 
@@ -218,8 +221,10 @@ static void Zoltan_Free_Zoltan_Struct_Members(ZZ *zz)
 {
   Zoltan_Free_Params(&(zz->Params));
   Zoltan_Timer_Destroy(&(zz->ZTime));
+  Zoltan_Memory_Arena_Destroy(&(zz->Memory_Arena));
   Zoltan_Free_Structures(zz);  /* Algorithm-specific structures */
   Zoltan_LB_Free_Struct(&(zz->LB));
+  Zoltan_Migrate_Free_Fields(&(zz->Migrate));
   Zoltan_Order_Free_Struct(&(zz->Order));
   Zoltan_TPL_Order_Free_Struct(&(zz->TPL_Order));
 }
@@ -256,6 +261,8 @@ static void Zoltan_Init(ZZ* zz)
   zz->Tflops_Special = ZOLTAN_TFLOPS_SPECIAL_DEF;
   zz->Seed = ZOLTAN_RAND_INIT;
   zz->Timer = ZOLTAN_TIMER_DEF;
+  zz->Memory_Arena_Size = ZOLTAN_MEMORY_ARENA_DEF;
+  zz->Memory_Arena = NULL;
   zz->Params = NULL;
   zz->Deterministic = ZOLTAN_DETERMINISTIC_DEF;
   zz->Obj_Weight_Dim = ZOLTAN_OBJ_WEIGHT_DEF;
@@ -63,6 +63,9 @@ extern "C" {
 #include "zz_util_const.h"
 #include "zoltan_mem.h"
 #include "zz_const.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 extern int fsync(int fd);
 
@@ -578,6 +581,20 @@ size_t mask;
   return 0;
 }
 
+/* Number of threads to use in the thread-parallel parts of an algorithm,
+ * given the value of its *_NUM_THREADS parameter: the requested number if
+ * positive, else the OpenMP default. Always 1 if Zoltan is built without
+ * OpenMP.
+ */
+int Zoltan_Num_Threads(int requested)
+{
+#ifdef _OPENMP
+  return (requested > 0) ? requested : omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
 
 /*****************************************************************************/
 #ifdef ZOLTAN_PURIFY
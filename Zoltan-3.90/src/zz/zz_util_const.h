@@ -80,6 +80,7 @@ int Zoltan_AllReduceInPlace(void *, int , MPI_Datatype , MPI_Op , MPI_Comm );
 void Zoltan_write_linux_meminfo(int append, char *msg, int committedOnly);
 long Zoltan_get_process_kilobytes();
 int Zoltan_overflow_test(size_t val);
+int Zoltan_Num_Threads(int requested);
 
 MPI_Datatype Zoltan_mpi_gno_type();
 char *Zoltan_mpi_gno_name();
@@ -0,0 +1,208 @@
+/* Test and timing of Zoltan_Color with threads (COLORING_NUM_THREADS):  */
+/* the colorings are valid and the same as the sequential ones.          */
+/* Usage: test_color_threads [grid size]                                 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+
+/* Rows of an n x n grid with diagonals, distributed by blocks of rows */
+typedef struct {
+  int n;
+  int np;                       /* number of procs */
+  int first, last;              /* first and past-last vertex of the proc */
+} GRID;
+
+/****************************************************************************/
+/****************************************************************************/
+static int numObj(void *data, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  *ierr = ZOLTAN_OK;
+  return g->last - g->first;
+}
+
+static void objList(void *data, int ngid, int nlid,
+                    ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                    int wdim, float *wgts, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = g->first; i < g->last; i++) {
+    gids[i - g->first] = (ZOLTAN_ID_TYPE) i;
+    lids[i - g->first] = (ZOLTAN_ID_TYPE) (i - g->first);
+  }
+}
+
+static int gridNeighbors(GRID *g, ZOLTAN_ID_TYPE v, ZOLTAN_ID_TYPE *nbor)
+{
+  int x = (int) (v % g->n), y = (int) (v / g->n), dx, dy, k = 0;
+  for (dy = -1; dy <= 1; dy++)
+    for (dx = -1; dx <= 1; dx++)
+      if ((dx || dy) && x + dx >= 0 && x + dx < g->n &&
+          y + dy >= 0 && y + dy < g->n)
+        nbor[k++] = (ZOLTAN_ID_TYPE) ((y + dy) * g->n + x + dx);
+  return k;
+}
+
+static void numEdgesMulti(void *data, int ngid, int nlid, int nobj,
+                          ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                          int *nedges, int *ierr)
+{
+  ZOLTAN_ID_TYPE nbor[8];
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < nobj; i++)
+    nedges[i] = gridNeighbors((GRID *) data, gids[i], nbor);
+}
+
+static int owner(GRID *g, ZOLTAN_ID_TYPE v)
+{
+  long rows = (long) g->n * g->n;
+  int p = (int) (((long) v * g->np) / rows);
+  while (p > 0 && (long) v < (rows * p) / g->np) p--;
+  while (p < g->np - 1 && (long) v >= (rows * (p + 1)) / g->np) p++;
+  return p;
+}
+
+static void edgeListMulti(void *data, int ngid, int nlid, int nobj,
+                          ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                          int *nedges, ZOLTAN_ID_PTR nborgids, int *nborprocs,
+                          int wdim, float *ewgts, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  int i, j, k;
+  *ierr = ZOLTAN_OK;
+  for (i = 0, k = 0; i < nobj; i++)
+    for (j = gridNeighbors(g, gids[i], nborgids + k); j > 0; j--, k++)
+      nborprocs[k] = owner(g, nborgids[k]);
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Color the grid; return the time spent and the colors of all the */
+/* vertices in color.                                              */
+static double run(GRID *g, char *problem, char *order, int threads,
+                  ZOLTAN_ID_PTR all, int *color, int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  char val[16];
+  double t;
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Param(zz, "COLORING_PROBLEM", problem);
+  Zoltan_Set_Param(zz, "VERTEX_VISIT_ORDER", order);
+  sprintf(val, "%d", threads);
+  Zoltan_Set_Param(zz, "COLORING_NUM_THREADS", val);
+  Zoltan_Set_Num_Obj_Fn(zz, numObj, g);
+  Zoltan_Set_Obj_List_Fn(zz, objList, g);
+  Zoltan_Set_Num_Edges_Multi_Fn(zz, numEdgesMulti, g);
+  Zoltan_Set_Edge_List_Multi_Fn(zz, edgeListMulti, g);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  t = MPI_Wtime();
+  if (Zoltan_Color(zz, 1, g->n * g->n, all, color) != ZOLTAN_OK)
+    (*nerrs)++;
+  t = MPI_Wtime() - t;
+
+  Zoltan_Destroy(&zz);
+  return t;
+}
+
+/* Return the number of colors, or -1 if two vertices at distance */
+/* dist or less have the same color.                              */
+static int checkColors(GRID *g, int dist, int *color)
+{
+  int x, y, dx, dy, v, maxc = 0;
+  for (v = 0; v < g->n * g->n; v++) {
+    if (color[v] < 1) return -1;
+    if (color[v] > maxc) maxc = color[v];
+    x = v % g->n;
+    y = v / g->n;
+    for (dy = -dist; dy <= dist; dy++)
+      for (dx = -dist; dx <= dist; dx++)
+        if ((dx || dy) && x + dx >= 0 && x + dx < g->n &&
+            y + dy >= 0 && y + dy < g->n &&
+            color[(y + dy) * g->n + x + dx] == color[v])
+          return -1;
+  }
+  return maxc;
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  GRID g;
+  int me, np, p, o, k, i;
+  int threads[3] = { 1, 2, 3 };
+  int ncolors[3];
+  int *color[3];
+  ZOLTAN_ID_PTR all;
+  double t[3], tmax[3];
+  int nerrs = 0, gerrs;
+  char *problems[] = { "distance-1", "distance-2" };
+  char *orders[] = { "I", "N", "L" };
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  g.n = 200;
+  if (narg > 1) g.n = atoi(arg[1]);
+  g.np = np;
+  g.first = (int) (((long) g.n * g.n * me) / np);
+  g.last  = (int) (((long) g.n * g.n * (me + 1)) / np);
+  all = (ZOLTAN_ID_PTR) malloc(g.n * g.n * sizeof(ZOLTAN_ID_TYPE));
+  for (i = 0; i < g.n * g.n; i++)
+    all[i] = (ZOLTAN_ID_TYPE) i;
+  for (k = 0; k < 3; k++)
+    color[k] = (int *) malloc(g.n * g.n * sizeof(int));
+
+  for (p = 0; p < 2; p++)
+    for (o = 0; o < 3; o++) {
+      for (k = 0; k < 3; k++) {
+        t[k] = run(&g, problems[p], orders[o], threads[k], all, color[k],
+                   &nerrs);
+        ncolors[k] = checkColors(&g, p + 1, color[k]);
+        if (ncolors[k] < 0) {
+          printf("%d of %d: %s order %s with %d threads: invalid coloring "
+                 "FAIL\n", me, np, problems[p], orders[o], threads[k]);
+          nerrs++;
+        }
+      }
+
+      /* Colorings with threads are the sequential ones */
+      for (k = 1; k < 3; k++)
+        if (memcmp(color[0], color[k], g.n * g.n * sizeof(int)) != 0) {
+          printf("%d of %d: %s order %s: coloring differs with %d threads "
+                 "FAIL\n", me, np, problems[p], orders[o], threads[k]);
+          nerrs++;
+        }
+
+      MPI_Reduce(t, tmax, 3, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+      if (me == 0)
+        printf("%d procs, %d x %d grid, %s order %s: %d colors, "
+               "1 thread %.4f s, 2 threads %.4f s, 3 threads %.4f s\n",
+               np, g.n, g.n, problems[p], orders[o], ncolors[0], tmax[0],
+               tmax[1], tmax[2]);
+    }
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  free(all);
+  for (k = 0; k < 3; k++)
+    free(color[k]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
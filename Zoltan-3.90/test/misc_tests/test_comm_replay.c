@@ -0,0 +1,122 @@
+/* Test and timing of Zoltan_Comm_Do_Replay against Zoltan_Comm_Do      */
+/* for an exchange repeated along the same communication plan.          */
+/* Usage: test_comm_replay [number of items per proc] [number of steps] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+#include "zoltan_comm.h"
+
+#define NBYTES 24           /* item size, as a few doubles per object */
+
+/****************************************************************************/
+/****************************************************************************/
+static void fill(char *buf, int nobj, int me, int step)
+{
+  int i;
+  for (i = 0; i < nobj * NBYTES; i++)
+    buf[i] = (char) (i * 7 + me * 13 + step);
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  ZOLTAN_COMM_OBJ *plan = NULL;
+  int me, np;
+  int i, k, ierr, step, pass, order;
+  int nobj = 20000, nsteps = 50, nrecv;
+  int *procs;
+  char *send[2], *recv_do, *recv_replay[2];
+  double t, time_do = 0., time_replay = 0., tmax;
+  int nerrs = 0, gerrs;
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  if (narg > 1) nobj = atoi(arg[1]);
+  if (narg > 2) nsteps = atoi(arg[2]);
+
+  procs = (int *) malloc((nobj + 1) * sizeof(int));
+  send[0] = (char *) malloc((size_t) (nobj + 1) * NBYTES);
+  send[1] = (char *) malloc((size_t) (nobj + 1) * NBYTES);
+
+  /* Two plans: items interleaved over procs (packed through indices) */
+  /* and items already grouped by destination proc.                   */
+  for (pass = 0; pass < 2; pass++) {
+    for (i = 0; i < nobj; i++)
+      procs[i] = (pass == 0) ? (me + i) % np
+                             : (int) (((long) i * np) / nobj);
+
+    ierr = Zoltan_Comm_Create(&plan, nobj, procs, MPI_COMM_WORLD, 1000, &nrecv);
+    if (ierr != ZOLTAN_OK) {
+      printf("%d of %d: Zoltan_Comm_Create FAIL\n", me, np);
+      nerrs++;
+      break;
+    }
+
+    recv_do        = (char *) malloc((size_t) (nrecv + 1) * NBYTES);
+    recv_replay[0] = (char *) malloc((size_t) (nrecv + 1) * NBYTES);
+    recv_replay[1] = (char *) malloc((size_t) (nrecv + 1) * NBYTES);
+
+    for (step = 0; step < nsteps; step++) {
+      /* New payload at every step, alternating between two buffers */
+      k = step % 2;
+      fill(send[k], nobj, me, step);
+
+      /* Swap the order of the two calls at every step, so that */
+      /* neither one always runs right after the payload update */
+      for (order = 0; order < 2; order++) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        t = MPI_Wtime();
+        if (order == k) {
+          Zoltan_Comm_Do(plan, 1001, send[k], NBYTES, recv_do);
+          time_do += MPI_Wtime() - t;
+        }
+        else {
+          ierr = Zoltan_Comm_Do_Replay(plan, 1002, send[k], NBYTES,
+                                       recv_replay[k]);
+          time_replay += MPI_Wtime() - t;
+        }
+      }
+
+      if (ierr != ZOLTAN_OK ||
+          memcmp(recv_do, recv_replay[k], (size_t) nrecv * NBYTES) != 0) {
+        printf("%d of %d: plan %d step %d Zoltan_Comm_Do_Replay FAIL\n",
+               me, np, pass, step);
+        nerrs++;
+        break;
+      }
+    }
+
+    free(recv_do);
+    free(recv_replay[0]);
+    free(recv_replay[1]);
+    Zoltan_Comm_Destroy(&plan);
+  }
+
+  MPI_Reduce(&time_do, &tmax, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  if (me == 0)
+    printf("%d procs, %d items of %d bytes, 2 plans x %d steps: "
+           "Zoltan_Comm_Do %.4f s,", np, nobj, NBYTES, nsteps, tmax);
+  MPI_Reduce(&time_replay, &tmax, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  if (me == 0)
+    printf(" Zoltan_Comm_Do_Replay %.4f s\n", tmax);
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  free(procs);
+  free(send[0]);
+  free(send[1]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
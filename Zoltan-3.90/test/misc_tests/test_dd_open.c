@@ -0,0 +1,197 @@
+/* Test of the open addressing table of the distributed directory           */
+/* (ZOLTAN_DD_TABLE_OPEN) with Zoltan_DD_Update, Zoltan_DD_Find,            */
+/* Zoltan_DD_Remove and Zoltan_DD_Stats.  All GIDs are hashed to proc 0, so */
+/* that one table holds them all and many GIDs collide on their home slot;  */
+/* GIDs are inserted in batches to grow the table past its load factor, and */
+/* removed GIDs are inserted again by another proc.  Every lookup is        */
+/* checked against the expected owner, partition, LID and user data, and    */
+/* against the chained table.                                               */
+/* Usage: test_dd_open [GIDs per proc]                                      */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+#include "zoltan_dd.h"
+
+#define NBATCH 5                /* number of insertion batches */
+
+/****************************************************************************/
+/****************************************************************************/
+static unsigned int hashToZero(ZOLTAN_ID_PTR gid, int ngid, unsigned int n)
+{
+  return 0;
+}
+
+/* Partition and user data stored with GID g by proc p */
+#define PART(g, p)  ((int) ((g) % 7) + 10 * (p))
+#define USER(g, p)  ((int) (3 * (g)) + (p))
+
+/****************************************************************************/
+/****************************************************************************/
+/* Update the n GIDs starting at gid from this proc */
+static int update(Zoltan_DD_Directory *dd, ZOLTAN_ID_TYPE *gid, int n,
+                  int me)
+{
+  ZOLTAN_ID_TYPE *lid;
+  int *part, *user, i, ierr;
+
+  lid = (ZOLTAN_ID_TYPE *) malloc((n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  part = (int *) malloc((n + 1) * sizeof(int));
+  user = (int *) malloc((n + 1) * sizeof(int));
+  for (i = 0; i < n; i++) {
+    lid[i] = gid[i] + 1;
+    part[i] = PART(gid[i], me);
+    user[i] = USER(gid[i], me);
+  }
+  ierr = Zoltan_DD_Update(dd, gid, lid, (char *) user, part, n);
+  free(lid);
+  free(part);
+  free(user);
+  return ierr;
+}
+
+/* Find the n GIDs, and check them against the expected owners (-1 for */
+/* GIDs not in the directory); return the number of wrong GIDs.        */
+static int check(Zoltan_DD_Directory *dd, ZOLTAN_ID_TYPE *gid, int *expect,
+                 int n, int *owner)
+{
+  ZOLTAN_ID_TYPE *lid;
+  int *part, *user, i, nbad = 0;
+
+  lid = (ZOLTAN_ID_TYPE *) malloc((n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  part = (int *) malloc((n + 1) * sizeof(int));
+  user = (int *) malloc((n + 1) * sizeof(int));
+  Zoltan_DD_Find(dd, gid, lid, (char *) user, part, n, owner);
+  for (i = 0; i < n; i++) {
+    if (owner[i] != expect[i])
+      nbad++;
+    else if (expect[i] >= 0 &&
+             (lid[i] != gid[i] + 1 || part[i] != PART(gid[i], expect[i]) ||
+              user[i] != USER(gid[i], expect[i])))
+      nbad++;
+  }
+  free(lid);
+  free(part);
+  free(user);
+  return nbad;
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  Zoltan_DD_Directory *dd[2];
+  ZOLTAN_ID_TYPE *mine, *all, *rm;
+  int *expect, *owner[2];
+  int me, np, i, k, b, first, nrm, nall;
+  int nloc = 2000;
+  static const char *names[2] = {"open", "chained"};
+  int nerrs = 0, gerrs;
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  if (narg > 1) nloc = atoi(arg[1]);
+  nall = np * nloc;
+
+  /* Proc p inserts GIDs p, p + np, p + 2 np, ... */
+  mine = (ZOLTAN_ID_TYPE *) malloc((nloc + 1) * sizeof(ZOLTAN_ID_TYPE));
+  rm = (ZOLTAN_ID_TYPE *) malloc((nloc + 1) * sizeof(ZOLTAN_ID_TYPE));
+  all = (ZOLTAN_ID_TYPE *) malloc((nall + 1) * sizeof(ZOLTAN_ID_TYPE));
+  expect = (int *) malloc((nall + 1) * sizeof(int));
+  owner[0] = (int *) malloc((nall + 1) * sizeof(int));
+  owner[1] = (int *) malloc((nall + 1) * sizeof(int));
+  for (i = 0; i < nloc; i++)
+    mine[i] = (ZOLTAN_ID_TYPE) (me + np * i);
+  for (i = 0; i < nall; i++)
+    all[i] = (ZOLTAN_ID_TYPE) i;
+
+  for (k = 0; k < 2; k++) {
+    Zoltan_DD_Create_Table(&dd[k], MPI_COMM_WORLD, 1, 1, sizeof(int), 16,
+                           (k == 0) ? ZOLTAN_DD_TABLE_OPEN
+                                    : ZOLTAN_DD_TABLE_CHAINED, 0);
+    Zoltan_DD_Set_Hash_Fn(dd[k], hashToZero);
+
+    /* Batches of increasing size, the last ones well past 3/4 of the */
+    /* table length at the time they are inserted                     */
+    for (b = 0, first = 0; b < NBATCH; b++) {
+      int n = (b == NBATCH - 1) ? nloc - first
+                                : (nloc >> (NBATCH - b)) - first;
+      if (n < 0) n = 0;
+      if (update(dd[k], mine + first, n, me) != ZOLTAN_OK) {
+        printf("%d of %d: %s table update failed FAIL\n", me, np, names[k]);
+        nerrs++;
+      }
+      first += n;
+    }
+    for (i = 0; i < nall; i++)
+      expect[i] = i % np;
+    if (check(dd[k], all, expect, nall, owner[k]) != 0) {
+      printf("%d of %d: %s table: wrong GIDs after insertion FAIL\n",
+             me, np, names[k]);
+      nerrs++;
+    }
+
+    /* Remove every other GID of mine, and update the others again */
+    for (i = 1, nrm = 0; i < nloc; i += 2)
+      rm[nrm++] = mine[i];
+    if (Zoltan_DD_Remove(dd[k], rm, nrm) != ZOLTAN_OK) {
+      printf("%d of %d: %s table remove failed FAIL\n", me, np, names[k]);
+      nerrs++;
+    }
+    for (i = 0; i < nall; i++)
+      expect[i] = ((i / np) % 2) ? -1 : i % np;
+    if (check(dd[k], all, expect, nall, owner[k]) != 0) {
+      printf("%d of %d: %s table: wrong GIDs after removal FAIL\n",
+             me, np, names[k]);
+      nerrs++;
+    }
+
+    /* The next proc inserts the removed GIDs again, with new data, in */
+    /* the slots the removal emptied                                   */
+    for (i = 0; i < nrm; i++)
+      rm[i] = (ZOLTAN_ID_TYPE) ((me + np - 1) % np + np * (2 * i + 1));
+    if (update(dd[k], rm, nrm, me) != ZOLTAN_OK) {
+      printf("%d of %d: %s table re-insertion failed FAIL\n",
+             me, np, names[k]);
+      nerrs++;
+    }
+    for (i = 0; i < nall; i++)
+      expect[i] = ((i / np) % 2) ? (i % np + 1) % np : i % np;
+    if (check(dd[k], all, expect, nall, owner[k]) != 0) {
+      printf("%d of %d: %s table: wrong GIDs after re-insertion FAIL\n",
+             me, np, names[k]);
+      nerrs++;
+    }
+
+    Zoltan_DD_Stats(dd[k]);
+  }
+
+  /* Both tables give the same answers */
+  if (memcmp(owner[0], owner[1], nall * sizeof(int))) {
+    printf("%d of %d: open and chained tables differ FAIL\n", me, np);
+    nerrs++;
+  }
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  Zoltan_DD_Destroy(&dd[0]);
+  Zoltan_DD_Destroy(&dd[1]);
+  free(mine);
+  free(rm);
+  free(all);
+  free(expect);
+  free(owner[0]);
+  free(owner[1]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
@@ -0,0 +1,219 @@
+/* Test and timing of repeated Zoltan_LB_Partition calls with and without */
+/* the memory arena (parameter MEMORY_ARENA).                             */
+/* Usage: test_memory_arena [grid size] [number of calls]                 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+#include "zoltan_mem.h"
+
+/* Rows of an n x n grid, distributed by blocks of rows over the procs */
+typedef struct {
+  int n;
+  int np;                       /* number of procs */
+  int first, last;              /* first and past-last vertex of the proc */
+} GRID;
+
+/****************************************************************************/
+/****************************************************************************/
+static int numObj(void *data, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  *ierr = ZOLTAN_OK;
+  return g->last - g->first;
+}
+
+static void objList(void *data, int ngid, int nlid,
+                    ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                    int wdim, float *wgts, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = g->first; i < g->last; i++) {
+    gids[i - g->first] = (ZOLTAN_ID_TYPE) i;
+    lids[i - g->first] = (ZOLTAN_ID_TYPE) (i - g->first);
+  }
+}
+
+static int numGeom(void *data, int *ierr)
+{
+  *ierr = ZOLTAN_OK;
+  return 2;
+}
+
+static void geomMulti(void *data, int ngid, int nlid, int nobj,
+                      ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                      int ndim, double *xy, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < nobj; i++) {
+    xy[2 * i]     = (double) (gids[i] % g->n);
+    xy[2 * i + 1] = (double) (gids[i] / g->n);
+  }
+}
+
+static int gridNeighbors(GRID *g, ZOLTAN_ID_TYPE v, ZOLTAN_ID_TYPE *nbor)
+{
+  int x = (int) (v % g->n), y = (int) (v / g->n), k = 0;
+  if (x > 0)        nbor[k++] = v - 1;
+  if (x < g->n - 1) nbor[k++] = v + 1;
+  if (y > 0)        nbor[k++] = v - g->n;
+  if (y < g->n - 1) nbor[k++] = v + g->n;
+  return k;
+}
+
+static void numEdgesMulti(void *data, int ngid, int nlid, int nobj,
+                          ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                          int *nedges, int *ierr)
+{
+  ZOLTAN_ID_TYPE nbor[4];
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < nobj; i++)
+    nedges[i] = gridNeighbors((GRID *) data, gids[i], nbor);
+}
+
+static int owner(GRID *g, ZOLTAN_ID_TYPE v)
+{
+  long rows = (long) g->n * g->n;
+  int p = (int) (((long) v * g->np) / rows);
+  while (p > 0 && (long) v < (rows * p) / g->np) p--;
+  while (p < g->np - 1 && (long) v >= (rows * (p + 1)) / g->np) p++;
+  return p;
+}
+
+static void edgeListMulti(void *data, int ngid, int nlid, int nobj,
+                          ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                          int *nedges, ZOLTAN_ID_PTR nborgids, int *nborprocs,
+                          int wdim, float *ewgts, int *ierr)
+{
+  GRID *g = (GRID *) data;
+  int i, j, k;
+  *ierr = ZOLTAN_OK;
+  for (i = 0, k = 0; i < nobj; i++)
+    for (j = gridNeighbors(g, gids[i], nborgids + k); j > 0; j--, k++)
+      nborprocs[k] = owner(g, nborgids[k]);
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Run ncalls partitions; return the time spent and the parts of the */
+/* local objects computed by the last call.                          */
+static double run(GRID *g, char *method, int arena, int ncalls, int *parts,
+                  int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  int changes, ngid, nlid, nimp, nexp, call, i, ierr;
+  ZOLTAN_ID_PTR impgid, implid, expgid, explid;
+  int *impproc, *imppart, *expproc, *exppart;
+  char val[16];
+  double t = 0., t0;
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "LB_METHOD", method);
+  Zoltan_Set_Param(zz, "RETURN_LISTS", "PARTS");
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Param(zz, "SEED", "1");    /* same random numbers in each run */
+  sprintf(val, "%d", arena);
+  Zoltan_Set_Param(zz, "MEMORY_ARENA", val);
+  Zoltan_Set_Num_Obj_Fn(zz, numObj, g);
+  Zoltan_Set_Obj_List_Fn(zz, objList, g);
+  Zoltan_Set_Num_Geom_Fn(zz, numGeom, g);
+  Zoltan_Set_Geom_Multi_Fn(zz, geomMulti, g);
+  Zoltan_Set_Num_Edges_Multi_Fn(zz, numEdgesMulti, g);
+  Zoltan_Set_Edge_List_Multi_Fn(zz, edgeListMulti, g);
+
+  for (call = 0; call < ncalls; call++) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    t0 = MPI_Wtime();
+    ierr = Zoltan_LB_Partition(zz, &changes, &ngid, &nlid,
+                               &nimp, &impgid, &implid, &impproc, &imppart,
+                               &nexp, &expgid, &explid, &expproc, &exppart);
+    if (ierr != ZOLTAN_OK) {
+      (*nerrs)++;
+      break;
+    }
+    if (call == ncalls - 1)
+      for (i = 0; i < nexp; i++)
+        parts[explid[i]] = exppart[i];
+    Zoltan_LB_Free_Part(&impgid, &implid, &impproc, &imppart);
+    Zoltan_LB_Free_Part(&expgid, &explid, &expproc, &exppart);
+    t += MPI_Wtime() - t0;
+  }
+
+  Zoltan_Destroy(&zz);
+  return t;
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  GRID g;
+  int me, np, m, nloc;
+  int ncalls = 20;
+  int *parts[2];
+  size_t used;
+  double t[2], tmax[2];
+  int nerrs = 0, gerrs;
+  char *methods[] = { "RCB", "GRAPH", "HSFC" };
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  g.n = 100;
+  if (narg > 1) g.n = atoi(arg[1]);
+  if (narg > 2) ncalls = atoi(arg[2]);
+  g.np = np;
+  g.first = (int) (((long) g.n * g.n * me) / np);
+  g.last  = (int) (((long) g.n * g.n * (me + 1)) / np);
+  nloc = g.last - g.first;
+  parts[0] = (int *) malloc((nloc + 1) * sizeof(int));
+  parts[1] = (int *) malloc((nloc + 1) * sizeof(int));
+
+  for (m = 0; m < 3; m++) {
+    t[0] = run(&g, methods[m], 0, ncalls, parts[0], &nerrs);
+    t[1] = run(&g, methods[m], 1024, ncalls, parts[1], &nerrs);
+    if (memcmp(parts[0], parts[1], nloc * sizeof(int)) != 0) {
+      printf("%d of %d: %s partition differs with MEMORY_ARENA FAIL\n",
+             me, np, methods[m]);
+      nerrs++;
+    }
+
+    /* All memory taken during the calls is accounted for and freed */
+    Zoltan_Memory_Debug(2);
+    used = Zoltan_Memory_Usage(ZOLTAN_MEM_STAT_TOTAL);
+    run(&g, methods[m], 1024, 1, parts[1], &nerrs);
+    if (Zoltan_Memory_Usage(ZOLTAN_MEM_STAT_TOTAL) != used) {
+      printf("%d of %d: %s memory in use after partitioning FAIL\n",
+             me, np, methods[m]);
+      nerrs++;
+    }
+    Zoltan_Memory_Debug(0);
+
+    MPI_Reduce(t, tmax, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (me == 0)
+      printf("%d procs, %d x %d grid, %s x %d calls: "
+             "malloc %.4f s, arena %.4f s\n",
+             np, g.n, g.n, methods[m], ncalls, tmax[0], tmax[1]);
+  }
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  free(parts[0]);
+  free(parts[1]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
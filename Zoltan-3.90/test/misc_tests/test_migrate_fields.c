@@ -0,0 +1,400 @@
+/* Test and timing of Zoltan_Migrate with fields registered with            */
+/* Zoltan_Set_Migrate_Field against the pack and unpack functions.          */
+/* Usage: test_migrate_fields [particles per proc] [number of calls]        */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+#include "zoltan_comm.h"
+
+/* Particles stored by fields: global IDs, positions (within a record */
+/* with padding, to have a stride larger than the field) and masses.  */
+typedef struct {
+  double x[3];
+  int pad;
+} POS;
+
+typedef struct {
+  int n;                        /* number of particles */
+  ZOLTAN_ID_TYPE *gid;
+  POS *pos;
+  float *mass;
+} PARTICLES;
+
+#define OBJ_SIZE (sizeof(ZOLTAN_ID_TYPE) + 3 * sizeof(double) + sizeof(float))
+
+static void initParticle(PARTICLES *p, int i, ZOLTAN_ID_TYPE gid)
+{
+  p->gid[i] = gid;
+  p->pos[i].x[0] = 0.5 * gid;
+  p->pos[i].x[1] = 1.5 * gid;
+  p->pos[i].x[2] = -1. * gid;
+  p->pos[i].pad = -1;
+  p->mass[i] = (float) (gid % 1000);
+}
+
+static int checkParticle(PARTICLES *p, int i)
+{
+  ZOLTAN_ID_TYPE gid = p->gid[i];
+  return (p->pos[i].x[0] == 0.5 * gid && p->pos[i].x[1] == 1.5 * gid &&
+          p->pos[i].x[2] == -1. * gid && p->mass[i] == (float) (gid % 1000));
+}
+
+static void allocParticles(PARTICLES *p, int n)
+{
+  p->n = 0;
+  p->gid = (ZOLTAN_ID_TYPE *) malloc((n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  p->pos = (POS *) malloc((n + 1) * sizeof(POS));
+  p->mass = (float *) malloc((n + 1) * sizeof(float));
+}
+
+static void freeParticles(PARTICLES *p)
+{
+  free(p->gid);
+  free(p->pos);
+  free(p->mass);
+}
+
+/****************************************************************************/
+/* Pack and unpack functions, for the reference path                        */
+/****************************************************************************/
+static void objSizeMulti(void *data, int ngid, int nlid, int num,
+                         ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                         int *sizes, int *ierr)
+{
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < num; i++)
+    sizes[i] = (int) OBJ_SIZE;
+}
+
+static void packMulti(void *data, int ngid, int nlid, int num,
+                      ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids, int *dest,
+                      int *sizes, int *idx, char *buf, int *ierr)
+{
+  PARTICLES *p = (PARTICLES *) data;
+  int i;
+  char *b;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < num; i++) {
+    b = buf + idx[i];
+    memcpy(b, &p->gid[lids[i]], sizeof(ZOLTAN_ID_TYPE));
+    b += sizeof(ZOLTAN_ID_TYPE);
+    memcpy(b, p->pos[lids[i]].x, 3 * sizeof(double));
+    b += 3 * sizeof(double);
+    memcpy(b, &p->mass[lids[i]], sizeof(float));
+  }
+}
+
+static void unpackMulti(void *data, int ngid, int num, ZOLTAN_ID_PTR gids,
+                        int *sizes, int *idx, char *buf, int *ierr)
+{
+  PARTICLES *p = (PARTICLES *) data;
+  int i;
+  char *b;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < num; i++, p->n++) {
+    b = buf + idx[i];
+    memcpy(&p->gid[p->n], b, sizeof(ZOLTAN_ID_TYPE));
+    b += sizeof(ZOLTAN_ID_TYPE);
+    memcpy(p->pos[p->n].x, b, 3 * sizeof(double));
+    b += 3 * sizeof(double);
+    memcpy(&p->mass[p->n], b, sizeof(float));
+    if (p->gid[p->n] != gids[i]) *ierr = ZOLTAN_FATAL;
+  }
+}
+
+static int cmpGid(const void *a, const void *b)
+{
+  ZOLTAN_ID_TYPE x = *(const ZOLTAN_ID_TYPE *) a;
+  ZOLTAN_ID_TYPE y = *(const ZOLTAN_ID_TYPE *) b;
+  return (x > y) - (x < y);
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Send particle i to proc (gid % np) ncalls times; return the time spent */
+/* and the particles received by the last call in in.                     */
+static double run(PARTICLES *own, int fields, int onlyProc, int ncalls,
+                  PARTICLES *in, int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  ZOLTAN_ID_TYPE *expgid, *explid;
+  int *expproc;
+  int me, np, nexp = 0, call, i, ierr;
+  double t = 0., t0;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+
+  expgid = (ZOLTAN_ID_TYPE *) malloc((own->n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  explid = (ZOLTAN_ID_TYPE *) malloc((own->n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  expproc = (int *) malloc((own->n + 1) * sizeof(int));
+  for (i = 0; i < own->n; i++) {
+    expgid[nexp] = own->gid[i];
+    explid[nexp] = (ZOLTAN_ID_TYPE) i;
+    expproc[nexp++] = (int) (own->gid[i] % np);
+  }
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Param(zz, "MIGRATE_ONLY_PROC_CHANGES", onlyProc ? "1" : "0");
+  if (fields) {
+    Zoltan_Set_Migrate_Field(zz, 0, sizeof(ZOLTAN_ID_TYPE), own->gid, 0,
+                             in->gid, 0, own->n);
+    Zoltan_Set_Migrate_Field(zz, 1, 3 * sizeof(double), own->pos,
+                             sizeof(POS), in->pos, sizeof(POS), own->n);
+    Zoltan_Set_Migrate_Field(zz, 2, sizeof(float), own->mass, 0,
+                             in->mass, 0, own->n);
+  }
+  else {
+    Zoltan_Set_Obj_Size_Multi_Fn(zz, objSizeMulti, own);
+    Zoltan_Set_Pack_Obj_Multi_Fn(zz, packMulti, own);
+    Zoltan_Set_Unpack_Obj_Multi_Fn(zz, unpackMulti, in);
+  }
+
+  for (call = 0; call < ncalls; call++) {
+    in->n = 0;
+    MPI_Barrier(MPI_COMM_WORLD);
+    t0 = MPI_Wtime();
+    ierr = Zoltan_Migrate(zz, -1, NULL, NULL, NULL, NULL,
+                          nexp, expgid, explid, expproc, NULL);
+    t += MPI_Wtime() - t0;
+    if (ierr != ZOLTAN_OK) {
+      (*nerrs)++;
+      break;
+    }
+  }
+
+  /* Fields are imported in rows 0 to (number of imports - 1): all the */
+  /* particles sent to me, less mine if they are not exported.         */
+  if (fields) {
+    in->n = 0;
+    for (i = 0; i < np * own->n; i++)
+      if (i % np == me && !(onlyProc && i / own->n == me)) in->n++;
+  }
+
+  Zoltan_Destroy(&zz);
+  free(expgid);
+  free(explid);
+  free(expproc);
+  return t;
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Proc 0 owns no particle and registers NULL source arrays, which must not */
+/* unregister its fields.  Then proc 0 alone unregisters its fields, which  */
+/* must make Zoltan_Migrate fail on all procs instead of hanging.           */
+static void runNoObjects(PARTICLES *own, PARTICLES *in, int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  ZOLTAN_ID_TYPE *expgid, *explid;
+  int *expproc;
+  int me, np, n, nexp = 0, nimp, i, ierr;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+
+  n = (me == 0) ? 0 : own->n;
+  expgid = (ZOLTAN_ID_TYPE *) malloc((n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  explid = (ZOLTAN_ID_TYPE *) malloc((n + 1) * sizeof(ZOLTAN_ID_TYPE));
+  expproc = (int *) malloc((n + 1) * sizeof(int));
+  for (i = 0; i < n; i++) {
+    expgid[nexp] = own->gid[i];
+    explid[nexp] = (ZOLTAN_ID_TYPE) i;
+    expproc[nexp++] = (int) (own->gid[i] % np);
+  }
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Migrate_Field(zz, 0, sizeof(ZOLTAN_ID_TYPE),
+                           n ? own->gid : NULL, 0, in->gid, 0, own->n);
+  Zoltan_Set_Migrate_Field(zz, 1, 3 * sizeof(double),
+                           n ? own->pos : NULL, sizeof(POS),
+                           in->pos, sizeof(POS), own->n);
+  Zoltan_Set_Migrate_Field(zz, 2, sizeof(float),
+                           n ? own->mass : NULL, 0, in->mass, 0, own->n);
+
+  ierr = Zoltan_Migrate(zz, -1, NULL, NULL, NULL, NULL,
+                        nexp, expgid, explid, expproc, NULL);
+  if (ierr != ZOLTAN_OK) {
+    printf("%d of %d: migration with no object on proc 0 failed FAIL\n",
+           me, np);
+    (*nerrs)++;
+  }
+  else {
+    /* Imports are the particles of procs 1 to np-1 sent to me, less mine */
+    for (i = own->n, nimp = 0; i < np * own->n; i++)
+      if (i % np == me && i / own->n != me) nimp++;
+    for (i = 0; i < nimp; i++)
+      if ((int) (in->gid[i] % np) != me || in->gid[i] < own->n ||
+          !checkParticle(in, i)) {
+        printf("%d of %d: wrong particle received with no object on proc 0 "
+               "FAIL\n", me, np);
+        (*nerrs)++;
+        break;
+      }
+  }
+
+  if (np > 1) {
+    if (me == 0) {
+      printf("Expect errors: fields unregistered on proc 0 only\n");
+      for (i = 0; i < 3; i++)
+        Zoltan_Set_Migrate_Field(zz, i, 0, NULL, 0, NULL, 0, 0);
+      Zoltan_Set_Obj_Size_Multi_Fn(zz, objSizeMulti, own);
+      Zoltan_Set_Pack_Obj_Multi_Fn(zz, packMulti, own);
+      Zoltan_Set_Unpack_Obj_Multi_Fn(zz, unpackMulti, in);
+    }
+    in->n = 0;
+    ierr = Zoltan_Migrate(zz, -1, NULL, NULL, NULL, NULL,
+                          nexp, expgid, explid, expproc, NULL);
+    if (ierr != ZOLTAN_FATAL) {
+      printf("%d of %d: mismatched field registration accepted FAIL\n",
+             me, np);
+      (*nerrs)++;
+    }
+  }
+
+  Zoltan_Destroy(&zz);
+  free(expgid);
+  free(explid);
+  free(expproc);
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Proc 0 sends its first particle to proc 1, and the other procs neither   */
+/* send nor receive.  Idle procs must still take part in the collective     */
+/* steps of Zoltan_Migrate and Zoltan_Comm_Do_Fields, or the others hang.   */
+static void runIdleProc(PARTICLES *own, PARTICLES *in, int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  ZOLTAN_COMM_OBJ *plan;
+  ZOLTAN_COMM_FIELD field;
+  ZOLTAN_ID_TYPE expgid[1], explid[1];
+  int expproc[1];
+  int me, np, dest, nexp, nrecv, nimp, ierr;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+
+  dest = 1 % np;
+  nexp = (me == 0 && dest != 0) ? 1 : 0;
+  nimp = (me == dest && dest != 0) ? 1 : 0;
+  expgid[0] = own->gid[0];
+  explid[0] = 0;
+  expproc[0] = dest;
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Migrate_Field(zz, 0, sizeof(ZOLTAN_ID_TYPE), own->gid, 0,
+                           in->gid, 0, own->n);
+  Zoltan_Set_Migrate_Field(zz, 1, 3 * sizeof(double), own->pos,
+                           sizeof(POS), in->pos, sizeof(POS), own->n);
+  Zoltan_Set_Migrate_Field(zz, 2, sizeof(float), own->mass, 0,
+                           in->mass, 0, own->n);
+
+  ierr = Zoltan_Migrate(zz, -1, NULL, NULL, NULL, NULL,
+                        nexp, expgid, explid, expproc, NULL);
+  if (ierr != ZOLTAN_OK) {
+    printf("%d of %d: migration with idle procs failed FAIL\n", me, np);
+    (*nerrs)++;
+  }
+  else if (nimp && (in->gid[0] != 0 || !checkParticle(in, 0))) {
+    printf("%d of %d: wrong particle received with idle procs FAIL\n",
+           me, np);
+    (*nerrs)++;
+  }
+  Zoltan_Destroy(&zz);
+
+  /* Same exchange through Zoltan_Comm_Do_Fields alone */
+  in->gid[0] = (ZOLTAN_ID_TYPE) -1;
+  ierr = Zoltan_Comm_Create(&plan, nexp, expproc, MPI_COMM_WORLD, 1, &nrecv);
+  if (ierr == ZOLTAN_OK) {
+    field.send = (char *) own->gid;
+    field.send_stride = sizeof(ZOLTAN_ID_TYPE);
+    field.recv = (char *) in->gid;
+    field.recv_stride = sizeof(ZOLTAN_ID_TYPE);
+    field.size = sizeof(ZOLTAN_ID_TYPE);
+    ierr = Zoltan_Comm_Do_Fields(plan, 2, 1, &field, NULL);
+    Zoltan_Comm_Destroy(&plan);
+  }
+  if (ierr != ZOLTAN_OK || nrecv != nimp ||
+      (nimp && in->gid[0] != 0)) {
+    printf("%d of %d: field exchange with idle procs failed FAIL\n", me, np);
+    (*nerrs)++;
+  }
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  PARTICLES own, in[2];
+  int me, np, i, k, onlyProc;
+  int nloc = 10000, ncalls = 10;
+  double t[2], tmax[2];
+  int nerrs = 0, gerrs;
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  if (narg > 1) nloc = atoi(arg[1]);
+  if (narg > 2) ncalls = atoi(arg[2]);
+
+  allocParticles(&own, nloc);
+  allocParticles(&in[0], nloc);
+  allocParticles(&in[1], nloc);
+  for (i = 0; i < nloc; i++)
+    initParticle(&own, i, (ZOLTAN_ID_TYPE) (me * nloc + i));
+  own.n = nloc;
+
+  for (onlyProc = 1; onlyProc >= 0; onlyProc--) {
+    t[0] = run(&own, 0, onlyProc, ncalls, &in[0], &nerrs);
+    t[1] = run(&own, 1, onlyProc, ncalls, &in[1], &nerrs);
+
+    /* Both paths import the same particles, with the right data */
+    for (k = 0; k < 2; k++)
+      for (i = 0; i < in[k].n; i++)
+        if ((int) (in[k].gid[i] % np) != me || !checkParticle(&in[k], i)) {
+          printf("%d of %d: wrong particle received with %s FAIL\n",
+                 me, np, k ? "fields" : "pack");
+          nerrs++;
+          break;
+        }
+    qsort(in[0].gid, in[0].n, sizeof(ZOLTAN_ID_TYPE), cmpGid);
+    qsort(in[1].gid, in[1].n, sizeof(ZOLTAN_ID_TYPE), cmpGid);
+    if (in[0].n != in[1].n ||
+        memcmp(in[0].gid, in[1].gid, in[0].n * sizeof(ZOLTAN_ID_TYPE))) {
+      printf("%d of %d: particles imported with fields differ FAIL\n", me, np);
+      nerrs++;
+    }
+
+    MPI_Reduce(t, tmax, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (me == 0)
+      printf("%d procs, %d particles per proc, MIGRATE_ONLY_PROC_CHANGES=%d, "
+             "%d calls: pack %.4f s, fields %.4f s\n",
+             np, nloc, onlyProc, ncalls, tmax[0], tmax[1]);
+  }
+
+  runNoObjects(&own, &in[1], &nerrs);
+  runIdleProc(&own, &in[1], &nerrs);
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  freeParticles(&own);
+  freeParticles(&in[0]);
+  freeParticles(&in[1]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
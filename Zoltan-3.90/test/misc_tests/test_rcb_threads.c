@@ -0,0 +1,184 @@
+/* Test and timing of RCB and RIB with threaded median scans                */
+/* (RCB_NUM_THREADS, RIB_NUM_THREADS): with integer weights, sums are exact */
+/* in any order, so the parts are the same as the sequential ones.          */
+/* Usage: test_rcb_threads [points per proc] [threads]                      */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mpi.h>
+#include "zoltan.h"
+
+/* Points with pseudo-random coordinates and integer weights */
+typedef struct {
+  int n;
+  int first;                    /* global ID of the first point */
+  double *x;                    /* 3 coordinates per point */
+  float *w;
+} POINTS;
+
+/****************************************************************************/
+/****************************************************************************/
+static int numObj(void *data, int *ierr)
+{
+  *ierr = ZOLTAN_OK;
+  return ((POINTS *) data)->n;
+}
+
+static void objList(void *data, int ngid, int nlid,
+                    ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids,
+                    int wdim, float *wgts, int *ierr)
+{
+  POINTS *p = (POINTS *) data;
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < p->n; i++) {
+    gids[i] = (ZOLTAN_ID_TYPE) (p->first + i);
+    lids[i] = (ZOLTAN_ID_TYPE) i;
+    if (wdim > 0) wgts[i] = p->w[i];
+  }
+}
+
+static int numGeom(void *data, int *ierr)
+{
+  *ierr = ZOLTAN_OK;
+  return 3;
+}
+
+static void geomMulti(void *data, int ngid, int nlid, int num,
+                      ZOLTAN_ID_PTR gids, ZOLTAN_ID_PTR lids, int dim,
+                      double *geom, int *ierr)
+{
+  POINTS *p = (POINTS *) data;
+  int i;
+  *ierr = ZOLTAN_OK;
+  for (i = 0; i < num; i++)
+    memcpy(geom + 3 * i, p->x + 3 * lids[i], 3 * sizeof(double));
+}
+
+/****************************************************************************/
+/****************************************************************************/
+/* Partition the points with method into parts, with the given number of */
+/* threads; return the time spent.                                       */
+static double run(POINTS *p, const char *method, int threads, int *parts,
+                  int *nerrs)
+{
+  struct Zoltan_Struct *zz;
+  ZOLTAN_ID_PTR impgid, implid, expgid, explid;
+  int *impproc, *imppart, *expproc, *exppart;
+  int changes, ngid, nlid, nimp, nexp, np, i, ierr;
+  char param[32], value[16];
+  double t;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+  zz = Zoltan_Create(MPI_COMM_WORLD);
+  Zoltan_Set_Param(zz, "DEBUG_LEVEL", "0");
+  Zoltan_Set_Param(zz, "LB_METHOD", method);
+  Zoltan_Set_Param(zz, "OBJ_WEIGHT_DIM", "1");
+  Zoltan_Set_Param(zz, "RETURN_LISTS", "PARTS");
+  Zoltan_Set_Param(zz, "NUM_GLOBAL_PARTS", "16");
+  sprintf(param, "%s_NUM_THREADS", method);
+  sprintf(value, "%d", threads);
+  Zoltan_Set_Param(zz, param, value);
+  Zoltan_Set_Num_Obj_Fn(zz, numObj, p);
+  Zoltan_Set_Obj_List_Fn(zz, objList, p);
+  Zoltan_Set_Num_Geom_Fn(zz, numGeom, p);
+  Zoltan_Set_Geom_Multi_Fn(zz, geomMulti, p);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  t = MPI_Wtime();
+  ierr = Zoltan_LB_Partition(zz, &changes, &ngid, &nlid,
+                             &nimp, &impgid, &implid, &impproc, &imppart,
+                             &nexp, &expgid, &explid, &expproc, &exppart);
+  t = MPI_Wtime() - t;
+
+  if (ierr != ZOLTAN_OK || nexp != p->n) {
+    printf("%s with %d threads failed FAIL\n", method, threads);
+    (*nerrs)++;
+  }
+  else {
+    for (i = 0; i < p->n; i++) parts[i] = -1;
+    for (i = 0; i < nexp; i++) parts[explid[i]] = exppart[i];
+    for (i = 0; i < p->n; i++)
+      if (parts[i] < 0 || parts[i] >= 16) {
+        printf("%s with %d threads: invalid part FAIL\n", method, threads);
+        (*nerrs)++;
+        break;
+      }
+  }
+
+  Zoltan_LB_Free_Part(&impgid, &implid, &impproc, &imppart);
+  Zoltan_LB_Free_Part(&expgid, &explid, &expproc, &exppart);
+  Zoltan_Destroy(&zz);
+  return t;
+}
+
+/****************************************************************************/
+/****************************************************************************/
+int main (int narg, char **arg)
+{
+  float ver;
+  POINTS p;
+  int me, np, i, m, ndiff;
+  int nloc = 50000, nthreads = 4;
+  int *parts[2];
+  unsigned int seed;
+  double t[2], tmax[2];
+  static const char *methods[2] = {"RCB", "RIB"};
+  int nerrs = 0, gerrs;
+
+  /* Initialize Zoltan */
+  MPI_Init(&narg, &arg);
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  Zoltan_Initialize(narg, arg, &ver);
+
+  if (narg > 1) nloc = atoi(arg[1]);
+  if (narg > 2) nthreads = atoi(arg[2]);
+
+  p.n = nloc;
+  p.first = me * nloc;
+  p.x = (double *) malloc((3 * nloc + 1) * sizeof(double));
+  p.w = (float *) malloc((nloc + 1) * sizeof(float));
+  parts[0] = (int *) malloc((nloc + 1) * sizeof(int));
+  parts[1] = (int *) malloc((nloc + 1) * sizeof(int));
+  seed = 12345u + 7919u * (unsigned int) me;
+  for (i = 0; i < 3 * nloc; i++) {
+    seed = seed * 1103515245u + 12345u;
+    p.x[i] = (double) ((seed >> 8) & 0xFFFF) / 65536.;
+  }
+  for (i = 0; i < nloc; i++)
+    p.w[i] = (float) (1 + (p.first + i) % 5);
+
+  for (m = 0; m < 2; m++) {
+    t[0] = run(&p, methods[m], 1, parts[0], &nerrs);
+    t[1] = run(&p, methods[m], nthreads, parts[1], &nerrs);
+
+    for (i = 0, ndiff = 0; i < nloc; i++)
+      if (parts[0][i] != parts[1][i]) ndiff++;
+    if (ndiff != 0) {
+      printf("%d of %d: %s parts differ with %d threads for %d points FAIL\n",
+             me, np, methods[m], nthreads, ndiff);
+      nerrs++;
+    }
+
+    MPI_Reduce(t, tmax, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if (me == 0)
+      printf("%d procs, %d points per proc, %s: 1 thread %.4f s, "
+             "%d threads %.4f s\n",
+             np, nloc, methods[m], tmax[0], nthreads, tmax[1]);
+  }
+
+  /* Wrap up */
+  MPI_Allreduce(&nerrs, &gerrs, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  if (me == 0 && gerrs == 0) printf("PASS\n");
+
+  free(p.x);
+  free(p.w);
+  free(parts[0]);
+  free(parts[1]);
+  MPI_Finalize();
+
+  return (gerrs != 0);
+}
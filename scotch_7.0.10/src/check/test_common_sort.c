@@ -0,0 +1,369 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_common_sort.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the integer sorting   **/
+/**                routines and measures their speed.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE               600
+#endif /* _XOPEN_SOURCE */
+#ifndef __USE_XOPEN2K
+#define __USE_XOPEN2K                             /* For POSIX pthread_barrier_t */
+#endif /* __USE_XOPEN2K */
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#define SORTNBRMAX                  1000000       /* Default size of timed arrays */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The sort routine types. +*/
+
+typedef void (* TestSortFunc) (void * const, const INT);
+typedef void (* TestRsortFunc) (void * const, const INT, Context * const);
+
+/*+ The tested sort types. +*/
+
+typedef struct TestSort_ {
+  const char *              nameptr;              /*+ Name of sort type          +*/
+  int                       valsnbr;              /*+ Number of values per tuple +*/
+  int                       keysnbr;              /*+ Number of key values       +*/
+  TestSortFunc              sortptr;              /*+ Sequential sort routine    +*/
+  TestRsortFunc             rsrtptr;              /*+ Context-aware sort routine +*/
+} TestSort;
+
+/*+ The key distributions. +*/
+
+typedef enum TestDist_ {
+  TESTDISTRAND,                                   /*+ Random keys           +*/
+  TESTDISTSORT,                                   /*+ Already sorted keys   +*/
+  TESTDISTREVS,                                   /*+ Reverse-sorted keys   +*/
+  TESTDISTDUPL,                                   /*+ Heavily duplicated keys +*/
+  TESTDISTNBR                                     /*+ Number of distributions +*/
+} TestDist;
+
+/*
+**  The static and global variables.
+*/
+
+static const char *         C_distnametab[TESTDISTNBR] = { "random", "sorted", "reversed", "duplicated" };
+
+static TestSort             C_sorttab[] = {
+  { "intSort1asc1", 1, 1, intSort1asc1, intRsort1asc1 },
+  { "intSort2asc1", 2, 1, intSort2asc1, intRsort2asc1 },
+  { "intSort2asc2", 2, 2, intSort2asc2, intRsort2asc2 },
+  { "intSort3asc1", 3, 1, intSort3asc1, intRsort3asc1 },
+  { "intSort3asc2", 3, 2, intSort3asc2, intRsort3asc2 },
+  { NULL,           0, 0, NULL,         NULL } };
+
+static int                  C_valsnbr;            /* Tuple size for comparison routine */
+
+/*************************/
+/*                       */
+/* The helper routines.  */
+/*                       */
+/*************************/
+
+/* This routine compares two tuples on
+** all of their values, for use by qsort().
+*/
+
+static
+int
+testCompare (
+const void * const          dat0ptr,
+const void * const          dat1ptr)
+{
+  const INT * const   val0tab = (const INT *) dat0ptr;
+  const INT * const   val1tab = (const INT *) dat1ptr;
+  int                 valnum;
+
+  for (valnum = 0; valnum < C_valsnbr; valnum ++) {
+    if (val0tab[valnum] != val1tab[valnum])
+      return ((val0tab[valnum] < val1tab[valnum]) ? -1 : 1);
+  }
+  return (0);
+}
+
+/* This routine fills an array of tuples with
+** keys of the given distribution. The last
+** value of tuples that have one is the index
+** of the tuple, so as to check stability.
+*/
+
+static
+void
+testFill (
+INT * const                 sorttab,
+const INT                   sortnbr,
+const TestSort * const      typeptr,
+const TestDist              distval,
+Context * const             contptr)
+{
+  INT                 sortnum;
+
+  for (sortnum = 0; sortnum < sortnbr; sortnum ++) {
+    INT * const         tuplptr = sorttab + sortnum * typeptr->valsnbr;
+    int                 valnum;
+
+    for (valnum = 0; valnum < typeptr->valsnbr; valnum ++) {
+      INT                 randval;
+
+      randval = (INT) intRandVal2 (contptr->randptr);
+      switch (distval) {
+        case TESTDISTRAND :
+          tuplptr[valnum] = randval;              /* Both signs and full range */
+          break;
+        case TESTDISTSORT :
+          tuplptr[valnum] = (valnum == 0) ? (sortnum / 3) - (sortnbr / 6) : (randval & 7);
+          break;
+        case TESTDISTREVS :
+          tuplptr[valnum] = (valnum == 0) ? (sortnbr - sortnum) : (randval & 7);
+          break;
+        default :
+          tuplptr[valnum] = (randval & 15) - 4;   /* Few distinct small keys */
+          break;
+      }
+    }
+    if (typeptr->valsnbr > typeptr->keysnbr)      /* Satellite value is tuple index */
+      tuplptr[typeptr->valsnbr - 1] = sortnum;
+  }
+  if (distval == TESTDISTSORT) {                  /* Make sure secondary keys are sorted too */
+    C_valsnbr = typeptr->valsnbr;
+    qsort (sorttab, sortnbr, typeptr->valsnbr * sizeof (INT), testCompare);
+    if (typeptr->valsnbr > typeptr->keysnbr) {
+      for (sortnum = 0; sortnum < sortnbr; sortnum ++)
+        sorttab[sortnum * typeptr->valsnbr + typeptr->valsnbr - 1] = sortnum;
+    }
+  }
+}
+
+/* This routine checks that the sorted array
+** is a permutation of the original one, that
+** it is sorted by keys, and that elements with
+** equal keys kept their order when requested.
+** It returns:
+** - 0   : if array is correct.
+** - !0  : on error.
+*/
+
+static
+int
+testCheck (
+const INT * const           sorttab,
+INT * const                 origtab,              /* Original array, destroyed */
+INT * const                 chektab,              /* Work array                */
+const INT                   sortnbr,
+const TestSort * const      typeptr,
+const int                   stabval)              /* Check for stability       */
+{
+  INT                 sortnum;
+
+  const int           valsnbr = typeptr->valsnbr;
+  const int           keysnbr = typeptr->keysnbr;
+
+  for (sortnum = 1; sortnum < sortnbr; sortnum ++) {
+    const INT * const   prevptr = sorttab + (sortnum - 1) * valsnbr;
+    const INT * const   tuplptr = prevptr + valsnbr;
+    int                 valnum;
+
+    for (valnum = 0; valnum < keysnbr; valnum ++) {
+      if (tuplptr[valnum] != prevptr[valnum])
+        break;
+    }
+    if (valnum < keysnbr) {
+      if (tuplptr[valnum] < prevptr[valnum]) {
+        errorPrint ("testCheck: array not sorted");
+        return (1);
+      }
+    }
+    else if ((stabval != 0) && (valsnbr > keysnbr) &&
+             (tuplptr[valsnbr - 1] < prevptr[valsnbr - 1])) {
+      errorPrint ("testCheck: sort not stable");
+      return (1);
+    }
+  }
+
+  C_valsnbr = valsnbr;
+  memCpy (chektab, sorttab, sortnbr * valsnbr * sizeof (INT));
+  qsort  (chektab, sortnbr, valsnbr * sizeof (INT), testCompare);
+  qsort  (origtab, sortnbr, valsnbr * sizeof (INT), testCompare);
+  if (memcmp (chektab, origtab, sortnbr * valsnbr * sizeof (INT)) != 0) {
+    errorPrint ("testCheck: not a permutation of original array");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  Context             contdat;
+  INT *               sorttab;
+  INT *               origtab;
+  INT *               chektab;
+  INT *               seqttab;
+  INT                 sortmax;
+  const TestSort *    typeptr;
+  int                 thrdnbr;
+  int                 o;
+
+  static const INT    sortnbrtab[] = { 0, 1, 100, 5000, 200000, -1 };
+
+  errorProg (argv[0]);
+
+  if ((argc < 1) || (argc > 2)) {
+    errorPrint ("usage: %s [size]", argv[0]);
+    exit       (EXIT_FAILURE);
+  }
+
+  sortmax = (argc > 1) ? (INT) atol (argv[1]) : SORTNBRMAX;
+  if (sortmax < sortnbrtab[4])
+    sortmax = sortnbrtab[4];
+
+  contextInit (&contdat);
+  if (contextCommit (&contdat) != 0) {
+    errorPrint ("main: cannot initialize context");
+    exit       (EXIT_FAILURE);
+  }
+  thrdnbr = contextThreadNbr (&contdat);
+  printf ("%d threads in context\n", thrdnbr);
+
+  if (memAllocGroup ((void **) (void *)
+                     &sorttab, (size_t) (sortmax * 3 * sizeof (INT)),
+                     &origtab, (size_t) (sortmax * 3 * sizeof (INT)),
+                     &chektab, (size_t) (sortmax * 3 * sizeof (INT)),
+                     &seqttab, (size_t) (sortmax * 3 * sizeof (INT)), NULL) == NULL) {
+    errorPrint ("main: out of memory");
+    exit       (EXIT_FAILURE);
+  }
+
+  o = 0;
+  for (typeptr = C_sorttab; typeptr->nameptr != NULL; typeptr ++) { /* Correctness tests */
+    TestDist            distval;
+    int                 sortidx;
+
+    for (distval = 0; distval < TESTDISTNBR; distval ++) {
+      for (sortidx = 0; sortnbrtab[sortidx] >= 0; sortidx ++) {
+        const INT           sortnbr = sortnbrtab[sortidx];
+        const size_t        sortsiz = sortnbr * typeptr->valsnbr * sizeof (INT);
+
+        testFill (origtab, sortnbr, typeptr, distval, &contdat);
+
+        memCpy (seqttab, origtab, sortsiz);       /* Sequential routine */
+        typeptr->sortptr (seqttab, sortnbr);
+
+        memCpy (sorttab, origtab, sortsiz);       /* Threaded routine   */
+        typeptr->rsrtptr (sorttab, sortnbr, &contdat);
+        if (memcmp (sorttab, seqttab, sortsiz) != 0) {
+          errorPrint ("main: sequential and threaded results differ (%s, %s, " INTSTRING ")",
+                      typeptr->nameptr, C_distnametab[distval], sortnbr);
+          o = 1;
+        }
+
+        if (testCheck (sorttab, origtab, chektab, sortnbr, typeptr, (sortnbr >= 5000)) != 0) {
+          errorPrint ("main: invalid sort (%s, %s, " INTSTRING ")",
+                      typeptr->nameptr, C_distnametab[distval], sortnbr);
+          o = 1;
+        }
+      }
+    }
+  }
+  if (o != 0)
+    exit (EXIT_FAILURE);
+
+  for (typeptr = C_sorttab; typeptr->nameptr != NULL; typeptr ++) { /* Throughput measurements */
+    TestDist            distval;
+
+    for (distval = 0; distval < TESTDISTNBR; distval ++) {
+      const size_t        sortsiz = sortmax * typeptr->valsnbr * sizeof (INT);
+      double              timetab[3];
+
+      testFill (origtab, sortmax, typeptr, distval, &contdat);
+
+      memCpy (sorttab, origtab, sortsiz);
+      C_valsnbr = typeptr->keysnbr;               /* Compare on keys only */
+      timetab[0] = clockGet ();
+      qsort (sorttab, sortmax, typeptr->valsnbr * sizeof (INT), testCompare);
+      timetab[0] = clockGet () - timetab[0];
+
+      memCpy (sorttab, origtab, sortsiz);
+      timetab[1] = clockGet ();
+      typeptr->sortptr (sorttab, sortmax);
+      timetab[1] = clockGet () - timetab[1];
+
+      memCpy (sorttab, origtab, sortsiz);
+      timetab[2] = clockGet ();
+      typeptr->rsrtptr (sorttab, sortmax, &contdat);
+      timetab[2] = clockGet () - timetab[2];
+
+      printf ("%s %-10s " INTSTRING " : qsort %g Mel/s, sequential %g Mel/s, %d threads %g Mel/s\n",
+              typeptr->nameptr, C_distnametab[distval], sortmax,
+              (double) sortmax / (1.0e6 * MAX (timetab[0], 1.0e-9)),
+              (double) sortmax / (1.0e6 * MAX (timetab[1], 1.0e-9)), thrdnbr,
+              (double) sortmax / (1.0e6 * MAX (timetab[2], 1.0e-9)));
+    }
+  }
+
+  memFree     (sorttab);                          /* Free group leader */
+  contextExit (&contdat);
+
+  exit (EXIT_SUCCESS);
+}
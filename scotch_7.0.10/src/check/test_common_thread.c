@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2015,2018,2019,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2015,2018,2019,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 04 nov 2012     **/
 /**                                 to   : 10 jul 2018     **/
 /**                # Version 7.0  : from : 21 aug 2019     **/
-/**                                 to   : 31 aug 2021     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,8 @@
 
 #define COMPVAL(n)                  (((n) * ((n) + 1)) / 2)
 
+#define TASKNBR                     100000        /* Number of leaves in task tree */
+
 /*
 **  The static and global variables.
 */
@@ -82,6 +84,14 @@ typedef struct TestData_ {
   int                       scanval[2];           /*+ Values for scan +*/
 } TestData;
 
+/*+ The task data structure. +*/
+
+typedef struct TestTask_ {
+  int                       vertmin;              /*+ First value of range     +*/
+  int                       vertnnd;              /*+ After last value         +*/
+  long                      sumval;               /*+ Sum of values of range   +*/
+} TestTask;
+
 /*+ The block data structure +*/
 
 typedef struct TestGroup_ {
@@ -165,6 +175,38 @@ volatile TestGroup * restrict     grouptr)
   threadBarrier (descptr);                        /* Final barrier before freeing work array */
 }
 
+/* The recursive task routine. */
+
+static
+void
+testTask (
+ThreadContext * restrict const  contptr,
+TestTask * restrict const       taskptr)
+{
+  TestTask            tasktab[2];
+  ThreadTask          taskdat;
+  int                 vertmed;
+
+  if ((taskptr->vertnnd - taskptr->vertmin) <= 1) { /* If leaf task */
+    taskptr->sumval = (long) taskptr->vertmin;
+    return;
+  }
+
+  vertmed = (taskptr->vertmin + taskptr->vertnnd + 1) / 2; /* Unequal split on purpose */
+  tasktab[0].vertmin = taskptr->vertmin;
+  tasktab[0].vertnnd = vertmed;
+  tasktab[1].vertmin = vertmed;
+  tasktab[1].vertnnd = taskptr->vertnnd;
+
+  taskdat.funcptr = (ThreadTaskFunc) testTask;
+  taskdat.paraptr = (void *) &tasktab[1];
+  threadTaskSpawn (contptr, &taskdat);
+  testTask (contptr, &tasktab[0]);
+  threadTaskSync  (contptr, &taskdat);
+
+  taskptr->sumval = tasktab[0].sumval + tasktab[1].sumval;
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -178,6 +220,7 @@ char *              argv[])
 {
   ThreadContext       contdat;
   TestGroup           groudat;
+  TestTask            taskdat;
   int                 thrdnbr;
 
   errorProg (argv[0]);
@@ -209,6 +252,20 @@ char *              argv[])
 
   free (groudat.datatab);
 
+  printf ("Performing task spawning\n");
+
+  taskdat.vertmin = 1;
+  taskdat.vertnnd = TASKNBR + 1;
+  taskdat.sumval  = 0;
+  if (threadTaskLaunch (&contdat, (ThreadTaskFunc) testTask, (void *) &taskdat) != 0) {
+    errorPrint ("main: cannot launch tasks");
+    exit       (EXIT_FAILURE);
+  }
+  if (taskdat.sumval != COMPVAL ((long) TASKNBR)) {
+    errorPrint ("main: invalid task result");
+    C_erroval = 1;
+  }
+
   threadContextExit (&contdat);
 
   exit ((C_erroval == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
@@ -0,0 +1,621 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_gain.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module benchmarks the gain table,  **/
+/**                Fibonacci heap and bucket array gain    **/
+/**                structures, by replaying Fiduccia-      **/
+/**                Mattheyses move traces recorded on a    **/
+/**                graph.                                  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/fibo.h"
+#include "../libscotch/gain.h"
+#include "../libscotch/gain_bckt.h"
+
+#include "scotch.h"
+
+#define TEST_PASSNBR                5             /* Default number of timed replays          */
+#define TEST_FMPASSNBR              4             /* Number of recorded FM passes             */
+#define TEST_GAINBITS               4             /* Gain table subbits, as in FM algorithms  */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Trace operation types. +*/
+
+typedef enum TestGainType_ {
+  TESTGAINADD,                                    /*+ Add element with given gain      +*/
+  TESTGAINDEL,                                    /*+ Remove element                   +*/
+  TESTGAINMIN,                                    /*+ Get element of best (given) gain +*/
+  TESTGAINFREE                                    /*+ Flush structure                  +*/
+} TestGainType;
+
+/*+ Trace operation. +*/
+
+typedef struct TestGainOper_ {
+  TestGainType              typeval;              /*+ Operation type           +*/
+  INT                       elemnum;              /*+ Element index, if any    +*/
+  INT                       gainval;              /*+ Gain value, if any       +*/
+} TestGainOper;
+
+/*+ Trace. +*/
+
+typedef struct TestGainTrac_ {
+  TestGainOper *            opertab;              /*+ Array of operations      +*/
+  INT                       opernbr;              /*+ Number of operations     +*/
+  INT                       opermax;              /*+ Size of operation array  +*/
+  INT                       gainmin;              /*+ Smallest recorded gain   +*/
+  INT                       gainmax;              /*+ Largest recorded gain    +*/
+} TestGainTrac;
+
+/*+ Elements of each structure. +*/
+
+typedef struct TestGainTabl_ {
+  GainLink                  linkdat;              /*+ Gain link: FIRST +*/
+  INT                       gainval;
+} TestGainTabl;
+
+typedef struct TestGainFibo_ {
+  FiboNode                  nodedat;              /*+ Heap node: FIRST +*/
+  INT                       gainval;
+} TestGainFibo;
+
+typedef struct TestGainBckt_ {
+  GainBcktLink              linkdat;              /*+ Bucket link: FIRST +*/
+  INT                       gainval;
+} TestGainBckt;
+
+/* This routine returns the element of exact
+** best gain in the bucket array, by scanning
+** the first bucket, since large gains may
+** share the same bucket.
+** It returns:
+** - !GAINBCKTNONE  : index of the element.
+** - GAINBCKTNONE   : if array is empty.
+*/
+
+static
+INT
+testGainBcktBest (
+GainBckt * const            bcktptr,
+const TestGainBckt * const  elemtab)
+{
+  INT                 elembest;
+  INT                 elemnum;
+  INT                 keyval;
+
+  if ((elembest = gainBcktFrst (bcktptr)) == GAINBCKTNONE)
+    return (GAINBCKTNONE);
+
+  for (elemnum = gainBcktNext (bcktptr, elembest), keyval = elemtab[elembest].linkdat.keyval;
+       (elemnum != GAINBCKTNONE) && (elemtab[elemnum].linkdat.keyval == keyval);
+       elemnum = gainBcktNext (bcktptr, elemnum)) {
+    if (elemtab[elemnum].gainval < elemtab[elembest].gainval)
+      elembest = elemnum;
+  }
+
+  return (elembest);
+}
+
+/*********************************/
+/*                               */
+/* The trace recording routines. */
+/*                               */
+/*********************************/
+
+static
+int
+testGainTracAdd (
+TestGainTrac * const        tracptr,
+const TestGainType          typeval,
+const INT                   elemnum,
+const INT                   gainval)
+{
+  TestGainOper *      operptr;
+
+  if (tracptr->opernbr >= tracptr->opermax) {     /* If operation array is full, enlarge it */
+    TestGainOper *      opertmp;
+    INT                 opermax;
+
+    opermax = tracptr->opermax + (tracptr->opermax >> 1) + 1024;
+    if ((opertmp = realloc (tracptr->opertab, opermax * sizeof (TestGainOper))) == NULL)
+      return (1);
+    tracptr->opertab = opertmp;
+    tracptr->opermax = opermax;
+  }
+
+  operptr = &tracptr->opertab[tracptr->opernbr ++];
+  operptr->typeval = typeval;
+  operptr->elemnum = elemnum;
+  operptr->gainval = gainval;
+  if (gainval < tracptr->gainmin)
+    tracptr->gainmin = gainval;
+  if (gainval > tracptr->gainmax)
+    tracptr->gainmax = gainval;
+
+  return (0);
+}
+
+/* This routine records the operations performed
+** on the gain structure by several passes of a
+** simplified Fiduccia-Mattheyses bipartitioning
+** algorithm, without balance constraint nor
+** rollback, starting from a bipartition of the
+** vertices by index. The bucket array is used
+** to select best vertices.
+** It returns:
+** - 0   : if trace could be recorded.
+** - !0  : on error.
+*/
+
+static
+int
+testGainTracBuild (
+TestGainTrac * const        tracptr,
+const SCOTCH_Graph * const  grafptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        verttax;
+  SCOTCH_Num *        vendtax;
+  SCOTCH_Num *        edgetax;
+  SCOTCH_Num *        edlotax;
+  SCOTCH_Num          vertnum;
+  TestGainBckt *      elemtab;
+  GainBckt            bcktdat;
+  int *               parttab;
+  int *               locktab;
+  INT *               cuttab;
+  int                 passnum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttax, &vendtax, NULL, NULL, NULL, &edgetax, &edlotax);
+  verttax -= baseval;
+  vendtax -= baseval;
+  edgetax -= baseval;
+  edlotax  = (edlotax != NULL) ? (edlotax - baseval) : NULL;
+
+  if (((elemtab = malloc (vertnbr * sizeof (TestGainBckt))) == NULL) ||
+      ((parttab = malloc (vertnbr * sizeof (int)))          == NULL) ||
+      ((locktab = malloc (vertnbr * sizeof (int)))          == NULL) ||
+      ((cuttab  = malloc (vertnbr * sizeof (INT)))          == NULL) ||
+      (gainBcktInit (&bcktdat, elemtab, sizeof (TestGainBckt)) != 0)) {
+    SCOTCH_errorPrint ("testGainTracBuild: out of memory");
+    return (1);
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) /* Split vertices by index */
+    parttab[vertnum] = (vertnum >= (vertnbr / 2)) ? 1 : 0;
+
+  for (passnum = 0; passnum < TEST_FMPASSNBR; passnum ++) {
+    INT                 movenbr;
+
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) { /* Compute gains of frontier vertices */
+      SCOTCH_Num          edgenum;
+      INT                 gainval;
+      INT                 cutnbr;
+
+      for (edgenum = verttax[vertnum + baseval], gainval = cutnbr = 0;
+           edgenum < vendtax[vertnum + baseval]; edgenum ++) {
+        SCOTCH_Num          vertend;
+        INT                 edloval;
+
+        vertend = edgetax[edgenum] - baseval;
+        edloval = (edlotax != NULL) ? (INT) edlotax[edgenum] : 1;
+        if (parttab[vertend] != parttab[vertnum]) {
+          gainval -= edloval;
+          cutnbr ++;
+        }
+        else
+          gainval += edloval;
+      }
+      elemtab[vertnum].gainval = gainval;
+      cuttab[vertnum]  = cutnbr;
+      locktab[vertnum] = 0;
+      if (cutnbr > 0) {
+        gainBcktAdd (&bcktdat, (INT) vertnum, gainval);
+        if (testGainTracAdd (tracptr, TESTGAINADD, (INT) vertnum, gainval) != 0)
+          goto fail;
+      }
+      else
+        elemtab[vertnum].linkdat.nextnum = -2;    /* Element not linked */
+    }
+
+    for (movenbr = vertnbr / 4; movenbr > 0; movenbr --) { /* Perform moves */
+      SCOTCH_Num          edgenum;
+      INT                 elemnum;
+
+      if ((elemnum = testGainBcktBest (&bcktdat, elemtab)) == GAINBCKTNONE)
+        break;
+      if (testGainTracAdd (tracptr, TESTGAINMIN, elemnum, elemtab[elemnum].gainval) != 0)
+        goto fail;
+      gainBcktDel (&bcktdat, &elemtab[elemnum].linkdat);
+      if (testGainTracAdd (tracptr, TESTGAINDEL, elemnum, 0) != 0)
+        goto fail;
+
+      locktab[elemnum]  = 1;
+      parttab[elemnum] ^= 1;
+      cuttab[elemnum]   = (INT) (vendtax[elemnum + baseval] - verttax[elemnum + baseval]) - cuttab[elemnum];
+      elemtab[elemnum].gainval = - elemtab[elemnum].gainval;
+
+      for (edgenum = verttax[elemnum + baseval]; edgenum < vendtax[elemnum + baseval]; edgenum ++) {
+        SCOTCH_Num          vertend;
+        INT                 edloval;
+
+        vertend = edgetax[edgenum] - baseval;
+        if (locktab[vertend] != 0)
+          continue;
+
+        edloval = (edlotax != NULL) ? (INT) edlotax[edgenum] : 1;
+        if (parttab[vertend] == parttab[elemnum]) { /* Edge is no longer cut */
+          elemtab[vertend].gainval += 2 * edloval;
+          cuttab[vertend] --;
+        }
+        else {
+          elemtab[vertend].gainval -= 2 * edloval;
+          cuttab[vertend] ++;
+        }
+
+        if (elemtab[vertend].linkdat.nextnum >= GAINBCKTNONE) { /* If element linked */
+          gainBcktDel (&bcktdat, &elemtab[vertend].linkdat);
+          elemtab[vertend].linkdat.nextnum = -2;
+          if (testGainTracAdd (tracptr, TESTGAINDEL, (INT) vertend, 0) != 0)
+            goto fail;
+        }
+        if (cuttab[vertend] > 0) {
+          gainBcktAdd (&bcktdat, (INT) vertend, elemtab[vertend].gainval);
+          if (testGainTracAdd (tracptr, TESTGAINADD, (INT) vertend, elemtab[vertend].gainval) != 0)
+            goto fail;
+        }
+      }
+    }
+
+    gainBcktFree (&bcktdat);
+    if (testGainTracAdd (tracptr, TESTGAINFREE, 0, 0) != 0)
+      goto fail;
+  }
+
+  if (gainBcktFail (&bcktdat))                    /* If gains could not be kept in order */
+    goto fail;
+  gainBcktExit (&bcktdat);
+  free (cuttab);
+  free (locktab);
+  free (parttab);
+  free (elemtab);
+  return (0);
+
+fail :
+  SCOTCH_errorPrint ("testGainTracBuild: out of memory");
+  return (1);
+}
+
+/******************************/
+/*                            */
+/* The trace replay routines. */
+/*                            */
+/******************************/
+
+/* These routines replay the given trace on
+** each of the gain structures, checking that
+** best elements are of expected gain when the
+** structure is exact.
+** They return:
+** - 0   : if replay succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testGainReplayTabl (
+const TestGainTrac * const  tracptr,
+TestGainTabl * const        elemtab)
+{
+  GainTabl *          tablptr;
+  INT                 opernum;
+
+  if ((tablptr = gainTablInit (GAINMAX, TEST_GAINBITS)) == NULL) {
+    SCOTCH_errorPrint ("testGainReplayTabl: cannot initialize gain table");
+    return (1);
+  }
+
+  for (opernum = 0; opernum < tracptr->opernbr; opernum ++) {
+    const TestGainOper *  operptr;
+
+    operptr = &tracptr->opertab[opernum];
+    switch (operptr->typeval) {
+      case TESTGAINADD :
+        elemtab[operptr->elemnum].gainval = operptr->gainval;
+        gainTablAdd (tablptr, &elemtab[operptr->elemnum].linkdat, operptr->gainval);
+        break;
+      case TESTGAINDEL :
+        gainTablDel (tablptr, &elemtab[operptr->elemnum].linkdat);
+        break;
+      case TESTGAINMIN :                          /* Logarithmic gain table is not exact */
+        if (gainTablFrst (tablptr) == NULL) {
+          SCOTCH_errorPrint ("testGainReplayTabl: empty gain table");
+          return (1);
+        }
+        break;
+      case TESTGAINFREE :
+        gainTablFree (tablptr);
+        break;
+    }
+  }
+
+  gainTablExit (tablptr);
+
+  return (0);
+}
+
+static
+int
+testGainFiboCmpFunc (
+const FiboNode * const      nod0ptr,
+const FiboNode * const      nod1ptr)
+{
+  INT                 gain0val;
+  INT                 gain1val;
+
+  gain0val = ((TestGainFibo *) nod0ptr)->gainval;
+  gain1val = ((TestGainFibo *) nod1ptr)->gainval;
+  if (gain0val < gain1val)
+    return (-1);
+  if (gain0val > gain1val)
+    return (1);
+  return (0);
+}
+
+static
+int
+testGainReplayFibo (
+const TestGainTrac * const  tracptr,
+TestGainFibo * const        elemtab)
+{
+  FiboHeap            heapdat;
+  INT                 opernum;
+
+  if (fiboHeapInit (&heapdat, testGainFiboCmpFunc) != 0) {
+    SCOTCH_errorPrint ("testGainReplayFibo: cannot initialize Fibonacci heap");
+    return (1);
+  }
+
+  for (opernum = 0; opernum < tracptr->opernbr; opernum ++) {
+    const TestGainOper *  operptr;
+    FiboNode *            nodeptr;
+
+    operptr = &tracptr->opertab[opernum];
+    switch (operptr->typeval) {
+      case TESTGAINADD :
+        elemtab[operptr->elemnum].gainval = operptr->gainval;
+        fiboHeapAdd (&heapdat, &elemtab[operptr->elemnum].nodedat);
+        break;
+      case TESTGAINDEL :
+        fiboHeapDel (&heapdat, &elemtab[operptr->elemnum].nodedat);
+        break;
+      case TESTGAINMIN :
+        if (((nodeptr = fiboHeapMin (&heapdat)) == NULL) ||
+            (((TestGainFibo *) nodeptr)->gainval != operptr->gainval)) {
+          SCOTCH_errorPrint ("testGainReplayFibo: invalid best element");
+          return (1);
+        }
+        break;
+      case TESTGAINFREE :
+        fiboHeapFree (&heapdat);
+        break;
+    }
+  }
+
+  fiboHeapExit (&heapdat);
+
+  return (0);
+}
+
+static
+int
+testGainReplayBckt (
+const TestGainTrac * const  tracptr,
+TestGainBckt * const        elemtab)
+{
+  GainBckt            bcktdat;
+  INT                 opernum;
+
+  if (gainBcktInit (&bcktdat, elemtab, sizeof (TestGainBckt)) != 0) {
+    SCOTCH_errorPrint ("testGainReplayBckt: cannot initialize bucket array");
+    return (1);
+  }
+
+  for (opernum = 0; opernum < tracptr->opernbr; opernum ++) {
+    const TestGainOper *  operptr;
+    INT                   elemnum;
+
+    operptr = &tracptr->opertab[opernum];
+    switch (operptr->typeval) {
+      case TESTGAINADD :
+        elemtab[operptr->elemnum].gainval = operptr->gainval;
+        gainBcktAdd (&bcktdat, operptr->elemnum, operptr->gainval);
+        break;
+      case TESTGAINDEL :
+        gainBcktDel (&bcktdat, &elemtab[operptr->elemnum].linkdat);
+        break;
+      case TESTGAINMIN :
+        if (((elemnum = testGainBcktBest (&bcktdat, elemtab)) == GAINBCKTNONE) ||
+            (elemtab[elemnum].gainval != operptr->gainval)) {
+          SCOTCH_errorPrint ("testGainReplayBckt: invalid best element");
+          return (1);
+        }
+        break;
+      case TESTGAINFREE :
+        gainBcktFree (&bcktdat);
+        break;
+    }
+  }
+
+  if (gainBcktFail (&bcktdat)) {
+    SCOTCH_errorPrint ("testGainReplayBckt: cannot enlarge bucket array");
+    return (1);
+  }
+  gainBcktExit (&bcktdat);
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Num          vertnbr;
+  TestGainTrac        tracdat;
+  void *              elemtab;                    /* Element array, large enough for all structures */
+  size_t              elemsiz;
+  const char *        nametab[3] = { "gain table", "Fibonacci heap", "bucket array" };
+  double              timetab[3];
+  int                 passnbr;
+  int                 passnum;
+  int                 typenum;
+  FILE *              fileptr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 2) || (argc > 3)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [passes]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+  passnbr = (argc > 2) ? atoi (argv[2]) : TEST_PASSNBR;
+  if (passnbr < 1) {
+    SCOTCH_errorPrint ("main: invalid parameters");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+
+  tracdat.opertab = NULL;
+  tracdat.opernbr =
+  tracdat.opermax = 0;
+  tracdat.gainmin = INTVALMAX;
+  tracdat.gainmax = - INTVALMAX;
+  if (testGainTracBuild (&tracdat, &grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot record trace");
+    exit (EXIT_FAILURE);
+  }
+
+  elemsiz = MAX (sizeof (TestGainTabl), MAX (sizeof (TestGainFibo), sizeof (TestGainBckt)));
+  if ((elemtab = malloc (vertnbr * elemsiz)) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (typenum = 0; typenum < 3; typenum ++) {
+    for (passnum = 0; passnum < passnbr; passnum ++) {
+      double              timeval;
+      int                 o;
+
+      timeval = clockGet ();
+      switch (typenum) {
+        case 0 :
+          o = testGainReplayTabl (&tracdat, (TestGainTabl *) elemtab);
+          break;
+        case 1 :
+          o = testGainReplayFibo (&tracdat, (TestGainFibo *) elemtab);
+          break;
+        default :
+          o = testGainReplayBckt (&tracdat, (TestGainBckt *) elemtab);
+          break;
+      }
+      timeval = clockGet () - timeval;
+      if (o != 0) {
+        SCOTCH_errorPrint ("main: cannot replay trace on %s", nametab[typenum]);
+        exit (EXIT_FAILURE);
+      }
+      if ((passnum == 0) || (timeval < timetab[typenum]))
+        timetab[typenum] = timeval;
+    }
+  }
+
+  printf ("Operations: " SCOTCH_NUMSTRING "\tgains: [" SCOTCH_NUMSTRING ";" SCOTCH_NUMSTRING "]\n",
+          (SCOTCH_Num) tracdat.opernbr, (SCOTCH_Num) tracdat.gainmin, (SCOTCH_Num) tracdat.gainmax);
+  for (typenum = 0; typenum < 3; typenum ++)
+    printf ("%s:\ttime: %g\tratio: %g\n", nametab[typenum], timetab[typenum],
+            (timetab[typenum] > 0.0) ? (timetab[0] / timetab[typenum]) : 1.0);
+
+  free             (elemtab);
+  free             (tracdat.opertab);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,230 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_context_cache.c             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the result cache      **/
+/**                feature of the library Context object.  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+/**********************************/
+/*                                */
+/* The counter checking routine.  */
+/*                                */
+/**********************************/
+
+static
+int
+testCacheCheck (
+SCOTCH_Context * const      contptr,
+const SCOTCH_Num            hitsnbr,
+const SCOTCH_Num            missnbr)
+{
+  SCOTCH_Num          hitstmp;
+  SCOTCH_Num          misstmp;
+
+  SCOTCH_contextCacheStat (contptr, &hitstmp, &misstmp);
+  if ((hitstmp != hitsnbr) || (misstmp != missnbr)) {
+    SCOTCH_errorPrint ("testCacheCheck: invalid counters (" SCOTCH_NUMSTRING "," SCOTCH_NUMSTRING "), expected (" SCOTCH_NUMSTRING "," SCOTCH_NUMSTRING ")",
+                       hitstmp, misstmp, hitsnbr, missnbr);
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        cogrdat;                    /* Context graph binding */
+  SCOTCH_Ordering     ordedat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num *        permtab;
+  SCOTCH_Num          cblktab[2];
+  int                 passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+
+  if ((parttab = malloc (vertnbr * 4 * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  permtab = parttab + 2 * vertnbr;
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_graphInit   (&cogrdat);
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind context");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_contextCacheInit (&contdat, 4) != 0) {
+    SCOTCH_errorPrint ("main: cannot enable cache");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Partition twice with same strategy */
+    if (SCOTCH_graphPart (&cogrdat, 7, &stradat, parttab + passnum * vertnbr) != 0) {
+      SCOTCH_errorPrint ("main: cannot partition graph (1)");
+      exit (EXIT_FAILURE);
+    }
+  }
+  if (testCacheCheck (&contdat, 1, 1) != 0) {
+    SCOTCH_errorPrint ("main: invalid partitioning cache counters (1)");
+    exit (EXIT_FAILURE);
+  }
+  if (memcmp (parttab, parttab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0) {
+    SCOTCH_errorPrint ("main: cached partition differs");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphPart (&cogrdat, 5, &stradat, parttab) != 0) { /* Different target architecture */
+    SCOTCH_errorPrint ("main: cannot partition graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_stratInit (&stradat);
+  SCOTCH_stratGraphMapBuild (&stradat, SCOTCH_STRATSPEED, 7, 0.05);
+  if (SCOTCH_graphPart (&cogrdat, 7, &stradat, parttab) != 0) { /* Different strategy */
+    SCOTCH_errorPrint ("main: cannot partition graph (3)");
+    exit (EXIT_FAILURE);
+  }
+  if (testCacheCheck (&contdat, 1, 3) != 0) {
+    SCOTCH_errorPrint ("main: invalid partitioning cache counters (2)");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Partitioning: cache hit and misses as expected\n");
+
+  SCOTCH_contextCacheReset (&contdat);
+  if (testCacheCheck (&contdat, 0, 0) != 0) {
+    SCOTCH_errorPrint ("main: cache counters not reset");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_stratInit (&stradat);
+  for (passnum = 0; passnum < 2; passnum ++) {    /* Order twice with same strategy */
+    if (SCOTCH_graphOrderInit (&grafdat, &ordedat, permtab + passnum * vertnbr, NULL, &cblktab[passnum], NULL, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot initialize ordering");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphOrderCompute (&cogrdat, &ordedat, &stradat) != 0) {
+      SCOTCH_errorPrint ("main: cannot order graph");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphOrderCheck (&grafdat, &ordedat) != 0) {
+      SCOTCH_errorPrint ("main: invalid ordering");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_graphOrderExit (&grafdat, &ordedat);
+  }
+  if (testCacheCheck (&contdat, 1, 1) != 0) {
+    SCOTCH_errorPrint ("main: invalid ordering cache counters");
+    exit (EXIT_FAILURE);
+  }
+  if ((cblktab[0] != cblktab[1]) ||
+      (memcmp (permtab, permtab + vertnbr, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+    SCOTCH_errorPrint ("main: cached ordering differs");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Ordering: cache hit as expected\n");
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&cogrdat);                  /* Free the context graph before its bound context */
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_graphExit   (&grafdat);
+  free (parttab);
+
+  exit (EXIT_SUCCESS);
+}
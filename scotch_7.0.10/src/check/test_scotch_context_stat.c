@@ -0,0 +1,270 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_context_stat.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the strategy method   **/
+/**                statistics feature of the library       **/
+/**                Context object.                         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+/*************************************/
+/*                                   */
+/* The record checking routine. It   */
+/* checks the consistency of all the */
+/* records held by the context.      */
+/*                                   */
+/*************************************/
+
+static
+int
+testStatCheck (
+SCOTCH_Context * const      contptr,
+const SCOTCH_Num            vertnbr,
+const char * const          typeptr)              /* Family of the outermost records */
+{
+  SCOTCH_Num          recdnbr;
+  SCOTCH_Num          recdnum;
+  int                 typeflg;
+
+  recdnbr = SCOTCH_contextStatNbr (contptr);
+  if (recdnbr <= 0) {
+    SCOTCH_errorPrint ("testStatCheck: no method call recorded");
+    return (1);
+  }
+
+  for (recdnum = 0, typeflg = 0; recdnum < recdnbr; recdnum ++) {
+    const char *        typetmp;
+    const char *        methtmp;
+    SCOTCH_Num          levlnum;
+    SCOTCH_Num          vertnum;
+    double              timeval;
+    double              costtab[2];
+    double              imbatab[2];
+
+    if (SCOTCH_contextStatGet (contptr, recdnum, &typetmp, &methtmp, &levlnum, &vertnum, NULL,
+                               &timeval, costtab, imbatab) != 0) {
+      SCOTCH_errorPrint ("testStatCheck: cannot get record");
+      return (1);
+    }
+    if ((typetmp == NULL) || (methtmp == NULL) || (methtmp[0] == '\0')) {
+      SCOTCH_errorPrint ("testStatCheck: invalid method name");
+      return (1);
+    }
+    if ((levlnum < 0) || ((recdnum == 0) && (levlnum != 0))) {
+      SCOTCH_errorPrint ("testStatCheck: invalid recursion level");
+      return (1);
+    }
+    if ((vertnum < 0) || (vertnum > vertnbr)) {
+      SCOTCH_errorPrint ("testStatCheck: invalid graph size");
+      return (1);
+    }
+    if (timeval < 0.0) {
+      SCOTCH_errorPrint ("testStatCheck: invalid time");
+      return (1);
+    }
+    if ((strcmp (typetmp, "kgraph") == 0) &&      /* Mapping methods always have an imbalance */
+        ((imbatab[0] < 0.0) || (imbatab[1] < 0.0))) {
+      SCOTCH_errorPrint ("testStatCheck: invalid imbalance");
+      return (1);
+    }
+    if ((levlnum == 0) && (strcmp (typetmp, typeptr) == 0))
+      typeflg = 1;
+  }
+  if (typeflg == 0) {
+    SCOTCH_errorPrint ("testStatCheck: outermost method not recorded");
+    return (1);
+  }
+
+  if (SCOTCH_contextStatGet (contptr, recdnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) == 0) {
+    SCOTCH_errorPrint ("testStatCheck: out of bounds record accepted");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Graph        cogrdat;                    /* Context graph binding */
+  SCOTCH_Ordering     ordedat;
+  SCOTCH_Strat        stradat;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num *        parttab;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+
+  if ((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_graphInit   (&cogrdat);
+  if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot bind context");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);
+  SCOTCH_graphOrderInit (&grafdat, &ordedat, NULL, NULL, NULL, NULL, NULL);
+  if (SCOTCH_graphOrderCompute (&cogrdat, &ordedat, &stradat) != 0) { /* Statistics not enabled yet */
+    SCOTCH_errorPrint ("main: cannot order graph (1)");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphOrderExit (&grafdat, &ordedat);
+
+  if (SCOTCH_contextStatNbr (&contdat) != 0) {
+    SCOTCH_errorPrint ("main: method calls recorded while statistics not enabled");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_contextStatInit (&contdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot enable statistics");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphOrderInit (&grafdat, &ordedat, NULL, NULL, NULL, NULL, NULL);
+  if (SCOTCH_graphOrderCompute (&cogrdat, &ordedat, &stradat) != 0) {
+    SCOTCH_errorPrint ("main: cannot order graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_graphOrderExit (&grafdat, &ordedat);
+
+  if (testStatCheck (&contdat, vertnbr, "hgraph") != 0) {
+    SCOTCH_errorPrint ("main: invalid ordering statistics");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Ordering: " SCOTCH_NUMSTRING " method calls recorded\n", SCOTCH_contextStatNbr (&contdat));
+
+  if ((fileptr = tmpfile ()) == NULL) {           /* Open temporary file for resulting output */
+    SCOTCH_errorPrint ("main: cannot open file (2)");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_contextStatSave (&contdat, fileptr) != 0) {
+    SCOTCH_errorPrint ("main: cannot save statistics (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_contextStatReset (&contdat);
+  if (SCOTCH_contextStatNbr (&contdat) != 0) {
+    SCOTCH_errorPrint ("main: records not discarded");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_stratInit (&stradat);
+  if (SCOTCH_graphPart (&cogrdat, 7, &stradat, parttab) != 0) {
+    SCOTCH_errorPrint ("main: cannot partition graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (testStatCheck (&contdat, vertnbr, "kgraph") != 0) {
+    SCOTCH_errorPrint ("main: invalid partitioning statistics");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Partitioning: " SCOTCH_NUMSTRING " method calls recorded\n", SCOTCH_contextStatNbr (&contdat));
+
+  if (SCOTCH_contextStatSave (&contdat, fileptr) != 0) {
+    SCOTCH_errorPrint ("main: cannot save statistics (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&cogrdat);                  /* Free the context graph before its bound context */
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_graphExit   (&grafdat);
+  free (parttab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,287 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_fold.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module benchmarks the folding of   **/
+/**                distributed graphs performed by the     **/
+/**                SCOTCH_dgraphCoarsen() routine, on      **/
+/**                graph files or on generated 3D grids.   **/
+/**                When node-aware folding is compiled     **/
+/**                in, it also compares the folding plan   **/
+/**                with rank-order folding, node           **/
+/**                boundaries being possibly forced by     **/
+/**                the SCOTCH_COMM_NODE_SIZE environment   **/
+/**                variable.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "ptscotch.h"
+
+#define TEST_PASSNBR                5             /* Number of timed passes per case */
+
+#ifdef SCOTCH_COMM_NODE
+#define TEST_CASENBR                5             /* Folding cases are also run in rank order */
+#else /* SCOTCH_COMM_NODE */
+#define TEST_CASENBR                3
+#endif /* SCOTCH_COMM_NODE */
+
+static File                 C_fileTab[1] = { /* File array */
+                              { FILEMODER } };
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  SCOTCH_Dgraph       finegrafdat;
+  SCOTCH_Num          finevertglbnbr;
+  SCOTCH_Num          finevertlocnbr;
+  double              timetab[TEST_CASENBR];      /* Best times of plain coarsening, folding and folding with duplication */
+#ifdef SCOTCH_COMM_NODE
+  char *              nodestr;                    /* Value of node size environment variable, if any */
+#endif /* SCOTCH_COMM_NODE */
+#ifdef SCOTCH_PTHREAD
+  int                 thrdreqlvl;
+  int                 thrdprolvl;
+#endif /* SCOTCH_PTHREAD */
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdreqlvl = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdreqlvl, &thrdprolvl) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if ((argc != 2) && (argc != 4)) {
+    SCOTCH_errorPrint ("usage: %s (graph_file | dimx dimy dimz)", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&finegrafdat, proccomm) != 0) { /* Initialize fine graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (argc == 2) {                                /* If graph file provided, possibly distributed */
+    fileBlockInit (C_fileTab, 1);                 /* Set default stream pointers                  */
+    fileBlockName (C_fileTab, 0) = argv[1];       /* Use provided file                            */
+
+    fileBlockOpenDist (C_fileTab, 1, procglbnbr, proclocnum, 0); /* Open all files */
+
+    if (SCOTCH_dgraphLoad (&finegrafdat, fileBlockFile (C_fileTab, 0), -1, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot load graph");
+      exit (EXIT_FAILURE);
+    }
+
+    fileBlockClose (C_fileTab, 1);                /* Always close explicitely to end eventual (un)compression tasks */
+  }
+  else {                                          /* Generate 26-neighbor 3D grid */
+    if (SCOTCH_dgraphBuildGrid3D (&finegrafdat, 0, (SCOTCH_Num) atol (argv[1]), (SCOTCH_Num) atol (argv[2]), (SCOTCH_Num) atol (argv[3]), 1, 1) != 0) {
+      SCOTCH_errorPrint ("main: cannot build grid");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_dgraphData (&finegrafdat, NULL, &finevertglbnbr, &finevertlocnbr, NULL, NULL, NULL, NULL, NULL,
+                     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+#ifdef SCOTCH_COMM_NODE
+  if ((nodestr = getenv ("SCOTCH_COMM_NODE_SIZE")) != NULL) /* Keep a copy, as it will be overwritten */
+    nodestr = strdup (nodestr);
+#endif /* SCOTCH_COMM_NODE */
+
+  for (i = 0; i < TEST_CASENBR; i ++) {           /* For all test cases */
+    SCOTCH_Num          coarvertlocmax;
+    SCOTCH_Num          coarvertglbnbr;
+    SCOTCH_Num *        multloctab;
+    SCOTCH_Num          foldval;
+    char *              foldstr;
+    int                 passnum;
+
+    switch (i) {
+      case 0 :
+        foldval = SCOTCH_COARSENNONE;
+        foldstr = "Plain coarsening";
+        break;
+      case 1 :
+        foldval = SCOTCH_COARSENFOLD;
+        foldstr = "Folding";
+        break;
+      case 2 :
+        foldval = SCOTCH_COARSENFOLDDUP;
+        foldstr = "Folding with duplication";
+        break;
+#ifdef SCOTCH_COMM_NODE
+      case 3 :
+        foldval = SCOTCH_COARSENFOLD;
+        foldstr = "Folding in rank order";
+        break;
+      case 4 :
+        foldval = SCOTCH_COARSENFOLDDUP;
+        foldstr = "Folding with duplication in rank order";
+        break;
+#endif /* SCOTCH_COMM_NODE */
+    }
+
+#ifdef SCOTCH_COMM_NODE
+    if (i < 3) {                                  /* Use folding plan, with forced node size if any */
+      if (nodestr != NULL)
+        setenv ("SCOTCH_COMM_NODE_SIZE", nodestr, 1);
+    }
+    else                                          /* One process per node amounts to rank order */
+      setenv ("SCOTCH_COMM_NODE_SIZE", "1", 1);
+#endif /* SCOTCH_COMM_NODE */
+
+    coarvertlocmax = SCOTCH_dgraphCoarsenVertLocMax (&finegrafdat, foldval); /* Get upper bound on size of multinode array */
+
+    if ((multloctab = malloc (coarvertlocmax * 2 * sizeof (SCOTCH_Num))) == NULL) { /* Allocate prescribed size */
+      SCOTCH_errorPrint ("main: cannot allocate multinode array");
+      exit (EXIT_FAILURE);
+    }
+
+    coarvertglbnbr = 0;
+    for (passnum = 0; passnum < TEST_PASSNBR; passnum ++) {
+      SCOTCH_Dgraph       coargrafdat;
+      double              timeloc;
+      double              timeglb;
+      int                 o;
+
+      if (SCOTCH_dgraphInit (&coargrafdat, proccomm) != 0) { /* Initialize coarse graph */
+        SCOTCH_errorPrint ("main: cannot initialize graph (2)");
+        exit (EXIT_FAILURE);
+      }
+
+      MPI_Barrier (proccomm);                     /* Start all processes at the same time */
+      timeloc = clockGet ();
+      o = SCOTCH_dgraphCoarsen (&finegrafdat, 0, 1.0, foldval, &coargrafdat, multloctab);
+      timeloc = clockGet () - timeloc;
+
+      if (o > 1) {
+        SCOTCH_errorPrint ("main: cannot create coarse graph");
+        exit (EXIT_FAILURE);
+      }
+
+      if (MPI_Allreduce (&timeloc, &timeglb, 1, MPI_DOUBLE, MPI_MAX, proccomm) != MPI_SUCCESS) {
+        SCOTCH_errorPrint ("main: cannot communicate (3)");
+        exit (EXIT_FAILURE);
+      }
+      if ((passnum == 0) || (timeglb < timetab[i]))
+        timetab[i] = timeglb;
+
+      if (o == 0) {                               /* If coarse graph created, possibly not on this process */
+        SCOTCH_Num          vertglbnbr;
+
+        SCOTCH_dgraphData (&coargrafdat, NULL, &vertglbnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+        if ((vertglbnbr > 0) &&                   /* Check folded graph on processes which hold it */
+            (SCOTCH_dgraphCheck (&coargrafdat) != 0)) {
+          SCOTCH_errorPrint ("main: invalid coarse graph");
+          exit (EXIT_FAILURE);
+        }
+        if (vertglbnbr > coarvertglbnbr)          /* Processes out of folded communicator report no vertices */
+          coarvertglbnbr = vertglbnbr;
+      }
+
+      SCOTCH_dgraphExit (&coargrafdat);
+    }
+
+    MPI_Allreduce (MPI_IN_PLACE, &coarvertglbnbr, 1, SCOTCH_NUM_MPI, MPI_MAX, proccomm);
+    if (proclocnum == 0)
+      printf ("%s: " SCOTCH_NUMSTRING " -> " SCOTCH_NUMSTRING " vertices, best time %g s over %d passes\n",
+              foldstr, finevertglbnbr, coarvertglbnbr, timetab[i], TEST_PASSNBR);
+
+    free (multloctab);
+  }
+
+  if (proclocnum == 0) {
+    printf ("Folding overhead: %g s, with duplication: %g s\n",
+            timetab[1] - timetab[0], timetab[2] - timetab[0]);
+#ifdef SCOTCH_COMM_NODE
+    printf ("Folding plan versus rank order: %g s, with duplication: %g s\n",
+            timetab[1] - timetab[3], timetab[2] - timetab[4]);
+#endif /* SCOTCH_COMM_NODE */
+  }
+
+#ifdef SCOTCH_COMM_NODE
+  if (nodestr != NULL)
+    free (nodestr);
+#endif /* SCOTCH_COMM_NODE */
+
+  SCOTCH_dgraphExit (&finegrafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,255 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_halo.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_dgraphHalo() and             **/
+/**                SCOTCH_dgraphHaloAsync() routines,      **/
+/**                over repeated exchanges which reuse     **/
+/**                the halo exchange plan of the graph.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+#include "ptscotch.h"
+
+#define HALOPASSNBR                 4             /* Number of rounds of exchanges */
+
+/* This routine checks that the ghost values
+** of the given array are the ones of the local
+** vertices of neighbor processes, that is, the
+** global vertex numbers plus the round offset.
+** It returns:
+** - 0   : if the ghost values are valid.
+** - !0  : on error.
+*/
+
+static
+int
+checkHalo (
+const SCOTCH_Num              baseval,
+const SCOTCH_Num              vertlocnbr,
+const SCOTCH_Num * const      vertloctab,
+const SCOTCH_Num * const      vendloctab,
+const SCOTCH_Num * const      edgeloctab,
+const SCOTCH_Num * const      edgegsttab,
+const SCOTCH_Num * const      datagsttab,
+const SCOTCH_Num              dataadj)
+{
+  SCOTCH_Num          vertlocnum;
+
+  for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++) {
+    SCOTCH_Num          edgelocnum;
+
+    for (edgelocnum = vertloctab[vertlocnum]; edgelocnum < vendloctab[vertlocnum]; edgelocnum ++) {
+      if (datagsttab[edgegsttab[edgelocnum - baseval] - baseval] != (edgeloctab[edgelocnum - baseval] + dataadj))
+        return (1);
+    }
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm              proccomm;
+  int                   procglbnbr;               /* Number of processes sharing graph data */
+  int                   proclocnum;               /* Number of this process                 */
+  SCOTCH_Num            baseval;
+  SCOTCH_Num            vertglbnbr;
+  SCOTCH_Num            vertlocnbr;
+  SCOTCH_Num            vertlocadj;               /* Global number of first local vertex    */
+  SCOTCH_Num            vertgstnbr;
+  SCOTCH_Num *          vertloctab;
+  SCOTCH_Num *          vendloctab;
+  SCOTCH_Num *          edgeloctab;
+  SCOTCH_Num *          edgegsttab;
+  SCOTCH_Num *          datagsttab;
+  SCOTCH_Dgraph         grafdat;
+  SCOTCH_DgraphHaloReq  requdat;
+  FILE *                file;
+  int                   passnum;
+  int                   cheklocval;
+  int                   chekglbval;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdreqlvl;
+  int                 thrdprolvl;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdreqlvl = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdreqlvl, &thrdprolvl) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+#ifdef SCOTCH_CHECK_NOAUTO
+  fprintf (stderr, "Proc %2d of %2d, pid %d\n", proclocnum, procglbnbr, getpid ());
+
+  if (proclocnum == 0) {                          /* Synchronize on keybord input */
+    char           c;
+
+    printf ("Waiting for key press...\n");
+    scanf ("%c", &c);
+  }
+#endif /* SCOTCH_CHECK_NOAUTO */
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&grafdat, proccomm) != 0) { /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  file = NULL;
+  if ((proclocnum == 0) &&
+      ((file = fopen (argv[1], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphLoad (&grafdat, file, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (file != NULL)
+    fclose (file);
+
+  if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Synchronize for debug */
+    SCOTCH_errorPrint ("main: cannot communicate (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphGhst (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute ghost edge array");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_dgraphData (&grafdat, &baseval, &vertglbnbr, &vertlocnbr, NULL, &vertgstnbr, &vertloctab, &vendloctab, NULL, NULL,
+                     NULL, NULL, NULL, &edgeloctab, &edgegsttab, NULL, NULL);
+
+  if ((datagsttab = malloc ((vertgstnbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: cannot allocate data array");
+    exit (EXIT_FAILURE);
+  }
+
+  if (MPI_Scan (&vertlocnbr, &vertlocadj, 1, SCOTCH_NUM_MPI, MPI_SUM, proccomm) != MPI_SUCCESS) {
+    SCOTCH_errorPrint ("main: cannot communicate (3)");
+    exit (EXIT_FAILURE);
+  }
+  vertlocadj += baseval - vertlocnbr;             /* Global number of first local vertex */
+
+  cheklocval = 0;
+  for (passnum = 0; passnum < HALOPASSNBR; passnum ++) { /* Plan is built on first pass and reused afterwards */
+    SCOTCH_Num          vertlocnum;
+    SCOTCH_Num          dataadj;
+
+    dataadj = passnum * vertglbnbr;               /* Values change on every pass */
+    for (vertlocnum = 0; vertlocnum < vertlocnbr; vertlocnum ++)
+      datagsttab[vertlocnum] = vertlocadj + vertlocnum + dataadj;
+    memset (datagsttab + vertlocnbr, ~0, (vertgstnbr - vertlocnbr) * sizeof (SCOTCH_Num));
+
+    if ((passnum & 1) == 0) {                     /* Alternate synchronous and asynchronous exchanges */
+      if (SCOTCH_dgraphHalo (&grafdat, datagsttab, SCOTCH_NUM_MPI) != 0) {
+        SCOTCH_errorPrint ("main: cannot perform halo exchange");
+        exit (EXIT_FAILURE);
+      }
+    }
+    else {
+      if ((SCOTCH_dgraphHaloAsync (&grafdat, datagsttab, SCOTCH_NUM_MPI, &requdat) != 0) ||
+          (SCOTCH_dgraphHaloWait (&requdat) != 0)) {
+        SCOTCH_errorPrint ("main: cannot perform asynchronous halo exchange");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    if (checkHalo (baseval, vertlocnbr, vertloctab, vendloctab, edgeloctab, edgegsttab, datagsttab, dataadj) != 0) {
+      SCOTCH_errorPrint ("main: invalid ghost data (pass %d)", passnum);
+      cheklocval = 1;
+    }
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, proccomm) != MPI_SUCCESS) {
+    SCOTCH_errorPrint ("main: cannot communicate (4)");
+    exit (EXIT_FAILURE);
+  }
+  if (chekglbval != 0)
+    exit (EXIT_FAILURE);
+
+  free (datagsttab);
+  SCOTCH_dgraphExit (&grafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,275 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_dgraph_match.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module benchmarks the matching     **/
+/**                phase of the SCOTCH_dgraphCoarsen()     **/
+/**                routine, on graph files or on generated **/
+/**                3D grids. When node-aware communica-    **/
+/**                tions are compiled in, it compares      **/
+/**                node-aware matching with MPI-only       **/
+/**                matching, which must yield the same     **/
+/**                coarse graphs. Nodes can be split by    **/
+/**                the SCOTCH_COMM_NODE_SIZE environment   **/
+/**                variable.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "ptscotch.h"
+
+#define TEST_PASSNBR                5             /* Number of timed passes per case */
+
+#ifdef SCOTCH_COMM_NODE
+#define TEST_CASENBR                2             /* Node-aware and MPI-only matchings */
+#else /* SCOTCH_COMM_NODE */
+#define TEST_CASENBR                1
+#endif /* SCOTCH_COMM_NODE */
+
+static File                 C_fileTab[1] = { /* File array */
+                              { FILEMODER } };
+
+/* This routine loads or builds the test graph.
+** Every case uses a graph of its own, since
+** node exchange data are attached to the graph.
+** It returns:
+** - void  : in all cases. Exits on error.
+*/
+
+static
+void
+testGraphBuild (
+SCOTCH_Dgraph * const       grafptr,
+MPI_Comm                    proccomm,
+int                         argc,
+char *                      argv[])
+{
+  int                 procglbnbr;
+  int                 proclocnum;
+
+  MPI_Comm_size (proccomm, &procglbnbr);
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  if (SCOTCH_dgraphInit (grafptr, proccomm) != 0) {
+    SCOTCH_errorPrint ("testGraphBuild: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (argc == 2) {                                /* If graph file provided, possibly distributed */
+    fileBlockInit (C_fileTab, 1);                 /* Set default stream pointers                  */
+    fileBlockName (C_fileTab, 0) = argv[1];       /* Use provided file                            */
+
+    fileBlockOpenDist (C_fileTab, 1, procglbnbr, proclocnum, 0); /* Open all files */
+
+    if (SCOTCH_dgraphLoad (grafptr, fileBlockFile (C_fileTab, 0), -1, 0) != 0) {
+      SCOTCH_errorPrint ("testGraphBuild: cannot load graph");
+      exit (EXIT_FAILURE);
+    }
+
+    fileBlockClose (C_fileTab, 1);                /* Always close explicitely to end eventual (un)compression tasks */
+  }
+  else {                                          /* Generate 26-neighbor 3D grid */
+    if (SCOTCH_dgraphBuildGrid3D (grafptr, 0, (SCOTCH_Num) atol (argv[1]), (SCOTCH_Num) atol (argv[2]), (SCOTCH_Num) atol (argv[3]), 1, 1) != 0) {
+      SCOTCH_errorPrint ("testGraphBuild: cannot build grid");
+      exit (EXIT_FAILURE);
+    }
+  }
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  SCOTCH_Num          finevertglbnbr;
+  SCOTCH_Num          finevertlocnbr;
+  SCOTCH_Num *        multloctab[TEST_CASENBR];   /* Multinode arrays of first pass of each case */
+  SCOTCH_Num          coarvertlocnbr[TEST_CASENBR];
+  double              timetab[TEST_CASENBR];      /* Best coarsening times of each case          */
+#ifdef SCOTCH_COMM_NODE
+  char *              nodestr;                    /* Value of node size environment variable, if any */
+#endif /* SCOTCH_COMM_NODE */
+#ifdef SCOTCH_PTHREAD
+  int                 thrdreqlvl;
+  int                 thrdprolvl;
+#endif /* SCOTCH_PTHREAD */
+  int                 i;
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdreqlvl = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdreqlvl, &thrdprolvl) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if ((argc != 2) && (argc != 4)) {
+    SCOTCH_errorPrint ("usage: %s (graph_file | dimx dimy dimz)", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+#ifdef SCOTCH_COMM_NODE
+  if ((nodestr = getenv ("SCOTCH_COMM_NODE_SIZE")) != NULL) /* Keep a copy, as it will be overwritten */
+    nodestr = strdup (nodestr);
+#endif /* SCOTCH_COMM_NODE */
+
+  for (i = 0; i < TEST_CASENBR; i ++) {           /* For all test cases */
+    SCOTCH_Dgraph       finegrafdat;
+    int                 passnum;
+
+#ifdef SCOTCH_COMM_NODE
+    if (i == 0) {                                 /* Use node-aware matching, with forced node size if any */
+      if (nodestr != NULL)
+        setenv ("SCOTCH_COMM_NODE_SIZE", nodestr, 1);
+    }
+    else                                          /* One process per node amounts to MPI-only matching */
+      setenv ("SCOTCH_COMM_NODE_SIZE", "1", 1);
+#endif /* SCOTCH_COMM_NODE */
+
+    testGraphBuild (&finegrafdat, proccomm, argc, argv);
+    SCOTCH_dgraphData (&finegrafdat, NULL, &finevertglbnbr, &finevertlocnbr, NULL, NULL, NULL, NULL, NULL,
+                       NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+    if ((multloctab[i] = malloc (finevertlocnbr * 2 * sizeof (SCOTCH_Num) + 1)) == NULL) { /* Plain coarsening needs no more */
+      SCOTCH_errorPrint ("main: cannot allocate multinode array");
+      exit (EXIT_FAILURE);
+    }
+
+    for (passnum = 0; passnum < TEST_PASSNBR; passnum ++) {
+      SCOTCH_Dgraph       coargrafdat;
+      double              timeloc;
+      double              timeglb;
+      int                 o;
+
+      if (SCOTCH_dgraphInit (&coargrafdat, proccomm) != 0) { /* Initialize coarse graph */
+        SCOTCH_errorPrint ("main: cannot initialize graph");
+        exit (EXIT_FAILURE);
+      }
+
+      SCOTCH_randomReset ();                      /* All passes of all cases must compute the same matching */
+      MPI_Barrier (proccomm);                     /* Start all processes at the same time                   */
+      timeloc = clockGet ();
+      o = SCOTCH_dgraphCoarsen (&finegrafdat, 0, 1.0, SCOTCH_COARSENNONE, &coargrafdat, multloctab[i]);
+      timeloc = clockGet () - timeloc;
+
+      if (o != 0) {
+        SCOTCH_errorPrint ("main: cannot create coarse graph");
+        exit (EXIT_FAILURE);
+      }
+      if (SCOTCH_dgraphCheck (&coargrafdat) != 0) {
+        SCOTCH_errorPrint ("main: invalid coarse graph");
+        exit (EXIT_FAILURE);
+      }
+
+      if (MPI_Allreduce (&timeloc, &timeglb, 1, MPI_DOUBLE, MPI_MAX, proccomm) != MPI_SUCCESS) {
+        SCOTCH_errorPrint ("main: cannot communicate (1)");
+        exit (EXIT_FAILURE);
+      }
+      if ((passnum == 0) || (timeglb < timetab[i]))
+        timetab[i] = timeglb;
+
+      if (passnum == 0)                           /* Keep multinode array of first pass */
+        SCOTCH_dgraphData (&coargrafdat, NULL, NULL, &coarvertlocnbr[i], NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+      SCOTCH_dgraphExit (&coargrafdat);
+    }
+
+    SCOTCH_dgraphExit (&finegrafdat);
+  }
+
+  for (i = 1; i < TEST_CASENBR; i ++) {           /* Coarse graphs must be the same in all cases */
+    int                 diffloc;
+    int                 diffglb;
+
+    diffloc = ((coarvertlocnbr[i] != coarvertlocnbr[0]) ||
+               (memcmp (multloctab[i], multloctab[0], coarvertlocnbr[0] * 2 * sizeof (SCOTCH_Num)) != 0)) ? 1 : 0;
+    if (MPI_Allreduce (&diffloc, &diffglb, 1, MPI_INT, MPI_MAX, proccomm) != MPI_SUCCESS) {
+      SCOTCH_errorPrint ("main: cannot communicate (2)");
+      exit (EXIT_FAILURE);
+    }
+    if (diffglb != 0) {
+      SCOTCH_errorPrint ("main: node-aware and MPI-only matchings differ");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if (proclocnum == 0) {
+    printf ("Matching: " SCOTCH_NUMSTRING " vertices, best time %g s over %d passes\n",
+            finevertglbnbr, timetab[0], TEST_PASSNBR);
+#ifdef SCOTCH_COMM_NODE
+    printf ("MPI-only matching: best time %g s over %d passes\n", timetab[1], TEST_PASSNBR);
+    printf ("Node-aware versus MPI-only matching: %g s\n", timetab[0] - timetab[1]);
+#endif /* SCOTCH_COMM_NODE */
+  }
+
+  for (i = 0; i < TEST_CASENBR; i ++)
+    free (multloctab[i]);
+#ifdef SCOTCH_COMM_NODE
+  if (nodestr != NULL)
+    free (nodestr);
+#endif /* SCOTCH_COMM_NODE */
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
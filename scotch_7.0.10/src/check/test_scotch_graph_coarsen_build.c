@@ -0,0 +1,260 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_coarsen_build.c       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module benchmarks the multi-       **/
+/**                threaded building of coarse graphs,     **/
+/**                and checks that coarse graphs built     **/
+/**                with any number of threads are equal    **/
+/**                to the sequentially built one.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 16 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_THRDMAX                64            /* Default maximum number of threads */
+#define TEST_PASSNBR                5             /* Default number of timed passes    */
+
+/*********************************/
+/*                               */
+/* The graph comparison routine. */
+/*                               */
+/*********************************/
+
+/* This routine checks that two coarse
+** graphs have the same vertices, loads
+** and adjacency lists, in the same order.
+** Both graphs may not be compact.
+** It returns:
+** - 0   : if graphs are equal.
+** - !0  : else.
+*/
+
+static
+int
+graphCompare (
+const SCOTCH_Graph * const  grafptr0,
+const SCOTCH_Graph * const  grafptr1)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Num *        verttab[2];
+  SCOTCH_Num *        vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Num          edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+
+  SCOTCH_graphData (grafptr0, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], NULL,
+                    &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grafptr1, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], NULL,
+                    &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((baseval[0] != baseval[1]) ||
+      (vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]))
+    return (1);
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    SCOTCH_Num          edgeidx0;
+    SCOTCH_Num          edgeidx1;
+    SCOTCH_Num          degrval;
+
+    degrval = vendtab[0][vertnum] - verttab[0][vertnum];
+    if ((degrval != (vendtab[1][vertnum] - verttab[1][vertnum])) ||
+        (velotab[0][vertnum] != velotab[1][vertnum]))
+      return (1);
+
+    edgeidx0 = verttab[0][vertnum] - baseval[0];
+    edgeidx1 = verttab[1][vertnum] - baseval[1];
+    if ((memcmp (edgetab[0] + edgeidx0, edgetab[1] + edgeidx1, degrval * sizeof (SCOTCH_Num)) != 0) ||
+        (memcmp (edlotab[0] + edgeidx0, edlotab[1] + edgeidx1, degrval * sizeof (SCOTCH_Num)) != 0))
+      return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Graph            finegrafdat;            /* Fine graph                            */
+  SCOTCH_Num              finevertnbr;            /* Number of fine vertices               */
+  SCOTCH_Num *            finematetab;            /* Reference mate array                  */
+  SCOTCH_Num *            finecoartab;            /* Mate array consumed by each build     */
+  SCOTCH_Graph            coargraftab[2];         /* Reference and current coarse graphs   */
+  SCOTCH_Num *            coarmulttab;            /* Multinode array                       */
+  SCOTCH_Num              coarvertnbr;            /* Number of coarse vertices             */
+  SCOTCH_Num              coaredgenbr;            /* Number of coarse edges                */
+  double                  timeref;                /* Time of sequential build              */
+  int                     thrdmax;
+  int                     thrdnbr;
+  int                     passnbr;
+  FILE *                  fileptr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 2) || (argc > 4)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [max_threads [passes]]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+  thrdmax = (argc > 2) ? atoi (argv[2]) : TEST_THRDMAX;
+  passnbr = (argc > 3) ? atoi (argv[3]) : TEST_PASSNBR;
+  if ((thrdmax < 1) || (passnbr < 1)) {
+    SCOTCH_errorPrint ("main: invalid parameters");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&finegrafdat) != 0) {     /* Initialize fine source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) { /* Open fine graph file */
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&finegrafdat, fileptr, -1, 0) != 0) { /* Read fine source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&finegrafdat, NULL, &finevertnbr, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  if (((finematetab = malloc (finevertnbr * sizeof (SCOTCH_Num)))     == NULL) ||
+      ((finecoartab = malloc (finevertnbr * sizeof (SCOTCH_Num)))     == NULL) ||
+      ((coarmulttab = malloc (finevertnbr * 2 * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  coarvertnbr = 0;                                /* Compute matching once, so that all builds use the same */
+  if (SCOTCH_graphCoarsenMatch (&finegrafdat, &coarvertnbr, 1.0, SCOTCH_COARSENNOMERGE, finematetab) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute matching");
+    exit (EXIT_FAILURE);
+  }
+
+  timeref = 0.0;
+  for (thrdnbr = 1; thrdnbr <= thrdmax; thrdnbr = (thrdnbr < thrdmax) ? MIN (thrdnbr * 2, thrdmax) : (thrdmax + 1)) {
+    SCOTCH_Context          contdat;
+    SCOTCH_Graph            grafdat;              /* Fine graph bound to context */
+    double                  timeval;
+    double                  timemin;
+    int                     passnum;
+
+    SCOTCH_contextInit (&contdat);
+    SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1);
+    if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot spawn threads");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_graphInit (&grafdat);
+    if (SCOTCH_contextBindGraph (&contdat, &finegrafdat, &grafdat) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+
+    for (passnum = 0, timemin = 0.0; passnum < passnbr; passnum ++) {
+      SCOTCH_Graph *          coargrafptr;
+
+      coargrafptr = &coargraftab[((thrdnbr == 1) && (passnum == 0)) ? 0 : 1]; /* First sequential build is the reference */
+      memcpy (finecoartab, finematetab, finevertnbr * sizeof (SCOTCH_Num)); /* Mate array is turned into fine-to-coarse array */
+
+      timeval = clockGet ();
+      if (SCOTCH_graphCoarsenBuild (&grafdat, coarvertnbr, finecoartab, coargrafptr, coarmulttab) != 0) {
+        SCOTCH_errorPrint ("main: cannot compute coarse graph");
+        exit (EXIT_FAILURE);
+      }
+      timeval = clockGet () - timeval;
+      if ((passnum == 0) || (timeval < timemin))
+        timemin = timeval;
+
+      if (coargrafptr != &coargraftab[0]) {
+        if (graphCompare (&coargraftab[0], coargrafptr) != 0) {
+          SCOTCH_errorPrint ("main: coarse graph built with %d threads differs from sequential one", thrdnbr);
+          exit (EXIT_FAILURE);
+        }
+        SCOTCH_graphExit (coargrafptr);
+      }
+    }
+    if (thrdnbr == 1)
+      timeref = timemin;
+
+    SCOTCH_graphSize (&coargraftab[0], &coarvertnbr, &coaredgenbr);
+    printf ("Threads: %3d\tvertices: " SCOTCH_NUMSTRING "\tedges: " SCOTCH_NUMSTRING "\ttime: %g\tspeedup: %g\n",
+            thrdnbr, coarvertnbr, coaredgenbr, timemin, (timemin > 0.0) ? (timeref / timemin) : 1.0);
+
+    SCOTCH_graphExit   (&grafdat);
+    SCOTCH_contextExit (&contdat);
+  }
+
+  SCOTCH_graphExit (&coargraftab[0]);
+  free             (coarmulttab);
+  free             (finecoartab);
+  free             (finematetab);
+  SCOTCH_graphExit (&finegrafdat);
+
+  exit (EXIT_SUCCESS);
+}
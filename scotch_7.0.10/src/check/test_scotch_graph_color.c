@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2018,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2018,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 06 jan 2012     **/
 /**                                 to   : 22 may 2018     **/
 /**                # Version 7.0  : from : 04 jul 2025     **/
-/**                                 to   : 04 jul 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -61,6 +61,88 @@
 
 #include "scotch.h"
 
+/*********************************/
+/*                               */
+/* The coloring checking routine */
+/*                               */
+/*********************************/
+
+/* This routine colors the given graph with
+** the given number of threads, a fixed random
+** seed and the given method, and checks that
+** the coloring is valid.
+** It returns:
+** - 0   : if coloring succeeded.
+** - !0  : on error.
+*/
+
+static
+int
+testColor (
+SCOTCH_Graph * const        grafptr,
+const int                   thrdnbr,
+const SCOTCH_Num            flagval,
+SCOTCH_Num * const          colotab,
+SCOTCH_Num * const          coloptr,
+double * const              timeptr)
+{
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;                    /* Context container graph */
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  double              timeval;
+  int                 o;
+
+  SCOTCH_contextInit (&contdat);
+  SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL);
+  if (SCOTCH_contextRandomClone (&contdat) != 0) {
+    SCOTCH_errorPrint ("testColor: cannot clone random context");
+    return (1);
+  }
+  SCOTCH_contextRandomSeed (&contdat, 1);         /* Same seed for every run */
+
+  SCOTCH_graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    SCOTCH_errorPrint ("testColor: cannot bind context");
+    return (1);
+  }
+
+  timeval = clockGet ();
+  o = SCOTCH_graphColor (&grafdat, colotab, coloptr, flagval);
+  *timeptr = clockGet () - timeval;
+
+  SCOTCH_graphExit   (&grafdat);
+  SCOTCH_contextExit (&contdat);
+
+  if (o != 0) {
+    SCOTCH_errorPrint ("testColor: cannot color graph");
+    return (1);
+  }
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          edgenum;
+
+    if ((colotab[vertnum] < 0) || (colotab[vertnum] >= *coloptr)) {
+      SCOTCH_errorPrint ("testColor: invalid color value");
+      return (1);
+    }
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      if (colotab[edgetab[edgenum - baseval] - baseval] == colotab[vertnum]) {
+        SCOTCH_errorPrint ("testColor: neighbors have same color");
+        return (1);
+      }
+    }
+  }
+
+  return (0);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -77,9 +159,13 @@ char *              argv[])
   SCOTCH_Num          vertnbr;
   SCOTCH_Num          vertnum;
   SCOTCH_Num          colonbr;
+  SCOTCH_Num          colotmp;
   SCOTCH_Num          colonum;
   SCOTCH_Num *        colotab;
+  SCOTCH_Num *        colotmptab;
   SCOTCH_Num *        cnbrtab;
+  double              timetab[2];
+  int                 thrdnbr;
 
   SCOTCH_errorProg (argv[0]);
 
@@ -88,6 +174,12 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+#ifdef SCOTCH_PTHREAD_NUMBER
+  thrdnbr = SCOTCH_PTHREAD_NUMBER;                /* If prescribed number defined at compile time, use it as default */
+#else /* SCOTCH_PTHREAD_NUMBER */
+  thrdnbr = 4;
+#endif /* SCOTCH_PTHREAD_NUMBER */
+
   if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
     SCOTCH_errorPrint ("main: cannot initialize graph");
     exit (EXIT_FAILURE);
@@ -112,18 +204,31 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
+  if ((colotmptab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory (2)");
+    exit (EXIT_FAILURE);
+  }
+
   if ((cnbrtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
+    SCOTCH_errorPrint ("main: out of memory (3)");
     exit (EXIT_FAILURE);
   }
   memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
 
-  if (SCOTCH_graphColor (&grafdat, colotab, &colonbr, 0) != 0) {
-    SCOTCH_errorPrint ("main: cannot color graph");
+  if ((testColor (&grafdat, 1,       SCOTCH_COLORDEFAULT, colotab,    &colonbr, &timetab[0]) != 0) ||
+      (testColor (&grafdat, thrdnbr, SCOTCH_COLORDEFAULT, colotmptab, &colotmp, &timetab[1]) != 0)) {
+    SCOTCH_errorPrint ("main: cannot color graph (1)");
+    exit (EXIT_FAILURE);
+  }
+  if ((colotmp != colonbr) ||
+      (memcmp (colotab, colotmptab, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+    SCOTCH_errorPrint ("main: coloring depends on number of threads");
     exit (EXIT_FAILURE);
   }
 
   printf ("Number of colors: %ld\n", (long) colonbr);
+  printf ("Default, %d thread(s): %g s, %g vertices/s\n", 1,       timetab[0], (double) vertnbr / (timetab[0] + 1e-9));
+  printf ("Default, %d thread(s): %g s, %g vertices/s\n", thrdnbr, timetab[1], (double) vertnbr / (timetab[1] + 1e-9));
 
   for (vertnum = 0; vertnum < vertnbr; vertnum ++) /* Sum-up color histogram */
     cnbrtab[colotab[vertnum]] ++;
@@ -133,7 +238,22 @@ char *              argv[])
             (long) colonum,
             (long) cnbrtab[colonum]);
 
+  if ((testColor (&grafdat, thrdnbr, SCOTCH_COLORGREEDY, colotab,    &colonbr, &timetab[0]) != 0) ||
+      (testColor (&grafdat, thrdnbr, SCOTCH_COLORGREEDY, colotmptab, &colotmp, &timetab[1]) != 0)) {
+    SCOTCH_errorPrint ("main: cannot color graph (2)");
+    exit (EXIT_FAILURE);
+  }
+  if ((colotmp != colonbr) ||
+      (memcmp (colotab, colotmptab, vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+    SCOTCH_errorPrint ("main: greedy coloring is not reproducible");
+    exit (EXIT_FAILURE);
+  }
+
+  printf ("Number of colors (greedy): %ld\n", (long) colonbr);
+  printf ("Greedy, %d thread(s): %g s, %g vertices/s\n", thrdnbr, timetab[0], (double) vertnbr / (timetab[0] + 1e-9));
+
   free (cnbrtab);
+  free (colotmptab);
   free (colotab);
   SCOTCH_graphExit (&grafdat);
 
@@ -0,0 +1,264 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_load.c                **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module checks that the in-memory   **/
+/**                parser of regular graph files yields    **/
+/**                the same graph as the stream reader     **/
+/**                used for pipes, for any number of       **/
+/**                threads, and times both.                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_THRDMAX                4             /* Default maximum number of threads */
+#define TEST_PASSNBR                3             /* Default number of timed passes    */
+
+/*********************************/
+/*                               */
+/* The graph comparison routine. */
+/*                               */
+/*********************************/
+
+/* This routine checks that two graphs
+** have the same vertices, labels, loads
+** and adjacency lists, in the same order.
+** It returns:
+** - 0   : if graphs are equal.
+** - !0  : else.
+*/
+
+static
+int
+graphCompare (
+const SCOTCH_Graph * const  grafptr0,
+const SCOTCH_Graph * const  grafptr1)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Num *        verttab[2];
+  SCOTCH_Num *        vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Num *        vlbltab[2];
+  SCOTCH_Num          edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+
+  SCOTCH_graphData (grafptr0, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], &vlbltab[0],
+                    &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grafptr1, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], &vlbltab[1],
+                    &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((baseval[0] != baseval[1]) ||
+      (vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]) ||
+      ((velotab[0] == NULL) != (velotab[1] == NULL)) ||
+      ((vlbltab[0] == NULL) != (vlbltab[1] == NULL)) ||
+      ((edlotab[0] == NULL) != (edlotab[1] == NULL)))
+    return (1);
+
+  if (((velotab[0] != NULL) && (memcmp (velotab[0], velotab[1], vertnbr[0] * sizeof (SCOTCH_Num)) != 0)) ||
+      ((vlbltab[0] != NULL) && (memcmp (vlbltab[0], vlbltab[1], vertnbr[0] * sizeof (SCOTCH_Num)) != 0)))
+    return (1);
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    SCOTCH_Num          edgeidx0;
+    SCOTCH_Num          edgeidx1;
+    SCOTCH_Num          degrval;
+
+    degrval = vendtab[0][vertnum] - verttab[0][vertnum];
+    if (degrval != (vendtab[1][vertnum] - verttab[1][vertnum]))
+      return (1);
+
+    edgeidx0 = verttab[0][vertnum] - baseval[0];
+    edgeidx1 = verttab[1][vertnum] - baseval[1];
+    if ((memcmp (edgetab[0] + edgeidx0, edgetab[1] + edgeidx1, degrval * sizeof (SCOTCH_Num)) != 0) ||
+        ((edlotab[0] != NULL) &&
+         (memcmp (edlotab[0] + edgeidx0, edlotab[1] + edgeidx1, degrval * sizeof (SCOTCH_Num)) != 0)))
+      return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  char *              cmdstr;                     /* Command to read graph file through a pipe */
+  SCOTCH_Graph        grafref;                    /* Graph read by stream reader  */
+  double              timeref;
+  double              timeval;
+  int                 thrdmax;
+  int                 thrdnbr;
+  int                 passnbr;
+  int                 passnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 2) || (argc > 4)) {
+    SCOTCH_errorPrint ("usage: %s graph_file [max_thread_number [pass_number]]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  thrdmax = (argc > 2) ? atoi (argv[2]) : TEST_THRDMAX;
+  passnbr = (argc > 3) ? atoi (argv[3]) : TEST_PASSNBR;
+  if ((thrdmax < 1) || (passnbr < 1)) {
+    SCOTCH_errorPrint ("main: invalid parameters");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((cmdstr = malloc (strlen (argv[1]) + 8)) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  sprintf (cmdstr, "cat '%s'", argv[1]);
+
+  for (passnum = 0, timeref = 0.0; passnum < passnbr; passnum ++) {
+    if ((fileptr = popen (cmdstr, "r")) == NULL) { /* Pipes are not mapped in memory, hence stream reader is used */
+      SCOTCH_errorPrint ("main: cannot open pipe");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_graphInit (&grafref);
+    timeval = clockGet ();
+    if (SCOTCH_graphLoad (&grafref, fileptr, -1, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot load graph (1)");
+      exit (EXIT_FAILURE);
+    }
+    timeval = clockGet () - timeval;
+    if ((passnum == 0) || (timeval < timeref))
+      timeref = timeval;
+
+    pclose (fileptr);
+    if (passnum < (passnbr - 1))                  /* Keep last graph as reference */
+      SCOTCH_graphExit (&grafref);
+  }
+
+  if (SCOTCH_graphCheck (&grafref) != 0) {
+    SCOTCH_errorPrint ("main: invalid reference graph");
+    exit (EXIT_FAILURE);
+  }
+  printf ("Stream\ttime: %g\n", timeref);
+
+  for (thrdnbr = 1; thrdnbr <= thrdmax; thrdnbr = (thrdnbr < thrdmax) ? MIN (thrdnbr * 2, thrdmax) : (thrdmax + 1)) {
+    SCOTCH_Context      contdat;
+    double              timemin;
+
+    SCOTCH_contextInit (&contdat);
+    if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot spawn threads");
+      exit (EXIT_FAILURE);
+    }
+
+    for (passnum = 0, timemin = 0.0; passnum < passnbr; passnum ++) {
+      SCOTCH_Graph        grafdat;
+      SCOTCH_Graph        cogrdat;                /* Context graph binding */
+
+      SCOTCH_graphInit (&grafdat);
+      SCOTCH_graphInit (&cogrdat);
+      if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+        SCOTCH_errorPrint ("main: cannot bind context");
+        exit (EXIT_FAILURE);
+      }
+
+      if ((fileptr = fopen (argv[1], "r")) == NULL) { /* Regular file is mapped in memory and parsed by threads */
+        SCOTCH_errorPrint ("main: cannot open file");
+        exit (EXIT_FAILURE);
+      }
+
+      timeval = clockGet ();
+      if (SCOTCH_graphLoad (&cogrdat, fileptr, -1, 0) != 0) {
+        SCOTCH_errorPrint ("main: cannot load graph (2)");
+        exit (EXIT_FAILURE);
+      }
+      timeval = clockGet () - timeval;
+      if ((passnum == 0) || (timeval < timemin))
+        timemin = timeval;
+
+      fclose (fileptr);
+
+      if (SCOTCH_graphCheck (&grafdat) != 0) {
+        SCOTCH_errorPrint ("main: invalid graph loaded with %d threads", thrdnbr);
+        exit (EXIT_FAILURE);
+      }
+      if (graphCompare (&grafref, &grafdat) != 0) {
+        SCOTCH_errorPrint ("main: graph loaded with %d threads differs from stream one", thrdnbr);
+        exit (EXIT_FAILURE);
+      }
+
+      SCOTCH_graphExit (&cogrdat);                /* Free the context graph before its bound context */
+      SCOTCH_graphExit (&grafdat);
+    }
+
+    printf ("Threads: %d\ttime: %g\tspeedup: %g\n",
+            thrdnbr, timemin, (timemin > 0.0) ? (timeref / timemin) : 0.0);
+
+    SCOTCH_contextExit (&contdat);
+  }
+
+  SCOTCH_graphExit (&grafref);
+  free (cmdstr);
+
+  exit (EXIT_SUCCESS);
+}
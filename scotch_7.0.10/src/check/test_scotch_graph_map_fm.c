@@ -0,0 +1,262 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_fm.c              **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module compares the quality of    **/
+/**                the mappings computed by the k-way FM   **/
+/**                refinement method with one thread and   **/
+/**                with several threads.                   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+
+#include "scotch.h"
+
+#define TEST_STRAT                  "m{vert=1000,low=r,asc=f{bal=0.05,move=80,thrd=y}}" /* Multilevel with threaded k-way FM refinement */
+#define TEST_COSTTOL                0.01          /* Relative communication cost increase allowed for threaded runs */
+
+/*************************************/
+/*                                   */
+/* The communication cost routine.   */
+/* It computes the sum, over all     */
+/* edges, of the edge load times the */
+/* distance between the end domains. */
+/*                                   */
+/*************************************/
+
+static
+SCOTCH_Num
+testCommCost (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Arch * const         archptr,
+const SCOTCH_ArchDom * const  domntab,
+const SCOTCH_Num * const    parttab)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_Num          commload;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, &edlotab);
+
+  for (vertnum = 0, commload = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          edgenum;
+
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      SCOTCH_Num          vertend;
+
+      vertend = edgetab[edgenum - baseval] - baseval;
+      if (vertend < vertnum)                      /* Count each edge once */
+        continue;
+
+      commload += ((edlotab != NULL) ? edlotab[edgenum - baseval] : 1) *
+                  SCOTCH_archDomDist (archptr, &domntab[parttab[vertnum]], &domntab[parttab[vertend]]);
+    }
+  }
+
+  return (commload);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_ArchDom *    domntab;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          partnbr;
+  SCOTCH_Num          partnum;
+  SCOTCH_Num *        parttab;
+  SCOTCH_Num          commref;
+  int                 thrdmax;
+  int                 thrdnbr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 3) || (argc > 4)) {
+    SCOTCH_errorPrint ("usage: %s graph_file target_file [thread_number]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  thrdmax = (argc > 3) ? atoi (argv[3]) : 4;
+  if (thrdmax < 2) {
+    SCOTCH_errorPrint ("main: invalid number of threads");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  if (SCOTCH_archInit (&archdat) != 0) {          /* Initialize target architecture */
+    SCOTCH_errorPrint ("main: cannot initialize architecture");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[2], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file (2)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_archLoad (&archdat, fileptr) != 0) { /* Read target architecture */
+    SCOTCH_errorPrint ("main: cannot load architecture");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+  partnbr = SCOTCH_archSize (&archdat);
+
+  if (((parttab = malloc (vertnbr * sizeof (SCOTCH_Num)))     == NULL) ||
+      ((domntab = malloc (partnbr * sizeof (SCOTCH_ArchDom))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (partnum = 0; partnum < partnbr; partnum ++) { /* Pre-compute terminal domains */
+    if (SCOTCH_archDomTerm (&archdat, &domntab[partnum], partnum) != 0) {
+      SCOTCH_errorPrint ("main: cannot get terminal domain");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  commref = 0;
+  for (thrdnbr = 1; thrdnbr <= thrdmax; thrdnbr = (thrdnbr < thrdmax) ? thrdmax : (thrdmax + 1)) {
+    SCOTCH_Context      contdat;
+    SCOTCH_Graph        cogrdat;                  /* Context graph binding */
+    SCOTCH_Strat        stradat;
+    SCOTCH_Num          commload;
+    double              timeval;
+
+    SCOTCH_contextInit (&contdat);
+    SCOTCH_contextOptionSetNum (&contdat, SCOTCH_OPTIONNUMDETERMINISTIC, 1);
+    if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+      SCOTCH_errorPrint ("main: cannot spawn threads");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_graphInit (&cogrdat);
+    if (SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_stratInit (&stradat);
+    if (SCOTCH_stratGraphMap (&stradat, TEST_STRAT) != 0) {
+      SCOTCH_errorPrint ("main: cannot build strategy");
+      exit (EXIT_FAILURE);
+    }
+
+    timeval = clockGet ();
+    if (SCOTCH_graphMap (&cogrdat, &archdat, &stradat, parttab) != 0) {
+      SCOTCH_errorPrint ("main: cannot map graph");
+      exit (EXIT_FAILURE);
+    }
+    timeval = clockGet () - timeval;
+
+    for (partnum = 0; partnum < vertnbr; partnum ++) {
+      if ((parttab[partnum] < 0) || (parttab[partnum] >= partnbr)) {
+        SCOTCH_errorPrint ("main: invalid mapping");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    commload = testCommCost (&grafdat, &archdat, domntab, parttab);
+    if (thrdnbr == 1)
+      commref = commload;
+
+    printf ("Threads: %d\tcommload: " SCOTCH_NUMSTRING "\tratio: %6.4f\ttime: %g\n",
+            thrdnbr, commload, (double) commload / (double) commref, timeval);
+
+    if ((double) commload > ((double) commref * (1.0 + TEST_COSTTOL))) {
+      SCOTCH_errorPrint ("main: threaded mapping too much worse than sequential one");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_stratExit   (&stradat);
+    SCOTCH_graphExit   (&cogrdat);                /* Free the context graph before its bound context */
+    SCOTCH_contextExit (&contdat);
+  }
+
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+  free (domntab);
+  free (parttab);
+
+  exit (EXIT_SUCCESS);
+}
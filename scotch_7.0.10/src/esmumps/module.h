@@ -1,4 +1,4 @@
-/* Copyright 2009,2018,2022-2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2009,2018,2022-2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 05 sep 2020     **/
 /**                                 to   : 05 sep 2020     **/
 /**                # Version 7.0  : from : 21 apr 2022     **/
-/**                                 to   : 20 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -125,9 +125,17 @@
 #endif /* SCOTCH_COMMON_RENAME */
 
 #if ((defined SCOTCH_COMMON_RENAME) && ! (defined SCOTCH_COMMON_INTERNAL))
+#define clockGet                    SCOTCH_NAME_INTERN (clockGet)
+#define contextCommit               SCOTCH_NAME_INTERN (contextCommit)
+#define contextExit                 SCOTCH_NAME_INTERN (contextExit)
+#define contextInit                 SCOTCH_NAME_INTERN (contextInit)
+#define contextOptionsInit          SCOTCH_NAME_INTERN (contextOptionsInit)
 #define intLoad                     SCOTCH_NAME_INTERN (intLoad)
 #define intSave                     SCOTCH_NAME_INTERN (intSave)
 #define intSort1asc1                SCOTCH_NAME_INTERN (intSort1asc1)
+#define intSort2asc1                SCOTCH_NAME_INTERN (intSort2asc1)
+#define threadContextNbr            SCOTCH_NAME_INTERN (threadContextNbr)
+#define threadLaunch                SCOTCH_NAME_INTERN (threadLaunch)
 #endif /* ((defined SCOTCH_COMMON_RENAME) && ! (defined SCOTCH_COMMON_INTERNAL)) */
 
 #ifndef ESMUMPS_NAME_PREFIX_INTERN
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2020,2022,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2020,2022,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.1  : from : 24 feb 2020     **/
 /**                                 to   : 24 feb 2020     **/
 /**                # Version 7.0  : from : 11 dec 2022     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,6 +72,20 @@
 #include "order.h"
 #include "fax.h"
 #include "symbol_fax.h"
+
+#define SYMBOL_FAX_NEIGHBOR_DATA(dataptr) \
+                                    void * const  ngbdptr = (dataptr)->ngbdptr;                                  \
+                                    INT        (* ngbfrst) (void * const, const INT) = (dataptr)->ngbfrst;       \
+                                    INT        (* ngbnext) (void * const)            = (dataptr)->ngbnext;       \
+                                    INT        (* ngbdegr) (void * const, const INT) = (dataptr)->ngbdegr
+
+#define SYMBOL_FAX_ITERATOR(ngbdptr, vertnum, vertend) \
+                                    for (vertend  = ngbfrst ((ngbdptr), (vertnum)); \
+                                         vertend >= baseval;                        \
+                                         vertend  = ngbnext (ngbdptr)) {
+
+#define SYMBOL_FAX_VERTEX_DEGREE(ngbdptr, vertnum) \
+                                    (ngbdegr ((ngbdptr), (vertnum)))
 #endif /* SYMBOL_FAX_INCLUDED */
 
 /***********************************/
@@ -80,9 +94,12 @@
 /*                                 */
 /***********************************/
 
-/*+ This routine computes the block symbolic
-*** factorization of the given matrix
-*** according to the given vertex ordering.
+/*+ This routine computes the blocks of the
+*** given column block, and appends them to
+*** the given block array. The contributing
+*** column blocks must have been linked into
+*** the contribution chain of the column block
+*** beforehand, by way of symbolFaxCtrb().
 *** It returns:
 *** - 0   : on success.
 *** - !0  : on error.
@@ -131,38 +148,24 @@
 ***     :           :                                |-----------|
 ***     :___________:                                :___________:
 ***                   <- bloktab + blokmax
+*** Since each column block only depends on
+*** the column blocks of its subtree in the
+*** column block elimination tree, disjoint
+*** subtrees which span contiguous ranges of
+*** column blocks can be factored concurrently
+*** in separate block arrays, which are then
+*** merged in column block order.
 +*/
 
-#ifndef SYMBOL_FAX_INCLUDED
-#define SYMBOL_FAX_ITERATOR(ngbdptr, vertnum, vertend) \
-                                    for (vertend  = ngbfrst ((ngbdptr), (vertnum)); \
-                                         vertend >= baseval;                        \
-                                         vertend  = ngbnext (ngbdptr)) {
-
-#define SYMBOL_FAX_VERTEX_DEGREE(ngbdptr, vertnum) \
-                                    (ngbdegr ((ngbdptr), (vertnum)))
-
+static
 int
-symbolFax (
-SymbolMatrix * const        symbptr,              /*+ Symbolic block matrix [based]                      +*/
-const INT                   vertnbr,              /*+ Number of vertices                                 +*/
-const INT                   edgenbr,              /*+ Number of edges                                    +*/
-const INT                   baseval,              /*+ Base value                                         +*/
-void * const                ngbdptr,              /*+ Neighbor bookkeeping area                          +*/
-INT                         ngbfrst (void * const, const INT), /*+ First neighbor function               +*/
-INT                         ngbnext (void * const), /*+ Next neighbor function                           +*/
-INT                         ngbdegr (void * const, const INT),  /*+ Vertex degree function (upper bound) +*/
-const Order * const         ordeptr)              /*+ Matrix ordering                                    +*/
-#endif /* SYMBOL_FAX_INCLUDED */
+symbolFaxCblk (
+const SymbolFaxData * restrict const  dataptr,    /*+ Factorization data                 +*/
+SymbolFaxArray * restrict const       arryptr,    /*+ Block array to which blocks are added +*/
+const INT                             cblknum)    /*+ Based number of column block         +*/
 {
   INT                       vertnum;              /* Vertex number of current column                   */
   INT                       vertend;              /* Current end vertex number                         */
-  const INT * restrict      permtax;              /* Based access to direct permutation array          */
-  const INT * restrict      peritax;              /* Based access to inverse permutation array         */
-  const INT * restrict      rangtax;              /* Based access to column block range array          */
-  INT * restrict            ctrbtax;              /* Based access to array of contribution chains      */
-  SymbolCblk * restrict     cblktax;              /* Based access to column block array                */
-  INT                       cblknum;              /* Based number of current column block              */
   INT                       cblkctr;              /* Based number of current contributing column block */
   SymbolBlok * restrict     bloktax;              /* Based access to block array                       */
   INT                       bloknum;              /* Based number of current first free block slot     */
@@ -174,330 +177,787 @@ const Order * const         ordeptr)              /*+ Matrix ordering
   INT * restrict            hashtab;              /* Hash vertex table                                 */
   INT                       hashmsk;              /* Mask for access to hash table                     */
   INT                       colend;               /* Column number of vertex neighbor                  */
-
-  permtax = ordeptr->permtab - baseval;           /* Compute array bases */
-  peritax = ordeptr->peritab - baseval;
-  rangtax = ordeptr->rangtab - baseval;
-
-  blokmax = ordeptr->cblknbr * (2 + edgenbr / vertnbr) + 2; /* Estimate size of initial block array */
-
-  {                                               /* Allocate arrays for factoring   */
-    INT *               ctrbtab;                  /* Array for contribution chaining */
-    SymbolCblk *        cblktab;                  /* Column block array              */
-    SymbolBlok *        bloktab;                  /* Block array                     */
-
-    if (((ctrbtab = (INT *)        memAlloc (ordeptr->cblknbr       * sizeof (INT)))        == NULL) ||
-        ((cblktab = (SymbolCblk *) memAlloc ((ordeptr->cblknbr + 1) * sizeof (SymbolCblk))) == NULL) ||
-        ((bloktab = (SymbolBlok *) memAlloc (blokmax                * sizeof (SymbolBlok))) == NULL)) {
-      errorPrint ("symbolFax: out of memory (1)");
-      if (ctrbtab != NULL) {
-        if (cblktab != NULL)
-          memFree (cblktab);
-        memFree (ctrbtab);
-      }
-      return (1);
-    }
-    memset (ctrbtab, ~0, ordeptr->cblknbr * sizeof (INT)); /* Initialize column block contributions link array */
-
-    cblktax = cblktab - baseval;                  /* Set based accesses */
-    bloktax = bloktab - baseval;
-    ctrbtax = ctrbtab - baseval;
-  }
-
-  bloknum = baseval;
-  for (cblknum = baseval; cblknum < baseval + ordeptr->cblknbr; cblknum ++) { /* For all column blocks */
-    INT                 colnum;                   /* Number of current column [based]                  */
-    INT                 colmax;                   /* Maximum column index for current column block     */
-
-    {                                             /* Compute offsets and check for array size */
-      INT                 degrmax;                /* Maximum number of local blocks in array  */
-      INT                 hashsiz;
-      INT                 hashmax;
-      INT                 ctrbtmp;
-      ptrdiff_t           sortoft;                /* Offset of sort array                   */
-      ptrdiff_t           tlokoft;                /* Offset of temporary block array        */
-      ptrdiff_t           tlndoft;                /* Offset of end of temporary block array */
-      INT                 tlokmax;
-
-      colnum = rangtax[cblknum];
-      colmax = rangtax[cblknum + 1];              /* Get maximum column value */
-
-      cblktax[cblknum].fcolnum = colnum;          /* Set column block data */
-      cblktax[cblknum].lcolnum = colmax - 1;
-      cblktax[cblknum].bloknum = bloknum;
-
-      degrmax = 0;
-      for ( ; colnum < colmax; colnum ++)         /* For all columns                              */
-        degrmax += SYMBOL_FAX_VERTEX_DEGREE (ngbdptr, peritax[colnum]); /* Add column degrees     */
-      if (degrmax > vertnbr)                      /* There cannot be more neighbors than vertices */
-        degrmax = vertnbr;
-
-      for (hashmax = 256; hashmax < degrmax; hashmax *= 2) ; /* Get upper bound on hash table size */
-      hashsiz = hashmax << 2;                     /* Fill hash table at 1/4 of capacity            */
-      hashmsk = hashsiz - 1;
-
-      for (ctrbsum = 0, ctrbtmp = ctrbtax[cblknum]; /* Follow chain of contributing column blocks */
-           ctrbtmp != ~0; ctrbtmp = ctrbtax[ctrbtmp])
-        ctrbsum += cblktax[ctrbtmp + 1].bloknum - cblktax[ctrbtmp].bloknum - 2; /* Sum contributing column blocks */
-
-      tlokmax = degrmax + ctrbsum;                /* Maximum possible number of blocks in temporary area */
-      sortoft = ((ptrdiff_t) tlokmax) * sizeof (SymbolBlok);
-      if ((((ptrdiff_t) hashsiz) * (ptrdiff_t) sizeof (INT)) > sortoft) /* Compute offset of sort area */
-        sortoft = (((ptrdiff_t) hashsiz) * (ptrdiff_t) sizeof (INT));
-      tlokoft = sortoft + ((ptrdiff_t) degrmax) * sizeof (INT); /* Compute offset of temporary block area */
-      tlndoft = tlokoft + ((ptrdiff_t) tlokmax) * sizeof (SymbolFaxTlok); /* Compute end of area          */
-
-      if (((byte *) (bloktax + bloknum) + tlndoft) > /* If not enough room */
-          ((byte *) (bloktax + blokmax))) {
-        SymbolBlok *        bloktmp;              /* Temporary pointer for array resizing */
-
-        do {
-          blokmax = blokmax + (blokmax >> 2) + 4; /* Increase block array size by 25% as long as it does not fit */
-
-          if (blokmax < bloknum) {
-            errorPrint ("symbolFax: integer overflow");
-            memFree    (bloktax + baseval);
-            memFree    (cblktax + baseval);
-            memFree    (ctrbtax + baseval);
-            return (1);
-          }
-        } while (((byte *) (bloktax + bloknum) + tlndoft) >
-                 ((byte *) (bloktax + blokmax)));
-
-        if ((bloktmp = (SymbolBlok *) memRealloc (bloktax + baseval, (blokmax * sizeof (SymbolBlok)))) == NULL) {
-          errorPrint ("symbolFax: out of memory (2)");
-          memFree    (bloktax + baseval);
-          memFree    (cblktax + baseval);
-          memFree    (ctrbtax + baseval);
+  INT                       colnum;               /* Number of current column [based]                  */
+  INT                       colmax;               /* Maximum column index for current column block     */
+
+  SYMBOL_FAX_NEIGHBOR_DATA (dataptr);
+  const INT                         baseval = dataptr->baseval;
+  const INT                         vertnbr = dataptr->vertnbr;
+  const INT                         cblknnd = dataptr->cblknbr + baseval;
+  const INT * restrict const        permtax = dataptr->permtax;
+  const INT * restrict const        peritax = dataptr->peritax;
+  const INT * restrict const        rangtax = dataptr->rangtax;
+  SymbolCblk * restrict const       cblktax = dataptr->cblktax;
+  const INT * restrict const        ctrbtax = dataptr->ctrbtax;
+
+  bloktax = arryptr->bloktax;
+  bloknum = arryptr->bloknum;
+  blokmax = arryptr->blokmax;
+
+  {                                               /* Compute offsets and check for array size */
+    INT                 degrmax;                  /* Maximum number of local blocks in array  */
+    INT                 hashsiz;
+    INT                 hashmax;
+    INT                 ctrbtmp;
+    ptrdiff_t           sortoft;                  /* Offset of sort array                   */
+    ptrdiff_t           tlokoft;                  /* Offset of temporary block array        */
+    ptrdiff_t           tlndoft;                  /* Offset of end of temporary block array */
+    INT                 tlokmax;
+
+    colnum = rangtax[cblknum];
+    colmax = rangtax[cblknum + 1];                /* Get maximum column value */
+
+    cblktax[cblknum].fcolnum = colnum;            /* Set column block data */
+    cblktax[cblknum].lcolnum = colmax - 1;
+    cblktax[cblknum].bloknum = bloknum;
+
+    degrmax = 0;
+    for ( ; colnum < colmax; colnum ++)           /* For all columns                              */
+      degrmax += SYMBOL_FAX_VERTEX_DEGREE (ngbdptr, peritax[colnum]); /* Add column degrees       */
+    if (degrmax > vertnbr)                        /* There cannot be more neighbors than vertices */
+      degrmax = vertnbr;
+
+    for (hashmax = 256; hashmax < degrmax; hashmax *= 2) ; /* Get upper bound on hash table size */
+    hashsiz = hashmax << 2;                       /* Fill hash table at 1/4 of capacity            */
+    hashmsk = hashsiz - 1;
+
+    for (ctrbsum = 0, ctrbtmp = ctrbtax[cblknum]; /* Follow chain of contributing column blocks */
+         ctrbtmp != ~0; ctrbtmp = ctrbtax[ctrbtmp])
+      ctrbsum += cblktax[ctrbtmp + 1].bloknum - cblktax[ctrbtmp].bloknum - 2; /* Sum contributing column blocks */
+
+    tlokmax = degrmax + ctrbsum;                  /* Maximum possible number of blocks in temporary area */
+    sortoft = ((ptrdiff_t) tlokmax) * sizeof (SymbolBlok);
+    if ((((ptrdiff_t) hashsiz) * (ptrdiff_t) sizeof (INT)) > sortoft) /* Compute offset of sort area */
+      sortoft = (((ptrdiff_t) hashsiz) * (ptrdiff_t) sizeof (INT));
+    tlokoft = sortoft + ((ptrdiff_t) degrmax) * sizeof (INT); /* Compute offset of temporary block area */
+    tlndoft = tlokoft + ((ptrdiff_t) tlokmax) * sizeof (SymbolFaxTlok); /* Compute end of area          */
+
+    if (((byte *) (bloktax + bloknum) + tlndoft) > /* If not enough room */
+        ((byte *) (bloktax + blokmax))) {
+      SymbolBlok *        bloktmp;                /* Temporary pointer for array resizing */
+
+      do {
+        blokmax = blokmax + (blokmax >> 2) + 4;   /* Increase block array size by 25% as long as it does not fit */
+
+        if (blokmax < bloknum) {
+          errorPrint ("symbolFaxCblk: integer overflow");
           return (1);
         }
-        bloktax = bloktmp - baseval;
+      } while (((byte *) (bloktax + bloknum) + tlndoft) >
+               ((byte *) (bloktax + blokmax)));
+
+      if ((bloktmp = (SymbolBlok *) memRealloc (bloktax + baseval, (blokmax * sizeof (SymbolBlok)))) == NULL) {
+        errorPrint ("symbolFaxCblk: out of memory");
+        return (1);
       }
+      bloktax = bloktmp - baseval;
+      arryptr->bloktax = bloktax;                 /* Record new array so that caller can free it */
+      arryptr->blokmax = blokmax;
+    }
 
-      hashtab = (INT *)           (bloktax + bloknum);
-      sorttab = (INT *)           ((byte *) hashtab + sortoft);
-      tloktab = (SymbolFaxTlok *) ((byte *) hashtab + tlokoft);
+    hashtab = (INT *)           (bloktax + bloknum);
+    sorttab = (INT *)           ((byte *) hashtab + sortoft);
+    tloktab = (SymbolFaxTlok *) ((byte *) hashtab + tlokoft);
 
-      memset (hashtab, ~0, hashsiz * sizeof (INT)); /* Initialize hash table */
-    }
+    memset (hashtab, ~0, hashsiz * sizeof (INT)); /* Initialize hash table */
+  }
 
-    sortnbr = 0;                                  /* No vertices yet                 */
-    for (colnum = rangtax[cblknum]; colnum < colmax; colnum ++) { /* For all columns */
-      INT                 hashnum;
+  sortnbr = 0;                                    /* No vertices yet                 */
+  for (colnum = rangtax[cblknum]; colnum < colmax; colnum ++) { /* For all columns */
+    INT                 hashnum;
 
-      vertnum = peritax[colnum];                  /* Get associated vertex      */
-      SYMBOL_FAX_ITERATOR (ngbdptr, vertnum, vertend) /* For all adjacent edges */
-        colend = permtax[vertend];                /* Get end column number      */
+    vertnum = peritax[colnum];                    /* Get associated vertex      */
+    SYMBOL_FAX_ITERATOR (ngbdptr, vertnum, vertend) /* For all adjacent edges */
+      colend = permtax[vertend];                  /* Get end column number      */
 
-        if (colend < colmax)                      /* If end vertex number in left columns */
-          continue;                               /* Skip to next neighbor                */
+      if (colend < colmax)                        /* If end vertex number in left columns */
+        continue;                                 /* Skip to next neighbor                */
 
-        for (hashnum = (colend * SYMBOL_FAX_HASHPRIME) & hashmsk; ; /* Search end column in hash table */
-             hashnum = (hashnum + 1) & hashmsk) {
-          INT *               hashptr;
+      for (hashnum = (colend * SYMBOL_FAX_HASHPRIME) & hashmsk; ; /* Search end column in hash table */
+           hashnum = (hashnum + 1) & hashmsk) {
+        INT *               hashptr;
 
-          hashptr = hashtab + hashnum;            /* Point to hash slot           */
-          if (*hashptr == colend)                 /* If end column in hash table  */
-            break;                                /* Skip to next end column      */
-          if (*hashptr == ~0) {                   /* If slot is empty             */
-            *hashptr = colend;                    /* Set column in hash table     */
-            sorttab[sortnbr ++] = colend;         /* Add end column to sort array */
-            break;
-          }
+        hashptr = hashtab + hashnum;              /* Point to hash slot           */
+        if (*hashptr == colend)                   /* If end column in hash table  */
+          break;                                  /* Skip to next end column      */
+        if (*hashptr == ~0) {                     /* If slot is empty             */
+          *hashptr = colend;                      /* Set column in hash table     */
+          sorttab[sortnbr ++] = colend;           /* Add end column to sort array */
+          break;
         }
-      }                                           /* End of loop on neighbors */
-    }                                             /* End of loop on columns   */
+      }
+    }                                             /* End of loop on neighbors */
+  }                                               /* End of loop on columns   */
 
-    intSort1asc1 (sorttab, sortnbr);              /* Sort neighbor array */
+  intSort1asc1 (sorttab, sortnbr);                /* Sort neighbor array */
 
-    cblkctr = cblknum;
-    if (ctrbtax[cblknum] == ~0) {                 /* If column is not to be updated */
-      INT                 sortnum;
+  cblkctr = cblknum;
+  if (ctrbtax[cblknum] == ~0) {                   /* If column is not to be updated */
+    INT                 sortnum;
 
-      bloktax[bloknum].frownum = cblktax[cblknum].fcolnum; /* Build diagonal block */
-      bloktax[bloknum].lrownum = cblktax[cblknum].lcolnum;
-      bloktax[bloknum].cblknum = cblknum;
+    bloktax[bloknum].frownum = cblktax[cblknum].fcolnum; /* Build diagonal block */
+    bloktax[bloknum].lrownum = cblktax[cblknum].lcolnum;
+    bloktax[bloknum].cblknum = cblknum;
 #ifdef SYMBOL_HAS_LEVFVAL
-      bloktax[bloknum].levfval = 0;
+    bloktax[bloknum].levfval = 0;
 #endif /* SYMBOL_HAS_LEVFVAL */
-      bloknum ++;
-
-      for (sortnum = 0; sortnum < sortnbr; ) {    /* For all entries in sorted array */
-        INT                 colend;               /* Column number of current entry  */
-
-        colend = sorttab[sortnum];
-        if (colend >= rangtax[cblkctr + 1]) {     /* If column block number to be found */
-          INT                 cblktmm;            /* Median value                       */
-          INT                 cblktmx;            /* Maximum value                      */
-
-          for (cblkctr ++,                        /* Find new column block by dichotomy */
-               cblktmx = ordeptr->cblknbr + baseval;
-               cblktmx - cblkctr > 1; ) {
-            cblktmm = (cblktmx + cblkctr) >> 1;
-            if (rangtax[cblktmm] <= colend)
-              cblkctr = cblktmm;
-            else
-              cblktmx = cblktmm;
-          }
+    bloknum ++;
+
+    for (sortnum = 0; sortnum < sortnbr; ) {      /* For all entries in sorted array */
+      INT                 colend;                 /* Column number of current entry  */
+
+      colend = sorttab[sortnum];
+      if (colend >= rangtax[cblkctr + 1]) {       /* If column block number to be found */
+        INT                 cblktmm;              /* Median value                       */
+        INT                 cblktmx;              /* Maximum value                      */
+
+        for (cblkctr ++,                          /* Find new column block by dichotomy */
+             cblktmx = cblknnd;
+             cblktmx - cblkctr > 1; ) {
+          cblktmm = (cblktmx + cblkctr) >> 1;
+          if (rangtax[cblktmm] <= colend)
+            cblkctr = cblktmm;
+          else
+            cblktmx = cblktmm;
         }
+      }
 
-        bloktax[bloknum].frownum = colend;        /* Set beginning of new block */
-        while ((++ sortnum < sortnbr) &&          /* Scan extent of block       */
-               (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
-               (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
-        bloktax[bloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
-        bloktax[bloknum].cblknum = cblkctr;
+      bloktax[bloknum].frownum = colend;          /* Set beginning of new block */
+      while ((++ sortnum < sortnbr) &&            /* Scan extent of block       */
+             (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
+             (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
+      bloktax[bloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
+      bloktax[bloknum].cblknum = cblkctr;
 #ifdef SYMBOL_HAS_LEVFVAL
-        bloktax[bloknum].levfval = 0;
+      bloktax[bloknum].levfval = 0;
 #endif /* SYMBOL_HAS_LEVFVAL */
-        bloknum ++;                               /* One more block */
-      }
+      bloknum ++;                                 /* One more block */
     }
-    else {                                        /* Column will be updated             */
-      INT                 sortnum;                /* Current index in sort array        */
-      INT                 tloknum;                /* Current index on temporary block   */
-      INT                 tlokfre;                /* Index of first free chained block  */
-      INT                 tlokfrm;                /* Index of next free unchained block */
+  }
+  else {                                          /* Column will be updated             */
+    INT                 sortnum;                  /* Current index in sort array        */
+    INT                 tloknum;                  /* Current index on temporary block   */
+    INT                 tlokfre;                  /* Index of first free chained block  */
+    INT                 tlokfrm;                  /* Index of next free unchained block */
 #ifdef FAX_DEBUG
-      INT                 tlokmax;                /* Maximum index of reserved space    */
+    INT                 tlokmax;                  /* Maximum index of reserved space    */
 #endif /* FAX_DEBUG */
 
-      tloktab->frownum = cblktax[cblknum].fcolnum; /* Build diagonal chained block */
-      tloktab->lrownum = cblktax[cblknum].lcolnum;
-      tloktab->cblknum = cblknum;
-      tloktab->nextnum = 1;
-
-      tloknum = 1;                                /* Prepare for extra-diagonal blocks */
-      for (sortnum = 0; sortnum < sortnbr; ) {    /* For all entries in sorted array   */
-        INT                 colend;               /* Column number of current entry    */
-
-        colend = sorttab[sortnum];
-        if (colend >= rangtax[cblkctr + 1]) {     /* If column block number to be found */
-          INT                 cblktmm;            /* Median value                       */
-          INT                 cblktmx;            /* Maximum value                      */
-
-          for (cblkctr ++,                        /* Find new column block by dichotomy */
-               cblktmx = ordeptr->cblknbr + baseval;
-               cblktmx - cblkctr > 1; ) {
-            cblktmm = (cblktmx + cblkctr) >> 1;
-            if (rangtax[cblktmm] <= colend)
-              cblkctr = cblktmm;
-            else
-              cblktmx = cblktmm;
-          }
+    tloktab->frownum = cblktax[cblknum].fcolnum;  /* Build diagonal chained block */
+    tloktab->lrownum = cblktax[cblknum].lcolnum;
+    tloktab->cblknum = cblknum;
+    tloktab->nextnum = 1;
+
+    tloknum = 1;                                  /* Prepare for extra-diagonal blocks */
+    for (sortnum = 0; sortnum < sortnbr; ) {      /* For all entries in sorted array   */
+      INT                 colend;                 /* Column number of current entry    */
+
+      colend = sorttab[sortnum];
+      if (colend >= rangtax[cblkctr + 1]) {       /* If column block number to be found */
+        INT                 cblktmm;              /* Median value                       */
+        INT                 cblktmx;              /* Maximum value                      */
+
+        for (cblkctr ++,                          /* Find new column block by dichotomy */
+             cblktmx = cblknnd;
+             cblktmx - cblkctr > 1; ) {
+          cblktmm = (cblktmx + cblkctr) >> 1;
+          if (rangtax[cblktmm] <= colend)
+            cblkctr = cblktmm;
+          else
+            cblktmx = cblktmm;
         }
-        tloktab[tloknum].frownum = colend;        /* Set beginning of new block */
-        while ((++ sortnum < sortnbr) &&          /* Scan extent of block       */
-               (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
-               (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
-        tloktab[tloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
-        tloktab[tloknum].cblknum = cblkctr;
-        tloktab[tloknum].nextnum = tloknum + 1;   /* Chain block */
-        tloknum ++;
       }
-      tloktab[tloknum].frownum =                  /* Build trailing block */
-      tloktab[tloknum].lrownum = vertnbr + baseval;
-      tloktab[tloknum].cblknum = ordeptr->cblknbr + baseval;
-      tloktab[tloknum].nextnum = 0;               /* Set end of chain (never chain to diagonal block) */
+      tloktab[tloknum].frownum = colend;          /* Set beginning of new block */
+      while ((++ sortnum < sortnbr) &&            /* Scan extent of block       */
+             (sorttab[sortnum] - 1 == sorttab[sortnum - 1]) &&
+             (sorttab[sortnum] < rangtax[cblkctr + 1])) ;
+      tloktab[tloknum].lrownum = sorttab[sortnum - 1]; /* Set end of block */
+      tloktab[tloknum].cblknum = cblkctr;
+      tloktab[tloknum].nextnum = tloknum + 1;     /* Chain block */
+      tloknum ++;
+    }
+    tloktab[tloknum].frownum =                    /* Build trailing block */
+    tloktab[tloknum].lrownum = vertnbr + baseval;
+    tloktab[tloknum].cblknum = cblknnd;
+    tloktab[tloknum].nextnum = 0;                 /* Set end of chain (never chain to diagonal block) */
 
-      tlokfre = ~0;                               /* Chain of free blocks is empty          */
-      tlokfrm = tloknum + 1;                      /* First allocatable unchained free block */
+    tlokfre = ~0;                                 /* Chain of free blocks is empty          */
+    tlokfrm = tloknum + 1;                        /* First allocatable unchained free block */
 #ifdef FAX_DEBUG
-      tlokmax = tlokfrm + ctrbsum;                /* Index after end of array */
+    tlokmax = tlokfrm + ctrbsum;                  /* Index after end of array */
 #endif /* FAX_DEBUG */
 
-      for (cblkctr = ctrbtax[cblknum]; cblkctr != ~0; cblkctr = ctrbtax[cblkctr]) { /* Follow chain */
-        INT                 blokctr;              /* Current index of contributing column block     */
-        INT                 tloklst;              /* Index of previous temporary block              */
+    for (cblkctr = ctrbtax[cblknum]; cblkctr != ~0; cblkctr = ctrbtax[cblkctr]) { /* Follow chain */
+      INT                 blokctr;                /* Current index of contributing column block     */
+      INT                 tloklst;                /* Index of previous temporary block              */
 
-        tloklst = 0;                              /* Previous is diagonal block */
-        tloknum = 0;                              /* Current is diagonal block  */
+      tloklst = 0;                                /* Previous is diagonal block */
+      tloknum = 0;                                /* Current is diagonal block  */
 
-        for (blokctr = cblktax[cblkctr].bloknum + 2; /* For all blocks in contributing column block */
-             blokctr < cblktax[cblkctr + 1].bloknum; blokctr ++) {
-          while ((tloktab[tloknum].cblknum < bloktax[blokctr].cblknum) || /* Skip unmatched chained blocks */
-                 (tloktab[tloknum].lrownum < bloktax[blokctr].frownum - 1)) {
-            tloklst = tloknum;
-            tloknum = tloktab[tloknum].nextnum;
-          }
+      for (blokctr = cblktax[cblkctr].bloknum + 2; /* For all blocks in contributing column block */
+           blokctr < cblktax[cblkctr + 1].bloknum; blokctr ++) {
+        while ((tloktab[tloknum].cblknum < bloktax[blokctr].cblknum) || /* Skip unmatched chained blocks */
+               (tloktab[tloknum].lrownum < bloktax[blokctr].frownum - 1)) {
+          tloklst = tloknum;
+          tloknum = tloktab[tloknum].nextnum;
+        }
 
-          if ((bloktax[blokctr].cblknum < tloktab[tloknum].cblknum) || /* If contributing block has no mate */
-              (bloktax[blokctr].lrownum < tloktab[tloknum].frownum - 1)) {
-            INT                 tloktmp;
+        if ((bloktax[blokctr].cblknum < tloktab[tloknum].cblknum) || /* If contributing block has no mate */
+            (bloktax[blokctr].lrownum < tloktab[tloknum].frownum - 1)) {
+          INT                 tloktmp;
 
-            if (tlokfre == ~0) {                  /* If no available chained free block */
+          if (tlokfre == ~0) {                    /* If no available chained free block */
 #ifdef FAX_DEBUG
-              if (tlokfrm >= tlokmax) {
-                errorPrint ("symbolFax: internal error (1)");
-                return (1);
-              }
-#endif /* FAX_DEBUG */
-              tlokfre = tlokfrm ++;               /* New free block is first unchained block */
-              tloktab[tlokfre].nextnum = ~0;      /* Make it the end of its own pseudo-chain */
+            if (tlokfrm >= tlokmax) {
+              errorPrint ("symbolFaxCblk: internal error");
+              return (1);
             }
-            tloktmp                  =
-            tloktab[tloklst].nextnum = tlokfre;   /* Chain new block                */
-            tloktab[tlokfre].frownum = bloktax[blokctr].frownum; /* Copy block data */
-            tloktab[tlokfre].lrownum = bloktax[blokctr].lrownum;
-            tloktab[tlokfre].cblknum = bloktax[blokctr].cblknum;
-            tlokfre                  = tloktab[tlokfre].nextnum;
-            tloktab[tloktmp].nextnum = tloknum;   /* Complete chainimg                    */
-            tloknum                  = tloktab[tloklst].nextnum; /* Resume from new block */
-            continue;                             /* Process next block                   */
+#endif /* FAX_DEBUG */
+            tlokfre = tlokfrm ++;                 /* New free block is first unchained block */
+            tloktab[tlokfre].nextnum = ~0;        /* Make it the end of its own pseudo-chain */
           }
+          tloktmp                  =
+          tloktab[tloklst].nextnum = tlokfre;     /* Chain new block                */
+          tloktab[tlokfre].frownum = bloktax[blokctr].frownum; /* Copy block data */
+          tloktab[tlokfre].lrownum = bloktax[blokctr].lrownum;
+          tloktab[tlokfre].cblknum = bloktax[blokctr].cblknum;
+          tlokfre                  = tloktab[tlokfre].nextnum;
+          tloktab[tloktmp].nextnum = tloknum;     /* Complete chainimg                    */
+          tloknum                  = tloktab[tloklst].nextnum; /* Resume from new block */
+          continue;                               /* Process next block                   */
+        }
 
-          if ((bloktax[blokctr].lrownum >= tloktab[tloknum].frownum - 1) && /* Update chained block lower bound */
-              (bloktax[blokctr].frownum <  tloktab[tloknum].frownum))
-            tloktab[tloknum].frownum = bloktax[blokctr].frownum;
-
-          if ((bloktax[blokctr].frownum <= tloktab[tloknum].lrownum + 1) && /* Update chained block upper bound */
-              (bloktax[blokctr].lrownum >  tloktab[tloknum].lrownum)) {
-            INT                 tloktmp;
-
-            tloktab[tloknum].lrownum = bloktax[blokctr].lrownum;
-
-            for (tloktmp = tloktab[tloknum].nextnum; /* Aggregate following chained blocks */
-                 (tloktab[tloktmp].cblknum == tloktab[tloknum].cblknum) &&
-                 (tloktab[tloktmp].frownum <= tloktab[tloknum].lrownum + 1);
-                 tloktmp = tloktab[tloknum].nextnum) {
-              if (tloktab[tloktmp].lrownum > tloktab[tloknum].lrownum) /* Merge aggregated block */
-                tloktab[tloknum].lrownum = tloktab[tloktmp].lrownum;
-              tloktab[tloknum].nextnum = tloktab[tloktmp].nextnum; /* Unlink aggregated block */
-              tloktab[tloktmp].nextnum = tlokfre;
-              tlokfre                  = tloktmp;
-            }
+        if ((bloktax[blokctr].lrownum >= tloktab[tloknum].frownum - 1) && /* Update chained block lower bound */
+            (bloktax[blokctr].frownum <  tloktab[tloknum].frownum))
+          tloktab[tloknum].frownum = bloktax[blokctr].frownum;
+
+        if ((bloktax[blokctr].frownum <= tloktab[tloknum].lrownum + 1) && /* Update chained block upper bound */
+            (bloktax[blokctr].lrownum >  tloktab[tloknum].lrownum)) {
+          INT                 tloktmp;
+
+          tloktab[tloknum].lrownum = bloktax[blokctr].lrownum;
+
+          for (tloktmp = tloktab[tloknum].nextnum; /* Aggregate following chained blocks */
+               (tloktab[tloktmp].cblknum == tloktab[tloknum].cblknum) &&
+               (tloktab[tloktmp].frownum <= tloktab[tloknum].lrownum + 1);
+               tloktmp = tloktab[tloknum].nextnum) {
+            if (tloktab[tloktmp].lrownum > tloktab[tloknum].lrownum) /* Merge aggregated block */
+              tloktab[tloknum].lrownum = tloktab[tloktmp].lrownum;
+            tloktab[tloknum].nextnum = tloktab[tloktmp].nextnum; /* Unlink aggregated block */
+            tloktab[tloktmp].nextnum = tlokfre;
+            tlokfre                  = tloktmp;
           }
         }
       }
+    }
 
-      for (tloknum = 0;                           /* For all chained blocks                    */
-           tloktab[tloknum].nextnum != 0;         /* Until trailer block is reached            */
-           tloknum = tloktab[tloknum].nextnum, bloknum ++) { /* Copy block data to block array */
-        bloktax[bloknum].frownum = tloktab[tloknum].frownum;
-        bloktax[bloknum].lrownum = tloktab[tloknum].lrownum;
-        bloktax[bloknum].cblknum = tloktab[tloknum].cblknum;
+    for (tloknum = 0;                             /* For all chained blocks                    */
+         tloktab[tloknum].nextnum != 0;           /* Until trailer block is reached            */
+         tloknum = tloktab[tloknum].nextnum, bloknum ++) { /* Copy block data to block array */
+      bloktax[bloknum].frownum = tloktab[tloknum].frownum;
+      bloktax[bloknum].lrownum = tloktab[tloknum].lrownum;
+      bloktax[bloknum].cblknum = tloktab[tloknum].cblknum;
 #ifdef SYMBOL_HAS_LEVFVAL
-        bloktax[bloknum].levfval = 0;
+      bloktax[bloknum].levfval = 0;
 #endif /* SYMBOL_HAS_LEVFVAL */
+    }
+  }
+
+  arryptr->bloknum = bloknum;
+
+  return (0);
+}
+
+/*+ This routine links the given column block,
+*** whose blocks end before the given block
+*** index, into the contribution chain of the
+*** column block facing its first extra-diagonal
+*** block, if it has more than one of them.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+static
+void
+symbolFaxCtrb (
+const SymbolFaxData * restrict const  dataptr,    /*+ Factorization data                +*/
+const SymbolBlok * restrict const     bloktax,    /*+ Block array holding column block  +*/
+const INT                             cblknum,    /*+ Column block to link              +*/
+const INT                             bloknnd)    /*+ After-last block of column block  +*/
+{
+  const SymbolCblk * restrict const cblktax = dataptr->cblktax;
+  INT * restrict const              ctrbtax = dataptr->ctrbtax;
+
+  if ((bloknnd - cblktax[cblknum].bloknum) > 2) { /* If more than one extra-diagonal blocks exist */
+    INT                 cblkfac;
+
+    cblkfac = bloktax[cblktax[cblknum].bloknum + 1].cblknum; /* Link contributing column blocks */
+    ctrbtax[cblknum] = ctrbtax[cblkfac];
+    ctrbtax[cblkfac] = cblknum;
+  }
+}
+
+#ifdef SYMBOL_FAX_THREAD
+
+/*+ This routine adds to the candidate array
+*** the roots of the largest subtrees of the
+*** given subtree which span contiguous ranges
+*** of column blocks.
+*** It returns:
+*** - the new number of candidates.
++*/
+
+static
+INT
+symbolFaxTreeAdd (
+const INT                   cblknum,              /*+ Root of subtree to add                  +*/
+const INT * restrict const  sontax,               /*+ First son array                         +*/
+const INT * restrict const  sibltax,              /*+ Next sibling array                      +*/
+const INT * restrict const  fdestax,              /*+ First descendant array                  +*/
+const INT * restrict const  sizetax,              /*+ Subtree size array                      +*/
+INT * restrict const        candtab,              /*+ Candidate array                         +*/
+INT                         candnbr,              /*+ Current number of candidates            +*/
+INT * restrict const        stcktab)              /*+ Stack area                              +*/
+{
+  INT                 stcknbr;
+
+  stcktab[0] = cblknum;
+  for (stcknbr = 1; stcknbr > 0; ) {
+    INT                 cblktmp;
+    INT                 cblkson;
+
+    cblktmp = stcktab[-- stcknbr];
+    if (sizetax[cblktmp] == (cblktmp - fdestax[cblktmp] + 1)) { /* If subtree is contiguous, it is a candidate */
+      candtab[candnbr ++] = cblktmp;
+      continue;
+    }
+    for (cblkson = sontax[cblktmp]; cblkson != ~0; cblkson = sibltax[cblkson]) /* Else try its sons */
+      stcktab[stcknbr ++] = cblkson;
+  }
+
+  return (candnbr);
+}
+
+/*+ This routine computes the elimination tree
+*** of column blocks, by applying Liu's algorithm
+*** with path compression to the quotient graph
+*** of column blocks, and splits it into subtrees
+*** which span contiguous ranges of column blocks,
+*** so that these can be factored concurrently.
+*** Subtrees of largest estimated work are split
+*** until there are enough of them to balance the
+*** load across threads. Subtrees are sorted by
+*** increasing column block number, and assigned
+*** to threads by decreasing work.
+*** It returns:
+*** - 0   : on success, with treenbr possibly 0.
+*** - !0  : on error.
++*/
+
+static
+int
+symbolFaxTree (
+const SymbolFaxData * restrict const  dataptr,    /*+ Factorization data            +*/
+const int                             thrdnbr,    /*+ Number of threads             +*/
+SymbolFaxTree ** const                treeptr,    /*+ Pointer to array of subtrees  +*/
+INT * const                           treenbrptr) /*+ Pointer to number of subtrees +*/
+{
+  INT * restrict            colctax;              /* Column block of every column           */
+  INT * restrict            parntax;              /* Father of every column block           */
+  INT * restrict            ancetax;              /* Ancestor array, then sibling array     */
+  INT * restrict            sontax;               /* First son of every column block        */
+  INT * restrict            fdestax;              /* First descendant of every column block */
+  INT * restrict            sizetax;              /* Number of column blocks in subtree     */
+  INT * restrict            wghttax;              /* Estimated work of subtree              */
+  INT * restrict            candtab;              /* Array of candidate subtree roots       */
+  INT * restrict            stcktab;              /* Stack area for adding candidates       */
+  INT * restrict            sorttab;              /* Sort array of (key, index) pairs       */
+  INT * restrict            loadtab;              /* Work assigned to every thread          */
+  INT                       candnbr;
+  INT                       candnum;
+  INT                       cblknum;
+  INT                       vertend;
+  SymbolFaxTree * restrict  treetab;
+  INT                       treenum;
+  int                       thrdnum;
+
+  SYMBOL_FAX_NEIGHBOR_DATA (dataptr);
+  const INT                   baseval = dataptr->baseval;
+  const INT                   cblknbr = dataptr->cblknbr;
+  const INT                   cblknnd = cblknbr + baseval;
+  const INT * restrict const  permtax = dataptr->permtax;
+  const INT * restrict const  peritax = dataptr->peritax;
+  const INT * restrict const  rangtax = dataptr->rangtax;
+
+  *treeptr    = NULL;
+  *treenbrptr = 0;
+
+  if ((colctax = (INT *) memAlloc ((dataptr->vertnbr + 11 * cblknbr + thrdnbr) * sizeof (INT))) == NULL) {
+    errorPrint ("symbolFaxTree: out of memory (1)");
+    return (1);
+  }
+  parntax  = colctax + dataptr->vertnbr;
+  ancetax  = parntax + cblknbr;
+  sontax   = ancetax + cblknbr;
+  fdestax  = sontax  + cblknbr;
+  sizetax  = fdestax + cblknbr;
+  wghttax  = sizetax + cblknbr;
+  candtab  = wghttax + cblknbr;                   /* Candidate, stack, sort and load arrays are not based */
+  stcktab  = candtab + cblknbr;
+  sorttab  = stcktab + cblknbr;
+  loadtab  = sorttab + 2 * cblknbr;
+  colctax -= baseval;
+  parntax -= baseval;
+  ancetax -= baseval;
+  sontax  -= baseval;
+  fdestax -= baseval;
+  sizetax -= baseval;
+  wghttax -= baseval;
+
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) {
+    INT                 colnum;
+
+    for (colnum = rangtax[cblknum]; colnum < rangtax[cblknum + 1]; colnum ++)
+      colctax[colnum] = cblknum;
+  }
+
+  memset (parntax + baseval, ~0, 3 * cblknbr * sizeof (INT)); /* No fathers, ancestors nor sons yet */
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) { /* Liu's algorithm on quotient graph */
+    INT                 colnum;
+    INT                 wghtval;
+
+    for (colnum = rangtax[cblknum], wghtval = 0; colnum < rangtax[cblknum + 1]; colnum ++) {
+      INT                 vertnum;
+
+      vertnum  = peritax[colnum];
+      wghtval += SYMBOL_FAX_VERTEX_DEGREE (ngbdptr, vertnum) + 1;
+      SYMBOL_FAX_ITERATOR (ngbdptr, vertnum, vertend)
+        INT                 cblkend;
+
+        cblkend = colctax[permtax[vertend]];
+        if (cblkend >= cblknum)                   /* Only consider left column blocks */
+          continue;
+
+        while ((ancetax[cblkend] != ~0) && (ancetax[cblkend] != cblknum)) { /* Climb up with path compression */
+          INT                 cblktmp;
+
+          cblktmp = ancetax[cblkend];
+          ancetax[cblkend] = cblknum;
+          cblkend = cblktmp;
+        }
+        if (ancetax[cblkend] == ~0) {             /* If root of subtree found, link it */
+          ancetax[cblkend] = cblknum;
+          parntax[cblkend] = cblknum;
+        }
       }
     }
-    if ((bloknum - cblktax[cblknum].bloknum) > 2) { /* If more than one extra-diagonal blocks exist                 */
-      ctrbtax[cblknum] = ctrbtax[bloktax[cblktax[cblknum].bloknum + 1].cblknum]; /* Link contributing column blocks */
-      ctrbtax[bloktax[cblktax[cblknum].bloknum + 1].cblknum] = cblknum;
+    wghttax[cblknum] = wghtval;
+    fdestax[cblknum] = cblknum;
+    sizetax[cblknum] = 1;
+  }
+
+  for (cblknum = cblknnd - 1; cblknum >= baseval; cblknum --) { /* Build son lists, reusing ancetax for siblings */
+    INT                 cblkfat;
+
+    ancetax[cblknum] = ~0;
+    cblkfat = parntax[cblknum];
+    if (cblkfat != ~0) {
+      ancetax[cblknum] = sontax[cblkfat];
+      sontax[cblkfat]  = cblknum;
     }
   }
-  cblktax[cblknum].fcolnum =                      /* Set last column block data */
-  cblktax[cblknum].lcolnum = vertnbr + baseval;
-  cblktax[cblknum].bloknum = bloknum;
+  for (cblknum = baseval; cblknum < cblknnd; cblknum ++) { /* Sons are always numbered before their father */
+    INT                 cblkfat;
+
+    cblkfat = parntax[cblknum];
+    if (cblkfat == ~0)
+      continue;
+    if (fdestax[cblknum] < fdestax[cblkfat])
+      fdestax[cblkfat] = fdestax[cblknum];
+    sizetax[cblkfat] += sizetax[cblknum];
+    wghttax[cblkfat] += wghttax[cblknum];
+  }
+
+  for (cblknum = baseval, candnbr = 0; cblknum < cblknnd; cblknum ++) { /* Start from largest contiguous subtrees */
+    if (parntax[cblknum] == ~0)
+      candnbr = symbolFaxTreeAdd (cblknum, sontax, ancetax, fdestax, sizetax, candtab, candnbr, stcktab);
+  }
+
+  while (candnbr < (SYMBOL_FAX_TREERATIO * thrdnbr)) { /* Split heaviest subtrees until enough of them */
+    INT                 candmax;
+    INT                 cblkson;
+
+    for (candnum = 0, candmax = ~0; candnum < candnbr; candnum ++) {
+      cblknum = candtab[candnum];
+      if ((sontax[cblknum] != ~0) &&              /* Leaves cannot be split */
+          ((candmax == ~0) || (wghttax[cblknum] > wghttax[candtab[candmax]])))
+        candmax = candnum;
+    }
+    if (candmax == ~0)                            /* If nothing left to split */
+      break;
+
+    cblknum = candtab[candmax];                   /* Root goes to the sequential part */
+    candtab[candmax] = candtab[-- candnbr];
+    for (cblkson = sontax[cblknum]; cblkson != ~0; cblkson = ancetax[cblkson])
+      candnbr = symbolFaxTreeAdd (cblkson, sontax, ancetax, fdestax, sizetax, candtab, candnbr, stcktab);
+  }
+
+  if (candnbr < 2) {                              /* Not worth threading */
+    memFree (colctax + baseval);
+    return (0);
+  }
+
+  if ((treetab = (SymbolFaxTree *) memAlloc (candnbr * sizeof (SymbolFaxTree))) == NULL) {
+    errorPrint ("symbolFaxTree: out of memory (2)");
+    memFree    (colctax + baseval);
+    return (1);
+  }
+
+  for (candnum = 0; candnum < candnbr; candnum ++) { /* Sort subtrees by increasing first column block */
+    sorttab[2 * candnum]     = fdestax[candtab[candnum]];
+    sorttab[2 * candnum + 1] = candtab[candnum];
+  }
+  intSort2asc1 (sorttab, candnbr);
+  for (treenum = 0; treenum < candnbr; treenum ++) {
+    cblknum = sorttab[2 * treenum + 1];
+    treetab[treenum].cblkbas = fdestax[cblknum];
+    treetab[treenum].cblknnd = cblknum + 1;
+    treetab[treenum].wghtval = wghttax[cblknum];
+    treetab[treenum].arrydat.bloktax = NULL;
+  }
+
+  for (treenum = 0; treenum < candnbr; treenum ++) { /* Sort subtrees by decreasing work */
+    sorttab[2 * treenum]     = - treetab[treenum].wghtval;
+    sorttab[2 * treenum + 1] = treenum;
+  }
+  intSort2asc1 (sorttab, candnbr);
+  memset (loadtab, 0, thrdnbr * sizeof (INT));
+  for (candnum = 0; candnum < candnbr; candnum ++) { /* Assign every subtree to least loaded thread */
+    int                 thrdmin;
+
+    for (thrdnum = 1, thrdmin = 0; thrdnum < thrdnbr; thrdnum ++) {
+      if (loadtab[thrdnum] < loadtab[thrdmin])
+        thrdmin = thrdnum;
+    }
+    treenum = sorttab[2 * candnum + 1];
+    treetab[treenum].thrdnum = thrdmin;
+    loadtab[thrdmin] += treetab[treenum].wghtval;
+  }
+
+  memFree (colctax + baseval);
 
-  memFree (ctrbtax + baseval);                    /* Free contribution link array */
+  *treeptr    = treetab;
+  *treenbrptr = candnbr;
+
+  return (0);
+}
+
+/*+ This routine factors the subtrees assigned
+*** to the current thread, each in its own block
+*** array. Roots of subtrees are not linked into
+*** contribution chains, as their fathers may be
+*** shared with other threads; this is done when
+*** subtrees are merged.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+static
+void
+symbolFaxTreeThread (
+ThreadDescriptor * restrict const   descptr,
+SymbolFaxTreeData * restrict const  treedat)
+{
+  INT                 treenum;
+
+  const int                         thrdnum = threadNum (descptr);
+  const SymbolFaxData * restrict const  dataptr = treedat->dataptr;
+  const INT                         baseval = dataptr->baseval;
+
+  for (treenum = 0; treenum < treedat->treenbr; treenum ++) {
+    SymbolFaxTree * restrict  treeptr;
+    SymbolFaxArray            arrydat;
+    INT                       cblknum;
+
+    treeptr = &treedat->treetab[treenum];
+    if (treeptr->thrdnum != thrdnum)
+      continue;
+
+    arrydat.bloknum = baseval;
+    arrydat.blokmax = (treeptr->cblknnd - treeptr->cblkbas) * (2 + dataptr->edgenbr / dataptr->vertnbr) + 2; /* Same estimate as global array */
+    if ((arrydat.bloktax = (SymbolBlok *) memAlloc (arrydat.blokmax * sizeof (SymbolBlok))) == NULL) {
+      errorPrint ("symbolFaxTreeThread: out of memory");
+      continue;                                   /* Leave bloktax set to NULL to flag error */
+    }
+    arrydat.bloktax -= baseval;
+
+    for (cblknum = treeptr->cblkbas; cblknum < treeptr->cblknnd; cblknum ++) {
+      if (symbolFaxCblk (dataptr, &arrydat, cblknum) != 0)
+        break;
+      if (cblknum < (treeptr->cblknnd - 1))       /* Do not link root of subtree */
+        symbolFaxCtrb (dataptr, arrydat.bloktax, cblknum, arrydat.bloknum);
+    }
+    if (cblknum < treeptr->cblknnd) {             /* If error, free array */
+      memFree (arrydat.bloktax + baseval);
+      continue;
+    }
+
+    treeptr->arrydat = arrydat;
+  }
+}
+
+#endif /* SYMBOL_FAX_THREAD */
+
+/*+ This routine computes the symbolic block
+*** matrix from the factorization data. When
+*** a context with several threads is given,
+*** independent subtrees of the elimination
+*** tree are factored concurrently, and their
+*** blocks are then merged, in column block
+*** order, with those of the column blocks
+*** which lie above them, so that the result
+*** is identical to the sequential one.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+static
+int
+symbolFax2 (
+SymbolMatrix * const                  symbptr,    /*+ Symbolic block matrix [based] +*/
+SymbolFaxData * restrict const        dataptr,    /*+ Factorization data            +*/
+Context * const                       contptr)    /*+ Execution context, or NULL    +*/
+{
+  SymbolFaxArray            arrydat;              /* Global block array                          */
+  SymbolFaxTree *           treetab;              /* Array of subtrees to be factored by threads */
+  INT                       treenbr;              /* Number of subtrees                          */
+  INT                       treenum;
+  INT                       cblknum;
+  int                       o;
+
+  const INT                 baseval = dataptr->baseval;
+  const INT                 cblknbr = dataptr->cblknbr;
+
+  arrydat.blokmax = cblknbr * (2 + dataptr->edgenbr / dataptr->vertnbr) + 2; /* Estimate size of initial block array */
+
+  {                                               /* Allocate arrays for factoring   */
+    INT *               ctrbtab;                  /* Array for contribution chaining */
+    SymbolCblk *        cblktab;                  /* Column block array              */
+    SymbolBlok *        bloktab;                  /* Block array                     */
+
+    if (((ctrbtab = (INT *)        memAlloc (cblknbr         * sizeof (INT)))        == NULL) ||
+        ((cblktab = (SymbolCblk *) memAlloc ((cblknbr + 1)   * sizeof (SymbolCblk))) == NULL) ||
+        ((bloktab = (SymbolBlok *) memAlloc (arrydat.blokmax * sizeof (SymbolBlok))) == NULL)) {
+      errorPrint ("symbolFax: out of memory (1)");
+      if (ctrbtab != NULL) {
+        if (cblktab != NULL)
+          memFree (cblktab);
+        memFree (ctrbtab);
+      }
+      return (1);
+    }
+    memset (ctrbtab, ~0, cblknbr * sizeof (INT)); /* Initialize column block contributions link array */
+
+    dataptr->cblktax = cblktab - baseval;         /* Set based accesses */
+    dataptr->ctrbtax = ctrbtab - baseval;
+    arrydat.bloktax  = bloktab - baseval;
+    arrydat.bloknum  = baseval;
+  }
+
+  treetab = NULL;
+  treenbr = 0;
+  o       = 0;
+#ifdef SYMBOL_FAX_THREAD
+  if ((contptr != NULL) &&                        /* If subtrees can be factored concurrently */
+      (contextThreadNbr (contptr) > 1) &&
+      (cblknbr >= SYMBOL_FAX_TREECBLKMIN)) {
+    SymbolFaxTreeData   treedat;
+
+    o = symbolFaxTree (dataptr, contextThreadNbr (contptr), &treetab, &treenbr);
+    if ((o == 0) && (treenbr > 0)) {
+      treedat.dataptr = dataptr;
+      treedat.treetab = treetab;
+      treedat.treenbr = treenbr;
+      contextThreadLaunch (contptr, (ThreadFunc) symbolFaxTreeThread, (void *) &treedat);
+
+      for (treenum = 0; treenum < treenbr; treenum ++) {
+        if (treetab[treenum].arrydat.bloktax == NULL) {
+          errorPrint ("symbolFax: cannot factor subtree");
+          o = 1;
+        }
+      }
+    }
+  }
+#endif /* SYMBOL_FAX_THREAD */
+
+  for (cblknum = baseval, treenum = 0; (o == 0) && (cblknum < cblknbr + baseval); ) { /* For all column blocks */
+    if ((treenum < treenbr) && (cblknum == treetab[treenum].cblkbas)) { /* If start of factored subtree */
+      SymbolFaxTree * restrict  treeptr;
+      INT                       bloknbr;
+      INT                       blokoft;
+      INT                       cblktmp;
+
+      treeptr = &treetab[treenum ++];
+      bloknbr = treeptr->arrydat.bloknum - baseval;
+      if ((arrydat.bloknum + bloknbr) > (arrydat.blokmax + baseval)) { /* If not enough room for subtree blocks */
+        SymbolBlok *        bloktmp;
+        INT                 blokmax;
+
+        blokmax = arrydat.bloknum + bloknbr - baseval;
+        blokmax = blokmax + (blokmax >> 2) + 4;
+        if ((bloktmp = (SymbolBlok *) memRealloc (arrydat.bloktax + baseval, (blokmax * sizeof (SymbolBlok)))) == NULL) {
+          errorPrint ("symbolFax: out of memory (2)");
+          o = 1;
+          break;
+        }
+        arrydat.bloktax = bloktmp - baseval;
+        arrydat.blokmax = blokmax;
+      }
+
+      memCpy (arrydat.bloktax + arrydat.bloknum, treeptr->arrydat.bloktax + baseval, bloknbr * sizeof (SymbolBlok));
+      blokoft = arrydat.bloknum - baseval;
+      for (cblktmp = cblknum; cblktmp < treeptr->cblknnd; cblktmp ++) /* Renumber blocks of subtree */
+        dataptr->cblktax[cblktmp].bloknum += blokoft;
+      arrydat.bloknum += bloknbr;
+
+      memFree (treeptr->arrydat.bloktax + baseval);
+      treeptr->arrydat.bloktax = NULL;
+
+      cblknum = treeptr->cblknnd - 1;             /* Link root of subtree */
+    }
+    else if (symbolFaxCblk (dataptr, &arrydat, cblknum) != 0) {
+      o = 1;
+      break;
+    }
+    symbolFaxCtrb (dataptr, arrydat.bloktax, cblknum, arrydat.bloknum);
+    cblknum ++;
+  }
+
+  if (treetab != NULL) {
+    for (treenum = 0; treenum < treenbr; treenum ++) { /* Free remaining subtree arrays, if any */
+      if (treetab[treenum].arrydat.bloktax != NULL)
+        memFree (treetab[treenum].arrydat.bloktax + baseval);
+    }
+    memFree (treetab);
+  }
+  memFree (dataptr->ctrbtax + baseval);           /* Free contribution link array */
+  if (o != 0) {
+    memFree (arrydat.bloktax + baseval);
+    memFree (dataptr->cblktax + baseval);
+    return (1);
+  }
+
+  dataptr->cblktax[cblknum].fcolnum =             /* Set last column block data */
+  dataptr->cblktax[cblknum].lcolnum = dataptr->vertnbr + baseval;
+  dataptr->cblktax[cblknum].bloknum = arrydat.bloknum;
 
   symbptr->baseval = baseval;                     /* Fill in matrix fields */
-  symbptr->cblknbr = ordeptr->cblknbr;
-  symbptr->bloknbr = bloknum - baseval;
-  symbptr->cblktab = cblktax + baseval;
-  symbptr->bloktab = memRealloc (bloktax + baseval, (bloknum - baseval) * sizeof (SymbolBlok)); /* Set array to its exact size */
-  symbptr->nodenbr = vertnbr;
+  symbptr->cblknbr = cblknbr;
+  symbptr->bloknbr = arrydat.bloknum - baseval;
+  symbptr->cblktab = dataptr->cblktax + baseval;
+  symbptr->bloktab = memRealloc (arrydat.bloktax + baseval, (arrydat.bloknum - baseval) * sizeof (SymbolBlok)); /* Set array to its exact size */
+  symbptr->nodenbr = dataptr->vertnbr;
 
 #ifdef FAX_DEBUG
   if (symbolCheck (symbptr) != 0) {
@@ -509,3 +969,46 @@ const Order * const         ordeptr)              /*+ Matrix ordering
 
   return (0);
 }
+
+/*+ This is the generic symbolic factorization
+*** routine, which accesses the graph through
+*** user-provided neighbor functions. As these
+*** functions are stateful, it always runs
+*** sequentially.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+#ifndef SYMBOL_FAX_INCLUDED
+
+int
+symbolFax (
+SymbolMatrix * const        symbptr,              /*+ Symbolic block matrix [based]                      +*/
+const INT                   vertnbr,              /*+ Number of vertices                                 +*/
+const INT                   edgenbr,              /*+ Number of edges                                    +*/
+const INT                   baseval,              /*+ Base value                                         +*/
+void * const                ngbdptr,              /*+ Neighbor bookkeeping area                          +*/
+INT                         ngbfrst (void * const, const INT), /*+ First neighbor function               +*/
+INT                         ngbnext (void * const), /*+ Next neighbor function                           +*/
+INT                         ngbdegr (void * const, const INT),  /*+ Vertex degree function (upper bound) +*/
+const Order * const         ordeptr)              /*+ Matrix ordering                                    +*/
+{
+  SymbolFaxData       faxdat;
+
+  faxdat.baseval = baseval;
+  faxdat.vertnbr = vertnbr;
+  faxdat.edgenbr = edgenbr;
+  faxdat.cblknbr = ordeptr->cblknbr;
+  faxdat.permtax = ordeptr->permtab - baseval;    /* Compute array bases */
+  faxdat.peritax = ordeptr->peritab - baseval;
+  faxdat.rangtax = ordeptr->rangtab - baseval;
+  faxdat.ngbdptr = ngbdptr;
+  faxdat.ngbfrst = ngbfrst;
+  faxdat.ngbnext = ngbnext;
+  faxdat.ngbdegr = ngbdegr;
+
+  return (symbolFax2 (symbptr, &faxdat, NULL));
+}
+
+#endif /* SYMBOL_FAX_INCLUDED */
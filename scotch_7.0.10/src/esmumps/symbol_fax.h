@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -51,7 +51,7 @@
 /**                # Version 3.0  : from : 03 mar 2004     **/
 /**                                 to   : 03 mar 2004     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,11 @@
 
 #define SYMBOL_FAX_HASHPRIME        17            /*+ Prime number for hashing +*/
 
+/* Subtree splitting parameters. */
+
+#define SYMBOL_FAX_TREECBLKMIN      64            /*+ Minimum number of column blocks for threading +*/
+#define SYMBOL_FAX_TREERATIO        4             /*+ Number of subtrees per thread to aim at       +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -77,3 +82,74 @@ typedef struct SymbolFaxTlok_ {
   INT                       cblknum;              /*+ Facing column block        +*/
   INT                       nextnum;              /*+ Index of next block        +*/
 } SymbolFaxTlok;
+
+/*+ The growing block array in which blocks
+    of column blocks are computed.           +*/
+
+typedef struct SymbolFaxArray_ {
+  SymbolBlok *              bloktax;              /*+ Block array [based]          +*/
+  INT                       bloknum;              /*+ Index of first free block    +*/
+  INT                       blokmax;              /*+ Size of block array          +*/
+} SymbolFaxArray;
+
+/*+ The data shared by all column block
+    computations. The neighbor data are
+    only used by the generic routine.    +*/
+
+typedef struct SymbolFaxData_ {
+  INT                       baseval;              /*+ Base value                                 +*/
+  INT                       vertnbr;              /*+ Number of vertices                         +*/
+  INT                       edgenbr;              /*+ Number of edges                            +*/
+  INT                       cblknbr;              /*+ Number of column blocks                    +*/
+  const INT *               permtax;              /*+ Direct permutation array [based]           +*/
+  const INT *               peritax;              /*+ Inverse permutation array [based]          +*/
+  const INT *               rangtax;              /*+ Column block range array [based]           +*/
+  SymbolCblk *              cblktax;              /*+ Column block array [based]                 +*/
+  INT *                     ctrbtax;              /*+ Array of contribution chains [based]       +*/
+  void *                    ngbdptr;              /*+ Neighbor bookkeeping area                  +*/
+  INT                    (* ngbfrst) (void * const, const INT); /*+ First neighbor function      +*/
+  INT                    (* ngbnext) (void * const); /*+ Next neighbor function                  +*/
+  INT                    (* ngbdegr) (void * const, const INT); /*+ Vertex degree function       +*/
+} SymbolFaxData;
+
+/*+ The neighbor data of the graph routine. +*/
+
+typedef struct SymbolFaxGraphData_ {
+  const INT *               verttax;              /*+ Vertex array [based]     +*/
+  const INT *               vendtax;              /*+ End vertex array [based] +*/
+  const INT *               edgetax;              /*+ Edge array [based]       +*/
+} SymbolFaxGraphData;
+
+/*+ A subtree of the column block elimination
+    tree, that is, a contiguous range of column
+    blocks whose last one is the root, which is
+    factored independently in its own array.    +*/
+
+typedef struct SymbolFaxTree_ {
+  INT                       cblkbas;              /*+ First column block of subtree        +*/
+  INT                       cblknnd;              /*+ After-last column block of subtree   +*/
+  INT                       wghtval;              /*+ Estimated work for subtree           +*/
+  int                       thrdnum;              /*+ Thread in charge of subtree          +*/
+  SymbolFaxArray            arrydat;              /*+ Block array; bloktax NULL on error   +*/
+} SymbolFaxTree;
+
+/*+ The data passed to the subtree threads. +*/
+
+typedef struct SymbolFaxTreeData_ {
+  const SymbolFaxData *     dataptr;              /*+ Factorization data         +*/
+  SymbolFaxTree *           treetab;              /*+ Array of subtrees          +*/
+  INT                       treenbr;              /*+ Number of subtrees         +*/
+} SymbolFaxTreeData;
+
+/*
+**  The function prototypes.
+*/
+
+static int                  symbolFaxCblk       (const SymbolFaxData * restrict const, SymbolFaxArray * restrict const, const INT);
+static void                 symbolFaxCtrb       (const SymbolFaxData * restrict const, const SymbolBlok * restrict const, const INT, const INT);
+#ifdef SYMBOL_FAX_THREAD
+static INT                  symbolFaxTreeAdd    (const INT, const INT * restrict const, const INT * restrict const, const INT * restrict const, const INT * restrict const, INT * restrict const, INT, INT * restrict const);
+static int                  symbolFaxTree       (const SymbolFaxData * restrict const, const int, SymbolFaxTree ** const, INT * const);
+static void                 symbolFaxTreeThread (ThreadDescriptor * restrict const, SymbolFaxTreeData * restrict const);
+#endif /* SYMBOL_FAX_THREAD */
+static int                  symbolFax2          (SymbolMatrix * const, SymbolFaxData * restrict const, Context * const);
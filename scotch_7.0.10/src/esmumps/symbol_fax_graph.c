@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.0  : from : 21 jan 2020     **/
 /**                                 to   : 22 jan 2020     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # symbolFaxGraph() could have called    **/
 /**                  symbolFax() in the regular way, as    **/
@@ -65,6 +65,10 @@
 /**                  reasons, we have decided to inline    **/
 /**                  symbolFax(), to avoid a function call **/
 /**                  for every arc.                        **/
+/**                # symbolFaxGraph() factors independent  **/
+/**                  subtrees concurrently when the graph  **/
+/**                  is bound to a context with several    **/
+/**                  threads.                              **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,8 +76,12 @@
 **  The defines and includes.
 */
 
+#define SYMBOL_FAX_INCLUDED
+#define SYMBOL_FAX_THREAD
+
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "scotch.h"
 #include "graph.h"
 #include "symbol.h"
@@ -81,6 +89,23 @@
 #include "fax.h"
 #include "symbol_fax.h"
 
+#define SYMBOL_FAX_NEIGHBOR_DATA(dataptr) \
+                                    const INT * restrict const  verttax = ((const SymbolFaxGraphData *) (dataptr)->ngbdptr)->verttax; \
+                                    const INT * restrict const  vendtax = ((const SymbolFaxGraphData *) (dataptr)->ngbdptr)->vendtax; \
+                                    const INT * restrict const  edgetax = ((const SymbolFaxGraphData *) (dataptr)->ngbdptr)->edgetax; \
+                                    INT                         edgenum
+
+#define SYMBOL_FAX_ITERATOR(ngbdptr, vertnum, vertend) \
+                                    for (edgenum = verttax[vertnum]; \
+                                         edgenum < vendtax[vertnum]; \
+                                         edgenum ++) {               \
+                                      vertend = edgetax[edgenum];
+
+#define SYMBOL_FAX_VERTEX_DEGREE(ngbdptr, vertnum) \
+                                    (vendtax[(vertnum)] - verttax[(vertnum)])
+
+#include "symbol_fax.c"
+
 /***********************************/
 /*                                 */
 /* Symbolic factorization routine. */
@@ -90,6 +115,9 @@
 /*+ This routine computes the block symbolic
 *** factorization of the given matrix graph
 *** according to the given vertex ordering.
+*** If the graph is bound to a context, its
+*** threads are used to factor independent
+*** subtrees of the elimination tree.
 *** It returns:
 *** - 0   : on success.
 *** - !0  : on error.
@@ -104,30 +132,38 @@ const Order * const         ordeptr)              /*+ Matrix ordering
   INT                   baseval;
   INT                   vertnbr;
   INT *                 verttab;
-  const INT * restrict  verttax;
   INT *                 vendtab;
-  const INT * restrict  vendtax;
   INT                   edgenbr;
-  INT                   edgenum;
   INT *                 edgetab;
-  const INT * restrict  edgetax;
+  SymbolFaxGraphData    ngbddat;
+  SymbolFaxData         faxdat;
+  int                   o;
+  CONTEXTDECL          (grafptr);
 
-  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, NULL);
-  verttax = verttab - baseval;
-  vendtax = vendtab - baseval;
-  edgetax = edgetab - baseval;
+  if (CONTEXTINIT (grafptr)) {
+    errorPrint ("symbolFaxGraph: cannot initialize context");
+    return (1);
+  }
 
-#define SYMBOL_FAX_ITERATOR(ngbdptr, vertnum, vertend) \
-                                    for (edgenum = verttax[vertnum]; \
-                                         edgenum < vendtax[vertnum]; \
-                                         edgenum ++) {               \
-                                      vertend = edgetax[edgenum];
+  SCOTCH_graphData (CONTEXTGETOBJECT (grafptr), &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, NULL);
+  ngbddat.verttax = verttab - baseval;
+  ngbddat.vendtax = vendtab - baseval;
+  ngbddat.edgetax = edgetab - baseval;
 
-#define SYMBOL_FAX_VERTEX_DEGREE(ngbdptr, vertnum) \
-                                    (vendtax[(vertnum)] - verttax[(vertnum)])
+  faxdat.baseval = baseval;
+  faxdat.vertnbr = vertnbr;
+  faxdat.edgenbr = edgenbr;
+  faxdat.cblknbr = ordeptr->cblknbr;
+  faxdat.permtax = ordeptr->permtab - baseval;    /* Compute array bases */
+  faxdat.peritax = ordeptr->peritab - baseval;
+  faxdat.rangtax = ordeptr->rangtab - baseval;
+  faxdat.ngbdptr = (void *) &ngbddat;
+  faxdat.ngbfrst = NULL;                          /* Neighbors are accessed through inlined macros */
+  faxdat.ngbnext = NULL;
+  faxdat.ngbdegr = NULL;
 
-  {
-#define SYMBOL_FAX_INCLUDED
-#include "symbol_fax.c"
-  }
+  o = symbolFax2 (symbptr, &faxdat, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
 }
@@ -1,4 +1,4 @@
-/* Copyright 2022,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2022,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                symbolic factorization routine.         **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 21 apr 2022     **/
-/**                                 to   : 10 sep 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,6 +56,64 @@
 #include "symbol.h"
 #include "fax.h"
 
+#define TEST_FAX_THRDNBR            4             /* Default number of threads */
+
+/*************************/
+/*                       */
+/* The test routine.     */
+/*                       */
+/*************************/
+
+/*+ This routine computes the symbolic
+*** factorization of the given graph, using
+*** a context with the given number of threads.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+static
+int
+testFax (
+Graph * const               grafptr,
+const Order * const         ordeptr,
+const int                   thrdnbr,
+SymbolMatrix * const        symbptr,
+double * const              timeptr)
+{
+  SCOTCH_Context      contdat;
+  Graph               grafdat;                    /* Context container graph */
+  double              timeval;
+  int                 o;
+
+  SCOTCH_contextInit (&contdat);
+  if (SCOTCH_contextThreadSpawn (&contdat, thrdnbr, NULL) != 0) {
+    errorPrint ("testFax: cannot spawn threads");
+    SCOTCH_contextExit (&contdat);
+    return (1);
+  }
+
+  graphInit (&grafdat);
+  if (SCOTCH_contextBindGraph (&contdat, grafptr, &grafdat) != 0) {
+    errorPrint ("testFax: cannot bind context");
+    SCOTCH_contextExit (&contdat);
+    return (1);
+  }
+
+  symbolInit (symbptr);
+  timeval = clockGet ();
+  o = symbolFaxGraph (symbptr, &grafdat, ordeptr);
+  *timeptr = clockGet () - timeval;
+
+  graphExit          (&grafdat);
+  SCOTCH_contextExit (&contdat);
+
+  if (o != 0)
+    errorPrint ("testFax: error in symbolic factorization");
+
+  return (o);
+}
+
 /******************************/
 /*                            */
 /* This is the main function. */
@@ -69,14 +127,22 @@ char *                      argv[])
 {
   Graph               grafdat;                    /* Graph to load */
   Order               ordedat;
-  SymbolMatrix        symbdat;
+  SymbolMatrix        symbdat;                    /* Sequential factorization */
+  SymbolMatrix        symbtmp;                    /* Threaded factorization   */
+  double              timetab[2];
+  int                 thrdnbr;
   Dof                 deofdat;
   FILE *              stream;
   double              nonzval;
   double              opcoval;
 
-  if (argc != 3) {
-    errorPrint ("test_fax: usage: test_fax graph_file ordering_file");
+  if ((argc < 3) || (argc > 4)) {
+    errorPrint ("test_fax: usage: test_fax graph_file ordering_file [thread_number]");
+    exit       (EXIT_FAILURE);
+  }
+  thrdnbr = (argc > 3) ? atoi (argv[3]) : TEST_FAX_THRDNBR;
+  if (thrdnbr < 1) {
+    errorPrint ("test_fax: invalid number of threads");
     exit       (EXIT_FAILURE);
   }
 
@@ -108,12 +174,26 @@ char *                      argv[])
   }
   fclose (stream);
 
-  symbolInit (&symbdat);
-  if (symbolFaxGraph (&symbdat, &grafdat, &ordedat) != 0) {
+  if ((testFax (&grafdat, &ordedat, 1,       &symbdat, &timetab[0]) != 0) ||
+      (testFax (&grafdat, &ordedat, thrdnbr, &symbtmp, &timetab[1]) != 0)) {
     errorPrint ("test_fax: error in symbolic factorization");
     exit       (EXIT_FAILURE);
   }
 
+  if ((symbdat.baseval != symbtmp.baseval) ||     /* Threaded result must be identical to sequential one */
+      (symbdat.cblknbr != symbtmp.cblknbr) ||
+      (symbdat.bloknbr != symbtmp.bloknbr) ||
+      (symbdat.nodenbr != symbtmp.nodenbr) ||
+      (memcmp (symbdat.cblktab, symbtmp.cblktab, (symbdat.cblknbr + 1) * sizeof (SymbolCblk)) != 0) ||
+      (memcmp (symbdat.bloktab, symbtmp.bloktab, symbdat.bloknbr * sizeof (SymbolBlok)) != 0)) {
+    errorPrint ("test_fax: threaded and sequential factorizations differ");
+    exit       (EXIT_FAILURE);
+  }
+  symbolExit (&symbtmp);
+
+  printf ("Fax time (1 thread):   %g s\nFax time (%d threads): %g s\n",
+          timetab[0], thrdnbr, timetab[1]);
+
   dofInit  (&deofdat);
   dofGraph (&deofdat, &grafdat, 1, ordedat.peritab);
 
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 30 apr 2015     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 18 feb 2018     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -210,7 +210,7 @@ FILE * restrict const       stream)
   archptr->levltab = levltab;
 
   for (levlnum = 0; levlnum < levlnbr; levlnum ++) {
-    if (graphLoad (&levltab[levlnum].grafdat, stream, -1, 0) != 0) {
+    if (graphLoad (&levltab[levlnum].grafdat, stream, -1, 0, NULL) != 0) {
       errorPrint ("archDeco2ArchLoad2: bad input (4)");
       archptr->levlmax = levlnum - 1;             /* Only free existing levels */
       goto abort;
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 11 sep 2011     **/
 /**                                 to   : 31 aug 2014     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,9 +58,87 @@
 #include "common.h"
 #include "arch.h"
 #include "dgraph.h"
+#include "dgraph_halo.h"
 #include "bdgraph.h"
 #include "bdgraph_bipart_df.h"
 
+/* This routine computes the new diffusion
+** values of the given non-anchor vertices,
+** from the old diffusion values of their
+** neighbors. As vertices are sorted by
+** ascending number, processing stops at
+** the first anchor vertex, if any.
+** It returns:
+** - 0   : if no overflow occured.
+** - !0  : on overflow.
+*/
+
+static
+int
+bdgraphBipartDfVert (
+const Bdgraph * restrict const  grafptr,          /*+ Distributed graph                       +*/
+const Gnum * restrict const     vertsrttab,       /*+ Array of vertices to process            +*/
+const Gnum                      vertsrtnbr,       /*+ Number of vertices in array             +*/
+const Gnum                      vanclocnnd,       /*+ Number of first local anchor vertex     +*/
+const float * restrict const    ielsloctax,       /*+ Inverse of degree array                 +*/
+const float * restrict const    difogsttax,       /*+ Old diffusion value array               +*/
+float * restrict const          difngsttax,       /*+ New diffusion value array               +*/
+const float                     cdifval,          /*+ Coefficient of diffused load            +*/
+const float                     cremval)          /*+ Coefficient of remaining load           +*/
+{
+  Gnum                vertsrtnum;
+  float               veloval;
+
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+  const Gnum * restrict const edgegsttax = grafptr->s.edgegsttax;
+  const Gnum * restrict const edloloctax = grafptr->s.edloloctax;
+
+  veloval = 1.0F;                                 /* Assume no vertex loads */
+  for (vertsrtnum = 0; vertsrtnum < vertsrtnbr; vertsrtnum ++) {
+    Gnum                vertlocnum;
+    Gnum                edgelocnum;
+    Gnum                edgelocnnd;
+    float               diffval;
+
+    vertlocnum = vertsrttab[vertsrtnum];
+    if (vertlocnum >= vanclocnnd)                 /* Anchor vertices are processed separately */
+      break;
+
+    diffval    = 0.0F;
+    edgelocnum = vertloctax[vertlocnum];
+    edgelocnnd = vendloctax[vertlocnum];
+    if (edloloctax != NULL)
+      for ( ; edgelocnum < edgelocnnd; edgelocnum ++)
+        diffval += difogsttax[edgegsttax[edgelocnum]] * (float) edloloctax[edgelocnum];
+    else
+      for ( ; edgelocnum < edgelocnnd; edgelocnum ++)
+        diffval += difogsttax[edgegsttax[edgelocnum]];
+
+    diffval *= cdifval;
+    diffval += (difogsttax[vertlocnum] * cremval) / ielsloctax[vertlocnum];
+
+    if (veloloctax != NULL)
+      veloval = (float) veloloctax[vertlocnum];
+    if (diffval >= 0.0F) {
+      diffval = (diffval - veloval) * ielsloctax[vertlocnum];
+      if (diffval <= 0.0F)
+        diffval = +BDGRAPHBIPARTDFEPSILON;
+    }
+    else {
+      diffval = (diffval + veloval) * ielsloctax[vertlocnum];
+      if (diffval >= 0.0F)
+        diffval = -BDGRAPHBIPARTDFEPSILON;
+    }
+    if (isnan (diffval))                          /* If overflow occured */
+      return (1);
+    difngsttax[vertlocnum] = diffval;
+  }
+
+  return (0);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -85,6 +163,8 @@ const BdgraphBipartDfParam * const  paraptr)      /*+ Method parameters +*/
   float * restrict        difogsttax;             /* Old diffusion value array */
   float * restrict        difngsttax;             /* New diffusion value array */
   const Gnum * restrict   edgegsttax;
+  const Gnum * restrict   vertsrttab;             /* Interior vertices first   */
+  Gnum                    vintlocnbr;             /* Number of inner vertices  */
   Gnum                    fronlocnum;
   Gnum                    veexlocnbr;
   float                   vanclocval[2];
@@ -121,8 +201,15 @@ const BdgraphBipartDfParam * const  paraptr)      /*+ Method parameters +*/
     reduloctab[3] = grafptr->s.veloloctax[grafptr->s.vertlocnnd - 1];
   }
 
+  if ((vertsrttab = dgraphHaloVert (&grafptr->s, &vintlocnbr)) == NULL) { /* Split local vertices to overlap halo exchanges */
+    errorPrint ("bdgraphBipartDf: cannot compute vertex split");
+    reduloctab[0] = -1;
+  }
+
   veexlocnbr = (grafptr->veexloctax != NULL) ? grafptr->s.vertlocnbr : 0;
-  if (memAllocGroup ((void **) (void *)
+  if (reduloctab[0] < 0)                          /* Do not allocate if already in error */
+    ielsloctax = NULL;
+  else if (memAllocGroup ((void **) (void *)
                      &ielsloctax, (size_t) (grafptr->s.vertlocnbr * sizeof (float)),
                      &veexloctax, (size_t) (veexlocnbr            * sizeof (float)),
                      &difogsttax, (size_t) (grafptr->s.vertgstnbr * sizeof (float)),
@@ -206,60 +293,33 @@ const BdgraphBipartDfParam * const  paraptr)      /*+ Method parameters +*/
   difngsttax[vanclocnnd]     =                    /* In case of isolated anchors, do not risk overflow because of NaN */
   difngsttax[vanclocnnd + 1] = 0.0F;
 
-  if (dgraphHaloSync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT) != 0) { /* Perform initial diffusion (and build communication structures) */
-    errorPrint ("bdgraphBipartDf: cannot propagate diffusion data (1)");
-    memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
-    return     (1);
-  }
-
   ovflval    = 0;
   cdifval    = (float) paraptr->cdifval;
   cremval    = (float) paraptr->cremval;
   edgegsttax = grafptr->s.edgegsttax;
-  for (passnum = 0; ; ) {                         /* For all passes         */
+  for (passnum = 0; ; ) {                         /* For all passes */
+    DgraphHaloRequest   requdat;
+
+    dgraphHaloAsync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT, &requdat); /* Perform diffusion of ghost values */
+    if ((ovflval == 0) &&                         /* Process interior vertices while exchange is in flight */
+        (bdgraphBipartDfVert (grafptr, vertsrttab, vintlocnbr, vanclocnnd, ielsloctax, difogsttax, difngsttax, cdifval, cremval) != 0))
+      ovflval = 1;                                /* We are in state of overflow; arrays will not be swapped */
+    if (dgraphHaloWait (&requdat) != 0) {
+      errorPrint ("bdgraphBipartDf: cannot propagate diffusion data");
+      memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
+      return     (1);
+    }
+
     if (ovflval == 0) {                           /* If no overflow occured */
       float *             diftgsttax;             /* Temporary swap value   */
       Gnum                vertlocnum;
-      float               veloval;
-
-      veloval = 1.0F;                             /* Assume no vertex loads */
-      for (vertlocnum = grafptr->s.baseval; vertlocnum < vanclocnnd; vertlocnum ++) {
-        Gnum                edgelocnum;
-        Gnum                edgelocnnd;
-        float               diffval;
-
-        diffval    = 0.0F;
-        edgelocnum = grafptr->s.vertloctax[vertlocnum];
-        edgelocnnd = grafptr->s.vendloctax[vertlocnum];
-        if (grafptr->s.edloloctax != NULL)
-          for ( ; edgelocnum < edgelocnnd; edgelocnum ++)
-            diffval += difogsttax[edgegsttax[edgelocnum]] * (float) grafptr->s.edloloctax[edgelocnum];
-        else
-          for ( ; edgelocnum < edgelocnnd; edgelocnum ++)
-            diffval += difogsttax[edgegsttax[edgelocnum]];
-
-        diffval *= cdifval;
-        diffval += (difogsttax[vertlocnum] * cremval) / ielsloctax[vertlocnum];
 
-        if (grafptr->s.veloloctax != NULL)
-          veloval = (float) grafptr->s.veloloctax[vertlocnum];
-        if (diffval >= 0.0F) {
-          diffval = (diffval - veloval) * ielsloctax[vertlocnum];
-          if (diffval <= 0.0F)
-            diffval = +BDGRAPHBIPARTDFEPSILON;
-        }
-        else {
-          diffval = (diffval + veloval) * ielsloctax[vertlocnum];
-          if (diffval >= 0.0F)
-            diffval = -BDGRAPHBIPARTDFEPSILON;
-        }
-        if (isnan (diffval)) {                    /* If overflow occured                    */
-          ovflval = 1;                            /* We are in state of overflow            */
-          goto abort;                             /* Exit this loop without swapping arrays */
-        }
-        difngsttax[vertlocnum] = diffval;
+      if (bdgraphBipartDfVert (grafptr, vertsrttab + vintlocnbr, grafptr->s.vertlocnbr - vintlocnbr, vanclocnnd, /* Process boundary vertices */
+                               ielsloctax, difogsttax, difngsttax, cdifval, cremval) != 0) {
+        ovflval = 1;                              /* We are in state of overflow            */
+        goto abort;                               /* Exit this loop without swapping arrays */
       }
-      for ( ; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) { /* For the two local anchor vertices */
+      for (vertlocnum = vanclocnnd; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) { /* For the two local anchor vertices */
         Gnum                edgelocnum;
         Gnum                edgelocnnd;
         float               diffval;
@@ -299,12 +359,6 @@ const BdgraphBipartDfParam * const  paraptr)      /*+ Method parameters +*/
 abort :                                           /* If overflow occured, resume here    */
     if (++ passnum >= paraptr->passnbr)           /* If maximum number of passes reached */
       break;                                      /* Exit main loop                      */
-
-    if (dgraphHaloSync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT) != 0) {
-      errorPrint ("bdgraphBipartDf: cannot propagate diffusion data (2)");
-      memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
-      return     (1);
-    }
   }
 
   for (vertlocnum = grafptr->s.baseval; vertlocnum < vanclocnnd; vertlocnum ++) /* Set new part distribution */
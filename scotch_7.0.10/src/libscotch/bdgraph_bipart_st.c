@@ -1,4 +1,4 @@
-/* Copyright 2007-2011,2014,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2011,2014,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 11 sep 2011     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 04 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -259,6 +259,7 @@ const Strat * restrict const  straptr)            /*+ Bipartitioning strategy
   StratTest           testdat;                    /* Result of condition evaluation */
   BdgraphStore        savetab[2];                 /* Results of the two strategies  */
   Gnum                compglbload0;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
   int                 o0;
   int                 o1;
@@ -375,8 +376,13 @@ take1:                                            /* Keep second partition by de
       proccommold = grafptr->s.proccomm;          /* Create new communicator to isolate method communications */
       MPI_Comm_dup (proccommold, &grafptr->s.proccomm);
 #endif /* SCOTCH_DEBUG_BDGRAPH2 */
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "bdgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertglbnbr, grafptr->s.edgeglbnbr, (double) grafptr->commglbload, fabs ((double) grafptr->compglbload0dlt));
       o = ((BdgraphBipartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
           (grafptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->commglbload, fabs ((double) grafptr->compglbload0dlt), o);
 #ifdef SCOTCH_DEBUG_BDGRAPH2
       MPI_Comm_free (&grafptr->s.proccomm);       /* Restore old communicator */
       grafptr->s.proccomm = proccommold;
@@ -44,6 +44,8 @@
 /**                                 to   : 22 jul 2008     **/
 /**                # Version 6.0  : from : 03 sep 2011     **/
 /**                                 to   : 31 aug 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -274,6 +276,8 @@ const Bdgraph * restrict const grafptr)
     memFree (grafdat.edgegsttax + grafptr->s.baseval);
   if (grafptr->s.procsidtab != grafdat.procsidtab) /* The same for procsidtab */
     memFree (grafdat.procsidtab);
+  if (grafptr->s.haloptr != grafdat.haloptr)      /* The same for the halo exchange plan */
+    dgraphHaloFree (&grafdat);
   memFree (partgsttax + grafptr->s.baseval);      /* Free group leader */
 
   if ((cheklocval == 0) &&
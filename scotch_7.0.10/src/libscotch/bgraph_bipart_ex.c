@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2016,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2016,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.0  : from : 14 aug 2016     **/
 /**                                 to   : 21 may 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -101,6 +101,7 @@ Bgraph * restrict const     grafptr)
   parafmdat.passnbr = ~0;
   parafmdat.deltval = 0.0L;                       /* Exact balance required */
   parafmdat.typeval = BGRAPHBIPARTFMTYPEALL;      /* All vertices involved  */
+  parafmdat.tablval = BGRAPHBIPARTFMGAINTABL;     /* Use default gain table */
   if (bgraphBipartFm (grafptr, &parafmdat) != 0)  /* Return if error        */
     return (1);
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2011,2014,2016,2019,2023-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -67,7 +67,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 20 aug 2019     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 25 jan 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,6 +83,7 @@
 #include "common.h"
 #include "fibo.h"
 #include "gain.h"
+#include "gain_bckt.h"
 #include "graph.h"
 #include "arch.h"
 #include "bgraph.h"
@@ -106,7 +107,7 @@
 
 static
 BgraphBipartFmVertex *
-bgraphBipartFmTablGet (
+bgraphBipartFmTablGetGain (
 BgraphBipartFmTabl * restrict const  gainptr,     /*+ Gain table        +*/
 const Gnum                           deltcur,     /*+ Current imbalance +*/
 const Gnum                           deltmin,     /*+ Minimum imbalance +*/
@@ -119,15 +120,15 @@ const Gnum                           deltmax)     /*+ Maximum imbalance +*/
   const GainEntr *        tablbest;
   Gnum                    deltbest;
 
-  tablptr  = *gainptr;
+  tablptr  = gainptr->tabldat;
   tablbest = tablptr->tend;                       /* Assume no candidate vertex found yet */
   gainbest = GAINMAX;
   vertbest = NULL;
   deltbest = deltmax;
 
   for (vexxptr = (BgraphBipartFmVertex *) gainTablFrst (tablptr); /* Select candidate vertices */
-       (vexxptr != NULL) && (vexxptr->gainlink.tabl < tablbest);
-       vexxptr = (BgraphBipartFmVertex *) gainTablNext (tablptr, &vexxptr->gainlink)) {
+       (vexxptr != NULL) && (vexxptr->gainlink.tabldat.tabl < tablbest);
+       vexxptr = (BgraphBipartFmVertex *) gainTablNext (tablptr, &vexxptr->gainlink.tabldat)) {
     Gnum                deltnew;
 
     deltnew = deltcur + vexxptr->compgain;
@@ -137,7 +138,7 @@ const Gnum                           deltmax)     /*+ Maximum imbalance +*/
       if ((vexxptr->commgain < gainbest) ||       /* And if it gives better gain */
           ((vexxptr->commgain == gainbest) &&     /* Or if it gives better load  */
            (deltnew < deltbest))) {
-        tablbest = vexxptr->gainlink.tabl;        /* Select it */
+        tablbest = vexxptr->gainlink.tabldat.tabl; /* Select it */
         gainbest = vexxptr->commgain;
         vertbest = vexxptr;
         deltbest = deltnew;
@@ -173,12 +174,13 @@ const FiboNode * const      data1ptr)
 
 static
 BgraphBipartFmVertex *
-bgraphBipartFmTablGet (
-BgraphBipartFmTabl * restrict const  tablptr,     /*+ Gain table        +*/
+bgraphBipartFmTablGetGain (
+BgraphBipartFmTabl * restrict const  gainptr,     /*+ Gain table        +*/
 const Gnum                           deltcur,     /*+ Current imbalance +*/
 const Gnum                           deltmin,     /*+ Minimum imbalance +*/
 const Gnum                           deltmax)     /*+ Maximum imbalance +*/
 {
+  FiboHeap *              tablptr;
   FiboNode *              remoptr;                /* List of removed links */
   BgraphBipartFmVertex *  vexxptr;
   BgraphBipartFmVertex *  vertbest;
@@ -186,10 +188,11 @@ const Gnum                           deltmax)     /*+ Maximum imbalance +*/
   Gnum                    deltbest;
   FiboNode *              linkptr;                /* Pointer to current gain link */
 
+  tablptr  = &gainptr->tabldat;
   gainbest = GAINMAX;
   vertbest = NULL;
   deltbest = deltmax;
-  remoptr = NULL;
+  remoptr  = NULL;
 
   while ((linkptr = fiboHeapMin (tablptr)) != NULL) { /* Select candidate vertices */
     Gnum                deltnew;
@@ -229,6 +232,66 @@ const Gnum                           deltmax)     /*+ Maximum imbalance +*/
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+/* This routine returns the vertex of best gain
+** whose swap will keep the balance correct,
+** when gains are kept in a bucket array. Since
+** large gains may share the same bucket, the
+** whole bucket holding the best vertex is
+** scanned. Among vertices of same gain, the one
+** which yields the best balance is preferred.
+** It returns:
+** - !NULL  : pointer to the vertex.
+** - NULL   : if no more vertices available.
+*/
+
+static
+BgraphBipartFmVertex *
+bgraphBipartFmTablGetBckt (
+BgraphBipartFmTabl * restrict const  gainptr,     /*+ Gain table        +*/
+const Gnum                           deltcur,     /*+ Current imbalance +*/
+const Gnum                           deltmin,     /*+ Minimum imbalance +*/
+const Gnum                           deltmax)     /*+ Maximum imbalance +*/
+{
+  GainBckt *              bcktptr;
+  BgraphBipartFmVertex *  hashtab;
+  BgraphBipartFmVertex *  vertbest;
+  Gnum                    gainbest;
+  INT                     bcktbest;               /* Key of bucket holding best vertex */
+  Gnum                    deltbest;
+  INT                     vexxnum;
+
+  bcktptr  = &gainptr->bcktdat;
+  hashtab  = (BgraphBipartFmVertex *) bcktptr->elemtab;
+  bcktbest = GAINMAX;                             /* Assume no candidate vertex found yet */
+  gainbest = GAINMAX;
+  vertbest = NULL;
+  deltbest = deltmax;
+
+  for (vexxnum = gainBcktFrst (bcktptr);          /* Select candidate vertices */
+       (vexxnum != GAINBCKTNONE) && (hashtab[vexxnum].gainlink.bcktdat.keyval <= bcktbest);
+       vexxnum = gainBcktNext (bcktptr, vexxnum)) {
+    BgraphBipartFmVertex *  vexxptr;
+    Gnum                    deltnew;
+
+    vexxptr = &hashtab[vexxnum];
+    deltnew = deltcur + vexxptr->compgain;
+    if ((deltnew >= deltmin) &&                   /* If vertex enforces balance */
+        (deltnew <= deltmax)) {
+      deltnew = abs (deltnew);
+      if ((vexxptr->commgain < gainbest) ||       /* And if it gives better gain */
+          ((vexxptr->commgain == gainbest) &&     /* Or if it gives better load  */
+           (deltnew < deltbest))) {
+        bcktbest = vexxptr->gainlink.bcktdat.keyval; /* Select it */
+        gainbest = vexxptr->commgain;
+        vertbest = vexxptr;
+        deltbest = deltnew;
+      }
+    }
+  }
+
+  return (vertbest);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -332,21 +395,21 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;
 
-  if (bgraphBipartFmTablInit (&tabldat) != 0) {
-    errorPrint ("bgraphBipartFm: internal error (1)"); /* Unable to do proper initialization */
-    bgraphBipartFmTablExit (&tabldat);
-    return (1);
-  }
-
-  tablptr = &tabldat;
   if (memAllocGroup ((void **) (void *)
                      &hashtmp, (size_t) (hashsiz * sizeof (BgraphBipartFmVertex)),
                      &savetab, (size_t) (hashsiz * sizeof (BgraphBipartFmSave)), NULL) == NULL) {
     errorPrint ("bgraphBipartFm: out of memory (1)");
-    bgraphBipartFmTablExit (tablptr);
     return (1);
   }
   hashtab = hashtmp;
+
+  tablptr = &tabldat;
+  if (bgraphBipartFmTablInit (tablptr, paraptr->tablval, hashtab) != 0) {
+    errorPrint ("bgraphBipartFm: internal error (1)"); /* Unable to do proper initialization */
+    bgraphBipartFmTablExit (tablptr);
+    memFree (hashtab);
+    return (1);
+  }
   memSet (hashtab, ~0, hashsiz * sizeof (BgraphBipartFmVertex)); /* Set all vertex numbers to ~0 */
 
   domndist = grafptr->domndist;
@@ -476,12 +539,12 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       hashtab[hashnum].commgain = savetab[savenbr].commgain;
       hashtab[hashnum].commcut  = savetab[savenbr].commcut;
 
-      if (bgraphBipartFmIsTabl (&hashtab[hashnum])) {       /* If vertex is linked */
-        bgraphBipartFmTablDel (tablptr, &hashtab[hashnum]); /* Unlink it           */
-        bgraphBipartFmSetFree (&hashtab[hashnum]);          /* Set it as free      */
+      if (bgraphBipartFmIsTabl (tablptr, &hashtab[hashnum])) { /* If vertex is linked */
+        bgraphBipartFmTablDel (tablptr, &hashtab[hashnum]); /* Unlink it            */
+        bgraphBipartFmSetFree (tablptr, &hashtab[hashnum]); /* Set it as free       */
       }
-      if (bgraphBipartFmIsFree (&hashtab[hashnum]) && (partval == 2)) /* If vertex not locked and in separator */
-        bgraphBipartFmTablAdd (tablptr, &hashtab[hashnum]); /* Re-link it                                      */
+      if (bgraphBipartFmIsFree (tablptr, &hashtab[hashnum]) && (partval == 2)) /* If vertex not locked and in separator */
+        bgraphBipartFmTablAdd (tablptr, &hashtab[hashnum]); /* Re-link it                                                 */
     }
     compload0dlt = compload0dltbst;               /* Restore best separator parameters */
     commload     = commloadbst;
@@ -502,12 +565,12 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       BgraphBipartFmVertex *    vexxptr;
 
       vexxptr = lockptr;                          /* Unlink vertex from list */
-      lockptr = bgraphBipartFmChainNext (vexxptr);
+      lockptr = bgraphBipartFmChainNext (tablptr, vexxptr);
 
       if ((typeval == BGRAPHBIPARTFMTYPEALL) || (vexxptr->commcut > 0)) /* If vertex has cut edges or should be put anyway */
         bgraphBipartFmTablAdd (tablptr, vexxptr); /* Put it in table */
       else
-        bgraphBipartFmSetFree (vexxptr);          /* Set it free anyway */
+        bgraphBipartFmSetFree (tablptr, vexxptr); /* Set it free anyway */
     }
 
     moveflag = 0;                                 /* No useful moves made              */
@@ -522,8 +585,8 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
       Gnum               edloval;
 
       bgraphBipartFmTablDel (tablptr, vexxptr);   /* Remove it from table */
-      bgraphBipartFmSetUsed (vexxptr);            /* Mark it as used      */
-      bgraphBipartFmChain (&lockptr, vexxptr);    /* Lock it              */
+      bgraphBipartFmSetUsed (tablptr, vexxptr);   /* Mark it as used      */
+      bgraphBipartFmChain (tablptr, &lockptr, vexxptr); /* Lock it        */
 
       vertnum = vexxptr->vertnum;
       partval = vexxptr->partval;
@@ -577,10 +640,10 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
             hashtab[hashnum].commgain += (domndist * 2) * edloval * partdlt;
             hashtab[hashnum].commcut  -= partdlt;
 
-            if (! bgraphBipartFmIsUsed(&hashtab[hashnum])) { /* If vertex is of use         */
-              if (bgraphBipartFmIsTabl(&hashtab[hashnum])) { /* If vertex is linked         */
-                bgraphBipartFmTablDel (tablptr, &hashtab[hashnum]); /* Remove it from table */
-                bgraphBipartFmSetFree (&hashtab[hashnum]); /* Mark it as free anyway        */
+            if (! bgraphBipartFmIsUsed (tablptr, &hashtab[hashnum])) { /* If vertex is of use */
+              if (bgraphBipartFmIsTabl (tablptr, &hashtab[hashnum])) { /* If vertex is linked */
+                bgraphBipartFmTablDel (tablptr, &hashtab[hashnum]); /* Remove it from table   */
+                bgraphBipartFmSetFree (tablptr, &hashtab[hashnum]); /* Mark it as free anyway */
               }
               if (hashtab[hashnum].commcut > 0)   /* If vertex belongs to the frontier */
                 bgraphBipartFmTablAdd (tablptr, &hashtab[hashnum]); /* Re-link it      */
@@ -600,6 +663,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
                 errorPrint ("bgraphBipartFm: out of memory (2)");
                 memFree    (hashtab);             /* Free group leader */
                 bgraphBipartFmTablExit (tablptr);
+                return (1);
               }
               for (hashnum = (vertend * BGRAPHBIPARTFMHASHPRIME) & hashmsk; hashtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ; /* Search for new first free slot */
             }
@@ -750,7 +814,7 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
             commgain = veextax[hashtab[hashnum].vertnum];
             if (commgain != 0) {                  /* If vertex has external cocycle edges                         */
               hashtab[hashnum].commgain += 2 * (1 - 2 * hashtab[hashnum].partval) * commgain; /* Compute new gain */
-              if (bgraphBipartFmIsTabl (&hashtab[hashnum])) { /* If vertex is linked                              */
+              if (bgraphBipartFmIsTabl (tablptr, &hashtab[hashnum])) { /* If vertex is linked                              */
                 bgraphBipartFmTablDel (tablptr, &hashtab[hashnum]); /* Remove it from table                       */
                 bgraphBipartFmTablAdd (tablptr, &hashtab[hashnum]); /* Re-link it                                 */
               }
@@ -784,6 +848,13 @@ const BgraphBipartFmParam * const paraptr)        /*+ Method parameters +*/
   } while ((moveflag != 0) &&                     /* As long as vertices are moved                          */
            (-- passnbr != 0));                    /* And we are allowed to loop (TRICK for negative values) */
 
+  if (bgraphBipartFmTablFail (tablptr)) {         /* If gain structure could not hold all gains exactly */
+    errorPrint ("bgraphBipartFm: out of memory (3)");
+    memFree (hashtab);                            /* Free group leader */
+    bgraphBipartFmTablExit (tablptr);
+    return (1);
+  }
+
 #ifdef SCOTCH_DEBUG_BGRAPH2
 #ifdef SCOTCH_DEBUG_BGRAPH3
   if (bgraphBipartFmCheck (grafptr, hashtab, hashmsk, swapval, compload0dlt, commload, commgainextn) != 0) {
@@ -918,8 +989,9 @@ BgraphBipartFmVertex ** const     lockptr)        /*+ Pointer to locked list
 
   memSet (hashtab + hashold, ~0, hashold * sizeof (BgraphBipartFmVertex));
 
-  bgraphBipartFmTablFree (tablptr);               /* Reset gain table  */
-  *lockptr = NULL;                                /* Rebuild lock list */
+  bgraphBipartFmTablBase (tablptr, hashtab);      /* Set new vertex array */
+  bgraphBipartFmTablFree (tablptr);               /* Reset gain table     */
+  *lockptr = NULL;                                /* Rebuild lock list    */
 
   for (hashbas = hashold - 1; hashtab[hashbas].vertnum != ~0; hashbas --) ; /* Start index of first segment to reconsider is last empty slot */
   hashnnd = hashold;                              /* First segment to reconsider ends at the end of the old array                            */
@@ -948,10 +1020,10 @@ BgraphBipartFmVertex ** const     lockptr)        /*+ Pointer to locked list
           }
         }
 
-        if (bgraphBipartFmIsTabl (&hashtab[hashnew])) /* If vertex was linked, re-link it */
+        if (bgraphBipartFmIsTabl (tablptr, &hashtab[hashnew])) /* If vertex was linked, re-link it */
           bgraphBipartFmTablAdd (tablptr, &hashtab[hashnew]);
-        else if (bgraphBipartFmIsUsed (&hashtab[hashnew]))  /* Re-lock used vertices */
-          bgraphBipartFmChain (lockptr, &hashtab[hashnew]); /* Lock it               */
+        else if (bgraphBipartFmIsUsed (tablptr, &hashtab[hashnew])) /* Re-lock used vertices */
+          bgraphBipartFmChain (tablptr, lockptr, &hashtab[hashnew]); /* Lock it              */
       }
     }
 
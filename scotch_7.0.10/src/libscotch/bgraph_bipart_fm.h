@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011,2016,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011,2016,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -61,7 +61,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 27 aug 2016     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -84,6 +84,13 @@ typedef enum BgraphBipartFmType_ {
   BGRAPHBIPARTFMTYPEBOUNDARY                      /*+ Boundary vertices only +*/
 } BgraphBipartFmType;
 
+/*+ Gain structure type. +*/
+
+typedef enum BgraphBipartFmGain_ {
+  BGRAPHBIPARTFMGAINTABL,                         /*+ Gain table or heap, depending on compilation flags +*/
+  BGRAPHBIPARTFMGAINBCKT                          /*+ Bucket array                                        +*/
+} BgraphBipartFmGain;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct BgraphBipartFmParam_ {
@@ -91,26 +98,43 @@ typedef struct BgraphBipartFmParam_ {
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
   BgraphBipartFmType        typeval;              /*+ Whether considered vertices are boundary or all      +*/
+  BgraphBipartFmGain        tablval;              /*+ Type of gain structure                               +*/
 } BgraphBipartFmParam;
 
 #ifdef SCOTCH_BGRAPH_BIPART_FM                    /* Private part of the module */
 
-/*+ The hash vertex structure. For trick
-    reasons, the gain table data structure
-    must be the first field of the structure. +*/
+/*+ The gain structures. Gain tables or heaps
+    are selected at compile time, and the bucket
+    array can be selected at run time in place
+    of them.                                     +*/
 
 #ifdef SCOTCH_TABLE_GAIN
 
-typedef GainTabl * BgraphBipartFmTabl;
-typedef GainLink BgraphBipartFmLink;
+typedef GainTabl * BgraphBipartFmGainTabl;
+typedef GainLink BgraphBipartFmGainLink;
 
 #else /* SCOTCH_TABLE_GAIN */
 
-typedef FiboHeap BgraphBipartFmTabl;
-typedef FiboNode BgraphBipartFmLink;
+typedef FiboHeap BgraphBipartFmGainTabl;
+typedef FiboNode BgraphBipartFmGainLink;
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+typedef union BgraphBipartFmLink_ {
+  BgraphBipartFmGainLink    tabldat;              /*+ Link in gain table or heap +*/
+  GainBcktLink              bcktdat;              /*+ Link in bucket array       +*/
+} BgraphBipartFmLink;
+
+typedef struct BgraphBipartFmTabl_ {
+  BgraphBipartFmGain        typeval;              /*+ Type of gain structure in use +*/
+  BgraphBipartFmGainTabl    tabldat;              /*+ Gain table or heap            +*/
+  GainBckt                  bcktdat;              /*+ Bucket array                  +*/
+} BgraphBipartFmTabl;
+
+/*+ The hash vertex structure. For trick
+    reasons, the gain table data structure
+    must be the first field of the structure. +*/
+
 typedef struct BgraphBipartFmVertex_ {
   BgraphBipartFmLink        gainlink;             /*+ Gain link: FIRST                        +*/
   Gnum                      vertnum;              /*+ Number of vertex                        +*/
@@ -135,7 +159,8 @@ typedef struct BgraphBipartFmSave_ {
 **  The function prototypes.
 */
 
-static BgraphBipartFmVertex * bgraphBipartFmTablGet (BgraphBipartFmTabl * restrict const, const Gnum, const Gnum, const Gnum);
+static BgraphBipartFmVertex * bgraphBipartFmTablGetGain (BgraphBipartFmTabl * restrict const, const Gnum, const Gnum, const Gnum);
+static BgraphBipartFmVertex * bgraphBipartFmTablGetBckt (BgraphBipartFmTabl * restrict const, const Gnum, const Gnum, const Gnum);
 
 static int                  bgraphBipartFmResize (BgraphBipartFmVertex * restrict *, Gnum * restrict const, Gnum * const, BgraphBipartFmSave * restrict *, const Gnum, BgraphBipartFmTabl * const, BgraphBipartFmVertex ** const);
 #ifdef SCOTCH_DEBUG_BGRAPH3
@@ -164,28 +189,28 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (((*(t)) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS)) == NULL)
-#define bgraphBipartFmTablFree(t)   gainTablFree (*(t))
-#define bgraphBipartFmTablExit(t)   do {                     \
-                                      if (*(t) != NULL)      \
-                                        gainTablExit (*(t)); \
+#define bgraphBipartFmGainInit(t)   (((t) = gainTablInit (GAINMAX, BGRAPHBIPARTFMSUBBITS)) == NULL)
+#define bgraphBipartFmGainFree(t)   gainTablFree (t)
+#define bgraphBipartFmGainExit(t)   do {                   \
+                                      if ((t) != NULL)     \
+                                        gainTablExit (t);  \
                                     } while (0)
-#define bgraphBipartFmTablAdd(t,v)  gainTablAdd ((*(t)), &(v)->gainlink, (v)->commgain)
-#define bgraphBipartFmTablDel(t,v)  gainTablDel ((*(t)), &(v)->gainlink)
-#define bgraphBipartFmIsFree(v)     ((v)->gainlink.next == BGRAPHBIPARTFMSTATEFREE)
-#define bgraphBipartFmIsTabl(v)     ((v)->gainlink.next >= BGRAPHBIPARTFMSTATELINK)
-#define bgraphBipartFmIsUsed(v)     ((v)->gainlink.next == BGRAPHBIPARTFMSTATEUSED)
-#define bgraphBipartFmSetFree(v)    do {                                            \
-                                      (v)->gainlink.next = BGRAPHBIPARTFMSTATEFREE; \
+#define bgraphBipartFmGainAdd(t,v)  gainTablAdd ((t), &(v)->gainlink.tabldat, (v)->commgain)
+#define bgraphBipartFmGainDel(t,v)  gainTablDel ((t), &(v)->gainlink.tabldat)
+#define bgraphBipartFmGainIsFree(v) ((v)->gainlink.tabldat.next == BGRAPHBIPARTFMSTATEFREE)
+#define bgraphBipartFmGainIsTabl(v) ((v)->gainlink.tabldat.next >= BGRAPHBIPARTFMSTATELINK)
+#define bgraphBipartFmGainIsUsed(v) ((v)->gainlink.tabldat.next == BGRAPHBIPARTFMSTATEUSED)
+#define bgraphBipartFmGainSetFree(v) do {                                                    \
+                                      (v)->gainlink.tabldat.next = BGRAPHBIPARTFMSTATEFREE; \
                                     } while (0)
-#define bgraphBipartFmSetUsed(v)    do {                                            \
-                                      (v)->gainlink.next = BGRAPHBIPARTFMSTATEUSED; \
+#define bgraphBipartFmGainSetUsed(v) do {                                                    \
+                                      (v)->gainlink.tabldat.next = BGRAPHBIPARTFMSTATEUSED; \
                                     } while (0)
-#define bgraphBipartFmChain(l,v)    do {                                      \
-                                      (v)->gainlink.prev = (GainLink *) *(l); \
-                                      *(l) = (v);                             \
+#define bgraphBipartFmGainChain(l,v) do {                                              \
+                                      (v)->gainlink.tabldat.prev = (GainLink *) *(l); \
+                                      *(l) = (v);                                     \
                                     } while (0)
-#define bgraphBipartFmChainNext(v)  ((BgraphBipartFmVertex *) (v)->gainlink.prev)
+#define bgraphBipartFmGainChainNext(v) ((BgraphBipartFmVertex *) (v)->gainlink.tabldat.prev)
 
 #else /* SCOTCH_TABLE_GAIN */
 
@@ -197,24 +222,102 @@ int                         bgraphBipartFm      (Bgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define bgraphBipartFmTablInit(t)   (fiboHeapInit ((t), bgraphBipartFmCmpFunc))
-#define bgraphBipartFmTablFree(t)   fiboHeapFree (t)
-#define bgraphBipartFmTablExit(t)   fiboHeapExit (t)
-#define bgraphBipartFmTablAdd(t,v)  fiboHeapAdd ((t), &(v)->gainlink)
-#define bgraphBipartFmTablDel(t,v)  fiboHeapDel ((t), &(v)->gainlink)
-#define bgraphBipartFmIsFree(v)     ((v)->gainlink.linkdat.nextptr == BGRAPHBIPARTFMSTATEFREE)
-#define bgraphBipartFmIsTabl(v)     ((v)->gainlink.linkdat.nextptr >= BGRAPHBIPARTFMSTATELINK)
-#define bgraphBipartFmIsUsed(v)     ((v)->gainlink.linkdat.nextptr == BGRAPHBIPARTFMSTATEUSED)
-#define bgraphBipartFmSetFree(v)    do {                                                       \
-                                      (v)->gainlink.linkdat.nextptr = BGRAPHBIPARTFMSTATEFREE; \
+#define bgraphBipartFmGainInit(t)   (fiboHeapInit (&(t), bgraphBipartFmCmpFunc))
+#define bgraphBipartFmGainFree(t)   fiboHeapFree (&(t))
+#define bgraphBipartFmGainExit(t)   fiboHeapExit (&(t))
+#define bgraphBipartFmGainAdd(t,v)  fiboHeapAdd (&(t), &(v)->gainlink.tabldat)
+#define bgraphBipartFmGainDel(t,v)  fiboHeapDel (&(t), &(v)->gainlink.tabldat)
+#define bgraphBipartFmGainIsFree(v) ((v)->gainlink.tabldat.linkdat.nextptr == BGRAPHBIPARTFMSTATEFREE)
+#define bgraphBipartFmGainIsTabl(v) ((v)->gainlink.tabldat.linkdat.nextptr >= BGRAPHBIPARTFMSTATELINK)
+#define bgraphBipartFmGainIsUsed(v) ((v)->gainlink.tabldat.linkdat.nextptr == BGRAPHBIPARTFMSTATEUSED)
+#define bgraphBipartFmGainSetFree(v) do {                                                               \
+                                      (v)->gainlink.tabldat.linkdat.nextptr = BGRAPHBIPARTFMSTATEFREE; \
                                     } while (0)
-#define bgraphBipartFmSetUsed(v)    do {                                                       \
-                                      (v)->gainlink.linkdat.nextptr = BGRAPHBIPARTFMSTATEUSED; \
+#define bgraphBipartFmGainSetUsed(v) do {                                                               \
+                                      (v)->gainlink.tabldat.linkdat.nextptr = BGRAPHBIPARTFMSTATEUSED; \
                                     } while (0)
-#define bgraphBipartFmChain(l,v)    do {                                                 \
-                                      (v)->gainlink.linkdat.prevptr = (FiboNode *) *(l); \
-                                      *(l) = (v);                                        \
+#define bgraphBipartFmGainChain(l,v) do {                                                         \
+                                      (v)->gainlink.tabldat.linkdat.prevptr = (FiboNode *) *(l); \
+                                      *(l) = (v);                                                \
                                     } while (0)
-#define bgraphBipartFmChainNext(v)  ((BgraphBipartFmVertex *) (v)->gainlink.linkdat.prevptr)
+#define bgraphBipartFmGainChainNext(v) ((BgraphBipartFmVertex *) (v)->gainlink.tabldat.linkdat.prevptr)
 
 #endif /* SCOTCH_TABLE_GAIN */
+
+/** Bucket array vertex status. Linked vertices
+    hold the index of their next vertex, which
+    is never smaller than GAINBCKTNONE.          **/
+
+#define BGRAPHBIPARTFMBCKTFREE      ((INT) -2)    /*+ Vertex in initial state                +*/
+#define BGRAPHBIPARTFMBCKTUSED      ((INT) -3)    /*+ Swapped vertex                         +*/
+#define BGRAPHBIPARTFMBCKTLINK      GAINBCKTNONE  /*+ Currently in bucket array if not lower +*/
+
+/*+ Bucket array service routines. Locked
+    vertices are chained by vertex index.  +*/
+
+#define bgraphBipartFmBcktNum(t,v)  ((INT) ((v) - (BgraphBipartFmVertex *) (t)->bcktdat.elemtab))
+#define bgraphBipartFmBcktAdd(t,v)  gainBcktAdd (&(t)->bcktdat, bgraphBipartFmBcktNum ((t), (v)), (INT) (v)->commgain)
+#define bgraphBipartFmBcktDel(t,v)  gainBcktDel (&(t)->bcktdat, &(v)->gainlink.bcktdat)
+#define bgraphBipartFmBcktChain(t,l,v) do {                                                                                              \
+                                      (v)->gainlink.bcktdat.prevnum = (*(l) == NULL) ? GAINBCKTNONE : bgraphBipartFmBcktNum ((t), *(l)); \
+                                      *(l) = (v);                                                                                        \
+                                    } while (0)
+#define bgraphBipartFmBcktChainNext(t,v) (((v)->gainlink.bcktdat.prevnum == GAINBCKTNONE) ? NULL : (BgraphBipartFmVertex *) gainBcktLink (&(t)->bcktdat, (v)->gainlink.bcktdat.prevnum))
+
+/*+ Service routines, for the type of
+    gain structure selected at run time. +*/
+
+#define bgraphBipartFmIsBckt(t)     ((t)->typeval == BGRAPHBIPARTFMGAINBCKT)
+#define bgraphBipartFmTablInit(t,g,h) ((((t)->typeval = (g)) == BGRAPHBIPARTFMGAINBCKT) ? gainBcktInit (&(t)->bcktdat, (h), sizeof (BgraphBipartFmVertex)) : bgraphBipartFmGainInit ((t)->tabldat))
+#define bgraphBipartFmTablExit(t)   do {                                       \
+                                      if (bgraphBipartFmIsBckt (t))            \
+                                        gainBcktExit (&(t)->bcktdat);          \
+                                      else                                     \
+                                        bgraphBipartFmGainExit ((t)->tabldat); \
+                                    } while (0)
+#define bgraphBipartFmTablBase(t,h) do {                                   \
+                                      if (bgraphBipartFmIsBckt (t))        \
+                                        gainBcktBase (&(t)->bcktdat, (h)); \
+                                    } while (0)
+#define bgraphBipartFmTablFree(t)   do {                                       \
+                                      if (bgraphBipartFmIsBckt (t))            \
+                                        gainBcktFree (&(t)->bcktdat);          \
+                                      else                                     \
+                                        bgraphBipartFmGainFree ((t)->tabldat); \
+                                    } while (0)
+#define bgraphBipartFmTablAdd(t,v)  do {                                           \
+                                      if (bgraphBipartFmIsBckt (t))                \
+                                        bgraphBipartFmBcktAdd ((t), (v));          \
+                                      else                                         \
+                                        bgraphBipartFmGainAdd ((t)->tabldat, (v)); \
+                                    } while (0)
+#define bgraphBipartFmTablDel(t,v)  do {                                           \
+                                      if (bgraphBipartFmIsBckt (t))                \
+                                        bgraphBipartFmBcktDel ((t), (v));          \
+                                      else                                         \
+                                        bgraphBipartFmGainDel ((t)->tabldat, (v)); \
+                                    } while (0)
+#define bgraphBipartFmTablFail(t)   (bgraphBipartFmIsBckt (t) && gainBcktFail (&(t)->bcktdat))
+#define bgraphBipartFmTablGet(t,c,n,x) (bgraphBipartFmIsBckt (t) ? bgraphBipartFmTablGetBckt ((t), (c), (n), (x)) : bgraphBipartFmTablGetGain ((t), (c), (n), (x)))
+#define bgraphBipartFmIsFree(t,v)   (bgraphBipartFmIsBckt (t) ? ((v)->gainlink.bcktdat.nextnum == BGRAPHBIPARTFMBCKTFREE) : bgraphBipartFmGainIsFree (v))
+#define bgraphBipartFmIsTabl(t,v)   (bgraphBipartFmIsBckt (t) ? ((v)->gainlink.bcktdat.nextnum >= BGRAPHBIPARTFMBCKTLINK) : bgraphBipartFmGainIsTabl (v))
+#define bgraphBipartFmIsUsed(t,v)   (bgraphBipartFmIsBckt (t) ? ((v)->gainlink.bcktdat.nextnum == BGRAPHBIPARTFMBCKTUSED) : bgraphBipartFmGainIsUsed (v))
+#define bgraphBipartFmSetFree(t,v)  do {                                                        \
+                                      if (bgraphBipartFmIsBckt (t))                             \
+                                        (v)->gainlink.bcktdat.nextnum = BGRAPHBIPARTFMBCKTFREE; \
+                                      else                                                      \
+                                        bgraphBipartFmGainSetFree (v);                          \
+                                    } while (0)
+#define bgraphBipartFmSetUsed(t,v)  do {                                                        \
+                                      if (bgraphBipartFmIsBckt (t))                             \
+                                        (v)->gainlink.bcktdat.nextnum = BGRAPHBIPARTFMBCKTUSED; \
+                                      else                                                      \
+                                        bgraphBipartFmGainSetUsed (v);                          \
+                                    } while (0)
+#define bgraphBipartFmChain(t,l,v)  do {                                         \
+                                      if (bgraphBipartFmIsBckt (t))              \
+                                        bgraphBipartFmBcktChain ((t), (l), (v)); \
+                                      else                                       \
+                                        bgraphBipartFmGainChain ((l), (v));      \
+                                    } while (0)
+#define bgraphBipartFmChainNext(t,v) (bgraphBipartFmIsBckt (t) ? bgraphBipartFmBcktChainNext ((t), (v)) : bgraphBipartFmGainChainNext (v))
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2012,2016,2017,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.0  : from : 23 feb 2011     **/
 /**                                 to   : 02 jan 2017     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 04 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -103,7 +103,7 @@ static union {
 static union {                                /* Default parameters for bipartitioning methods */
   BgraphBipartFmParam       param;            /* Parameter zone                                */
   StratNodeMethodData       padding;          /* To avoid reading out of structure             */
-} bgraphbipartstdefaultfm = { { 80, ~0, 0.01L, BGRAPHBIPARTFMTYPEBOUNDARY } };
+} bgraphbipartstdefaultfm = { { 80, ~0, 0.01L, BGRAPHBIPARTFMTYPEBOUNDARY, BGRAPHBIPARTFMGAINTABL } };
 
 static union {
   BgraphBipartGaParam       param;
@@ -174,6 +174,10 @@ static StratParamTab        bgraphbipartstparatab[] = { /* Method parameter list
                                 (byte *) &bgraphbipartstdefaultfm.param,
                                 (byte *) &bgraphbipartstdefaultfm.param.typeval,
                                 (void *) "ab" },
+                              { BGRAPHBIPARTSTMETHFM,  STRATPARAMCASE,   "gain",
+                                (byte *) &bgraphbipartstdefaultfm.param,
+                                (byte *) &bgraphbipartstdefaultfm.param.tablval,
+                                (void *) "tb" },
                               { BGRAPHBIPARTSTMETHGA,  STRATPARAMINT,    "pass",
                                 (byte *) &bgraphbipartstdefaultga.param,
                                 (byte *) &bgraphbipartstdefaultga.param.passnbr,
@@ -272,6 +276,7 @@ const Strat * restrict const  straptr)            /*+ Bipartitioning strategy
   StratTest           testdat;                    /* Result of condition evaluation */
   BgraphStore         savetab[2];                 /* Results of the two strategies  */
   Gnum                compload0;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
   int                 o0;
   int                 o1;
@@ -380,8 +385,14 @@ take1:                                            /* Keep second partition by de
       bgraphStoreExit (&savetab[0]);
       break;
     case STRATNODEMETHOD :
-      return (((BgraphBipartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "bgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertnbr, grafptr->s.edgenbr, (double) grafptr->commload, fabs ((double) grafptr->compload0dlt));
+      o = ((BgraphBipartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->commload, fabs ((double) grafptr->compload0dlt), o);
+      return (o);
     default :
       errorPrint ("bgraphBipartSt: invalid parameter (2)");
       return (1);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 28 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -349,6 +349,15 @@ typedef struct ThreadDescriptor_ {
 typedef void (* ThreadFunc) (ThreadDescriptor * const, void * const);
 typedef void (* ThreadReduceFunc) (void * const, void * const, const void * const);
 typedef void (* ThreadScanFunc) (void * const, void * const, const int, const int, const void * const);
+typedef void (* ThreadTaskFunc) (ThreadContext * const, void * const);
+
+/** The task descriptor for work-stealing execution. **/
+
+typedef struct ThreadTask_ {
+  ThreadTaskFunc            funcptr;              /*+ Routine run by the task     +*/
+  void *                    paraptr;              /*+ Routine parameters          +*/
+  volatile int              flagval;              /*+ Set when task has completed +*/
+} ThreadTask;
 
 /*
 **  Handling of values.
@@ -359,6 +368,34 @@ typedef void (* ThreadScanFunc) (void * const, void * const, const int, const in
 struct ValuesContext_;
 typedef struct ValuesContext_ ValuesContext;
 
+/*
+**  Handling of strategy statistics.
+*/
+
+/*+ The abstract statistics context datatype. +*/
+
+struct StatContext_;
+typedef struct StatContext_ StatContext;
+
+/*+ The mark of an ongoing method call. +*/
+
+typedef struct StatMark_ {
+  INT                       recdnum;              /*+ Index of record, or -1 if not recorded +*/
+  INT                       parenum;              /*+ Index of enclosing record, or -1       +*/
+  double                    timeval;              /*+ Start time of call                     +*/
+} StatMark;
+
+/*
+**  Handling of result caches.
+*/
+
+#define CACHEKEYSIZE                2             /*+ Number of 64-bit words in cache keys +*/
+
+/*+ The abstract cache context datatype. +*/
+
+struct CacheContext_;
+typedef struct CacheContext_ CacheContext;
+
 /*
 **  Handling of execution contexts.
 */
@@ -366,9 +403,12 @@ typedef struct ValuesContext_ ValuesContext;
 /** The execution context. **/
 
 typedef struct Context_ {
-  ThreadContext *           thrdptr;              /*+ Threading context +*/
-  IntRandContext *          randptr;              /*+ Random context    +*/
-  ValuesContext *           valuptr;              /*+ Values context    +*/
+  ThreadContext *           thrdptr;              /*+ Threading context                    +*/
+  IntRandContext *          randptr;              /*+ Random context                       +*/
+  ValuesContext *           valuptr;              /*+ Values context                       +*/
+  StatContext *             statptr;              /*+ Statistics context, or NULL if none  +*/
+  INT                       statnum;              /*+ Index of current statistics record   +*/
+  CacheContext *            cachptr;              /*+ Result cache, or NULL if none        +*/
 } Context;
 
 /*+ The context splitting user function. +*/
@@ -428,6 +468,8 @@ int                         fileBlockOpen       (File * const, const int);
 int                         fileBlockOpenDist   (File * const, const int, const int, const int, const int);
 void                        fileBlockClose      (File * const, const int);
 char *                      fileNameDistExpand  (char * const, const int, const int);
+void *                      fileMap             (FILE * const, const off_t, const size_t);
+int                         fileUnmap           (void * const);
 
 void                        errorProg           (const char * const);
 void                        errorPrint          (const char * const, ...);
@@ -452,9 +494,16 @@ void                        intSort2asc2        (void * const, const INT);
 void                        intSort3asc1        (void * const, const INT);
 void                        intSort3asc2        (void * const, const INT);
 void                        intPsort2asc1       (void * const, const INT, const int);
+void                        intRsort1asc1       (void * const, const INT, Context * const);
+void                        intRsort2asc1       (void * const, const INT, Context * const);
+void                        intRsort2asc2       (void * const, const INT, Context * const);
+void                        intRsort3asc1       (void * const, const INT, Context * const);
+void                        intRsort3asc2       (void * const, const INT, Context * const);
 INT                         intSearchDicho      (const INT * const, const INT, const INT, const INT);
 INT                         intGcd              (INT, INT);
 
+UINT64                      hashMem             (const void * const, const size_t, const UINT64);
+
 void                        clockInit           (Clock * const);
 void                        clockStart          (Clock * const);
 void                        clockStop           (Clock * const);
@@ -473,6 +522,9 @@ int                         threadContextNbr    (ThreadContext * const);
 void                        threadLaunch        (ThreadContext * const, ThreadFunc const, void * const);
 void                        threadReduce        (const ThreadDescriptor * const, void * const, const size_t, ThreadReduceFunc const, const int, const void * const);
 void                        threadScan          (const ThreadDescriptor * const, void * const, const size_t, ThreadScanFunc const, const void * const);
+int                         threadTaskLaunch    (ThreadContext * const, ThreadTaskFunc const, void * const);
+void                        threadTaskSpawn     (ThreadContext * const, ThreadTask * const);
+void                        threadTaskSync      (ThreadContext * const, ThreadTask * const);
 
 void                        contextInit         (Context * const);
 void                        contextExit         (Context * const);
@@ -481,11 +533,26 @@ int                         contextRandomClone  (Context * const);
 int                         contextThreadInit2  (Context * const, const int, const int * const);
 int                         contextThreadInit   (Context * const);
 int                         contextThreadLaunchSplit (Context * const, ContextSplitFunc const, void * const);
+int                         contextThreadLaunchTask (Context * const, ContextSplitFunc const, void * const, const INT);
 int                         contextValuesInit   (Context * const, void * const, const size_t, const int, const size_t, const int, const size_t);
 int                         contextValuesGetDbl (Context * const, const int, double * const);
 int                         contextValuesGetInt (Context * const, const int, INT * const);
 int                         contextValuesSetDbl (Context * const, const int, const double);
 int                         contextValuesSetInt (Context * const, const int, const INT);
+int                         contextStatInit     (Context * const);
+void                        contextStatExit     (Context * const);
+void                        contextStatReset    (Context * const);
+INT                         contextStatNbr      (Context * const);
+void                        contextStatBegin    (Context * const, StatMark * const, const char * const, const char * const, const INT, const INT, const double, const double);
+void                        contextStatEnd      (Context * const, const StatMark * const, const double, const double, const int);
+int                         contextStatGet      (Context * const, const INT, const char ** const, const char ** const, INT * const, INT * const, INT * const, double * const, double * const, double * const);
+int                         contextStatSave     (Context * const, FILE * const);
+int                         contextCacheInit    (Context * const, const INT);
+void                        contextCacheExit    (Context * const);
+void                        contextCacheReset   (Context * const);
+const void *                contextCacheFind    (Context * const, const UINT64 * const, size_t * const);
+int                         contextCacheStore   (Context * const, const UINT64 * const, const void * const, const size_t);
+void                        contextCacheStat    (Context * const, INT * const, INT * const);
 
 /*
 **  Macro definitions.
@@ -511,6 +578,10 @@ int                         contextValuesSetInt (Context * const, const int, con
 #define contextThreadLaunch(c,f,d)  threadLaunch ((c)->thrdptr, (f), (d))
 #define contextThreadNbr(c)         threadContextNbr ((c)->thrdptr)
 
+#define contextStatActive(c)        ((c)->statptr != NULL)
+
+#define contextCacheActive(c)       ((c)->cachptr != NULL)
+
 #define DATASIZE(n,p,i)             ((INT) (((n) + ((p) - 1 - (i))) / (p)))
 #define DATASCAN(n,p,i)             ((i) * ((INT) (n) / (INT) (p)) + (((i) > ((n) % (p))) ? ((n) % (p)) : (i)))
 
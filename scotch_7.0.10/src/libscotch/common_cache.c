@@ -0,0 +1,252 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_cache.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the caching of      **/
+/**                computation results in contexts.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "common_cache.h"
+
+/***********************************/
+/*                                 */
+/* These routines handle the cache */
+/* features of contexts.           */
+/*                                 */
+/***********************************/
+
+/*+ This routine enables the caching of
+*** computation results in the given
+*** context, with the given number of
+*** entries. When the cache is full, the
+*** oldest entry is replaced. If a cache
+*** already exists, it is emptied and
+*** resized.
+*** It returns:
+*** - 0   : if the cache is available.
+*** - !0  : on error.
++*/
+
+int
+contextCacheInit (
+Context * const             contptr,
+const INT                   entrnbr)              /*+ Number of cache entries +*/
+{
+  CacheContext * restrict cachptr;
+  INT                     entrnum;
+
+  if (entrnbr < 1) {
+    errorPrint ("contextCacheInit: invalid number of entries");
+    return (1);
+  }
+
+  contextCacheExit (contptr);                     /* Free existing cache, if any */
+
+  if ((cachptr = (CacheContext *) memAlloc (sizeof (CacheContext))) == NULL) {
+    errorPrint ("contextCacheInit: out of memory (1)");
+    return (1);
+  }
+  if ((cachptr->entrtab = (CacheEntry *) memAlloc (entrnbr * sizeof (CacheEntry))) == NULL) {
+    errorPrint ("contextCacheInit: out of memory (2)");
+    memFree    (cachptr);
+    return (1);
+  }
+  for (entrnum = 0; entrnum < entrnbr; entrnum ++)
+    cachptr->entrtab[entrnum].dataptr = NULL;
+  cachptr->entrnbr = entrnbr;
+  cachptr->entrnum =
+  cachptr->hitnbr  =
+  cachptr->misnbr  = 0;
+
+  contptr->cachptr = cachptr;
+
+  return (0);
+}
+
+/*+ This routine frees the cache of
+*** the given context, if any.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+contextCacheExit (
+Context * const             contptr)
+{
+  if (contptr->cachptr == NULL)
+    return;
+
+  contextCacheReset (contptr);
+  memFree (contptr->cachptr->entrtab);
+  memFree (contptr->cachptr);
+
+  contptr->cachptr = NULL;
+}
+
+/*+ This routine discards all the entries
+*** of the cache of the given context, and
+*** resets its counters.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+contextCacheReset (
+Context * const             contptr)
+{
+  CacheContext * restrict cachptr;
+  INT                     entrnum;
+
+  cachptr = contptr->cachptr;
+  if (cachptr == NULL)
+    return;
+
+  for (entrnum = 0; entrnum < cachptr->entrnbr; entrnum ++) {
+    if (cachptr->entrtab[entrnum].dataptr != NULL) {
+      memFree (cachptr->entrtab[entrnum].dataptr);
+      cachptr->entrtab[entrnum].dataptr = NULL;
+    }
+  }
+  cachptr->entrnum =
+  cachptr->hitnbr  =
+  cachptr->misnbr  = 0;
+}
+
+/*+ This routine searches the cache of the
+*** given context for the entry of the given
+*** key, and updates the hit and miss counters
+*** accordingly.
+*** It returns:
+*** - !NULL  : pointer to the cached data block, of size *datasizptr.
+*** - NULL   : if key not found.
++*/
+
+const void *
+contextCacheFind (
+Context * const             contptr,
+const UINT64 * const        keytab,               /*+ Key of entry to find +*/
+size_t * const              datasizptr)           /*+ Size of data block   +*/
+{
+  CacheContext * restrict cachptr;
+  INT                     entrnum;
+
+  cachptr = contptr->cachptr;
+  for (entrnum = 0; entrnum < cachptr->entrnbr; entrnum ++) {
+    const CacheEntry *  entrptr;
+
+    entrptr = &cachptr->entrtab[entrnum];
+    if ((entrptr->dataptr != NULL) &&
+        (memcmp (entrptr->keytab, keytab, CACHEKEYSIZE * sizeof (UINT64)) == 0)) {
+      cachptr->hitnbr ++;
+      *datasizptr = entrptr->datasiz;
+      return (entrptr->dataptr);
+    }
+  }
+
+  cachptr->misnbr ++;
+  return (NULL);
+}
+
+/*+ This routine stores a copy of the given
+*** data block in the cache of the given
+*** context, in place of its oldest entry.
+*** It returns:
+*** - 0   : if the data block has been stored.
+*** - !0  : on error.
++*/
+
+int
+contextCacheStore (
+Context * const             contptr,
+const UINT64 * const        keytab,               /*+ Key of entry        +*/
+const void * const          dataptr,              /*+ Data block to copy  +*/
+const size_t                datasiz)              /*+ Size of data block  +*/
+{
+  CacheContext * restrict cachptr;
+  CacheEntry * restrict   entrptr;
+  void *                  datatmp;
+
+  if ((datatmp = memAlloc (datasiz + 1)) == NULL) { /* "+1" in case of empty data block */
+    errorPrintW ("contextCacheStore: out of memory");
+    return (1);
+  }
+  memCpy (datatmp, dataptr, datasiz);
+
+  cachptr = contptr->cachptr;
+  entrptr = &cachptr->entrtab[cachptr->entrnum];
+  if (entrptr->dataptr != NULL)                   /* Replace oldest entry */
+    memFree (entrptr->dataptr);
+  memCpy (entrptr->keytab, keytab, CACHEKEYSIZE * sizeof (UINT64));
+  entrptr->datasiz = datasiz;
+  entrptr->dataptr = datatmp;
+
+  cachptr->entrnum = (cachptr->entrnum + 1) % cachptr->entrnbr;
+
+  return (0);
+}
+
+/*+ This routine returns the hit and
+*** miss counters of the cache of the
+*** given context, which are zero if no
+*** cache has been enabled.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+contextCacheStat (
+Context * const             contptr,
+INT * const                 hitptr,
+INT * const                 misptr)
+{
+  const CacheContext *  cachptr;
+
+  cachptr = contptr->cachptr;
+  if (hitptr != NULL)
+    *hitptr = (cachptr != NULL) ? cachptr->hitnbr : 0;
+  if (misptr != NULL)
+    *misptr = (cachptr != NULL) ? cachptr->misnbr : 0;
+}
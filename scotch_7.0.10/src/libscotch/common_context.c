@@ -1,4 +1,4 @@
-/* Copyright 2019,2021-2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021-2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -39,7 +39,7 @@
 /**                context management routines.            **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 12 mar 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,6 +53,14 @@
 #include "common_thread_system.h"
 #include "common_values.h"
 
+/*+ Number of vertices per thread below which
+    recursive jobs are run as tasks rather than
+    by splitting the thread context.           +*/
+
+#ifndef CONTEXTTHREADTASKLOAD
+#define CONTEXTTHREADTASKLOAD       16384
+#endif /* CONTEXTTHREADTASKLOAD */
+
 /*
 **  The static and global variables.
 */
@@ -77,6 +85,9 @@ Context * const             contptr)
   contptr->thrdptr = NULL;                        /* Thread context not initialized yet       */
   contptr->randptr = &intranddat;                 /* Use global random generator by default   */
   contptr->valuptr = NULL;                        /* Allow user library to provide its values */
+  contptr->statptr = NULL;                        /* No statistics gathered by default        */
+  contptr->statnum = -1;
+  contptr->cachptr = NULL;                        /* No result cache by default               */
 
   intRandInit (&intranddat);                      /* Make sure random context is initialized before cloning */
 }
@@ -101,6 +112,8 @@ Context * const             contptr)
       memFree (contptr->valuptr->dataptr);
     memFree (contptr->valuptr);
   }
+  contextStatExit  (contptr);
+  contextCacheExit (contptr);
 
 #ifdef SCOTCH_DEBUG_CONTEXT1
   contptr->thrdptr = NULL;
@@ -227,6 +240,61 @@ Context * const             contptr)
   return (contextThreadInit2 (contptr, thrdnbr, NULL));
 }
 
+/* These routines run the second job of a
+** recursive algorithm as a task, when the
+** context is in work-stealing mode. Sub-task
+** pseudo-random generators are derived in the
+** same way as for context splitting, so that
+** results do not depend on the execution mode
+** nor on the thread which runs the task.
+** They return:
+** - void  : in all cases.
+*/
+
+static
+void
+contextThreadLaunchTask2 (
+ThreadContext * const       thrdptr,              /*+ Context of worker running the task +*/
+ContextSplit * const        spltptr)              /*+ Data of second job                 +*/
+{
+  Context             contdat;
+
+  contdat = spltptr->conttab[1];
+  contdat.thrdptr = thrdptr;                      /* Run job in context of current worker */
+
+  spltptr->funcptr (&contdat, 1, spltptr->paraptr);
+}
+
+static
+void
+contextThreadLaunchTask3 (
+Context * const             contptr,              /*+ Context of current worker +*/
+ContextSplitFunc const      funcptr,              /*+ Function to launch        +*/
+void * const                paraptr)              /*+ Function parameters       +*/
+{
+  ContextSplit        spltdat;                    /* Data of second job                   */
+  IntRandContext      randdat;                    /* Pseudo-random context for second job */
+  ThreadTask          taskdat;                    /* Task running second job              */
+
+  spltdat.conttab[1].randptr = &randdat;          /* Set independent pseudo-random generator for second job */
+  spltdat.conttab[1].valuptr = contptr->valuptr;
+  spltdat.conttab[1].statptr = contptr->statptr;  /* Second job records its calls in the same statistics */
+  spltdat.conttab[1].statnum = contptr->statnum;
+  spltdat.conttab[1].cachptr = NULL;              /* Results are only cached at the library level */
+  spltdat.funcptr = funcptr;
+  spltdat.paraptr = paraptr;
+
+  intRandProc (&randdat, intRandVal2 (contptr->randptr)); /* Initialize new generator as for context splitting */
+  intRandSeed (&randdat, intRandVal2 (contptr->randptr));
+
+  taskdat.funcptr = (ThreadTaskFunc) contextThreadLaunchTask2;
+  taskdat.paraptr = (void *) &spltdat;
+  threadTaskSpawn (contptr->thrdptr, &taskdat);   /* Second job may be stolen by idle threads */
+
+  funcptr (contptr, 0, paraptr);                  /* Run first job in place          */
+  threadTaskSync (contptr->thrdptr, &taskdat);    /* Wait for second job to complete */
+}
+
 /* This routine, to be called only by the leader thread
 ** of the current threading environment, splits this
 ** context into two sub-contexts, each of them inheriting
@@ -236,6 +304,8 @@ Context * const             contptr)
 ** initialized as if a contextInit() were called on each
 ** of them, after which each sub-context leader runs the
 ** user-provided function within its sub-context.
+** If the context is already in work-stealing mode,
+** the second job is spawned as a task instead.
 ** It returns:
 ** - 0  : if sub-contexts could be created.
 ** - 1  : if initial context is too small.
@@ -280,15 +350,25 @@ void * const                paraptr)              /* Function parameters */
   IntRandContext            randdat;              /* Pseudo-random context for second sub-context */
   const int                 thrdnbr = contextThreadNbr (contptr);
 
+  if (contptr->thrdptr->poolptr != NULL) {        /* If already in work-stealing mode, spawn second job */
+    contextThreadLaunchTask3 (contptr, funcptr, paraptr);
+    return (0);
+  }
   if (thrdnbr <= 1)                               /* If current context too small or inactive, nothing to do */
     return (1);
 
   spltdat.conttab[0].thrdptr = &thrdtab[0];
   spltdat.conttab[0].randptr = contptr->randptr;  /* Re-use pseudo-random generator of initial context in sub-context 0 */
   spltdat.conttab[0].valuptr = contptr->valuptr;
+  spltdat.conttab[0].statptr = contptr->statptr;  /* Both sub-contexts share the statistics of the initial context */
+  spltdat.conttab[0].statnum = contptr->statnum;
+  spltdat.conttab[0].cachptr = NULL;              /* Results are only cached at the library level */
   spltdat.conttab[1].thrdptr = &thrdtab[1];
   spltdat.conttab[1].randptr = &randdat;          /* Set independent pseudo-random generator for sub-context 1 */
   spltdat.conttab[1].valuptr = contptr->valuptr;
+  spltdat.conttab[1].statptr = contptr->statptr;
+  spltdat.conttab[1].statnum = contptr->statnum;
+  spltdat.conttab[1].cachptr = NULL;
   spltdat.funcptr = funcptr;
   spltdat.paraptr = paraptr;
 
@@ -302,3 +382,61 @@ void * const                paraptr)              /* Function parameters */
 
   return (0);
 }
+
+/* These routines run the two jobs of a recursive
+** algorithm either by splitting the context, if
+** the jobs are big enough for each half of the
+** threads to run data-parallel routines on them,
+** or else as tasks on a work-stealing pool made
+** of all the threads of the context. In the latter
+** case, all the jobs of the lower levels of the
+** recursion are also run as tasks, so that idle
+** threads steal jobs instead of waiting for
+** their sibling sub-context to complete.
+** It returns:
+** - 0  : if jobs have been run concurrently.
+** - 1  : if context is too small.
+*/
+
+static
+void
+contextThreadLaunchTask4 (
+ThreadContext * const       thrdptr,              /*+ Context of master worker +*/
+ContextSplit * const        spltptr)              /*+ Data of root job         +*/
+{
+  Context             contdat;
+
+  contdat = spltptr->conttab[0];
+  contdat.thrdptr = thrdptr;                      /* Run root job in context of master worker */
+
+  contextThreadLaunchTask3 (&contdat, spltptr->funcptr, spltptr->paraptr);
+}
+
+int
+contextThreadLaunchTask (
+Context * const             contptr,
+ContextSplitFunc const      funcptr,              /* Function to launch             */
+void * const                paraptr,              /* Function parameters            */
+const INT                   loadval)              /* Number of vertices of both jobs */
+{
+  ContextSplit              spltdat;              /* Data structure for passing arguments */
+  const int                 thrdnbr = contextThreadNbr (contptr);
+
+  if (contptr->thrdptr->poolptr != NULL) {        /* If already in work-stealing mode, spawn second job */
+    contextThreadLaunchTask3 (contptr, funcptr, paraptr);
+    return (0);
+  }
+  if (thrdnbr <= 1)                               /* If current context too small or inactive, nothing to do */
+    return (1);
+
+  if (loadval >= ((INT) thrdnbr * CONTEXTTHREADTASKLOAD)) /* If jobs big enough for data-parallel routines */
+    return (contextThreadLaunchSplit (contptr, funcptr, paraptr));
+
+  spltdat.conttab[0] = *contptr;                  /* Root job inherits the context */
+  spltdat.funcptr    = funcptr;
+  spltdat.paraptr    = paraptr;
+  if (threadTaskLaunch (contptr->thrdptr, (ThreadTaskFunc) contextThreadLaunchTask4, (void *) &spltdat) != 0)
+    return (contextThreadLaunchSplit (contptr, funcptr, paraptr)); /* Fall back to context splitting */
+
+  return (0);
+}
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 10 nov 2014     **/
 /**                                 to   : 14 jul 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 08 aug 2024     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,9 +55,22 @@
 
 #include "module.h"
 #include "common.h"
+#ifndef COMMON_OS_WINDOWS
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* COMMON_OS_WINDOWS */
 #include "common_file.h"
 #include "common_file_compress.h"
 
+/*
+**  The static variables.
+*/
+
+static FileMap *            filemaplistptr = NULL; /*+ List of mapped file regions +*/
+#ifdef COMMON_PTHREAD
+static pthread_mutex_t      filemapmutedat = PTHREAD_MUTEX_INITIALIZER; /*+ Lock for list of mapped regions +*/
+#endif /* COMMON_PTHREAD */
+
 /*********************************/
 /*                               */
 /* Basic routines for filenames. */
@@ -301,3 +314,110 @@ const int                   filenbr)
     fileCompressExit (&filetab[i]);               /* After stream closed, if there is (de)compression data to free */
   }
 }
+
+/************************************/
+/*                                  */
+/* Basic routines for mapped files. */
+/*                                  */
+/************************************/
+
+/* This routine maps in memory the given
+** region of the file underlying the given
+** stream. Mapped pages are private and
+** writable: modifications are not written
+** back to the file. Mapping is only possible
+** for regular files; for other streams, such
+** as pipes or (de)compressed files, the caller
+** has to read data by itself.
+** It returns:
+** - !NULL  : pointer to the mapped region.
+** - NULL   : if the region could not be mapped.
+*/
+
+void *
+fileMap (
+FILE * const                stream,               /*+ Stream of file to map     +*/
+const off_t                 dataoff,              /*+ Offset of region in file  +*/
+const size_t                datasiz)              /*+ Size of region to map     +*/
+{
+#ifndef COMMON_OS_WINDOWS
+  FileMap *           mapptr;
+  struct stat         statdat;
+  off_t               mmapoff;                    /* Page-aligned start of mapping */
+  size_t              mmapsiz;
+  void *              mmapptr;
+  long                pagesiz;
+
+  if ((datasiz == 0) ||
+      (dataoff < 0)  ||
+      (fstat (fileno (stream), &statdat) != 0) ||
+      (! S_ISREG (statdat.st_mode))            || /* Only regular files can be mapped */
+      ((dataoff + (off_t) datasiz) > statdat.st_size))
+    return (NULL);
+
+  if ((pagesiz = sysconf (_SC_PAGESIZE)) <= 0)
+    return (NULL);
+  mmapoff = dataoff - (dataoff % (off_t) pagesiz);
+  mmapsiz = datasiz + (size_t) (dataoff - mmapoff);
+
+  if ((mapptr = memAlloc (sizeof (FileMap))) == NULL)
+    return (NULL);
+  if ((mmapptr = mmap (NULL, mmapsiz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno (stream), mmapoff)) == MAP_FAILED) {
+    memFree (mapptr);
+    return  (NULL);
+  }
+  mapptr->mmapptr = mmapptr;
+  mapptr->mmapsiz = mmapsiz;
+  mapptr->dataptr = (byte *) mmapptr + (dataoff - mmapoff);
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&filemapmutedat);
+#endif /* COMMON_PTHREAD */
+  mapptr->nextptr = filemaplistptr;               /* Link mapped region */
+  filemaplistptr  = mapptr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&filemapmutedat);
+#endif /* COMMON_PTHREAD */
+
+  return (mapptr->dataptr);
+#else /* COMMON_OS_WINDOWS */
+  return (NULL);                                  /* No file mapping available */
+#endif /* COMMON_OS_WINDOWS */
+}
+
+/* This routine unmaps a region that has
+** been mapped by fileMap().
+** It returns:
+** - 0   : on success.
+** - !0  : if the region was not found.
+*/
+
+int
+fileUnmap (
+void * const                dataptr)              /*+ Pointer returned by fileMap() +*/
+{
+#ifndef COMMON_OS_WINDOWS
+  FileMap **          mapqptr;
+  FileMap *           mapptr;
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&filemapmutedat);
+#endif /* COMMON_PTHREAD */
+  for (mapqptr = &filemaplistptr; ((mapptr = *mapqptr) != NULL) && (mapptr->dataptr != dataptr); mapqptr = &mapptr->nextptr) ;
+  if (mapptr != NULL)                             /* If region found, unlink it */
+    *mapqptr = mapptr->nextptr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&filemapmutedat);
+#endif /* COMMON_PTHREAD */
+
+  if (mapptr == NULL) {
+    errorPrint ("fileUnmap: region not found");
+    return (1);
+  }
+
+  munmap  (mapptr->mmapptr, mapptr->mmapsiz);
+  memFree (mapptr);
+#endif /* COMMON_OS_WINDOWS */
+
+  return (0);
+}
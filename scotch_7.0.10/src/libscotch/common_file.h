@@ -42,7 +42,7 @@
 /**   DATES      : # Version P0.5 : from : 21 may 2007     **/
 /**                                 to   : 21 may 2007     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,3 +54,16 @@
 
 #define FILENAMEDISTEXPANDNBR       10            /* TRICK: Change this value in ssprintf() format strings too */
 #define FILENAMEDISTEXPANDSTR       "%-10d"       /* TRICK: Change this value if FILENAMEDISTEXPANDNBR changes */
+
+/*+ The mapped file region structure. Since
+    mappings must start on page boundaries,
+    the mapped area may start before the
+    data area returned to the user, which
+    is used as a key to find it back.     +*/
+
+typedef struct FileMap_ {
+  struct FileMap_ *         nextptr;              /*+ Pointer to next mapped region +*/
+  void *                    mmapptr;              /*+ Start of mapped area          +*/
+  size_t                    mmapsiz;              /*+ Size of mapped area           +*/
+  void *                    dataptr;              /*+ Start of user data area       +*/
+} FileMap;
@@ -0,0 +1,185 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_hash.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes fast 64-bit        **/
+/**                non-cryptographic hash values of        **/
+/**                memory areas.                           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+
+/*+ Hashing primes, as defined by the XXH64
+    algorithm. They are built from 32-bit
+    halves to remain portable to compilers
+    without 64-bit integer constants.        +*/
+
+#define HASHPRIME1                  ((((UINT64) 0x9E3779B1) << 32) | (UINT64) 0x85EBCA87)
+#define HASHPRIME2                  ((((UINT64) 0xC2B2AE3D) << 32) | (UINT64) 0x27D4EB4F)
+#define HASHPRIME3                  ((((UINT64) 0x165667B1) << 32) | (UINT64) 0x9E3779F9)
+#define HASHPRIME4                  ((((UINT64) 0x85EBCA77) << 32) | (UINT64) 0xC2B2AE63)
+#define HASHPRIME5                  ((((UINT64) 0x27D4EB2F) << 32) | (UINT64) 0x165667C5)
+
+#define hashRotl(v,r)               (((v) << (r)) | ((v) >> (64 - (r))))
+
+/*********************************/
+/*                               */
+/* These routines compute hash   */
+/* values of memory areas.       */
+/*                               */
+/*********************************/
+
+/* This routine mixes a 64-bit word
+** into a lane accumulator.
+** It returns:
+** - the updated accumulator.
+*/
+
+static
+UINT64
+hashMemRound (
+UINT64                      hashval,
+const UINT64                wordval)
+{
+  hashval += wordval * HASHPRIME2;
+  hashval  = hashRotl (hashval, 31);
+  return (hashval * HASHPRIME1);
+}
+
+/* This routine reads an unaligned
+** 64-bit word from memory.
+** It returns:
+** - the word value.
+*/
+
+static
+UINT64
+hashMemWord (
+const byte * const          dataptr)
+{
+  UINT64              wordval;
+
+  memCpy (&wordval, dataptr, sizeof (UINT64));    /* Compilers turn it into a single load */
+  return (wordval);
+}
+
+/* This routine computes the 64-bit hash
+** value of the given memory area, using
+** the XXH64 algorithm. Large areas are
+** processed by four independent lanes,
+** which run at several gigabytes per
+** second. Areas can be chained by passing
+** the hash value of the previous area as
+** the seed of the next one.
+** It returns:
+** - the hash value.
+*/
+
+UINT64
+hashMem (
+const void * const          dataptr,              /*+ Area to hash                 +*/
+const size_t                datasiz,              /*+ Size of area, in bytes       +*/
+const UINT64                seedval)              /*+ Seed or previous hash value  +*/
+{
+  const byte *        byteptr;
+  const byte *        bytennd;
+  UINT64              hashval;
+
+  byteptr = (const byte *) dataptr;
+  bytennd = byteptr + datasiz;
+
+  if (datasiz >= 32) {
+    const byte *        bloknnd;                  /* End of last full 32-byte block */
+    UINT64              lanetab[4];
+
+    lanetab[0] = seedval + HASHPRIME1 + HASHPRIME2;
+    lanetab[1] = seedval + HASHPRIME2;
+    lanetab[2] = seedval;
+    lanetab[3] = seedval - HASHPRIME1;
+
+    for (bloknnd = bytennd - 32; byteptr <= bloknnd; byteptr += 32) {
+      lanetab[0] = hashMemRound (lanetab[0], hashMemWord (byteptr));
+      lanetab[1] = hashMemRound (lanetab[1], hashMemWord (byteptr + 8));
+      lanetab[2] = hashMemRound (lanetab[2], hashMemWord (byteptr + 16));
+      lanetab[3] = hashMemRound (lanetab[3], hashMemWord (byteptr + 24));
+    }
+
+    hashval = hashRotl (lanetab[0], 1)  + hashRotl (lanetab[1], 7) +
+              hashRotl (lanetab[2], 12) + hashRotl (lanetab[3], 18);
+    hashval = ((hashval ^ hashMemRound (0, lanetab[0])) * HASHPRIME1) + HASHPRIME4; /* Merge lanes */
+    hashval = ((hashval ^ hashMemRound (0, lanetab[1])) * HASHPRIME1) + HASHPRIME4;
+    hashval = ((hashval ^ hashMemRound (0, lanetab[2])) * HASHPRIME1) + HASHPRIME4;
+    hashval = ((hashval ^ hashMemRound (0, lanetab[3])) * HASHPRIME1) + HASHPRIME4;
+  }
+  else
+    hashval = seedval + HASHPRIME5;
+
+  hashval += (UINT64) datasiz;
+
+  for ( ; byteptr + 8 <= bytennd; byteptr += 8) { /* Process remaining words */
+    hashval ^= hashMemRound (0, hashMemWord (byteptr));
+    hashval  = (hashRotl (hashval, 27) * HASHPRIME1) + HASHPRIME4;
+  }
+  if (byteptr + 4 <= bytennd) {                   /* Process remaining half-word */
+    UINT32              halfval;
+
+    memCpy (&halfval, byteptr, sizeof (UINT32));
+    hashval ^= (UINT64) halfval * HASHPRIME1;
+    hashval  = (hashRotl (hashval, 23) * HASHPRIME2) + HASHPRIME3;
+    byteptr += 4;
+  }
+  for ( ; byteptr < bytennd; byteptr ++) {        /* Process remaining bytes */
+    hashval ^= (UINT64) *byteptr * HASHPRIME5;
+    hashval  = hashRotl (hashval, 11) * HASHPRIME1;
+  }
+
+  hashval ^= hashval >> 33;                       /* Final avalanche */
+  hashval *= HASHPRIME2;
+  hashval ^= hashval >> 29;
+  hashval *= HASHPRIME3;
+  hashval ^= hashval >> 32;
+
+  return (hashval);
+}
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014-2016,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014-2016,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 03 jun 2018     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -471,6 +471,15 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 /*                   */
 /*********************/
 
+/* Every intSortXascY() routine is a radix
+** sort, run by intRsortXascY() without any
+** thread context. Small arrays are handled
+** by the quicksort routine intQsortXascY().
+** As radix sorting is stable, the order of
+** elements with equal keys may differ from
+** that of quicksort for large arrays.
+*/
+
 /* This routine sorts an array of
 ** INT values in ascending order
 ** by their first value, used as key.
@@ -478,16 +487,38 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 ** - VOID  : in all cases.
 */
 
-#define INTSORTNAME                 intSort1asc1
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 intQsort1asc1
 #define INTSORTSIZE                 (sizeof (INT))
 #define INTSORTSWAP(p,q)            do { INT t; t = *((INT *) (p)); *((INT *) (p)) = *((INT *) (q)); *((INT *) (q)) = t; } while (0)
 #define INTSORTCMP(p,q)             (*((INT *) (p)) < *((INT *) (q)))
 #include "common_sort.c"
+#undef INTSORTQUAL
 #undef INTSORTNAME
 #undef INTSORTSIZE
 #undef INTSORTSWAP
 #undef INTSORTCMP
 
+#define INTSORTNAME                 intRsort1asc1
+#define INTSORTLOOP                 intRsort1asc1Loop
+#define INTSORTQSRT                 intQsort1asc1
+#define INTSORTVALS                 1
+#define INTSORTKEYS                 1
+#include "common_rsort.c"
+#undef INTSORTNAME
+#undef INTSORTLOOP
+#undef INTSORTQSRT
+#undef INTSORTVALS
+#undef INTSORTKEYS
+
+void
+intSort1asc1 (
+void * const                sorttab,              /*+ Array to sort             +*/
+const INT                   sortnbr)              /*+ Number of entries to sort +*/
+{
+  intRsort1asc1 (sorttab, sortnbr, NULL);
+}
+
 /* This routine sorts an array of pairs of
 ** INT values in ascending order by their
 ** first value, used as key.
@@ -495,16 +526,38 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 ** - VOID  : in all cases.
 */
 
-#define INTSORTNAME                 intSort2asc1
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 intQsort2asc1
 #define INTSORTSIZE                 (2 * sizeof (INT))
 #define INTSORTSWAP(p,q)            do { INT t, u; t = *((INT *) (p)); u = *((INT *) (p) + 1); *((INT *) (p)) = *((INT *) (q)); *((INT *) (p) + 1) = *((INT *) (q) + 1); *((INT *) (q)) = t; *((INT *) (q) + 1) = u; } while (0)
 #define INTSORTCMP(p,q)             (*((INT *) (p)) < *((INT *) (q)))
 #include "common_sort.c"
+#undef INTSORTQUAL
 #undef INTSORTNAME
 #undef INTSORTSIZE
 #undef INTSORTSWAP
 #undef INTSORTCMP
 
+#define INTSORTNAME                 intRsort2asc1
+#define INTSORTLOOP                 intRsort2asc1Loop
+#define INTSORTQSRT                 intQsort2asc1
+#define INTSORTVALS                 2
+#define INTSORTKEYS                 1
+#include "common_rsort.c"
+#undef INTSORTNAME
+#undef INTSORTLOOP
+#undef INTSORTQSRT
+#undef INTSORTVALS
+#undef INTSORTKEYS
+
+void
+intSort2asc1 (
+void * const                sorttab,              /*+ Array to sort             +*/
+const INT                   sortnbr)              /*+ Number of entries to sort +*/
+{
+  intRsort2asc1 (sorttab, sortnbr, NULL);
+}
+
 /* This routine sorts an array of pairs of
 ** INT values in ascending order by both
 ** of their values, used as primary and
@@ -513,16 +566,38 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 ** - VOID  : in all cases.
 */
 
-#define INTSORTNAME                 intSort2asc2
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 intQsort2asc2
 #define INTSORTSIZE                 (2 * sizeof (INT))
 #define INTSORTSWAP(p,q)            do { INT t, u; t = *((INT *) (p)); u = *((INT *) (p) + 1); *((INT *) (p)) = *((INT *) (q)); *((INT *) (p) + 1) = *((INT *) (q) + 1); *((INT *) (q)) = t; *((INT *) (q) + 1) = u; } while (0)
 #define INTSORTCMP(p,q)             ((*((INT *) (p)) < *((INT *) (q))) || ((*((INT *) (p)) == *((INT *) (q))) && (*((INT *) (p) + 1) < *((INT *) (q) + 1))))
 #include "common_sort.c"
+#undef INTSORTQUAL
 #undef INTSORTNAME
 #undef INTSORTSIZE
 #undef INTSORTSWAP
 #undef INTSORTCMP
 
+#define INTSORTNAME                 intRsort2asc2
+#define INTSORTLOOP                 intRsort2asc2Loop
+#define INTSORTQSRT                 intQsort2asc2
+#define INTSORTVALS                 2
+#define INTSORTKEYS                 2
+#include "common_rsort.c"
+#undef INTSORTNAME
+#undef INTSORTLOOP
+#undef INTSORTQSRT
+#undef INTSORTVALS
+#undef INTSORTKEYS
+
+void
+intSort2asc2 (
+void * const                sorttab,              /*+ Array to sort             +*/
+const INT                   sortnbr)              /*+ Number of entries to sort +*/
+{
+  intRsort2asc2 (sorttab, sortnbr, NULL);
+}
+
 /* This routine sorts an array of 3-uples of
 ** INT values in ascending order by their
 ** first value, used as key.
@@ -530,16 +605,38 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 ** - VOID  : in all cases.
 */
 
-#define INTSORTNAME                 intSort3asc1
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 intQsort3asc1
 #define INTSORTSIZE                 (3 * sizeof (INT))
 #define INTSORTSWAP(p,q)            do { INT t, u, v; t = *((INT *) (p)); u = *((INT *) (p) + 1); v = *((INT *) (p) + 2); *((INT *) (p)) = *((INT *) (q)); *((INT *) (p) + 1) = *((INT *) (q) + 1); *((INT *) (p) + 2) = *((INT *) (q) + 2); *((INT *) (q)) = t; *((INT *) (q) + 1) = u; *((INT *) (q) + 2) = v; } while (0)
 #define INTSORTCMP(p,q)             (*((INT *) (p)) < *((INT *) (q)))
 #include "common_sort.c"
+#undef INTSORTQUAL
 #undef INTSORTNAME
 #undef INTSORTSIZE
 #undef INTSORTSWAP
 #undef INTSORTCMP
 
+#define INTSORTNAME                 intRsort3asc1
+#define INTSORTLOOP                 intRsort3asc1Loop
+#define INTSORTQSRT                 intQsort3asc1
+#define INTSORTVALS                 3
+#define INTSORTKEYS                 1
+#include "common_rsort.c"
+#undef INTSORTNAME
+#undef INTSORTLOOP
+#undef INTSORTQSRT
+#undef INTSORTVALS
+#undef INTSORTKEYS
+
+void
+intSort3asc1 (
+void * const                sorttab,              /*+ Array to sort             +*/
+const INT                   sortnbr)              /*+ Number of entries to sort +*/
+{
+  intRsort3asc1 (sorttab, sortnbr, NULL);
+}
+
 /* This routine sorts an array of 3-uples of
 ** INT values in ascending order by their
 ** first and second values, used as primary
@@ -548,16 +645,38 @@ IntRandContext * const      contptr)              /*+ Random context to load +*/
 ** - VOID  : in all cases.
 */
 
-#define INTSORTNAME                 intSort3asc2
+#define INTSORTQUAL                 static
+#define INTSORTNAME                 intQsort3asc2
 #define INTSORTSIZE                 (3 * sizeof (INT))
 #define INTSORTSWAP(p,q)            do { INT t, u, v; t = *((INT *) (p)); u = *((INT *) (p) + 1); v = *((INT *) (p) + 2); *((INT *) (p)) = *((INT *) (q)); *((INT *) (p) + 1) = *((INT *) (q) + 1); *((INT *) (p) + 2) = *((INT *) (q) + 2); *((INT *) (q)) = t; *((INT *) (q) + 1) = u; *((INT *) (q) + 2) = v; } while (0)
 #define INTSORTCMP(p,q)             ((*((INT *) (p)) < *((INT *) (q))) || ((*((INT *) (p)) == *((INT *) (q))) && (*((INT *) (p) + 1) < *((INT *) (q) + 1))))
 #include "common_sort.c"
+#undef INTSORTQUAL
 #undef INTSORTNAME
 #undef INTSORTSIZE
 #undef INTSORTSWAP
 #undef INTSORTCMP
 
+#define INTSORTNAME                 intRsort3asc2
+#define INTSORTLOOP                 intRsort3asc2Loop
+#define INTSORTQSRT                 intQsort3asc2
+#define INTSORTVALS                 3
+#define INTSORTKEYS                 2
+#include "common_rsort.c"
+#undef INTSORTNAME
+#undef INTSORTLOOP
+#undef INTSORTQSRT
+#undef INTSORTVALS
+#undef INTSORTKEYS
+
+void
+intSort3asc2 (
+void * const                sorttab,              /*+ Array to sort             +*/
+const INT                   sortnbr)              /*+ Number of entries to sort +*/
+{
+  intRsort3asc2 (sorttab, sortnbr, NULL);
+}
+
 /*****************************/
 /*                           */
 /* Partial sorting routines. */
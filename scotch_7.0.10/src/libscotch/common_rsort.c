@@ -0,0 +1,277 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_rsort.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the generic radix sort   **/
+/**                routine for arrays of INT tuples. It is **/
+/**                included several times by the integer   **/
+/**                handling module, once per sort type.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/* This is a least significant digit radix sort.
+** Elements are moved by counting sort, one digit
+** of INTRSORTBITS bits at a time, from the least
+** significant digit of the last key to the most
+** significant digit of the first key. Digits which
+** have the same value for all elements are skipped,
+** so that small key ranges only cost a few passes.
+** As every pass is stable, the result is the unique
+** stable order of the array, whatever the number of
+** threads used. When threads are available, each of
+** them counts and scatters a contiguous slice of the
+** array, and bucket offsets are computed such that
+** slices are written in order.
+** Small arrays, and arrays for which no auxiliary
+** array can be allocated, are handed to the
+** quicksort routine.
+*/
+
+/* To be defined :
+** INTSORTQUAL : whether the function is "static" or not
+** INTSORTNAME : Name of function
+** INTSORTLOOP : Name of threaded routine
+** INTSORTQSRT : Name of quicksort fallback routine
+** INTSORTVALS : Number of INT values per element
+** INTSORTKEYS : Number of leading INT values used as keys
+*/
+
+#ifndef INTRSORT_DEFINED
+#define INTRSORT_DEFINED
+
+#define INTRSORTBITS                11            /* Number of bits per digit            */
+#define INTRSORTBCKT                (1 << INTRSORTBITS) /* Number of buckets per pass */
+#define INTRSORTDGTS                ((sizeof (INT) * CHAR_BIT + INTRSORTBITS - 1) / INTRSORTBITS) /* Digits per key */
+#define INTRSORTPASS                (2 * INTRSORTDGTS) /* Maximum number of passes   */
+#define INTRSORTSIGN                (((UINT) 1) << (sizeof (INT) * CHAR_BIT - 1)) /* Sign bit to flip */
+#define INTRSORTNBRMIN              2048          /* Below this size, use quicksort      */
+#define INTRSORTTHRDMIN             32768         /* Minimum number of elements per thread */
+
+#define intRsortDigit(p,k,s)        ((int) (((((UINT) (p)[k]) ^ INTRSORTSIGN) >> (s)) & (INTRSORTBCKT - 1)))
+
+/*+ The radix sort shared data. +*/
+
+typedef struct IntRsortData_ {
+  INT *                     sorttab;              /*+ Array to sort                          +*/
+  INT *                     tmpptab;              /*+ Auxiliary array of same size           +*/
+  INT                       sortnbr;              /*+ Number of elements                     +*/
+  int                       thrdnbr;              /*+ Number of threads                      +*/
+  INT *                     cnttab;               /*+ Per-thread bucket counts               +*/
+  INT *                     ofsttab;              /*+ Per-thread bucket offsets              +*/
+  UINT *                    difftab;              /*+ Per-thread key bits that differ        +*/
+} IntRsortData;
+
+#endif /* INTRSORT_DEFINED */
+
+/* This routine performs the sort of one slice
+** of the array; it is run by every thread of
+** the context, or alone with a NULL descriptor.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+INTSORTLOOP (
+ThreadDescriptor * restrict const descptr,
+IntRsortData * restrict const     dataptr)
+{
+  INT * restrict      srcptab;
+  INT * restrict      dstptab;
+  INT * restrict      cntptr;
+  INT * restrict      ofsptr;
+  INT                 sortnum;
+  INT                 sortnnd;
+  UINT                difftab[INTSORTKEYS];
+  int                 passtab[INTRSORTPASS][2];   /* Key index and shift of every pass */
+  int                 passnbr;
+  int                 passnum;
+  int                 keynum;
+  int                 thrdnum;
+
+  const int           thrdnbr = dataptr->thrdnbr;
+
+  thrdnum = (descptr != NULL) ? threadNum (descptr) : 0;
+  sortnum = DATASCAN (dataptr->sortnbr, thrdnbr, thrdnum);
+  sortnnd = DATASCAN (dataptr->sortnbr, thrdnbr, thrdnum + 1);
+  cntptr  = dataptr->cnttab  + thrdnum * INTRSORTBCKT;
+  ofsptr  = dataptr->ofsttab + thrdnum * INTRSORTBCKT;
+
+  for (keynum = 0; keynum < INTSORTKEYS; keynum ++) { /* Find key bits that differ from those of first element */
+    UINT                diffval;
+    INT                 keyval;
+    INT                 sortidx;
+
+    keyval = dataptr->sorttab[keynum];
+    for (sortidx = sortnum, diffval = 0; sortidx < sortnnd; sortidx ++)
+      diffval |= (UINT) (dataptr->sorttab[sortidx * INTSORTVALS + keynum] ^ keyval);
+    dataptr->difftab[thrdnum * INTSORTKEYS + keynum] = diffval;
+  }
+  if (descptr != NULL)
+    threadBarrier (descptr);
+
+  for (keynum = 0; keynum < INTSORTKEYS; keynum ++) {
+    int                 thrdtmp;
+
+    for (thrdtmp = 0, difftab[keynum] = 0; thrdtmp < thrdnbr; thrdtmp ++)
+      difftab[keynum] |= dataptr->difftab[thrdtmp * INTSORTKEYS + keynum];
+  }
+  for (keynum = INTSORTKEYS - 1, passnbr = 0; keynum >= 0; keynum --) { /* Least significant key first */
+    int                 shftval;
+
+    for (shftval = 0; shftval < (int) (sizeof (INT) * CHAR_BIT); shftval += INTRSORTBITS) {
+      if (((difftab[keynum] >> shftval) & (INTRSORTBCKT - 1)) != 0) { /* Skip digits that never change */
+        passtab[passnbr][0] = keynum;
+        passtab[passnbr][1] = shftval;
+        passnbr ++;
+      }
+    }
+  }
+
+  srcptab = dataptr->sorttab;
+  dstptab = dataptr->tmpptab;
+  for (passnum = 0; passnum < passnbr; passnum ++) {
+    const int           keyidx = passtab[passnum][0];
+    const int           shftval = passtab[passnum][1];
+    INT                 sortidx;
+    INT                 ofstval;
+    int                 bcktnum;
+    INT * restrict      tmpptab;
+
+    memSet (cntptr, 0, INTRSORTBCKT * sizeof (INT));
+    for (sortidx = sortnum; sortidx < sortnnd; sortidx ++)
+      cntptr[intRsortDigit (srcptab + sortidx * INTSORTVALS, keyidx, shftval)] ++;
+    if (descptr != NULL)
+      threadBarrier (descptr);
+
+    for (bcktnum = 0, ofstval = 0; bcktnum < INTRSORTBCKT; bcktnum ++) { /* Compute offsets of slice buckets */
+      int                 thrdtmp;
+
+      for (thrdtmp = 0; thrdtmp < thrdnum; thrdtmp ++)
+        ofstval += dataptr->cnttab[thrdtmp * INTRSORTBCKT + bcktnum];
+      ofsptr[bcktnum] = ofstval;
+      for ( ; thrdtmp < thrdnbr; thrdtmp ++)
+        ofstval += dataptr->cnttab[thrdtmp * INTRSORTBCKT + bcktnum];
+    }
+
+    for (sortidx = sortnum; sortidx < sortnnd; sortidx ++) { /* Scatter slice elements */
+      const INT * restrict  srcpptr = srcptab + sortidx * INTSORTVALS;
+      INT * restrict        dstpptr;
+      int                   wordnum;
+
+      dstpptr = dstptab + (ofsptr[intRsortDigit (srcpptr, keyidx, shftval)] ++) * INTSORTVALS;
+      for (wordnum = 0; wordnum < INTSORTVALS; wordnum ++)
+        dstpptr[wordnum] = srcpptr[wordnum];
+    }
+    if (descptr != NULL)                          /* Counts of all threads no longer needed */
+      threadBarrier (descptr);
+
+    tmpptab = srcptab;                            /* Swap arrays */
+    srcptab = dstptab;
+    dstptab = tmpptab;
+  }
+
+  if (srcptab != dataptr->sorttab)                /* If data ended in auxiliary array, copy slice back */
+    memCpy (dataptr->sorttab + sortnum * INTSORTVALS, srcptab + sortnum * INTSORTVALS,
+            (sortnnd - sortnum) * INTSORTVALS * sizeof (INT));
+}
+
+/* This routine sorts the given array of
+** INT tuples in ascending order of their
+** INTSORTKEYS first values, using the
+** threads of the given context, if any.
+** It returns:
+** - void  : in all cases.
+*/
+
+#ifdef INTSORTQUAL
+INTSORTQUAL
+#endif /* INTSORTQUAL */
+void
+INTSORTNAME (
+void * const                sorttab,              /*+ Array to sort                 +*/
+const INT                   sortnbr,              /*+ Number of entries to sort     +*/
+Context * const             contptr)              /*+ Execution context, or NULL    +*/
+{
+  IntRsortData        sortdat;
+  INT                 sortnum;
+  int                 thrdnbr;
+
+  if (sortnbr < INTRSORTNBRMIN) {                 /* Small arrays are sorted faster by quicksort */
+    INTSORTQSRT (sorttab, sortnbr);
+    return;
+  }
+
+  for (sortnum = 1; sortnum < sortnbr; sortnum ++) { /* Nothing to do if array already sorted */
+    const INT * const   prevptr = (INT *) sorttab + (sortnum - 1) * INTSORTVALS;
+    const INT * const   sortptr = prevptr + INTSORTVALS;
+    int                 keynum;
+
+    for (keynum = 0; keynum < INTSORTKEYS; keynum ++) {
+      if (sortptr[keynum] != prevptr[keynum])
+        break;
+    }
+    if ((keynum < INTSORTKEYS) && (sortptr[keynum] < prevptr[keynum]))
+      break;
+  }
+  if (sortnum >= sortnbr)
+    return;
+
+  thrdnbr = ((contptr != NULL) && (sortnbr >= (2 * INTRSORTTHRDMIN))) /* Do not use threads for too small arrays */
+            ? contextThreadNbr (contptr) : 1;
+
+  if (memAllocGroup ((void **) (void *)
+                     &sortdat.tmpptab, (size_t) (sortnbr * INTSORTVALS * sizeof (INT)),
+                     &sortdat.cnttab,  (size_t) (thrdnbr * INTRSORTBCKT * sizeof (INT)),
+                     &sortdat.ofsttab, (size_t) (thrdnbr * INTRSORTBCKT * sizeof (INT)),
+                     &sortdat.difftab, (size_t) (thrdnbr * INTSORTKEYS * sizeof (UINT)), NULL) == NULL) {
+    INTSORTQSRT (sorttab, sortnbr);               /* Not enough memory for auxiliary array: use quicksort */
+    return;
+  }
+  sortdat.sorttab = (INT *) sorttab;
+  sortdat.sortnbr = sortnbr;
+  sortdat.thrdnbr = thrdnbr;
+
+  if (thrdnbr > 1)
+    contextThreadLaunch (contptr, (ThreadFunc) INTSORTLOOP, (void *) &sortdat);
+  else
+    INTSORTLOOP (NULL, &sortdat);
+
+  memFree (sortdat.tmpptab);                      /* Free group leader */
+}
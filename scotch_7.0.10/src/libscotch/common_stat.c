@@ -0,0 +1,434 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_stat.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the gathering of    **/
+/**                statistics on strategy method calls.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "common_stat.h"
+
+/****************************************/
+/*                                      */
+/* These routines handle the statistics */
+/* features of contexts.                */
+/*                                      */
+/****************************************/
+
+/*+ This routine enables the gathering of
+*** strategy method statistics in the given
+*** context. Records accumulate across calls
+*** until the context is reset or freed.
+*** It returns:
+*** - 0   : if the statistics context is available.
+*** - !0  : on error.
++*/
+
+int
+contextStatInit (
+Context * const             contptr)
+{
+  StatContext * restrict  statptr;
+
+  if (contptr->statptr != NULL)                   /* If statistics already enabled */
+    return (0);
+
+  if ((statptr = (StatContext *) memAlloc (sizeof (StatContext))) == NULL) {
+    errorPrint ("contextStatInit: out of memory");
+    return (1);
+  }
+#ifdef COMMON_PTHREAD
+  pthread_mutex_init (&statptr->lockdat, NULL);
+#endif /* COMMON_PTHREAD */
+  statptr->recdtab = NULL;
+  statptr->recdnbr =
+  statptr->recdmax = 0;
+
+  contptr->statptr = statptr;
+  contptr->statnum = -1;                          /* No enclosing record */
+
+  return (0);
+}
+
+/*+ This routine frees the statistics
+*** context of the given context, if any.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+contextStatExit (
+Context * const             contptr)
+{
+  StatContext * restrict  statptr;
+
+  statptr = contptr->statptr;
+  if (statptr == NULL)
+    return;
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_destroy (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  if (statptr->recdtab != NULL)
+    memFree (statptr->recdtab);
+  memFree (statptr);
+
+  contptr->statptr = NULL;
+}
+
+/*+ This routine discards all the records
+*** of the given statistics context.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+contextStatReset (
+Context * const             contptr)
+{
+  if (contptr->statptr != NULL)
+    contptr->statptr->recdnbr = 0;
+  contptr->statnum = -1;
+}
+
+/*+ This routine returns the number of
+*** records of the given context.
+*** It returns:
+*** - >=0  : number of records.
++*/
+
+INT
+contextStatNbr (
+Context * const             contptr)
+{
+  return ((contptr->statptr != NULL) ? contptr->statptr->recdnbr : 0);
+}
+
+/*+ These routines open and close the
+*** record of a strategy method call. They
+*** must only be called when statistics
+*** are enabled, that is, when the
+*** contextStatActive() macro is true. The
+*** record is created when the call starts,
+*** so that records are stored in call order,
+*** and completed when it ends. Since the
+*** statistics context is shared by all the
+*** sub-contexts of a split context, records
+*** are created and completed under a lock.
+*** They return:
+*** - void  : in all cases.
++*/
+
+void
+contextStatBegin (
+Context * const             contptr,
+StatMark * const            markptr,
+const char * const          typeptr,              /*+ Name of method family +*/
+const char * const          methptr,              /*+ Name of method        +*/
+const INT                   vertnbr,
+const INT                   edgenbr,
+const double                costval,              /*+ Cost before call, or negative      +*/
+const double                imbaval)              /*+ Imbalance before call, or negative +*/
+{
+  StatContext * restrict  statptr;
+  StatRecord * restrict   recdptr;
+  INT                     recdnum;
+
+  statptr = contptr->statptr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  recdnum = statptr->recdnbr;
+  if (recdnum >= statptr->recdmax) {              /* If record array must be resized */
+    StatRecord *        recdtmp;
+    INT                 recdmax;
+
+    recdmax = (statptr->recdmax <= 0) ? STATRECDMIN : (statptr->recdmax + (statptr->recdmax >> 1));
+    if ((recdtmp = (StatRecord *) memRealloc (statptr->recdtab, recdmax * sizeof (StatRecord))) == NULL) {
+#ifdef COMMON_PTHREAD
+      pthread_mutex_unlock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+      errorPrintW ("contextStatBegin: out of memory");
+      markptr->recdnum = -1;                      /* Call will not be recorded */
+      return;
+    }
+    statptr->recdtab = recdtmp;
+    statptr->recdmax = recdmax;
+  }
+  statptr->recdnbr = recdnum + 1;
+
+  recdptr = &statptr->recdtab[recdnum];
+  recdptr->typeptr    = typeptr;
+  recdptr->methptr    = methptr;
+  recdptr->parenum    = contptr->statnum;
+  recdptr->levlnum    = (contptr->statnum < 0) ? 0 : (statptr->recdtab[contptr->statnum].levlnum + 1);
+  recdptr->vertnbr    = vertnbr;
+  recdptr->edgenbr    = edgenbr;
+  recdptr->retuval    = 0;
+  recdptr->timeval    = 0.0;
+  recdptr->costtab[0] = costval;
+  recdptr->costtab[1] = -1.0;
+  recdptr->imbatab[0] = imbaval;
+  recdptr->imbatab[1] = -1.0;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+
+  markptr->recdnum = recdnum;
+  markptr->parenum = contptr->statnum;
+  contptr->statnum = recdnum;                     /* Nested calls will be children of this one */
+  markptr->timeval = clockGet ();
+}
+
+void
+contextStatEnd (
+Context * const             contptr,
+const StatMark * const      markptr,
+const double                costval,              /*+ Cost after call, or negative      +*/
+const double                imbaval,              /*+ Imbalance after call, or negative +*/
+const int                   retuval)              /*+ Value returned by method          +*/
+{
+  StatContext * restrict  statptr;
+  StatRecord * restrict   recdptr;
+  double                  timeval;
+
+  timeval = clockGet () - markptr->timeval;
+  if (markptr->recdnum < 0)                       /* If call could not be recorded */
+    return;
+
+  contptr->statnum = markptr->parenum;
+
+  statptr = contptr->statptr;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+  recdptr = &statptr->recdtab[markptr->recdnum];
+  recdptr->retuval    = retuval;
+  recdptr->timeval    = timeval;
+  recdptr->costtab[1] = costval;
+  recdptr->imbatab[1] = imbaval;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&statptr->lockdat);
+#endif /* COMMON_PTHREAD */
+}
+
+/*+ This routine retrieves the data of
+*** the given record.
+*** It returns:
+*** - 0   : if the record exists.
+*** - !0  : on error.
++*/
+
+int
+contextStatGet (
+Context * const             contptr,
+const INT                   recdnum,
+const char ** const         typeptr,
+const char ** const         methptr,
+INT * const                 levlptr,
+INT * const                 vertptr,
+INT * const                 edgeptr,
+double * const              timeptr,
+double * const              costtab,
+double * const              imbatab)
+{
+  const StatRecord *  recdptr;
+
+  if ((contptr->statptr == NULL) ||
+      (recdnum < 0) || (recdnum >= contptr->statptr->recdnbr)) {
+    errorPrint ("contextStatGet: invalid record number");
+    return (1);
+  }
+
+  recdptr = &contptr->statptr->recdtab[recdnum];
+  if (typeptr != NULL)
+    *typeptr = recdptr->typeptr;
+  if (methptr != NULL)
+    *methptr = recdptr->methptr;
+  if (levlptr != NULL)
+    *levlptr = recdptr->levlnum;
+  if (vertptr != NULL)
+    *vertptr = recdptr->vertnbr;
+  if (edgeptr != NULL)
+    *edgeptr = recdptr->edgenbr;
+  if (timeptr != NULL)
+    *timeptr = recdptr->timeval;
+  if (costtab != NULL) {
+    costtab[0] = recdptr->costtab[0];
+    costtab[1] = recdptr->costtab[1];
+  }
+  if (imbatab != NULL) {
+    imbatab[0] = recdptr->imbatab[0];
+    imbatab[1] = recdptr->imbatab[1];
+  }
+
+  return (0);
+}
+
+/*+ This routine writes a value which may be
+*** irrelevant, in which case it is null.
+*** It returns:
+*** - >=0  : on success.
+*** - <0   : on error.
++*/
+
+static
+int
+contextStatSave2 (
+FILE * const                stream,
+const double                valeval)
+{
+  return ((valeval < 0.0) ? fprintf (stream, "null") : fprintf (stream, "%.17g", valeval));
+}
+
+/*+ This routine saves the records of the
+*** given context in JSON format, followed
+*** by a summary per method. The self time
+*** of a record is its time minus that of
+*** the records of the calls it directly
+*** encloses. As enclosed calls may have
+*** run concurrently in sub-contexts, self
+*** times are bounded below by zero.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+contextStatSave (
+Context * const             contptr,
+FILE * const                stream)
+{
+  const StatRecord * restrict recdtab;
+  INT                         recdnbr;
+  INT                         recdnum;
+  double * restrict           selftab;            /* Self time of records                  */
+  INT * restrict              sumytab;            /* Index of first record of each summary */
+  INT                         sumynbr;
+  INT                         sumynum;
+  int                         o;
+
+  recdnbr = contextStatNbr (contptr);
+  recdtab = (contptr->statptr != NULL) ? contptr->statptr->recdtab : NULL;
+
+  if (memAllocGroup ((void **) (void *)
+                     &selftab, (size_t) ((recdnbr + 1) * sizeof (double)),
+                     &sumytab, (size_t) ((recdnbr + 1) * sizeof (INT)), NULL) == NULL) {
+    errorPrint ("contextStatSave: out of memory");
+    return (1);
+  }
+
+  for (recdnum = 0; recdnum < recdnbr; recdnum ++) /* Compute self times */
+    selftab[recdnum] = recdtab[recdnum].timeval;
+  for (recdnum = 0; recdnum < recdnbr; recdnum ++) {
+    if (recdtab[recdnum].parenum >= 0)
+      selftab[recdtab[recdnum].parenum] -= recdtab[recdnum].timeval;
+  }
+  for (recdnum = 0; recdnum < recdnbr; recdnum ++) {
+    if (selftab[recdnum] < 0.0)                   /* If enclosed calls ran concurrently */
+      selftab[recdnum] = 0.0;
+  }
+
+  o = (fprintf (stream, "{\n  \"records\": [") < 0);
+  for (recdnum = 0; (o == 0) && (recdnum < recdnbr); recdnum ++) {
+    const StatRecord *  recdptr;
+
+    recdptr = &recdtab[recdnum];
+    o  = (fprintf (stream, "%s\n    { \"type\": \"%s\", \"method\": \"%s\", \"level\": " INTSTRING
+                   ", \"vertnbr\": " INTSTRING ", \"edgenbr\": " INTSTRING ", \"time\": %.17g, \"self\": %.17g, \"status\": %d, \"cost\": [",
+                   (recdnum == 0) ? "" : ",",
+                   recdptr->typeptr, recdptr->methptr, recdptr->levlnum,
+                   recdptr->vertnbr, recdptr->edgenbr, recdptr->timeval, selftab[recdnum], recdptr->retuval) < 0);
+    o |= (contextStatSave2 (stream, recdptr->costtab[0]) < 0);
+    o |= (fprintf (stream, ", ") < 0);
+    o |= (contextStatSave2 (stream, recdptr->costtab[1]) < 0);
+    o |= (fprintf (stream, "], \"imbalance\": [") < 0);
+    o |= (contextStatSave2 (stream, recdptr->imbatab[0]) < 0);
+    o |= (fprintf (stream, ", ") < 0);
+    o |= (contextStatSave2 (stream, recdptr->imbatab[1]) < 0);
+    o |= (fprintf (stream, "] }") < 0);
+  }
+  if (o == 0)
+    o = (fprintf (stream, "\n  ],\n  \"summary\": [") < 0);
+
+  for (recdnum = 0, sumynbr = 0; (o == 0) && (recdnum < recdnbr); recdnum ++) { /* Aggregate by family and method */
+    INT                 countnbr;
+    double              timesum;
+    double              selfsum;
+    INT                 recdtmp;
+
+    for (sumynum = 0; sumynum < sumynbr; sumynum ++) { /* Skip methods already summarized */
+      if ((strcmp (recdtab[sumytab[sumynum]].typeptr, recdtab[recdnum].typeptr) == 0) &&
+          (strcmp (recdtab[sumytab[sumynum]].methptr, recdtab[recdnum].methptr) == 0))
+        break;
+    }
+    if (sumynum < sumynbr)
+      continue;
+    sumytab[sumynbr ++] = recdnum;
+
+    for (recdtmp = recdnum, countnbr = 0, timesum = selfsum = 0.0; recdtmp < recdnbr; recdtmp ++) {
+      if ((strcmp (recdtab[recdtmp].typeptr, recdtab[recdnum].typeptr) == 0) &&
+          (strcmp (recdtab[recdtmp].methptr, recdtab[recdnum].methptr) == 0)) {
+        countnbr ++;
+        timesum += recdtab[recdtmp].timeval;
+        selfsum += selftab[recdtmp];
+      }
+    }
+
+    o = (fprintf (stream, "%s\n    { \"type\": \"%s\", \"method\": \"%s\", \"count\": " INTSTRING ", \"time\": %.17g, \"self\": %.17g }",
+                  (sumynbr == 1) ? "" : ",",
+                  recdtab[recdnum].typeptr, recdtab[recdnum].methptr, countnbr, timesum, selfsum) < 0);
+  }
+  if (o == 0)
+    o = (fprintf (stream, "\n  ]\n}\n") < 0);
+
+  memFree (selftab);                              /* Free group leader */
+
+  if (o != 0)
+    errorPrint ("contextStatSave: bad output");
+
+  return (o);
+}
@@ -0,0 +1,83 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_stat.h                           **/
+/**                                                        **/
+/**   AUTHORS    : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the internal data       **/
+/**                declarations for the strategy method    **/
+/**                statistics routines.                    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+#define STATRECDMIN                 64            /*+ Initial number of records +*/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The method invocation record. Cost and
+    imbalance values are negative when they
+    are not relevant to the method family.  +*/
+
+typedef struct StatRecord_ {
+  const char *              typeptr;              /*+ Name of method family, e.g. "vgraph"   +*/
+  const char *              methptr;              /*+ Name of method                         +*/
+  INT                       parenum;              /*+ Index of enclosing record, or -1       +*/
+  INT                       levlnum;              /*+ Nesting level of invocation            +*/
+  INT                       vertnbr;              /*+ Number of vertices of graph or mesh    +*/
+  INT                       edgenbr;              /*+ Number of edges of graph or mesh       +*/
+  int                       retuval;              /*+ Value returned by method               +*/
+  double                    timeval;              /*+ Wall-clock time, including sub-methods +*/
+  double                    costtab[2];           /*+ Cost before and after method           +*/
+  double                    imbatab[2];           /*+ Imbalance before and after method      +*/
+} StatRecord;
+
+/*+ Statistics context. The abstract type is defined in "common.h". +*/
+
+struct StatContext_ {
+#ifdef COMMON_PTHREAD
+  pthread_mutex_t           lockdat;              /*+ Lock for concurrent sub-contexts +*/
+#endif /* COMMON_PTHREAD */
+  StatRecord *              recdtab;              /*+ Array of records                 +*/
+  INT                       recdnbr;              /*+ Number of records                +*/
+  INT                       recdmax;              /*+ Size of record array             +*/
+};
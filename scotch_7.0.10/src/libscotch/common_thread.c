@@ -1,4 +1,4 @@
-/* Copyright 2012-2015,2018,2019,2021,2022,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012-2015,2018,2019,2021,2022,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -41,7 +41,7 @@
 /**   DATES      : # Version 6.0  : from : 04 jul 2012     **/
 /**                                 to   : 27 apr 2015     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 28 sep 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -89,6 +89,40 @@ ThreadContext * const       contptr)
   return ((void *) contptr->paraptr);
 }
 
+/* This routine runs the given task within
+** the given (worker) thread context, and
+** flags it as completed.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskRun (
+ThreadContext * const       contptr,
+ThreadTask * const          taskptr)
+{
+  taskptr->funcptr (contptr, taskptr->paraptr);
+
+#ifdef COMMON_PTHREAD
+  __sync_synchronize ();                          /* Results of task must be visible before completion flag */
+  taskptr->flagval = 1;
+
+  if (contptr->poolptr != NULL) {                 /* If in work-stealing mode */
+    ThreadTaskPool * const  poolptr = contptr->poolptr;
+
+    __sync_synchronize ();                        /* Flag must be set before counting parked threads */
+    if (poolptr->idlenbr > 0) {                   /* If some threads may wait for this task         */
+      pthread_mutex_lock (&poolptr->lockdat);
+      pthread_cond_broadcast (&poolptr->conddat);
+      pthread_mutex_unlock (&poolptr->lockdat);
+    }
+  }
+#else /* COMMON_PTHREAD */
+  taskptr->flagval = 1;
+#endif /* COMMON_PTHREAD */
+}
+
 #ifdef COMMON_PTHREAD
 
 /* This routine initializes a thread context
@@ -118,6 +152,8 @@ const int * const           coretab)
   contptr->bainnum = 0;
   contptr->funcptr = NULL;
   contptr->paraptr = NULL;
+  contptr->poolptr = NULL;
+  contptr->poolnum = 0;
   contptr->thrdnbr = thrdnbr;
 
   if (thrdnbr == 1) {                             /* If no threads wanted       */
@@ -215,6 +251,10 @@ ThreadContext * const       contptr)
 ** not always available, and the cond and mutex
 ** objects already exist in the thread context,
 ** so it is more efficient to re-use them.
+** Waiting threads first poll the barrier
+** instance number for some time, and only
+** park on the condition variable if the
+** barrier has not completed meanwhile.
 ** It returns:
 ** - 0   : thread is not the last thread.
 ** - !0  : thread is the last thread.
@@ -226,7 +266,7 @@ ThreadContext * const       contptr)
 {
   int                 barrnbr;
   unsigned int        bainnum;
-  int                 o;
+  int                 spinnum;
 
   if (contptr->thrdnbr == 1)                      /* If thread system not started, return immediately */
     return (PTHREAD_BARRIER_SERIAL_THREAD);
@@ -236,24 +276,31 @@ ThreadContext * const       contptr)
   barrnbr = contptr->barrnbr + 1;
   bainnum = contptr->bainnum;
 
-  o = 0;                                          /* Assume thread will not be the last one */
-
   if (barrnbr == contptr->thrdnbr) {              /* If last thread         */
     contptr->barrnbr = 0;                         /* Reset barrier counters */
+    __sync_synchronize ();                        /* Make all previous writes visible to polling threads */
     contptr->bainnum = bainnum + 1;
-    pthread_cond_broadcast (&contptr->conddat);   /* Wake-up all sleeping threads      */
-    o = PTHREAD_BARRIER_SERIAL_THREAD;            /* Last thread returns special value */
+    pthread_cond_broadcast (&contptr->conddat);   /* Wake-up all sleeping threads */
+    pthread_mutex_unlock (&contptr->lockdat);
+    return (PTHREAD_BARRIER_SERIAL_THREAD);       /* Last thread returns special value */
   }
-  else {                                          /* Not last thread         */
-    contptr->barrnbr = barrnbr;                   /* One more thread blocked */
-    do
-      pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
-    while (contptr->bainnum == bainnum);
+
+  contptr->barrnbr = barrnbr;                     /* One more thread blocked */
+  pthread_mutex_unlock (&contptr->lockdat);
+
+  for (spinnum = THREADSPINNBR; spinnum > 0; spinnum --) { /* Poll barrier instance before parking */
+    if (contptr->bainnum != bainnum) {
+      __sync_synchronize ();
+      return (0);
+    }
   }
 
+  pthread_mutex_lock (&contptr->lockdat);         /* Park thread until barrier completes */
+  while (contptr->bainnum == bainnum)
+    pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
   pthread_mutex_unlock (&contptr->lockdat);
 
-  return (o);
+  return (0);
 }
 
 /* This routine performs a specific barrier on
@@ -271,6 +318,7 @@ ThreadContext * const       contptr)
 {
   int                 barrnbr;
   unsigned int        bainnum;
+  int                 spinnum;
 
   pthread_mutex_lock (&contptr->lockdat);
 
@@ -284,16 +332,26 @@ ThreadContext * const       contptr)
     contptr->paraptr = NULL;
 #endif /* COMMON_DEBUG */
     contptr->barrnbr = 0;                         /* Reset barrier counters */
+    __sync_synchronize ();                        /* Status must be visible before instance number */
     contptr->bainnum = bainnum + 1;
     pthread_cond_broadcast (&contptr->conddat);   /* Wake-up all sleeping threads */
+    pthread_mutex_unlock (&contptr->lockdat);
+    return;
   }
-  else {                                          /* Not last thread         */
-    contptr->barrnbr = barrnbr;                   /* One more thread blocked */
-    do
-      pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
-    while (contptr->bainnum == bainnum);
+
+  contptr->barrnbr = barrnbr;                     /* One more thread blocked */
+  pthread_mutex_unlock (&contptr->lockdat);
+
+  for (spinnum = THREADSPINNBR; spinnum > 0; spinnum --) { /* Poll barrier instance before parking */
+    if (contptr->bainnum != bainnum) {
+      __sync_synchronize ();
+      return;
+    }
   }
 
+  pthread_mutex_lock (&contptr->lockdat);         /* Park thread until barrier completes */
+  while (contptr->bainnum == bainnum)
+    pthread_cond_wait (&contptr->conddat, &contptr->lockdat);
   pthread_mutex_unlock (&contptr->lockdat);
 }
 
@@ -310,16 +368,24 @@ ThreadDescriptor * const    thrdptr)              /* Initial thread descriptor;
 {
   ThreadContextStatus statval;                    /* Status being read at wake-up time                                 */
   ThreadDescriptor    thrddat;                    /* Permanent descriptor passed to the routines of the current thread */
+  int                 spinnum;
 
   thrddat = *thrdptr;                             /* Make local copy of thread descriptor before barrier */
 
   threadContextBarrier (thrddat.contptr);         /* Wait for all threads to complete initialization */
 
   while (1) {
-    pthread_mutex_lock (&thrddat.contptr->lockdat);
-    while ((statval = thrddat.contptr->statval) == THREADCONTEXTSTATUSRDY) /* As long as nothing to do, go on sleeping */
-      pthread_cond_wait (&thrddat.contptr->conddat, &thrddat.contptr->lockdat);
-    pthread_mutex_unlock (&thrddat.contptr->lockdat);
+    for (spinnum = THREADSPINNBR;                 /* Poll status for some time before parking */
+         ((statval = thrddat.contptr->statval) == THREADCONTEXTSTATUSRDY) && (spinnum > 0); spinnum --) ;
+
+    if (statval == THREADCONTEXTSTATUSRDY) {      /* If still nothing to do, park thread */
+      pthread_mutex_lock (&thrddat.contptr->lockdat);
+      while ((statval = thrddat.contptr->statval) == THREADCONTEXTSTATUSRDY) /* As long as nothing to do, go on sleeping */
+        pthread_cond_wait (&thrddat.contptr->conddat, &thrddat.contptr->lockdat);
+      pthread_mutex_unlock (&thrddat.contptr->lockdat);
+    }
+    else
+      __sync_synchronize ();                      /* Make sure function parameters are visible */
 
     if (statval != THREADCONTEXTSTATUSRUN)        /* Exit loop if not asked to run a routine */
       break;
@@ -367,7 +433,8 @@ void * const                paraptr)              /* Function parameters */
   pthread_mutex_lock (&contptr->lockdat);         /* In case writes are not atomic */
   contptr->funcptr = funcptr;                     /* Set function parameters       */
   contptr->paraptr = paraptr;
-  contptr->statval = THREADCONTEXTSTATUSRUN;      /* Allow other threads to run */
+  __sync_synchronize ();                          /* Parameters must be visible to polling threads */
+  contptr->statval = THREADCONTEXTSTATUSRUN;      /* Allow other threads to run                    */
   pthread_cond_broadcast (&contptr->conddat);     /* Wake them up               */
   pthread_mutex_unlock (&contptr->lockdat);
 
@@ -588,6 +655,8 @@ const int                   thrdnbr)
   contptr->funcptr = NULL;
   contptr->barrnbr = 0;
   contptr->bainnum = 0;
+  contptr->poolptr = NULL;
+  contptr->poolnum = 0;
 
   if (thrdnbr == 1) {                             /* If no threads wanted       */
     contptr->statval = THREADCONTEXTSTATUSDWN;    /* Do not start thread system */
@@ -626,6 +695,311 @@ const int                   thrdnum)              /*+ Number of thread in its ou
     threadContextBarrier (contptr);
 }
 
+/*******************************************/
+/*                                         */
+/* Work-stealing task management routines. */
+/*                                         */
+/*******************************************/
+
+/* This routine, called by the master thread,
+** runs the given root task on the given thread
+** context in work-stealing mode. Every thread
+** of the context is given a private, single-
+** thread worker context and a task deque. The
+** master thread runs the root task, which may
+** spawn sub-tasks that idle threads steal from
+** the deques of busy threads. The routine
+** returns once the root task has completed.
+** If the context has only one thread or is
+** already in work-stealing mode, the root
+** task is run in sequence.
+** It returns:
+** - 0   : if the root task has been run.
+** - !0  : on error; the task has not been run.
+*/
+
+int
+threadTaskLaunch (
+ThreadContext * const       contptr,
+ThreadTaskFunc const        funcptr,              /* Root task routine    */
+void * const                paraptr)              /* Root task parameters */
+{
+  ThreadTaskPool      pooldat;
+  ThreadTask **       tasktab;
+  int                 thrdnum;
+
+  const int           thrdnbr = contptr->thrdnbr;
+
+  if ((thrdnbr <= 1) || (contptr->poolptr != NULL)) { /* If no threads available or already in work-stealing mode */
+    funcptr (contptr, paraptr);
+    return (0);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &pooldat.quettab, (size_t) (thrdnbr * sizeof (ThreadTaskQueue)),
+                     &tasktab,         (size_t) (thrdnbr * THREADTASKQUEUESIZE * sizeof (ThreadTask *)), NULL) == NULL) {
+    errorPrint ("threadTaskLaunch: out of memory");
+    return (1);
+  }
+
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    ThreadTaskQueue * const quetptr = &pooldat.quettab[thrdnum];
+
+    pthread_mutex_init (&quetptr->lockdat, NULL);
+    quetptr->tasktab = tasktab + thrdnum * THREADTASKQUEUESIZE;
+    quetptr->tasksiz = THREADTASKQUEUESIZE;
+    quetptr->headnum = 0;
+    quetptr->tasknbr = 0;
+    quetptr->flagval = 0;
+  }
+  pooldat.thrdnbr = thrdnbr;
+  pooldat.avalnbr = 0;
+  pooldat.idlenbr = 0;
+  pooldat.flagval = 0;
+  pooldat.funcptr = funcptr;
+  pooldat.paraptr = paraptr;
+  pthread_mutex_init (&pooldat.lockdat, NULL);
+  pthread_cond_init  (&pooldat.conddat, NULL);
+
+  threadLaunch (contptr, (ThreadFunc) threadTaskLaunch2, (void *) &pooldat);
+
+  pthread_cond_destroy  (&pooldat.conddat);
+  pthread_mutex_destroy (&pooldat.lockdat);
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    ThreadTaskQueue * const quetptr = &pooldat.quettab[thrdnum];
+
+    if (quetptr->flagval != 0)                    /* If deque has been reallocated */
+      memFree (quetptr->tasktab);
+    pthread_mutex_destroy (&quetptr->lockdat);
+  }
+  memFree (pooldat.quettab);                      /* Free group leader */
+
+  return (0);
+}
+
+/* This routine is run by every thread of
+** a context in work-stealing mode.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskLaunch2 (
+ThreadDescriptor * const    descptr,
+ThreadTaskPool * const      poolptr)
+{
+  ThreadContext       workdat;                    /* Single-thread context of worker thread */
+  int                 spinnum;
+
+  const int           thrdnum = threadNum (descptr);
+
+  workdat.thrdnbr = 1;                            /* Worker context behaves as a sequential context */
+  workdat.statval = THREADCONTEXTSTATUSDWN;
+  workdat.paraptr = NULL;
+  workdat.funcptr = NULL;
+  workdat.barrnbr = 0;
+  workdat.bainnum = 0;
+  workdat.poolptr = poolptr;
+  workdat.poolnum = thrdnum;
+
+  if (thrdnum == 0) {                             /* Master thread runs the root task */
+    poolptr->funcptr (&workdat, poolptr->paraptr);
+
+    pthread_mutex_lock (&poolptr->lockdat);       /* All sub-tasks have been synchronized */
+    poolptr->flagval = 1;
+    pthread_cond_broadcast (&poolptr->conddat);   /* Release parked threads */
+    pthread_mutex_unlock (&poolptr->lockdat);
+    return;
+  }
+
+  spinnum = THREADSPINNBR;
+  while (poolptr->flagval == 0) {                 /* As long as root task is running */
+    ThreadTask *        taskptr;
+
+    if ((taskptr = threadTaskGet (poolptr, thrdnum)) != NULL) {
+      threadTaskRun (&workdat, taskptr);
+      spinnum = THREADSPINNBR;
+      continue;
+    }
+    if (-- spinnum > 0)                           /* Poll deques for some time before parking */
+      continue;
+
+    threadTaskPark (poolptr, &poolptr->flagval);
+    spinnum = THREADSPINNBR;
+  }
+}
+
+/* This routine gets a task to run, first
+** from the tail of the deque of the given
+** thread and, if it is empty, from the head
+** of the deque of another thread.
+** It returns:
+** - !NULL  : pointer to the task to run.
+** - NULL   : if no task is available.
+*/
+
+static
+ThreadTask *
+threadTaskGet (
+ThreadTaskPool * const      poolptr,
+const int                   thrdnum)
+{
+  ThreadTask *        taskptr;
+  int                 thrdtmp;
+
+  const int           thrdnbr = poolptr->thrdnbr;
+
+  if (poolptr->avalnbr <= 0)                      /* If no task available, do not bother locking */
+    return (NULL);
+
+  taskptr = NULL;
+  for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) { /* Start with own deque, then try others */
+    ThreadTaskQueue * const quetptr = &poolptr->quettab[(thrdnum + thrdtmp) % thrdnbr];
+
+    if (quetptr->tasknbr <= 0)                    /* If deque seems empty, skip it */
+      continue;
+
+    pthread_mutex_lock (&quetptr->lockdat);
+    if (quetptr->tasknbr > 0) {
+      if (thrdtmp == 0)                           /* Own deque: take most recent task */
+        taskptr = quetptr->tasktab[(quetptr->headnum + quetptr->tasknbr - 1) % quetptr->tasksiz];
+      else {                                      /* Other deque: steal oldest, hence biggest, task */
+        taskptr = quetptr->tasktab[quetptr->headnum];
+        quetptr->headnum = (quetptr->headnum + 1) % quetptr->tasksiz;
+      }
+      quetptr->tasknbr --;
+    }
+    pthread_mutex_unlock (&quetptr->lockdat);
+
+    if (taskptr != NULL) {
+      __sync_fetch_and_sub (&poolptr->avalnbr, 1);
+      break;
+    }
+  }
+
+  return (taskptr);
+}
+
+/* This routine parks the calling thread
+** until tasks become available in the pool
+** or the given flag is set.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+threadTaskPark (
+ThreadTaskPool * const      poolptr,
+volatile int * const        flagptr)
+{
+  pthread_mutex_lock (&poolptr->lockdat);
+  __sync_fetch_and_add (&poolptr->idlenbr, 1);    /* Count ourselves before checking the wake-up condition */
+  while ((poolptr->avalnbr <= 0) && (*flagptr == 0))
+    pthread_cond_wait (&poolptr->conddat, &poolptr->lockdat);
+  __sync_fetch_and_sub (&poolptr->idlenbr, 1);
+  pthread_mutex_unlock (&poolptr->lockdat);
+}
+
+/* This routine spawns the given task from
+** within a worker context. The task is pushed
+** on the deque of the worker thread, from which
+** it can be stolen by idle threads. If the
+** context is not in work-stealing mode, or if
+** the deque cannot be enlarged, the task is
+** run immediately.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskSpawn (
+ThreadContext * const       contptr,
+ThreadTask * const          taskptr)
+{
+  ThreadTaskQueue *   quetptr;
+
+  ThreadTaskPool * const  poolptr = contptr->poolptr;
+
+  taskptr->flagval = 0;
+  if (poolptr == NULL) {                          /* If not in work-stealing mode */
+    threadTaskRun (contptr, taskptr);
+    return;
+  }
+
+  quetptr = &poolptr->quettab[contptr->poolnum];
+  pthread_mutex_lock (&quetptr->lockdat);
+  if (quetptr->tasknbr >= quetptr->tasksiz) {     /* If deque is full, enlarge it */
+    ThreadTask **       tasktab;
+    int                 tasknum;
+
+    if ((tasktab = memAlloc (quetptr->tasksiz * 2 * sizeof (ThreadTask *))) == NULL) {
+      pthread_mutex_unlock (&quetptr->lockdat);
+      threadTaskRun (contptr, taskptr);           /* Run task in sequence */
+      return;
+    }
+    for (tasknum = 0; tasknum < quetptr->tasknbr; tasknum ++) /* Unroll circular array */
+      tasktab[tasknum] = quetptr->tasktab[(quetptr->headnum + tasknum) % quetptr->tasksiz];
+    if (quetptr->flagval != 0)                    /* If not initial array */
+      memFree (quetptr->tasktab);
+    quetptr->tasktab  = tasktab;
+    quetptr->flagval  = 1;
+    quetptr->tasksiz *= 2;
+    quetptr->headnum  = 0;
+  }
+  quetptr->tasktab[(quetptr->headnum + quetptr->tasknbr) % quetptr->tasksiz] = taskptr;
+  quetptr->tasknbr ++;
+  pthread_mutex_unlock (&quetptr->lockdat);
+
+  __sync_fetch_and_add (&poolptr->avalnbr, 1);    /* Task can be stolen; full barrier before reading idle count */
+  if (poolptr->idlenbr > 0) {                     /* Wake-up one parked thread, if any                          */
+    pthread_mutex_lock (&poolptr->lockdat);
+    pthread_cond_signal (&poolptr->conddat);
+    pthread_mutex_unlock (&poolptr->lockdat);
+  }
+}
+
+/* This routine waits for the completion of
+** the given task, which must have been spawned
+** by the calling worker. While waiting, the
+** worker runs pending tasks, starting with its
+** own ones, so that the spawned task is run in
+** place if it has not been stolen.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+threadTaskSync (
+ThreadContext * const       contptr,
+ThreadTask * const          taskptr)
+{
+  int                 spinnum;
+
+  ThreadTaskPool * const  poolptr = contptr->poolptr;
+
+  if (poolptr == NULL)                            /* If not in work-stealing mode, task already run */
+    return;
+
+  spinnum = THREADSPINNBR;
+  while (taskptr->flagval == 0) {
+    ThreadTask *        tasktmp;
+
+    if ((tasktmp = threadTaskGet (poolptr, contptr->poolnum)) != NULL) {
+      threadTaskRun (contptr, tasktmp);
+      spinnum = THREADSPINNBR;
+      continue;
+    }
+    if (-- spinnum > 0)
+      continue;
+
+    threadTaskPark (poolptr, &taskptr->flagval);
+    spinnum = THREADSPINNBR;
+  }
+  __sync_synchronize ();                          /* Make results of task visible */
+}
+
 #endif /* COMMON_PTHREAD */
 
 /**********************************/
@@ -644,6 +1018,7 @@ const int * const           coretab)
 {
   contptr->thrdnbr = 1;                           /* Only main thread will be active */
   contptr->statval = THREADCONTEXTSTATUSDWN;      /* Thread system is not functional */
+  contptr->poolptr = NULL;
 
   return (0);
 }
@@ -741,6 +1116,7 @@ const int                   thrdnbr)
 {
   contptr->thrdnbr = 1;                           /* Only main thread will be active */
   contptr->statval = THREADCONTEXTSTATUSDWN;      /* Thread system is not functional */
+  contptr->poolptr = NULL;
 }
 
 /*
@@ -754,6 +1130,44 @@ const int                   thrdnum)              /*+ Number of thread in its ou
 {
 }
 
+/*
+**
+*/
+
+int
+threadTaskLaunch (
+ThreadContext * const       contptr,
+ThreadTaskFunc const        funcptr,              /* Root task routine    */
+void * const                paraptr)              /* Root task parameters */
+{
+  funcptr (contptr, paraptr);                     /* Run root task alone */
+
+  return (0);
+}
+
+/*
+**
+*/
+
+void
+threadTaskSpawn (
+ThreadContext * const       contptr,
+ThreadTask * const          taskptr)
+{
+  threadTaskRun (contptr, taskptr);               /* Run task in sequence */
+}
+
+/*
+**
+*/
+
+void
+threadTaskSync (
+ThreadContext * const       contptr,
+ThreadTask * const          taskptr)
+{
+}
+
 #endif /* COMMON_PTHREAD */
 
 /*****************************/
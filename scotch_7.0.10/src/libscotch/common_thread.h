@@ -1,4 +1,4 @@
-/* Copyright 2018,2019,2021,2022,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2018,2019,2021,2022,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                routines.                               **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 05 jun 2018     **/
-/**                                 to   : 06 aug 2024     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,6 +54,18 @@
 #define PTHREAD_BARRIER_SERIAL_THREAD -1
 #endif /* PTHREAD_BARRIER_SERIAL_THREAD */
 
+/*+ Number of polling rounds performed by
+    waiting threads before they park on the
+    condition variable of the context.     +*/
+
+#ifndef THREADSPINNBR
+#define THREADSPINNBR               4096
+#endif /* THREADSPINNBR */
+
+/*+ Initial size of the task deques. +*/
+
+#define THREADTASKQUEUESIZE         64
+
 /*
 **  The type and structure definitions.
 */
@@ -66,12 +78,44 @@ typedef enum ThreadContextStatus_ {
   THREADCONTEXTSTATUSDWN                          /*+ Out of order +*/
 } ThreadContextStatus;
 
+/*+ Work-stealing task deque. The owner thread
+    pushes and pops tasks at the tail, while idle
+    threads steal the oldest tasks at the head.  +*/
+
+#ifdef COMMON_PTHREAD
+typedef struct ThreadTaskQueue_ {
+  pthread_mutex_t               lockdat;          /*+ Lock for accessing the deque  +*/
+  ThreadTask **                 tasktab;          /*+ Circular array of tasks       +*/
+  int                           tasksiz;          /*+ Size of task array            +*/
+  int                           headnum;          /*+ Index of oldest task          +*/
+  volatile int                  tasknbr;          /*+ Number of queued tasks        +*/
+  int                           flagval;          /*+ Set if task array to be freed +*/
+} ThreadTaskQueue;
+
+/*+ Task pool shared by all the threads of a
+    context running in work-stealing mode.    +*/
+
+typedef struct ThreadTaskPool_ {
+  int                           thrdnbr;          /*+ Number of worker threads             +*/
+  ThreadTaskQueue *             quettab;          /*+ Array of per-thread deques           +*/
+  volatile int                  avalnbr;          /*+ Number of tasks waiting to be stolen +*/
+  volatile int                  idlenbr;          /*+ Number of parked worker threads      +*/
+  volatile int                  flagval;          /*+ Set when root task has completed     +*/
+  ThreadTaskFunc                funcptr;          /*+ Root task routine                    +*/
+  void *                        paraptr;          /*+ Root task parameters                 +*/
+  pthread_mutex_t               lockdat;          /*+ Lock for parking threads             +*/
+  pthread_cond_t                conddat;          /*+ Wake-up condition for parked threads +*/
+} ThreadTaskPool;
+#endif /* COMMON_PTHREAD */
+
 /*+ Context in which parallel tasks can be launched. The abstract type is defined in "common.h". +*/
 
 struct ThreadContext_ {
   int                           thrdnbr;          /*+ Number of threads                   +*/
   volatile ThreadContextStatus  statval;          /*+ Thread group status                 +*/
   volatile void *               paraptr;          /*+ Pointer to function parameter       +*/
+  struct ThreadTaskPool_ *      poolptr;          /*+ Task pool if in work-stealing mode  +*/
+  int                           poolnum;          /*+ Rank of worker thread in task pool  +*/
 #ifdef COMMON_PTHREAD
   volatile ThreadFunc           funcptr;          /*+ Function to call at run time        +*/
   volatile int                  barrnbr;          /*+ Number of threads currently blocked +*/
@@ -95,6 +139,9 @@ struct ThreadContext_ {
 #ifdef COMMON_PTHREAD
 static void                 threadWaitBarrier   (ThreadContext * const);
 static void *               threadWait          (ThreadDescriptor * const);
+static void                 threadTaskLaunch2   (ThreadDescriptor * const, ThreadTaskPool * const);
+static ThreadTask *         threadTaskGet       (ThreadTaskPool * const, const int);
+static void                 threadTaskPark      (ThreadTaskPool * const, volatile int * const);
 
 static int                  threadCreate        (ThreadDescriptor * const, const int, const int);
 static int                  threadProcessCoreNbr (ThreadContext * const);
@@ -102,4 +149,5 @@ static int                  threadProcessCoreNum (ThreadContext * const, int);
 static void                 threadProcessStateRestore (ThreadContext * const);
 static void                 threadProcessStateSave (ThreadContext * const);
 #endif /* COMMON_PTHREAD */
+static void                 threadTaskRun       (ThreadContext * const, ThreadTask * const);
 #endif /* SCOTCH_COMMON_THREAD */
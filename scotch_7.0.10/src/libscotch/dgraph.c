@@ -57,7 +57,7 @@
 /**                # Version 6.1  : from : 24 sep 2021     **/
 /**                                 to   : 24 sep 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -113,7 +113,9 @@ MPI_Comm                    proccomm)             /* Communicator to be used for
 ** private data if some graphs are known not to have
 ** holes.
 ** It is not a collective routine, as no communication
-** is needed to perform the freeing of memory structures.
+** is needed to perform the freeing of memory structures,
+** save when the graph owns a halo exchange plan, which
+** is freed by the collective dgraphHaloFree() routine.
 ** It returns:
 ** - VOID  : in all cases.
 */
@@ -136,17 +138,26 @@ Dgraph * restrict const     grafptr)
       if (grafptr->vlblloctax != NULL)
         memFree (grafptr->vlblloctax + grafptr->baseval);
     }
-    if (grafptr->edgeloctax != NULL)
-      memFree (grafptr->edgeloctax + grafptr->baseval);
-    if ((grafptr->flagval & DGRAPHEDGEGROUP) == 0) { /* If edge arrays not grouped */
+    if ((grafptr->flagval & DGRAPHEDGEMMAP) != 0) { /* If edge arrays mapped from file */
+      fileUnmap (grafptr->edgeloctax + grafptr->baseval);
       if (grafptr->edloloctax != NULL)
-        memFree (grafptr->edloloctax + grafptr->baseval);
+        fileUnmap (grafptr->edloloctax + grafptr->baseval);
+    }
+    else {
+      if (grafptr->edgeloctax != NULL)
+        memFree (grafptr->edgeloctax + grafptr->baseval);
+      if ((grafptr->flagval & DGRAPHEDGEGROUP) == 0) { /* If edge arrays not grouped */
+        if (grafptr->edloloctax != NULL)
+          memFree (grafptr->edloloctax + grafptr->baseval);
+      }
     }
   }
   if ((grafptr->flagval & DGRAPHFREEPSID) != 0) { /* If process send arrays must be freed */
     if (grafptr->procsidtab != NULL)
       memFree (grafptr->procsidtab);
   }
+  if ((grafptr->flagval & DGRAPHFREEHALO) != 0)   /* If halo exchange plan must be freed */
+    dgraphHaloFree (grafptr);
   if ((grafptr->flagval & DGRAPHFREEEDGEGST) != 0) { /* If ghost array must be freed */
     if (grafptr->edgegsttax != NULL)
       memFree (grafptr->edgegsttax + grafptr->baseval);
@@ -183,8 +194,10 @@ Dgraph * restrict const     grafptr)
 }
 
 /* This routine destroys a distributed graph structure.
-** It is not a collective routine, as no communication
-** is needed to perform the freeing of memory structures.
+** It is a collective routine when the graph owns its
+** communicator or a halo exchange plan, as these have
+** to be freed by all processes together. Else, no
+** communication is needed to free memory structures.
 ** Private data are always destroyed. If this is not
 ** wanted, use dgraphFree() instead.
 ** It returns:
@@ -61,7 +61,7 @@
 /**                # Version 6.1  : from : 19 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 03 may 2019     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -77,6 +77,14 @@
 #define SCOTCH_COMM_PTOP_RAT        0.25          /* Percentage under which point-to-point is allowed */
 #endif /* SCOTCH_COMM_PTOP_RAT */
 
+/* Node-aware communication, where data exchanged
+   between processes of the same shared-memory node
+   go through an MPI-3 shared-memory window.        */
+
+#if ((defined SCOTCH_COMM_NODE) && (defined MPI_VERSION) && (MPI_VERSION >= 3))
+#define DGRAPHHALONODE
+#endif /* ((defined SCOTCH_COMM_NODE) && (defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+
 /* Graph flags. */
 
 #define DGRAPHNONE                  0x0000        /* No options set */
@@ -89,12 +97,14 @@
 #define DGRAPHHASEDGEGST            0x0020        /* Edge ghost array computed           */
 #define DGRAPHVERTGROUP             0x0040        /* All vertex arrays grouped           */
 #define DGRAPHEDGEGROUP             0x0080        /* All edge arrays grouped             */
-#define DGRAPHFREEALL               (DGRAPHFREEPRIV | DGRAPHFREECOMM | DGRAPHFREETABS | DGRAPHFREEPSID | DGRAPHFREEEDGEGST)
+#define DGRAPHFREEALL               (DGRAPHFREEPRIV | DGRAPHFREECOMM | DGRAPHFREETABS | DGRAPHFREEPSID | DGRAPHFREEEDGEGST | DGRAPHFREEHALO)
 #define DGRAPHCOMMPTOP              0x0100        /* Use point-to-point collective communication */
 #define DGRAPHHASVENDLOC            0x0200        /* Graph is not compact                        */
+#define DGRAPHEDGEMMAP              0x0400        /* Edge arrays mapped from file, not grouped   */
+#define DGRAPHFREEHALO              0x0800        /* Set if halo exchange plan freed on exit     */
 
-#define DGRAPHBITSUSED              0x03FF        /* Significant bits for plain distributed graph routines               */
-#define DGRAPHBITSNOTUSED           0x0400        /* Value above which bits not used by plain distributed graph routines */
+#define DGRAPHBITSUSED              0x0FFF        /* Significant bits for plain distributed graph routines               */
+#define DGRAPHBITSNOTUSED           0x1000        /* Value above which bits not used by plain distributed graph routines */
 
 /* Used in algorithms */
 
@@ -195,6 +205,7 @@ typedef struct Dgraph_ {
   int *                     procsndtab;           /*+ Number of vertices to send in ghost vertex sub-arrays     +*/
   int *                     procsidtab;           /*+ Array of indices to build communication vectors (send)    +*/
   int                       procsidnbr;           /*+ Size of the send index array                              +*/
+  struct DgraphHaloPlan_ *  haloptr;              /*+ Halo exchange plan, built on first halo exchange          +*/
 } Dgraph;
 
 /*
@@ -234,6 +245,12 @@ int                         dgraphScatter       (Dgraph * const, const Graph * c
 #endif /* SCOTCH_GRAPH_H */
 
 int                         dgraphHaloSync      (Dgraph * const, void * const, MPI_Datatype);
+void                        dgraphHaloFree      (Dgraph * const);
+#ifdef DGRAPHHALONODE
+int                         dgraphHaloNodeInit  (Dgraph * const, const size_t, const int ** const);
+int                         dgraphHaloNodeSend  (Dgraph * const, const void * const, const size_t, const int * const, const int * const);
+int                         dgraphHaloNodeRecv  (Dgraph * const, void * const, const size_t, const int * const, int * const);
+#endif /* DGRAPHHALONODE */
 
 /*
 **  The macro definitions.
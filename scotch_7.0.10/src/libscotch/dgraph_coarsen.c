@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 17 jun 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -1371,6 +1371,16 @@ Context * restrict const              contptr)    /*+ Execution context
   }
   matedat.c.thrdmin = thrdglbmin;                 /* Minimum number of threads across all processes */
 
+#ifdef DGRAPHMATCHNODE
+  if (((finegrafptr->flagval & DGRAPHCOMMPTOP) == 0) && /* Node-aware exchanges only apply to collective synchronization */
+      (dgraphHaloNodeInit (finegrafptr, sizeof (DgraphCoarsenVert), &matedat.nodengbtab) != 0)) {
+    errorPrint        ("dgraphCoarsen: cannot initialize node-aware matching");
+    dgraphMatchExit   (&matedat);
+    dgraphCoarsenExit (&matedat.c);
+    return (2);
+  }
+#endif /* DGRAPHMATCHNODE */
+
   for (passnum = 0; passnum < passnbr; passnum ++) {
     ((passnum == 0) ? dgraphMatchHl : dgraphMatchHy) (&matedat); /* If first pass, process lightest vertices first */
 
@@ -47,7 +47,7 @@
 /**                # Version 6.1  : from : 18 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 14 sep 2021     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,8 +58,8 @@
 #include "module.h"
 #include "common.h"
 #include "dgraph.h"
-#include "dgraph_fold.h"
 #include "dgraph_fold_comm.h"
+#include "dgraph_fold.h"
 
 /******************************/
 /*                            */
@@ -68,9 +68,141 @@
 /*                            */
 /******************************/
 
+/* This routine creates the derived datatype of a
+** folding message made of several blocks, which
+** allows all the arrays relative to a given chunk
+** of vertices or edges to be sent in a single
+** message. Block displacements are relative to the
+** address of the first block, which must exist.
+** Blocks with a NULL address are skipped.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphFoldType (
+const int                   blocnbr,
+void * const * const        blocptrtab,
+const Gnum * const          bloccnttab,
+const MPI_Datatype * const  bloctyptab,
+MPI_Datatype * const        typeptr)
+{
+  MPI_Aint            typedsptab[DGRAPHFOLDBLOCNBR];
+  int                 typecnttab[DGRAPHFOLDBLOCNBR];
+  MPI_Datatype        typetyptab[DGRAPHFOLDBLOCNBR];
+  MPI_Aint            typeadrbas;
+  int                 typenbr;
+  int                 blocnum;
+
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+  MPI_Get_address (blocptrtab[0], &typeadrbas);
+#else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+  MPI_Address (blocptrtab[0], &typeadrbas);
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+  for (blocnum = typenbr = 0; blocnum < blocnbr; blocnum ++) {
+    if (blocptrtab[blocnum] == NULL)              /* Skip non-existent arrays */
+      continue;
+
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+    MPI_Get_address (blocptrtab[blocnum], &typedsptab[typenbr]);
+#else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+    MPI_Address (blocptrtab[blocnum], &typedsptab[typenbr]);
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+    typedsptab[typenbr] -= typeadrbas;
+    typecnttab[typenbr]  = (int) bloccnttab[blocnum];
+    typetyptab[typenbr]  = bloctyptab[blocnum];
+    typenbr ++;
+  }
+
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+  if ((MPI_Type_create_struct (typenbr, typecnttab, typedsptab, typetyptab, typeptr) != MPI_SUCCESS) ||
+#else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+  if ((MPI_Type_struct (typenbr, typecnttab, typedsptab, typetyptab, typeptr) != MPI_SUCCESS) ||
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+      (MPI_Type_commit (typeptr) != MPI_SUCCESS))
+    return (1);
+
+  return (0);
+}
+
+/* These routines create the derived datatypes of
+** the two messages exchanged for each folding
+** communication: the vertex message, which holds
+** the number of edges to be sent afterwards, the
+** vertex, vertex load and vertex number arrays,
+** as well as the associated data; and the edge
+** message, which holds the edge and edge load
+** arrays. Absent arrays are passed as NULL.
+** They return:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphFoldTypeVert (
+Gnum * const                edgenbrptr,           /*+ Pointer to number of edges, first block +*/
+Gnum * const                vertloctab,
+Gnum * const                veloloctab,
+Gnum * const                vnumloctab,
+void * const                dataloctab,
+const Gnum                  vertnbr,
+MPI_Datatype                datatype,
+MPI_Datatype * const        typeptr)
+{
+  void *              blocptrtab[DGRAPHFOLDBLOCNBR];
+  Gnum                bloccnttab[DGRAPHFOLDBLOCNBR];
+  MPI_Datatype        bloctyptab[DGRAPHFOLDBLOCNBR];
+
+  blocptrtab[0] = (void *) edgenbrptr;
+  bloccnttab[0] = 1;
+  bloctyptab[0] = GNUM_MPI;
+  blocptrtab[1] = (void *) vertloctab;
+  bloccnttab[1] = vertnbr;
+  bloctyptab[1] = GNUM_MPI;
+  blocptrtab[2] = (void *) veloloctab;
+  bloccnttab[2] = vertnbr;
+  bloctyptab[2] = GNUM_MPI;
+  blocptrtab[3] = (void *) vnumloctab;
+  bloccnttab[3] = vertnbr;
+  bloctyptab[3] = GNUM_MPI;
+  blocptrtab[4] = dataloctab;
+  bloccnttab[4] = vertnbr;
+  bloctyptab[4] = datatype;
+
+  return (dgraphFoldType (5, blocptrtab, bloccnttab, bloctyptab, typeptr));
+}
+
+static
+int
+dgraphFoldTypeEdge (
+Gnum * const                edgeloctab,
+Gnum * const                edloloctab,
+const Gnum                  edgenbr,
+MPI_Datatype * const        typeptr)
+{
+  void *              blocptrtab[2];
+  Gnum                bloccnttab[2];
+  MPI_Datatype        bloctyptab[2];
+
+  blocptrtab[0] = (void *) edgeloctab;
+  bloccnttab[0] = edgenbr;
+  bloctyptab[0] = GNUM_MPI;
+  blocptrtab[1] = (void *) edloloctab;
+  bloccnttab[1] = edgenbr;
+  bloctyptab[1] = GNUM_MPI;
+
+  return (dgraphFoldType (2, blocptrtab, bloccnttab, bloctyptab, typeptr));
+}
+
 /* This routine builds a folded graph by merging graph
 ** data to the processes of the first half or to the
 ** second half of the communicator.
+** When node-aware folding is enabled, halves are
+** not taken in rank order but according to a folding
+** plan, so that folding takes place within nodes.
 ** The key value of the folded communicator is not
 ** changed as it is not relevant.
 ** It returns:
@@ -87,14 +219,28 @@ const void * restrict const   orgdataptr,         /*+ Un-based array of data whi
 void ** const                 flddataptr,         /*+ Un-based array of data which must be folded, e.g. coarmulttab [norestrict] +*/
 MPI_Datatype                  datatype)
 {
+#ifdef DGRAPHFOLDNODE
+  DgraphFoldPlan    fldplandat;
+#endif /* DGRAPHFOLDNODE */
+  DgraphFoldPlan *  fldplanptr;                   /* Folding plan, or NULL if rank order used        */
   int               fldprocnbr;
   int               fldprocnum;                   /* Index of local process in folded communicator   */
   int               fldproccol;                   /* Color of receiver or not wanted in communicator */
   MPI_Comm          fldproccomm;                  /* Communicator of folded part                     */
   int               o;
 
+  fldplanptr = NULL;
+#ifdef DGRAPHFOLDNODE
+  if (dgraphFoldPlanInit (orggrafptr, &fldplandat) != 0) {
+    errorPrint ("dgraphFold: cannot compute folding plan");
+    return (1);
+  }
+  if (fldplandat.procfldtab != NULL)
+    fldplanptr = &fldplandat;
+#endif /* DGRAPHFOLDNODE */
+
   fldprocnbr = (orggrafptr->procglbnbr + 1) / 2;
-  fldprocnum = orggrafptr->proclocnum;
+  fldprocnum = (fldplanptr != NULL) ? fldplanptr->procfldtab[orggrafptr->proclocnum] : orggrafptr->proclocnum;
   if (partval == 1) {
     fldprocnum = fldprocnum - fldprocnbr;
     fldprocnbr = orggrafptr->procglbnbr - fldprocnbr;
@@ -103,15 +249,28 @@ MPI_Datatype                  datatype)
 
   if (MPI_Comm_split (orggrafptr->proccomm, fldproccol, fldprocnum, &fldproccomm) != MPI_SUCCESS) {
     errorPrint ("dgraphFold: communication error");
-    return (1);
+    o = 1;
+  }
+  else {
+    o = dgraphFold3 (orggrafptr, partval, fldgrafptr, fldproccomm, fldplanptr, orgdataptr, flddataptr, datatype);
+    fldgrafptr->pkeyglbval = fldproccol;          /* Key of folded communicator is always zero if no duplication occurs */
   }
 
-  o = dgraphFold2 (orggrafptr, partval, fldgrafptr, fldproccomm, orgdataptr, flddataptr, datatype);
-  fldgrafptr->pkeyglbval = fldproccol;            /* Key of folded communicator is always zero if no duplication occurs */
+#ifdef DGRAPHFOLDNODE
+  dgraphFoldPlanExit (&fldplandat);
+#endif /* DGRAPHFOLDNODE */
 
   return (o);
 }
 
+/* This routine folds a graph according to
+** rank order, on the folded communicator
+** provided by the caller.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
 int
 dgraphFold2 (
 const Dgraph * restrict const orggrafptr,
@@ -121,6 +280,32 @@ MPI_Comm                      fldproccomm,
 const void * restrict const   orgdataptr,         /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
 void ** const                 flddataptr,         /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
 MPI_Datatype                  datatype)
+{
+  return (dgraphFold3 (orggrafptr, partval, fldgrafptr, fldproccomm, NULL, orgdataptr, flddataptr, datatype));
+}
+
+/* This routine folds a graph on the folded
+** communicator provided by the caller, the
+** halves of which are defined by the given
+** folding plan, or by rank order if it is NULL.
+** For each communication, graph data are sent
+** as two messages only, one for vertex data and
+** one for edge data, by means of derived datatypes.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphFold3 (
+const Dgraph * restrict const         orggrafptr,
+const int                             partval,    /*+ 0 for first half, 1 for second half                          +*/
+Dgraph * const                        fldgrafptr, /*+ Folded graph structure to fill [norestrict:async]            +*/
+MPI_Comm                              fldproccomm,
+const DgraphFoldPlan * restrict const planptr,    /*+ Folding plan, or NULL for rank order                         +*/
+const void * restrict const           orgdataptr, /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
+void ** const                         flddataptr, /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
+MPI_Datatype                          datatype)
 {
   Gnum * restrict               orgvertloctax;    /* Pointer to (possible compacted) vertex array                     */ 
   Gnum * restrict               orgedgeloctax;    /* Pointer to (possible compacted) edge array                       */
@@ -152,7 +337,7 @@ MPI_Datatype                  datatype)
 
   if ((orggrafptr->flagval & DGRAPHHASVENDLOC) != 0) { /* If graph is not compact */
     if (dgraphCompact2 (orggrafptr, &orgvertloctax, &orgedgeloctax, &orgedloloctax) != 0) {
-      errorPrint ("dgraphFold2: cannot compact graph");
+      errorPrint ("dgraphFold3: cannot compact graph");
       return (1);
     }
   }
@@ -163,12 +348,11 @@ MPI_Datatype                  datatype)
   }
 
   fldprocglbnbr = (orggrafptr->procglbnbr + 1) / 2;
+  fldproclocnum = (planptr != NULL) ? planptr->procfldtab[orggrafptr->proclocnum] : orggrafptr->proclocnum;
   if (partval == 1) {
-    fldproclocnum = orggrafptr->proclocnum - fldprocglbnbr;
+    fldproclocnum = fldproclocnum - fldprocglbnbr;
     fldprocglbnbr = orggrafptr->procglbnbr - fldprocglbnbr;
   }
-  else
-    fldproclocnum = orggrafptr->proclocnum;
 
   fldcommtypval = ((fldproclocnum >= 0) && (fldproclocnum < fldprocglbnbr)) ? DGRAPHFOLDCOMMRECV : DGRAPHFOLDCOMMSEND;
   if (orgdataptr != NULL)
@@ -180,11 +364,11 @@ MPI_Datatype                  datatype)
   if (fldcommtypval == DGRAPHFOLDCOMMRECV) {      /* If we are going to receive */
 #ifdef SCOTCH_DEBUG_DGRAPH2
     if (fldgrafptr == NULL) {
-      errorPrint ("dgraphFold2: invalid parameters (1)");
+      errorPrint ("dgraphFold3: invalid parameters (1)");
       return (1);
     }
     if (fldproccomm == MPI_COMM_NULL) {
-      errorPrint ("dgraphFold2: invalid parameters (2)");
+      errorPrint ("dgraphFold3: invalid parameters (2)");
       return (1);
     }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
@@ -202,12 +386,12 @@ MPI_Datatype                  datatype)
                        &fldgrafptr->procngbtab, (size_t) (fldprocglbnbr       * sizeof (int)),
                        &fldgrafptr->procrcvtab, (size_t) (fldprocglbnbr       * sizeof (int)),
                        &fldgrafptr->procsndtab, (size_t) (fldprocglbnbr       * sizeof (int)), NULL) == NULL) {
-      errorPrint ("dgraphFold2: out of memory (1)");
+      errorPrint ("dgraphFold3: out of memory (1)");
       cheklocval = 1;
     }
-    else if (dgraphFoldComm (orggrafptr, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
+    else if (dgraphFoldComm (orggrafptr, partval, planptr, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
                              fldgrafptr->proccnttab, &fldvertadjnbr, &fldvertadjtab, &fldvertdlttab) != 0) {
-      errorPrint ("dgraphFold2: cannot compute folding communications (1)");
+      errorPrint ("dgraphFold3: cannot compute folding communications (1)");
       cheklocval = 1;
     }
     else {
@@ -240,7 +424,7 @@ MPI_Datatype                  datatype)
                          &fldgrafptr->vertloctax, (size_t) ((fldvertlocnbr + 1) * sizeof (Gnum)),
                          &fldgrafptr->vnumloctax, (size_t) ( fldvertlocnbr      * sizeof (Gnum)),
                          &fldgrafptr->veloloctax, (size_t) ( fldvelolocnbr      * sizeof (Gnum)), NULL) == NULL) {
-        errorPrint ("dgraphFold2: out of memory (2)");
+        errorPrint ("dgraphFold3: out of memory (2)");
         cheklocval = 1;
       }
       else if (fldgrafptr->vertloctax -= orggrafptr->baseval,
@@ -249,13 +433,13 @@ MPI_Datatype                  datatype)
                fldgrafptr->veloloctax  = ((orggrafptr->veloloctax != NULL) ? (fldgrafptr->veloloctax - orggrafptr->baseval) : NULL),
                fldedlolocsiz = ((orgedloloctax != NULL) ? fldedgelocsiz : 0),
                (fldgrafptr->edgeloctax = memAlloc ((fldedgelocsiz + fldedlolocsiz) * sizeof (Gnum))) == NULL) { /* Allocate single array for both edge arrays */
-        errorPrint ("dgraphFold2: out of memory (3)");
+        errorPrint ("dgraphFold3: out of memory (3)");
         cheklocval = 1;
       }
       else {
         if (orgdataptr != NULL) {
           if ((*flddataptr = (byte *) memAlloc (fldvertlocnbr * infosiz)) == NULL) {
-            errorPrint ("dgraphFold2: out of memory (4)");
+            errorPrint ("dgraphFold3: out of memory (4)");
             cheklocval = 1;
           }
         }
@@ -266,13 +450,13 @@ MPI_Datatype                  datatype)
   else {                                          /* Process is a sender */
 #ifdef SCOTCH_DEBUG_HDGRAPH2
     if (fldproccomm != MPI_COMM_NULL) {
-      errorPrint ("dgraphFold2: invalid parameters (3)");
+      errorPrint ("dgraphFold3: invalid parameters (3)");
       return (1);
     }
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
 
-    if (dgraphFoldComm (orggrafptr, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
-      errorPrint ("dgraphFold2: cannot compute folding communications (2)");
+    if (dgraphFoldComm (orggrafptr, partval, planptr, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
+      errorPrint ("dgraphFold3: cannot compute folding communications (2)");
       cheklocval = 1;
     }
   }
@@ -284,13 +468,13 @@ MPI_Datatype                  datatype)
                       &fldedgecnttab, (size_t) (commmax * sizeof (Gnum)),
                       &fldedgecnptab, (size_t) (commmax * sizeof (Gnum)),
                       &requtab,       (size_t) (commmax * DGRAPHFOLDTAGNBR * sizeof (MPI_Request)), NULL) == NULL)) {
-    errorPrint ("dgraphFold2: out of memory (5)");
+    errorPrint ("dgraphFold3: out of memory (5)");
     cheklocval = 1;
   }
 
 #ifdef SCOTCH_DEBUG_DGRAPH1                       /* Communication cannot be merged with a useful one */
   if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, orggrafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphFold2: communication error (1)");
+    errorPrint ("dgraphFold3: communication error (1)");
     chekglbval = 1;
   }
 #else /* SCOTCH_DEBUG_DGRAPH1 */
@@ -325,59 +509,44 @@ MPI_Datatype                  datatype)
       fldedgeidxtab[i] = orgvertloctax[vertsndbas];
       fldedgecnptab[i] =                          /* Save fldedgecnttab in temporary array to read it while MPI communication in progress */
       fldedgecnttab[i] = orgvertloctax[vertsndbas + vertsndnbr] - orgvertloctax[vertsndbas]; /* Graph is compact        */
-      if (MPI_Isend (&fldedgecnptab[i], 1, GNUM_MPI, fldcommdattab[i].procnum,
-                     TAGFOLD + TAGVLBLLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
-        errorPrint ("dgraphFold2: communication error (2)");
-        cheklocval = 1;
-      }
     }
     commnbr = i;
 
     for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-      if (MPI_Isend (orgvertloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, fldcommdattab[i].procnum,
-                     TAGFOLD + TAGVERTLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
-        errorPrint ("dgraphFold2: communication error (3)");
+      MPI_Datatype      typedat;                  /* Datatype of vertex message */
+
+      if (dgraphFoldTypeVert (&fldedgecnptab[i], orgvertloctax + fldvertidxtab[i],
+                              (orggrafptr->veloloctax != NULL) ? (orggrafptr->veloloctax + fldvertidxtab[i]) : NULL,
+                              (orggrafptr->vnumloctax != NULL) ? (orggrafptr->vnumloctax + fldvertidxtab[i]) : NULL,
+                              (orgdataptr != NULL) ? ((byte *) orgdataptr + ((fldvertidxtab[i] - orggrafptr->baseval) * infosiz)) : NULL,
+                              fldcommdattab[i].vertnbr, datatype, &typedat) != 0) {
+        errorPrint ("dgraphFold3: communication error (2)");
         cheklocval = 1;
+        break;
       }
-    }
-    for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-      if (MPI_Isend (orgedgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                     TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
-        errorPrint ("dgraphFold2: communication error (4)");
+      if (MPI_Isend (&fldedgecnptab[i], 1, typedat, fldcommdattab[i].procnum,
+                     TAGFOLD + TAGVERTLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
+        errorPrint ("dgraphFold3: communication error (3)");
         cheklocval = 1;
       }
-    }
-    if (orggrafptr->veloloctax != NULL) {
-      for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-        if  (MPI_Isend (orggrafptr->veloloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, fldcommdattab[i].procnum,
-                        TAGFOLD + TAGVELOLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
-          errorPrint ("dgraphFold2: communication error (5)");
-          cheklocval = 1;
-        }
-      }
+      MPI_Type_free (&typedat);                   /* Pending communications are not affected */
     }
     for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-      int               procsndnum;               /* Rank of process to send to */
+      MPI_Datatype      typedat;                  /* Datatype of edge message */
 
-      procsndnum = fldcommdattab[i].procnum;
-      if ((orgedloloctax != NULL) &&
-          (MPI_Isend (orgedloloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, procsndnum,
-                      TAGFOLD + TAGEDLOLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
-        errorPrint ("dgraphFold2: communication error (6)");
-        cheklocval = 1;
-      }
-      else if ((orggrafptr->vnumloctax != NULL) &&
-               (MPI_Isend (orggrafptr->vnumloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, procsndnum,
-                           TAGFOLD + TAGVNUMLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
-        errorPrint ("dgraphFold2: communication error (7)");
+      if (dgraphFoldTypeEdge (orgedgeloctax + fldedgeidxtab[i],
+                              (orgedloloctax != NULL) ? (orgedloloctax + fldedgeidxtab[i]) : NULL,
+                              fldedgecnttab[i], &typedat) != 0) {
+        errorPrint ("dgraphFold3: communication error (4)");
         cheklocval = 1;
+        break;
       }
-      else if ((orgdataptr != NULL)  &&
-               (MPI_Isend ((byte *) orgdataptr + ((fldvertidxtab[i] - orggrafptr->baseval) * infosiz), fldcommdattab[i].vertnbr, datatype, procsndnum,
-                           TAGFOLD + TAGDATALOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
-        errorPrint ("dgraphFold2: communication error (8)");
+      if (MPI_Isend (orgedgeloctax + fldedgeidxtab[i], 1, typedat, fldcommdattab[i].procnum,
+                     TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS) {
+        errorPrint ("dgraphFold3: communication error (5)");
         cheklocval = 1;
       }
+      MPI_Type_free (&typedat);
     }
   }                                               /* Communications of sender-receivers will be completed in the receiving phase */
 
@@ -413,74 +582,57 @@ MPI_Datatype                  datatype)
         fldvertrcvnbr  = fldcommdattab[i].vertnbr;
 
         fldvertidxtab[i] = fldvertrcvbas;
-        if (MPI_Irecv (&fldedgecnttab[i], 1, GNUM_MPI, fldcommdattab[i].procnum,
-                       TAGFOLD + TAGVLBLLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGENBR * commmax + i]) != MPI_SUCCESS) {
-          errorPrint ("dgraphFold2: communication error (9)");
+      }
+      for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
+        MPI_Datatype        typedat;              /* Datatype of vertex message */
+
+        if (dgraphFoldTypeVert (&fldedgecnttab[i], fldgrafptr->vertloctax + fldvertidxtab[i],
+                                (orggrafptr->veloloctax != NULL) ? (fldgrafptr->veloloctax + fldvertidxtab[i]) : NULL,
+                                (orggrafptr->vnumloctax != NULL) ? (fldgrafptr->vnumloctax + fldvertidxtab[i]) : NULL,
+                                (orgdataptr != NULL) ? ((byte *) (*flddataptr) + ((fldvertidxtab[i] - orggrafptr->baseval) * infosiz)) : NULL,
+                                fldcommdattab[i].vertnbr, datatype, &typedat) != 0) {
+          errorPrint ("dgraphFold3: communication error (6)");
           cheklocval = 1;
+          break;
         }
-      }
-
-      for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) { /* Let these communications progress while we process the edge size messages */
-        if (MPI_Irecv (fldgrafptr->vertloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, fldcommdattab[i].procnum,
+        if (MPI_Irecv (&fldedgecnttab[i], 1, typedat, fldcommdattab[i].procnum,
                        TAGFOLD + TAGVERTLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGVERT * commmax + i]) != MPI_SUCCESS) {
-          errorPrint ("dgraphFold2: communication error (10)");
+          errorPrint ("dgraphFold3: communication error (7)");
           cheklocval = 1;
         }
+        MPI_Type_free (&typedat);
       }
 
-      MPI_Waitall (commnbr, &requtab[DGRAPHFOLDTAGENBR * commmax], MPI_STATUSES_IGNORE);
+      if (MPI_Waitall (commnbr, &requtab[DGRAPHFOLDTAGVERT * commmax], MPI_STATUSES_IGNORE) != MPI_SUCCESS) { /* Edge counts are needed to place edge sub-arrays */
+        errorPrint ("dgraphFold3: communication error (8)");
+        cheklocval = 1;
+      }
 
-      for (i = 0, fldedgelocbas = orgvertloctax[orggrafptr->vertlocnnd]; (i < commnbr) && (cheklocval == 0); i ++) {
+      for (i = 0, fldedgelocbas = orgvertloctax[orggrafptr->vertlocnnd]; i < commnbr; i ++) {
         fldedgeidxtab[i] = fldedgelocbas;
         fldedgelocbas += fldedgecnttab[i];
-
-        if (MPI_Irecv (fldgrafptr->edgeloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                       TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDGE * commmax + i]) != MPI_SUCCESS) {
-          errorPrint ("dgraphFold2: communication error (11)");
-          cheklocval = 1;
-        }
       }
       fldgrafptr->edgelocnbr =                    /* Get number of local edges */
       fldgrafptr->edgelocsiz = fldedgelocbas - orggrafptr->baseval;
-
-      if (orggrafptr->veloloctax != NULL) {
-        for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-          if (MPI_Irecv (fldgrafptr->veloloctax + fldvertidxtab[i], fldcommdattab[i].vertnbr, GNUM_MPI, fldcommdattab[i].procnum,
-                         TAGFOLD + TAGVELOLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGVELO * commmax + i]) != MPI_SUCCESS) {
-            errorPrint ("dgraphFold2: communication error (12)");
-            cheklocval = 1;
-          }
-        }
-      }
-      if (orgedloloctax != NULL) {
+      if (orgedloloctax != NULL)
         fldgrafptr->edloloctax = fldgrafptr->edgeloctax + fldgrafptr->edgelocnbr; /* Set start index of edge load array */
 
-        for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-          if (MPI_Irecv (fldgrafptr->edloloctax + fldedgeidxtab[i], fldedgecnttab[i], GNUM_MPI, fldcommdattab[i].procnum,
-                         TAGFOLD + TAGEDLOLOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDLO * commmax + i]) != MPI_SUCCESS) {
-            errorPrint ("dgraphFold2: communication error (13)");
-            cheklocval = 1;
-          }
-        }
-      }
       for (i = 0; (i < commnbr) && (cheklocval == 0); i ++) {
-        int               procrcvnum;             /* Rank of process to receive from */
-        Gnum              vertrcvnbr;
-
-        procrcvnum = fldcommdattab[i].procnum;
-        vertrcvnbr = fldcommdattab[i].vertnbr;
-        if ((orggrafptr->vnumloctax != NULL) &&
-            (MPI_Irecv (fldgrafptr->vnumloctax + fldvertidxtab[i], vertrcvnbr, GNUM_MPI, procrcvnum,
-                        TAGFOLD + TAGVNUMLOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
-          errorPrint ("dgraphFold2: communication error (14)");
+        MPI_Datatype        typedat;              /* Datatype of edge message */
+
+        if (dgraphFoldTypeEdge (fldgrafptr->edgeloctax + fldedgeidxtab[i],
+                                (orgedloloctax != NULL) ? (fldgrafptr->edloloctax + fldedgeidxtab[i]) : NULL,
+                                fldedgecnttab[i], &typedat) != 0) {
+          errorPrint ("dgraphFold3: communication error (9)");
           cheklocval = 1;
+          break;
         }
-        else if ((orgdataptr != NULL) &&
-                 (MPI_Irecv ((byte *) (*flddataptr) + ((fldvertidxtab[i] - orggrafptr->baseval) * infosiz), vertrcvnbr, datatype, procrcvnum,
-                             TAGFOLD + TAGDATALOCTAB, orggrafptr->proccomm, &requtab[requnbr ++]) != MPI_SUCCESS)) {
-          errorPrint ("dgraphFold2: communication error (15)");
+        if (MPI_Irecv (fldgrafptr->edgeloctax + fldedgeidxtab[i], 1, typedat, fldcommdattab[i].procnum,
+                       TAGFOLD + TAGEDGELOCTAB, orggrafptr->proccomm, &requtab[DGRAPHFOLDTAGEDGE * commmax + i]) != MPI_SUCCESS) {
+          errorPrint ("dgraphFold3: communication error (10)");
           cheklocval = 1;
         }
+        MPI_Type_free (&typedat);
       }
 
       orgvertlocnbr = orggrafptr->vertlocnbr;     /* Process all local vertices */
@@ -590,26 +742,18 @@ MPI_Datatype                  datatype)
     if (orgdataptr != NULL)                       /* If additional data present */
       memCpy ((byte *) (*flddataptr), (byte *) orgdataptr, orgvertlocnbr * infosiz); /* Copy local part */
 
-    for (i = 0; i < commnbr; i ++) {
-      int               j;
-
-      if (MPI_Waitany (commnbr, &requtab[DGRAPHFOLDTAGVERT * commmax], &j, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
-        errorPrint ("dgraphFold2: communication error (16)");
-        cheklocval = 1;
-      }
-      else {                                      /* Adjust first remote part of vertex array */
-        Gnum              fldvertlocnum;
-        Gnum              fldvertlocnnd;
-        Gnum              fldvertlocadj;
+    for (i = 0; i < commnbr; i ++) {              /* Adjust remote parts of vertex array, which have already been received */
+      Gnum              fldvertlocnum;
+      Gnum              fldvertlocnnd;
+      Gnum              fldvertlocadj;
 
-        Gnum * restrict const fldvertloctax = fldgrafptr->vertloctax;
+      Gnum * restrict const fldvertloctax = fldgrafptr->vertloctax;
 
-        fldvertlocnum = fldvertidxtab[j];
-        fldvertlocadj = fldedgeidxtab[j] - fldgrafptr->vertloctax[fldvertlocnum];
+      fldvertlocnum = fldvertidxtab[i];
+      fldvertlocadj = fldedgeidxtab[i] - fldgrafptr->vertloctax[fldvertlocnum];
 
-        for (fldvertlocnnd = fldvertlocnum + fldcommdattab[j].vertnbr; fldvertlocnum < fldvertlocnnd; fldvertlocnum ++)
-          fldvertloctax[fldvertlocnum] += fldvertlocadj;
-      }
+      for (fldvertlocnnd = fldvertlocnum + fldcommdattab[i].vertnbr; fldvertlocnum < fldvertlocnnd; fldvertlocnum ++)
+        fldvertloctax[fldvertlocnum] += fldvertlocadj;
     }
 
     for (i = 0; i < commnbr; i ++) {
@@ -617,7 +761,7 @@ MPI_Datatype                  datatype)
       int               j;
 
       if (MPI_Waitany (commnbr, &requtab[DGRAPHFOLDTAGEDGE * commmax], &j, &statdat) != MPI_SUCCESS) {
-        errorPrint ("dgraphFold2: communication error (17)");
+        errorPrint ("dgraphFold3: communication error (11)");
         cheklocval = 1;
       }
       else if (cheklocval == 0) {                 /* Adjust remote part(s) of edge array */
@@ -631,9 +775,9 @@ MPI_Datatype                  datatype)
 #ifdef SCOTCH_DEBUG_DGRAPH2
         int               fldedgercvnbr;
 
-        MPI_Get_count (&statdat, GNUM_MPI, &fldedgercvnbr);
-        if (fldedgercvnbr != fldedgecnttab[j]) {
-          errorPrint  ("dgraphFold2: internal error (1)");
+        MPI_Get_elements (&statdat, GNUM_MPI, &fldedgercvnbr); /* Edge loads, if any, are part of edge message */
+        if (fldedgercvnbr != (fldedgecnttab[j] * ((orgedloloctax != NULL) ? 2 : 1))) {
+          errorPrint  ("dgraphFold3: internal error (1)");
           return (1);
         }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
@@ -658,7 +802,7 @@ MPI_Datatype                  datatype)
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
           if (fldedgelocnum >= (fldgrafptr->edgelocnbr + orggrafptr->baseval)) {
-            errorPrint  ("dgraphFold2: internal error (2)");
+            errorPrint  ("dgraphFold3: internal error (2)");
             return (1);
           }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
@@ -691,21 +835,13 @@ MPI_Datatype                  datatype)
     if (orggrafptr->veloloctax == NULL)           /* If no vertex loads, reset graph vertex load to number of vertices */
       fldvelolocsum = fldvertlocnbr;
     else {                                        /* Graph has vertex loads and load of local part has already been computed */
-      for (i = 0; i < commnbr; i ++) {
-        int               j;
-
-        if (MPI_Waitany (commnbr, &requtab[DGRAPHFOLDTAGVELO * commmax], &j, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
-          errorPrint ("dgraphFold2: communication error (18)");
-          cheklocval = 1;
-        }
-        else if (cheklocval == 0) {               /* Accumulate vertex loads for received vertex load array */
-          Gnum              fldvertlocnum;
-          Gnum              fldvertlocnnd;
+      for (i = 0; i < commnbr; i ++) {            /* Accumulate vertex loads of received vertex load arrays */
+        Gnum              fldvertlocnum;
+        Gnum              fldvertlocnnd;
 
-          for (fldvertlocnum = fldvertidxtab[j], fldvertlocnnd = fldvertlocnum + fldcommdattab[j].vertnbr;
-               fldvertlocnum < fldvertlocnnd; fldvertlocnum ++)
-            fldvelolocsum += fldgrafptr->veloloctax[fldvertlocnum];
-        }
+        for (fldvertlocnum = fldvertidxtab[i], fldvertlocnnd = fldvertlocnum + fldcommdattab[i].vertnbr;
+             fldvertlocnum < fldvertlocnnd; fldvertlocnum ++)
+          fldvelolocsum += fldgrafptr->veloloctax[fldvertlocnum];
       }
     }
 
@@ -713,13 +849,8 @@ MPI_Datatype                  datatype)
       Gnum                fldedgeloctmp;
 
       fldedgeloctmp = fldgrafptr->edgelocnbr;
-      if (orgedloloctax != NULL) {
+      if (orgedloloctax != NULL)
         fldedgeloctmp *= 2;
-        if (MPI_Waitall (commnbr, &requtab[DGRAPHFOLDTAGEDLO * commmax], MPI_STATUSES_IGNORE) != MPI_SUCCESS) { /* Wait for edge load sub-arrays */
-          errorPrint ("dgraphFold2: communication error (19)");
-          cheklocval = 1;
-        }
-      }
 
       fldgrafptr->edgeloctax  = memRealloc (fldgrafptr->edgeloctax + orggrafptr->baseval, fldedgeloctmp * sizeof (Gnum));
       fldgrafptr->edgeloctax -= orggrafptr->baseval;
@@ -733,14 +864,14 @@ MPI_Datatype                  datatype)
     fldgrafptr->velolocsum = fldvelolocsum;
     fldgrafptr->degrglbmax = orggrafptr->degrglbmax;
     if (dgraphBuild4 (fldgrafptr) != 0) {
-      errorPrint ("dgraphFold2: cannot build folded graph");
+      errorPrint ("dgraphFold3: cannot build folded graph");
       dgraphExit (fldgrafptr);
       return (1);
     }
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
     if (dgraphCheck (fldgrafptr) != 0) {          /* Check graph consistency; vnumloctab is not checked so no need to wait for it */
-      errorPrint ("dgraphFold2: internal error (3)");
+      errorPrint ("dgraphFold3: internal error (3)");
       dgraphExit (fldgrafptr);
       return (1);
     }
@@ -750,7 +881,7 @@ MPI_Datatype                  datatype)
   memFree (fldcommdattab);                        /* Free group leader */
 
   if (MPI_Waitall (requnbr, requtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS) { /* Wait for all graph data to arrive because graph could be freed afterwards */
-    errorPrint ("dgraphFold2: communication error (20)");
+    errorPrint ("dgraphFold3: communication error (12)");
     cheklocval = 1;
   }
 
@@ -760,7 +891,7 @@ MPI_Datatype                  datatype)
 
 #ifdef SCOTCH_DEBUG_DGRAPH1                       /* Communication cannot be merged with a useful one */
   if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, orggrafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphFold2: communication error (21)");
+    errorPrint ("dgraphFold3: communication error (13)");
     chekglbval = 1;
   }
 #else /* SCOTCH_DEBUG_DGRAPH1 */
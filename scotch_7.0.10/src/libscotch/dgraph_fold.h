@@ -43,6 +43,8 @@
 /**                                 to   : 06 sep 2006     **/
 /**                # Version 5.1  : from : 31 dec 2008     **/
 /**                                 to   : 01 jan 2009     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -53,15 +55,19 @@
 /* Slot indices used for point-to-point folding
    communications. First indices are used for
    communications without further processing.
-   At the moment, there are two anonymous slots:
-   the first one for vnumloctab, and the second
-   one for vertinfotab.                          */
+   At the moment, there are two anonymous slots,
+   used by senders for their vertex and edge
+   messages. The vertex message holds the edge
+   count, vertloctab, veloloctab, vnumloctab and
+   vertinfotab; the edge message holds edgeloctab
+   and edloloctab.                               */
 
 typedef enum DgraphFoldTag_ {
-  DGRAPHFOLDTAGENBR = 2,                          /*+ Edge size message  +*/
-  DGRAPHFOLDTAGVERT,                              /*+ vertloctab message +*/
-  DGRAPHFOLDTAGVELO,                              /*+ veloloctab message +*/
-  DGRAPHFOLDTAGEDGE,                              /*+ edgeloctab message +*/
-  DGRAPHFOLDTAGEDLO,                              /*+ edgeloctab message +*/
-  DGRAPHFOLDTAGNBR                                /*+ Number of tags     +*/
+  DGRAPHFOLDTAGVERT = 2,                          /*+ Vertex message +*/
+  DGRAPHFOLDTAGEDGE,                              /*+ Edge message   +*/
+  DGRAPHFOLDTAGNBR                                /*+ Number of tags +*/
 } DgraphFoldTag;
+
+/*+ Maximum number of blocks in a folding message. +*/
+
+#define DGRAPHFOLDBLOCNBR           5
@@ -44,7 +44,7 @@
 /**                # Version 5.1  : from : 18 jan 2009     **/
 /**                                 to   : 10 sep 2011     **/
 /**                # Version 7.0  : from : 18 jun 2023     **/
-/**                                 to   : 12 aug 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -107,11 +107,170 @@ const int                     flagval)            /*+ Coarsening type
   return (coarvertlocmax);
 }
 
+#ifdef DGRAPHFOLDNODE
+
+/* This routine computes a node-aware folding
+** plan. Processes are ordered by node and, within
+** nodes, by rank, and are then alternately assigned
+** to part 0 and part 1. Hence, each node hosts about
+** as many processes of each part, and folding data
+** can be exchanged within nodes. When all processes
+** are on the same node, or on distinct nodes, there
+** is nothing to gain, and the plan is not created.
+** For testing purposes, node boundaries can be
+** forced by way of the "SCOTCH_COMM_NODE_SIZE"
+** environment variable, which gives the number of
+** consecutive ranks to be grouped in every node.
+** It returns:
+** - 0   : on success; procfldtab is NULL if
+**         rank order is to be used.
+** - !0  : on error.
+*/
+
+int
+dgraphFoldPlanInit (
+const Dgraph * restrict const     grafptr,
+DgraphFoldPlan * restrict const   planptr)
+{
+  MPI_Comm            nodecomm;
+  int                 nodesiz;                    /* Forced number of processes per node, if positive        */
+  int *               nodecnttab;                 /* Number of processes per node, then start index of nodes */
+  int                 nodeglbnum;                 /* Node index of local process: smallest rank on the node  */
+  int                 nodeglbnbr;
+  int                 procfldnbr;                 /* Number of processes in part 0 */
+  int                 procnum;
+  int                 sortnum;
+  int                 cheklocval;
+  int                 chekglbval;
+
+  const int           procglbnbr = grafptr->procglbnbr;
+
+  planptr->procfldtab = NULL;                     /* Assume rank order will be used */
+
+  nodesiz = envGetInt ("SCOTCH_COMM_NODE_SIZE", 0);
+  if (nodesiz > 0)                                /* If node boundaries forced */
+    nodeglbnum = grafptr->proclocnum - (grafptr->proclocnum % nodesiz);
+  else if ((MPI_Comm_split_type (grafptr->proccomm, MPI_COMM_TYPE_SHARED, grafptr->proclocnum, MPI_INFO_NULL, &nodecomm) != MPI_SUCCESS) ||
+           (MPI_Allreduce (&grafptr->proclocnum, &nodeglbnum, 1, MPI_INT, MPI_MIN, nodecomm) != MPI_SUCCESS) ||
+           (MPI_Comm_free (&nodecomm) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFoldPlanInit: communication error (1)");
+    return (1);
+  }
+
+  cheklocval = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &planptr->procfldtab, (size_t) (procglbnbr * sizeof (int)),
+                     &planptr->procordtab, (size_t) (procglbnbr * sizeof (int)),
+                     &planptr->procnodtab, (size_t) (procglbnbr * sizeof (int)),
+                     &nodecnttab,          (size_t) (procglbnbr * sizeof (int)), NULL) == NULL) {
+    errorPrint ("dgraphFoldPlanInit: out of memory");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphFoldPlanInit: communication error (2)");
+    chekglbval = 1;
+  }
+  if ((chekglbval == 0) &&
+      (MPI_Allgather (&nodeglbnum, 1, MPI_INT, planptr->procnodtab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFoldPlanInit: communication error (3)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (planptr->procfldtab != NULL) {
+      memFree (planptr->procfldtab);              /* Free group leader */
+      planptr->procfldtab = NULL;
+    }
+    return (1);
+  }
+
+  memSet (nodecnttab, 0, procglbnbr * sizeof (int));
+  for (procnum = nodeglbnbr = 0; procnum < procglbnbr; procnum ++) {
+    int                 nodenum;
+
+    nodenum = planptr->procnodtab[procnum];
+    if (nodenum == procnum)                       /* Process is the first of its node */
+      nodeglbnbr ++;
+    nodecnttab[nodenum] ++;
+  }
+  if ((nodeglbnbr == 1) || (nodeglbnbr == procglbnbr)) { /* If no locality to take advantage of */
+    memFree (planptr->procfldtab);
+    planptr->procfldtab = NULL;
+    return (0);
+  }
+
+  for (procnum = sortnum = 0; procnum < procglbnbr; procnum ++) { /* Compute start index of each node in sorted order */
+    int                 nodecnt;
+
+    nodecnt = nodecnttab[procnum];
+    nodecnttab[procnum] = sortnum;
+    sortnum += nodecnt;
+  }
+  for (procnum = 0; procnum < procglbnbr; procnum ++) /* Sort processes by node, then by rank */
+    planptr->procordtab[nodecnttab[planptr->procnodtab[procnum]] ++] = procnum;
+
+  procfldnbr = (procglbnbr + 1) / 2;
+  for (sortnum = 0; sortnum < procglbnbr; sortnum ++) { /* Alternately assign sorted processes to both parts */
+    procnum = planptr->procordtab[sortnum];
+    planptr->procfldtab[procnum] = ((sortnum & 1) == 0) ? (sortnum / 2) : (procfldnbr + sortnum / 2);
+  }
+  for (procnum = 0; procnum < procglbnbr; procnum ++) /* Build inverse permutation */
+    planptr->procordtab[planptr->procfldtab[procnum]] = procnum;
+
+  return (0);
+}
+
+/* This routine frees a folding plan.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+dgraphFoldPlanExit (
+DgraphFoldPlan * restrict const planptr)
+{
+  if (planptr->procfldtab != NULL)
+    memFree (planptr->procfldtab);                /* Free group leader */
+}
+
+#endif /* DGRAPHFOLDNODE */
+
+/* This routine sorts by ascending number of
+** vertices each of the runs of consecutive
+** processes that belong to the same node.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+dgraphFoldCommSort (
+DgraphFoldCommData * restrict const sorttab,
+const int                           sortnbr,
+const int * restrict const          procnodtab)
+{
+  int                 sortbas;
+  int                 sortnnd;
+
+  for (sortbas = 0; sortbas < sortnbr; sortbas = sortnnd) {
+    int                 nodenum;
+
+    nodenum = procnodtab[sorttab[sortbas].procnum];
+    for (sortnnd = sortbas + 1; (sortnnd < sortnbr) && (procnodtab[sorttab[sortnnd].procnum] == nodenum); sortnnd ++) ;
+    intSort2asc1 (sorttab + sortbas, sortnnd - sortbas);
+  }
+}
+
 /* This routine computes an optimized communication
 ** scheme for folding the data of a distributed graph.
 ** It is currently based on a maximum fixed number of
 ** communications per process. If this maximum is reached,
 ** the algorithm will fail.
+** When a node-aware folding plan is provided, senders
+** and receivers are first matched node by node, so that
+** vertices stay within nodes as much as possible. If this
+** scheme creates more overload than the plain one, which
+** matches processes by vertex load only, the latter is
+** used.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -121,6 +280,7 @@ int
 dgraphFoldComm (
 const Dgraph * restrict const                   grafptr,
 const int                                       partval, /* 0 for first half, 1 for second half                           */
+const DgraphFoldPlan * restrict const           planptr, /* Folding plan, or NULL for rank order                          */
 int * restrict const                            commmaxptr, /* Pointer to maximum number of communications per process    */
 int * restrict const                            commtypvalptr, /* Process will be sender or receiver                      */
 DgraphFoldCommData * restrict * restrict const  commdattabptr, /* Slots for communication                                 */
@@ -145,6 +305,10 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
   Gnum * restrict               vertdlttab;
   int                           commmax;          /* Current maximum number of communications per process           */
   int                           procnum;
+  int                           orgproclocpos;    /* Position of local process in fold order                        */
+  int                           nodeval;          /* Node-aware scheme: 0 if not, 1 if first try, 2 if final try    */
+  Gnum                          vertglbdlt;       /* Global overload accepted for receiver vertices                 */
+  Gnum                          vertnoddlt;       /* Global overload of node-aware scheme                           */
 #ifdef SCOTCH_DEBUG_DGRAPH2
   DgraphFoldCommData * restrict procchktab;
   int                           chekloctab[2];
@@ -155,6 +319,8 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
   const int                         orgproclocnum = grafptr->proclocnum;
   const Gnum * restrict const       orgproccnttab = grafptr->proccnttab;
   const Gnum * restrict const       orgprocvrttab = grafptr->procvrttab;
+  const int * restrict const        orgprocfldtab = (planptr != NULL) ? planptr->procfldtab : NULL;
+  const int * restrict const        orgprocordtab = (planptr != NULL) ? planptr->procordtab : NULL;
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
   if (orgprocglbnbr < 2) {                        /* Folding is useless when graph is on a single process */
@@ -183,7 +349,8 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
     procfldnbr = orgprocglbnbr - procfldnbr;      /* Number of processes in folded graph is in fact the smaller half */
   }
 
-  if ((orgproclocnum >= procrcvbas) && (orgproclocnum < procrcvnnd)) { /* If calling process is a receiver          */
+  orgproclocpos = (orgprocfldtab != NULL) ? orgprocfldtab[orgproclocnum] : orgproclocnum;
+  if ((orgproclocpos >= procrcvbas) && (orgproclocpos < procrcvnnd)) { /* If calling process is a receiver          */
     fldproccnttab  = proccnttab;                  /* Point to vertex count array of receiver process                */
     *commtypvalptr = DGRAPHFOLDCOMMRECV;          /* Set local process type as receiver (pure receiver, by default) */
   }
@@ -200,28 +367,90 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
   }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
-  for (procnum = procsndbas; procnum < procsndnnd; procnum ++) { /* Senders will not be changed in loop  */
-    procsrttab[procnum].vertnbr = orgproccnttab[procnum]; /* All vertices of senders must be disposed of */
-    procsrttab[procnum].procnum = (Gnum) procnum;
+  nodeval    = ((orgprocfldtab != NULL) && (planptr->procnodtab != NULL)) ? 1 : 0; /* Try node-aware scheme first if plan provided */
+  vertnoddlt = 0;
+  commdattab = NULL;                              /* Vertex redistribution arrays not allocated yet */
+retry:                                            /* (Re)start computation with another scheme      */
+  if (nodeval == 0) {
+    for (procnum = procsndbas; procnum < procsndnnd; procnum ++) { /* Senders will not be changed in loop  */
+      int                 procsndnum;
+
+      procsndnum = (orgprocordtab != NULL) ? orgprocordtab[procnum] : procnum;
+      procsrttab[procnum].vertnbr = orgproccnttab[procsndnum]; /* All vertices of senders must be disposed of */
+      procsrttab[procnum].procnum = (Gnum) procsndnum;
+    }
+    intSort2asc1 (procsrttab + procsndbas, procsndnnd - procsndbas); /* Sort sender part once for good */
+  }
+  else {                                          /* Empty senders first, then senders by descending node index */
+    int                 sortsndnum;
+
+    for (procnum = procsndnnd - 1, sortsndnum = procsndbas; procnum >= procsndbas; procnum --) {
+      int                 procsndnum;
+
+      procsndnum = orgprocordtab[procnum];
+      if (orgproccnttab[procsndnum] == 0) {
+        procsrttab[sortsndnum].vertnbr = 0;
+        procsrttab[sortsndnum].procnum = (Gnum) procsndnum;
+        sortsndnum ++;
+      }
+    }
+    for (procnum = procsndnnd - 1, sortsndbas = sortsndnum; procnum >= procsndbas; procnum --) {
+      int                 procsndnum;
+
+      procsndnum = orgprocordtab[procnum];
+      if (orgproccnttab[procsndnum] != 0) {
+        procsrttab[sortsndnum].vertnbr = orgproccnttab[procsndnum];
+        procsrttab[sortsndnum].procnum = (Gnum) procsndnum;
+        sortsndnum ++;
+      }
+    }
+    dgraphFoldCommSort (procsrttab + sortsndbas, procsndnnd - sortsndbas, planptr->procnodtab); /* Node with smallest index will send first */
   }
-  intSort2asc1 (procsrttab + procsndbas, procsndnnd - procsndbas); /* Sort sender part once for good */
 
-  commdattab = NULL;                              /* Vertex redistribution arrays not allocated yet                        */
   for (commmax = DGRAPHFOLDCOMMNBR; ; commmax ++) { /* Start with small number of communications per process               */
     int * restrict      slotsndtax;               /* Based access to slot array, with respect to (procrcvbas * commsiz)    */
     int                 sortsndnnd;               /* Index of current end of send sub-array in sort array                  */
     int                 sortrcvnnd;               /* Index of current end of receive sub-array in sort array               */
     int                 sortrcvnum;               /* Index of current receiver process in sort array                       */
-    Gnum                vertglbdlt;               /* Global overload accepted for receiver vertices                        */
     int                 commrcvnum;               /* Number of communications already performed by current receiver        */
     int                 commsiz;                  /* Size of receiver communication arrays for local process (commmax + 1) */
     int                 commnum;
 
-    for (procnum = procrcvbas; procnum < procrcvnnd; procnum ++) { /* Compute difference with respect to average for receivers */
-      procsrttab[procnum].vertnbr = orgproccnttab[procnum] - DATASIZE (grafptr->vertglbnbr, procfldnbr, procnum - procrcvbas);
-      procsrttab[procnum].procnum = (Gnum) procnum;
+    if (nodeval == 0) {
+      for (procnum = procrcvbas; procnum < procrcvnnd; procnum ++) { /* Compute difference with respect to average for receivers */
+        int                 procrcvnum;
+
+        procrcvnum = (orgprocordtab != NULL) ? orgprocordtab[procnum] : procnum;
+        procsrttab[procnum].vertnbr = orgproccnttab[procrcvnum] - DATASIZE (grafptr->vertglbnbr, procfldnbr, procnum - procrcvbas);
+        procsrttab[procnum].procnum = (Gnum) procrcvnum;
+      }
+      intSort2asc1 (procsrttab + procrcvbas, procrcvnnd - procrcvbas); /* (Re)sort receiver part as may have been modified by previous loop */
+    }
+    else {                                        /* Receivers with room first, by ascending node index, then the others */
+      int                 sortrcvidx;
+      int                 sortrcvbas;
+      int                 passnum;
+
+      for (passnum = 0, sortrcvidx = sortrcvbas = procrcvbas; passnum < 2; passnum ++) {
+        if (passnum == 1)
+          sortrcvbas = sortrcvidx;                /* Start of receivers without room */
+
+        for (procnum = procrcvbas; procnum < procrcvnnd; procnum ++) {
+          int                 procrcvnum;
+          Gnum                vertnbr;
+
+          procrcvnum = orgprocordtab[procnum];
+          vertnbr    = orgproccnttab[procrcvnum] - DATASIZE (grafptr->vertglbnbr, procfldnbr, procnum - procrcvbas);
+          if ((vertnbr < 0) == (passnum == 0)) {
+            procsrttab[sortrcvidx].vertnbr = vertnbr;
+            procsrttab[sortrcvidx].procnum = (Gnum) procrcvnum;
+            sortrcvidx ++;
+          }
+        }
+      }
+      dgraphFoldCommSort (procsrttab + procrcvbas, sortrcvbas - procrcvbas, planptr->procnodtab);
+      intSort2asc1 (procsrttab + sortrcvbas, procrcvnnd - sortrcvbas); /* Sender receivers will be taken by descending load */
     }
-    intSort2asc1 (procsrttab + procrcvbas, procrcvnnd - procrcvbas); /* (Re)sort receiver part as may have been modified by previous loop */
 
     for (sortsndbas = procsndbas; sortsndbas < procsndnnd; sortsndbas ++) { /* Discard empty senders */
       if (procsrttab[sortsndbas].vertnbr != 0)    /* Stop at first non-empty sender                  */
@@ -253,17 +482,20 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
     if (fldproccnttab != NULL) {                  /* If we are a receiver process, initialize count and adjustment arrays */
       int                 procrcvnum;
 
+      *commtypvalptr = DGRAPHFOLDCOMMRECV;        /* Previous try may have turned process into a sender receiver */
       memSet (vertadjtab, ~0, commsiz * orgprocglbnbr * sizeof (Gnum)); /* Initialize index adjustment arrays */
       memSet (slotsndtab, ~0, commsiz * procfldnbr * sizeof (int));
       slotsndtax = slotsndtab - (procrcvbas * commsiz); /* Base access to slot array for receivers */
 
       for (procrcvnum = procrcvbas; procrcvnum < procrcvnnd; procrcvnum ++) { /* For all slots of receiver processes */
+        int                 procrcvtmp;           /* Rank of receiver process                                        */
         int                 slotrcvnum;           /* First index in slot array for receiver process                  */
 
-        slotrcvnum = procrcvnum * commsiz;
-        vertadjtab[slotrcvnum] = orgprocvrttab[procrcvnum]; /* Set global start index of local chunk            */
-        vertdlttab[slotrcvnum] = orgproccnttab[procrcvnum]; /* Set number of vertices to be kept in local chunk */
-        slotsndtax[slotrcvnum] = slotrcvnum;      /* First slot of receiver is active                           */
+        procrcvtmp = (orgprocordtab != NULL) ? orgprocordtab[procrcvnum] : procrcvnum;
+        slotrcvnum = procrcvtmp * commsiz;
+        vertadjtab[slotrcvnum] = orgprocvrttab[procrcvtmp]; /* Set global start index of local chunk            */
+        vertdlttab[slotrcvnum] = orgproccnttab[procrcvtmp]; /* Set number of vertices to be kept in local chunk */
+        slotsndtax[procrcvnum * commsiz] = slotrcvnum; /* First slot of receiver is active                      */
       }
     }
 
@@ -354,7 +586,7 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
         procrcvnum = (int) procsrttab[sortrcvnum].procnum; /* Get receiver index                                    */
-        slotrcvnum = procrcvnum * commsiz + 1;        /* Start slot of receiver is after local slot (even if empty) */
+        slotrcvnum = ((orgprocfldtab != NULL) ? orgprocfldtab[procrcvnum] : procrcvnum) * commsiz + 1; /* Start slot of receiver is after local slot (even if empty) */
         vertrcvnbr = vertglbdlt - procsrttab[sortrcvnum].vertnbr; /* Compute capacity of receiver process           */
 
         if ((vertrcvdlt >  0) &&                  /* If there is a possibility to interleave a pure sender */
@@ -400,7 +632,7 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
             commrcvnum = 0;
 
             procrcvnum = (int) procsrttab[sortrcvnum].procnum; /* Get receiver index                                    */
-            slotrcvnum = procrcvnum * commsiz + 1;        /* Start slot of receiver is after local slot (even if empty) */
+            slotrcvnum = ((orgprocfldtab != NULL) ? orgprocfldtab[procrcvnum] : procrcvnum) * commsiz + 1; /* Start slot of receiver is after local slot (even if empty) */
             vertrcvnbr = vertglbdlt - procsrttab[sortrcvnum].vertnbr; /* Compute capacity of receiver process           */
           }
         }
@@ -470,6 +702,16 @@ Gnum * restrict * restrict const                vertdlttabptr) /* Pointer to glo
 redo: ;                                           /* Increase maximum number of communications and retry */
   }
 done:                                             /* A valid communication pattern has been produced */
+  if ((nodeval == 1) && (vertglbdlt > 0)) {       /* If node-aware scheme is not perfectly balanced   */
+    vertnoddlt = vertglbdlt;                      /* Record its overload and try plain scheme         */
+    nodeval    = 0;
+    goto retry;
+  }
+  if ((vertnoddlt > 0) && (vertglbdlt >= vertnoddlt)) { /* If plain scheme does not do better, use node-aware one */
+    vertnoddlt = 0;
+    nodeval    = 2;
+    goto retry;
+  }
 
   memFree (procsrttab);                           /* Sort array is no longer necessary */
 
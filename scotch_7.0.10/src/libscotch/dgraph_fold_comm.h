@@ -44,7 +44,7 @@
 /**                # Version 5.1  : from : 30 jul 2010     **/
 /**                                 to   : 03 jan 2011     **/
 /**                # Version 7.0  : from : 29 jul 2023     **/
-/**                                 to   : 29 jul 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,6 +56,13 @@
 
 #define DGRAPHFOLDCOMMNBR           4             /* Starting maximum number of communications per process */
 
+/*+ Node-aware folding is only available
+    with MPI-3 shared-memory communicators. +*/
+
+#if ((defined SCOTCH_COMM_NODE) && (defined MPI_VERSION) && (MPI_VERSION >= 3))
+#define DGRAPHFOLDNODE
+#endif /* ((defined SCOTCH_COMM_NODE) && (defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+
 /*
 **  The type and structure definitions.
 */
@@ -88,8 +95,28 @@ typedef struct DgraphFoldCommData_ {
   Gnum             procnum;                       /*+ Processor index; TRICK: Gnum for sorting +*/
 } DgraphFoldCommData;
 
+/*+ Folding plan. By default, the first half of
+    the processes, in rank order, forms part 0,
+    and the second half forms part 1. A folding
+    plan defines another order, called the fold
+    order, so that the first (procglbnbr + 1) / 2
+    processes in fold order form part 0. Node
+    indices allow the communication scheme to
+    favor communications within nodes.          +*/
+
+typedef struct DgraphFoldPlan_ {
+  int *            procfldtab;                    /*+ Position of each process in fold order +*/
+  int *            procordtab;                    /*+ Process at each position in fold order +*/
+  int *            procnodtab;                    /*+ Node index of each process             +*/
+} DgraphFoldPlan;
+
 /*
 ** The function prototypes.
 */
 
-int                         dgraphFoldComm      (const Dgraph * restrict const, const int, int * restrict const, int * restrict const, DgraphFoldCommData * restrict * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, int * restrict const, Gnum * restrict * restrict const, Gnum * restrict * restrict const);
+int                         dgraphFoldComm      (const Dgraph * restrict const, const int, const DgraphFoldPlan * restrict const, int * restrict const, int * restrict const, DgraphFoldCommData * restrict * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, int * restrict const, Gnum * restrict * restrict const, Gnum * restrict * restrict const);
+int                         dgraphFold3         (const Dgraph * restrict const, const int, Dgraph * const, MPI_Comm, const DgraphFoldPlan * restrict const, const void * restrict const, void ** restrict const, MPI_Datatype);
+#ifdef DGRAPHFOLDNODE
+int                         dgraphFoldPlanInit  (const Dgraph * restrict const, DgraphFoldPlan * restrict const);
+void                        dgraphFoldPlanExit  (DgraphFoldPlan * restrict const);
+#endif /* DGRAPHFOLDNODE */
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 28 sep 2014     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 12 sep 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,7 @@
 #include "module.h"
 #include "common.h"
 #include "dgraph.h"
+#include "dgraph_fold_comm.h"
 #include "dgraph_fold_dup.h"
 
 /******************************/
@@ -74,7 +75,9 @@
 ** of the processes. The number of processes
 ** does not need to be even. There is a
 ** multi-threaded version, as well as a
-** sequential one.
+** sequential one. When node-aware folding
+** is enabled, halves are defined by the
+** folding plan instead of by rank order.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -89,8 +92,8 @@ const DgraphFoldDupSplit * const  spltptr)
 {
   int                 o;
 
-  o = dgraphFold2 (spltptr->splttab[spltnum].orggrafptr, spltnum, spltptr->fldgrafptr,
-                   spltptr->splttab[spltnum].fldproccomm, spltptr->orgdataptr, spltptr->flddataptr, spltptr->datatype);
+  o = dgraphFold3 (spltptr->splttab[spltnum].orggrafptr, spltnum, spltptr->fldgrafptr, spltptr->splttab[spltnum].fldproccomm,
+                   spltptr->planptr, spltptr->orgdataptr, spltptr->flddataptr, spltptr->datatype);
 
   if (o != 0)
     *spltptr->revaptr = 1;                        /* No mutex protection */
@@ -110,6 +113,9 @@ Context * restrict const      contptr)            /*+ Context
   int                 thrdprolvl;
   int                 thrdglbmin;
 #endif /* SCOTCH_PTHREAD_MPI */
+#ifdef DGRAPHFOLDNODE
+  DgraphFoldPlan      fldplandat;
+#endif /* DGRAPHFOLDNODE */
   int                 thrdval;                    /* Flag set if multithreaded process is possible */
   int                 fldprocnbr;
   int                 fldprocnum;
@@ -117,18 +123,28 @@ Context * restrict const      contptr)            /*+ Context
   DgraphFoldDupSplit  fldspltdat;
   int                 o;
 
+  fldspltdat.planptr = NULL;                      /* Assume rank order will be used */
+#ifdef DGRAPHFOLDNODE
+  if (dgraphFoldPlanInit (orggrafptr, &fldplandat) != 0) {
+    errorPrint ("dgraphFoldDup: cannot compute folding plan");
+    return (1);
+  }
+  if (fldplandat.procfldtab != NULL)
+    fldspltdat.planptr = &fldplandat;
+#endif /* DGRAPHFOLDNODE */
+
   fldprocnbr = (orggrafptr->procglbnbr + 1) / 2;  /* Median cut on number of processors     */
-  if (orggrafptr->proclocnum < fldprocnbr) {      /* Compute color and rank in two subparts */
+  fldprocnum = (fldspltdat.planptr != NULL) ? fldspltdat.planptr->procfldtab[orggrafptr->proclocnum] : orggrafptr->proclocnum;
+  if (fldprocnum < fldprocnbr)                    /* Compute color and rank in two subparts */
     fldproccol = 0;
-    fldprocnum = orggrafptr->proclocnum;
-  }
   else {
     fldproccol = 1;
-    fldprocnum = orggrafptr->proclocnum - fldprocnbr;
+    fldprocnum -= fldprocnbr;
   }
   if (MPI_Comm_split (orggrafptr->proccomm, fldproccol, fldprocnum, &fldspltdat.splttab[fldproccol].fldproccomm) != MPI_SUCCESS) {
     errorPrint ("dgraphFoldDup: communication error (1)");
-    return (1);
+    o = 1;
+    goto abort;
   }
   fldspltdat.splttab[fldproccol ^ 1].fldproccomm = MPI_COMM_NULL;
 
@@ -150,7 +166,8 @@ Context * restrict const      contptr)            /*+ Context
     thrdlocmin = contextThreadNbr (contptr);
     if (MPI_Allreduce (&thrdlocmin, &thrdglbmin, 1, MPI_INT, MPI_MIN, orggrafptr->proccomm) != MPI_SUCCESS) {
       errorPrint ("dgraphFoldDup: communication error (2)");
-      return (1);
+      o = 1;
+      goto abort;
     }
 
     if (thrdglbmin > 1) {                         /* If all processes have multiple threads available */
@@ -159,7 +176,8 @@ Context * restrict const      contptr)            /*+ Context
 
       if (MPI_Comm_dup (orggrafptr->proccomm, &orggrafdat.proccomm) != MPI_SUCCESS) { /* Duplicate communicator to avoid interferences in communications */
         errorPrint ("dgraphFoldDup: communication error (3)");
-        return (1);
+        o = 1;
+        goto abort;
       }
 
 #ifndef DGRAPHFOLDDUPNOTHREAD
@@ -186,5 +204,10 @@ Context * restrict const      contptr)            /*+ Context
 
   fldgrafptr->pkeyglbval = fldproccol;            /* Discriminate between folded communicators at same level */
 
+abort:
+#ifdef DGRAPHFOLDNODE
+  dgraphFoldPlanExit (&fldplandat);
+#endif /* DGRAPHFOLDNODE */
+
   return (o);
 }
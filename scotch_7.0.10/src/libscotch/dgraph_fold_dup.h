@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 28 sep 2014     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 26 sep 2021     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,7 @@ typedef struct DgraphFoldDupSplit2_ {
 
 typedef struct DgraphFoldDupSplit_ {
   DgraphFoldDupSplit2       splttab[2];           /*+ Array of folded graph data                    +*/
+  const DgraphFoldPlan *    planptr;              /*+ Folding plan, or NULL for rank order          +*/
   void *                    orgdataptr;           /*+ Data associated to vertices, e.g. coarmulttab +*/
   Dgraph *                  fldgrafptr;           /*+ Pointer to folded graph                       +*/
   void *                    flddataptr;           /*+ Data associated to vertices, e.g. coarmulttab +*/
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 05 apr 2021     **/
 /**                                 to   : 18 dec 2021     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 29 aug 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -107,23 +107,602 @@
 #undef DGRAPHHALOFILLSIZE
 #undef DGRAPHHALOFILLCOPY
 
+/* This routine returns the halo exchange plan
+** of the given graph, building it on the first
+** call. The plan holds the displacement arrays
+** and the packing buffer, so that they are not
+** recomputed on every exchange. If passval is
+** not zero, an exchange is about to be made
+** with the plan. From the second exchange on,
+** the plan also holds a neighborhood communicator
+** restricted to the neighbor processes, so that
+** graphs which are exchanged only once do not
+** pay for its creation.
+** It returns:
+** - !NULL  : pointer to the plan.
+** - NULL   : on error.
+*/
+
+static
+DgraphHaloPlan *
+dgraphHaloPlan (
+Dgraph * restrict const     grafptr,
+const int                   passval)              /*+ Set if plan is used for an exchange +*/
+{
+  DgraphHaloPlan * restrict planptr;
+
+  if (dgraphGhst (grafptr) != 0) {                /* Compute ghost edge array if not already present */
+    errorPrint ("dgraphHaloPlan: cannot compute ghost edge array");
+    return (NULL);
+  }
+
+  planptr = grafptr->haloptr;
+  if ((planptr == NULL) ||                        /* If no plan yet, or plan of a cloned graph with another communicator */
+      (planptr->proccomm != grafptr->proccomm)) {
+    int * restrict      senddsptab;
+    int * restrict      recvdsptab;
+    byte **             attrdsptab;
+    int * restrict      ngbsndcnttab;
+    int * restrict      ngbsnddsptab;
+    int * restrict      ngbrcvcnttab;
+    int * restrict      ngbrcvdsptab;
+    MPI_Request *       requtab;
+    int                 procngbnbr;
+    int                 procngbnum;
+    int                 procnum;
+
+    const int * restrict const  procngbtab = grafptr->procngbtab;
+    const int * restrict const  procsndtab = grafptr->procsndtab;
+    const int * restrict const  procrcvtab = grafptr->procrcvtab;
+
+    procngbnbr = grafptr->procngbnbr;
+    if (memAllocGroup ((void **) (void *)
+                       &planptr,      (size_t) (sizeof (DgraphHaloPlan)),
+                       &senddsptab,   (size_t) (grafptr->procglbnbr * sizeof (int)),
+                       &recvdsptab,   (size_t) (grafptr->procglbnbr * sizeof (int)),
+                       &attrdsptab,   (size_t) (grafptr->procglbnbr * sizeof (byte *)),
+                       &ngbsndcnttab, (size_t) (procngbnbr          * sizeof (int)),
+                       &ngbsnddsptab, (size_t) (procngbnbr          * sizeof (int)),
+                       &ngbrcvcnttab, (size_t) (procngbnbr          * sizeof (int)),
+                       &ngbrcvdsptab, (size_t) (procngbnbr          * sizeof (int)),
+                       &requtab,      (size_t) (procngbnbr * 2      * sizeof (MPI_Request)), NULL) == NULL) {
+      errorPrint ("dgraphHaloPlan: out of memory");
+      return (NULL);
+    }
+    planptr->proccomm     = grafptr->proccomm;
+    planptr->ngbcomm      = MPI_COMM_NULL;
+    planptr->passnbr      = 0;
+    planptr->senddsptab   = senddsptab;
+    planptr->recvdsptab   = recvdsptab;
+    planptr->attrdsptab   = attrdsptab;
+    planptr->ngbsndcnttab = ngbsndcnttab;
+    planptr->ngbsnddsptab = ngbsnddsptab;
+    planptr->ngbrcvcnttab = ngbrcvcnttab;
+    planptr->ngbrcvdsptab = ngbrcvdsptab;
+    planptr->requtab      = requtab;
+    planptr->attrsndtab   = NULL;
+    planptr->attrsndsiz   = 0;
+    planptr->vertsrttab   = NULL;
+    planptr->vertintnbr   = 0;
+#ifdef DGRAPHHALONODE
+    planptr->nodeval      = -1;                   /* Node exchanges not yet set up */
+    planptr->nodecomm     = MPI_COMM_NULL;
+#endif /* DGRAPHHALONODE */
+
+    senddsptab[0] = 0;
+    recvdsptab[0] = grafptr->vertlocnbr;          /* Ghost vertices are received after local vertices */
+    for (procnum = 1; procnum < grafptr->procglbnbr; procnum ++) {
+      senddsptab[procnum] = senddsptab[procnum - 1] + procsndtab[procnum - 1];
+      recvdsptab[procnum] = recvdsptab[procnum - 1] + procrcvtab[procnum - 1];
+    }
+    for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* Neighbor arrays follow the sorted order of procngbtab */
+      int                 procglbnum;
+
+      procglbnum = procngbtab[procngbnum];
+      ngbsndcnttab[procngbnum] = procsndtab[procglbnum];
+      ngbsnddsptab[procngbnum] = senddsptab[procglbnum];
+      ngbrcvcnttab[procngbnum] = procrcvtab[procglbnum];
+      ngbrcvdsptab[procngbnum] = recvdsptab[procglbnum];
+    }
+
+    grafptr->haloptr  = planptr;                  /* A plan of another communicator belongs to the graph it was cloned from */
+    grafptr->flagval |= DGRAPHFREEHALO;
+  }
+
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+  if ((passval != 0) &&
+      (planptr->ngbcomm == MPI_COMM_NULL) &&      /* If plan is reused, create neighborhood communicator */
+      (planptr->passnbr ++ > 0)) {
+    if (MPI_Dist_graph_create_adjacent (grafptr->proccomm,
+                                        grafptr->procngbnbr, grafptr->procngbtab, planptr->ngbrcvcnttab, /* Halo relation is symmetric */
+                                        grafptr->procngbnbr, grafptr->procngbtab, planptr->ngbsndcnttab, /* Weigh edges by volume    */
+                                        MPI_INFO_NULL, 0, &planptr->ngbcomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphHaloPlan: communication error");
+      return (NULL);
+    }
+  }
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+
+  return (planptr);
+}
+
+#ifdef DGRAPHHALONODE
+
+/* This routine frees the node exchange data
+** of the given plan, if any. Since the window
+** is freed, it is collective across the processes
+** of the node.
+** It returns:
+** - void  : in all cases.
+*/
+
 static
 void
-dgraphHaloFill (
-const Dgraph * restrict const grafptr,
-const void * restrict const   attrgsttab,         /* Attribute array to diffuse     */
-int                           attrglbsiz,         /* Type extent of attribute       */
-byte * restrict const         attrsndtab,         /* Array for packing data to send */
-int * const                   senddsptab,         /* Temporary displacement array   */
-const int * restrict const    sendcnttab)         /* Count array                    */
+dgraphHaloNodeFree (
+DgraphHaloPlan * restrict const planptr)
 {
+  int                 fnlzval;
+
+  if (planptr->nodeval > 0) {                     /* If window and node arrays allocated */
+    MPI_Finalized (&fnlzval);
+    if (fnlzval == 0) {                           /* Window cannot be freed once MPI is finalized */
+      MPI_Win_unlock_all (planptr->nodewin);
+      MPI_Win_free       (&planptr->nodewin);
+    }
+    memFree (planptr->nodeptrtab);                /* Free group leader */
+  }
+  if (planptr->nodecomm != MPI_COMM_NULL) {
+    MPI_Finalized (&fnlzval);
+    if (fnlzval == 0)
+      MPI_Comm_free (&planptr->nodecomm);
+    planptr->nodecomm = MPI_COMM_NULL;
+  }
+  planptr->nodeval = -1;
+}
+
+/* This routine sets up the node exchanges of
+** the given graph, in which data bound to
+** neighbor processes of the same shared-memory
+** node are copied through an MPI-3 shared-memory
+** window rather than sent as MPI messages. The
+** node communicator and the window are kept in
+** the halo exchange plan, so that they are built
+** only once per graph. Each buffer of the window
+** can hold itemsiz bytes per halo vertex, in each
+** direction. Node exchanges are used only if some
+** node hosts several processes. For testing
+** purposes, nodes can be split into groups of
+** consecutive ranks, the size of which is given
+** by the "SCOTCH_COMM_NODE_SIZE" environment
+** variable.
+** It must be called collectively.
+** It returns:
+** - 0   : on success; *nodeptr points to the
+**         array of node ranks of neighbors, -1
+**         for neighbors not on the node, or is
+**         NULL if node exchanges are not used.
+** - !0  : on error.
+*/
+
+int
+dgraphHaloNodeInit (
+Dgraph * restrict const     grafptr,
+const size_t                itemsiz,              /*+ Space per halo vertex in each buffer      +*/
+const int ** const          nodeptr)              /*+ Pointer to node ranks of neighbors, or NULL +*/
+{
+  DgraphHaloPlan * restrict planptr;
+  MPI_Comm            typecomm;
+  MPI_Group           procgrp;
+  MPI_Group           nodegrp;
+  Gnum                vertsndnbr;
+  Gnum                vertrcvnbr;
+  size_t              bufsiz;
+  int                 nodesiz;                    /* Forced number of processes per node, if positive */
+  int                 nodeglbmax;                 /* Largest number of processes per node             */
+  int                 procngbnum;
   int                 procnum;
-  byte **             attrdsptab;
+  int                 cheklocval;
+  int                 chekglbval;
+
+  const int                   procngbnbr = grafptr->procngbnbr;
+  const int * restrict const  procngbtab = grafptr->procngbtab;
+
+  *nodeptr = NULL;
+
+  if ((planptr = dgraphHaloPlan (grafptr, 0)) == NULL) {
+    errorPrint ("dgraphHaloNodeInit: cannot create halo exchange plan");
+    return (1);
+  }
+  if ((planptr->nodeval == 0) ||                  /* If node exchanges already known to be useless */
+      ((planptr->nodeval > 0) && (itemsiz <= planptr->nodeitemsiz))) { /* Or window is large enough */
+    if (planptr->nodeval > 0)
+      *nodeptr = planptr->nodengbtab;
+    return (0);
+  }
+  dgraphHaloNodeFree (planptr);                   /* Window will be re-created with larger buffers, if any */
+
+  nodesiz = envGetInt ("SCOTCH_COMM_NODE_SIZE", 0);
+  if (MPI_Comm_split_type (grafptr->proccomm, MPI_COMM_TYPE_SHARED, grafptr->proclocnum, MPI_INFO_NULL, &typecomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloNodeInit: communication error (1)");
+    return (1);
+  }
+  if (nodesiz > 0) {                              /* If nodes are split into groups of consecutive ranks */
+    if ((MPI_Comm_split (typecomm, grafptr->proclocnum / nodesiz, grafptr->proclocnum, &planptr->nodecomm) != MPI_SUCCESS) ||
+        (MPI_Comm_free (&typecomm) != MPI_SUCCESS)) {
+      errorPrint ("dgraphHaloNodeInit: communication error (2)");
+      return (1);
+    }
+  }
+  else
+    planptr->nodecomm = typecomm;
+
+  MPI_Comm_size (planptr->nodecomm, &planptr->nodeprocnbr);
+  MPI_Comm_rank (planptr->nodecomm, &planptr->nodeproclocnum);
+  if (MPI_Allreduce (&planptr->nodeprocnbr, &nodeglbmax, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloNodeInit: communication error (3)");
+    return (1);
+  }
+  if (nodeglbmax <= 1) {                          /* If no node hosts several processes */
+    MPI_Comm_free (&planptr->nodecomm);
+    planptr->nodecomm = MPI_COMM_NULL;
+    planptr->nodeval  = 0;
+    return (0);
+  }
+
+  for (procnum = 0, vertsndnbr = vertrcvnbr = 0; procnum < grafptr->procglbnbr; procnum ++) {
+    vertsndnbr += grafptr->procsndtab[procnum];
+    vertrcvnbr += grafptr->procrcvtab[procnum];
+  }
+  planptr->nodeitemsiz = itemsiz;
+  planptr->nodehedsiz  = DGRAPHHALONODESIZE (2 * planptr->nodeprocnbr * sizeof (int));
+  bufsiz = DGRAPHHALONODESIZE (planptr->nodehedsiz + MAX (vertsndnbr, vertrcvnbr) * itemsiz);
+
+  cheklocval = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &planptr->nodeptrtab, (size_t) (MAX (procngbnbr, 1) * sizeof (byte *)),
+                     &planptr->nodengbtab, (size_t) (MAX (procngbnbr, 1) * sizeof (int)),
+                     &planptr->nodereqtab, (size_t) (MAX (procngbnbr, 1) * 2 * sizeof (MPI_Request)), NULL) == NULL) {
+    errorPrint ("dgraphHaloNodeInit: out of memory");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloNodeInit: communication error (4)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (cheklocval == 0)
+      memFree (planptr->nodeptrtab);              /* Free group leader */
+    dgraphHaloNodeFree (planptr);
+    return (1);
+  }
+  if (MPI_Win_allocate_shared ((MPI_Aint) (DGRAPHHALONODESIZE (sizeof (DgraphHaloNodeHead)) + 2 * bufsiz), 1,
+                               MPI_INFO_NULL, planptr->nodecomm, (void *) &planptr->nodesegtab, &planptr->nodewin) != MPI_SUCCESS) {
+    errorPrint         ("dgraphHaloNodeInit: communication error (5)");
+    memFree            (planptr->nodeptrtab);     /* Free group leader */
+    dgraphHaloNodeFree (planptr);
+    return (1);
+  }
+  planptr->nodeval = 1;
+
+  ((DgraphHaloNodeHead *) planptr->nodesegtab)->bufsiz = bufsiz;
+  planptr->nodeseqnum = 0;
+
+  MPI_Comm_group (grafptr->proccomm, &procgrp);
+  MPI_Comm_group (planptr->nodecomm, &nodegrp);
+  MPI_Group_translate_ranks (procgrp, procngbnbr, (int *) procngbtab, nodegrp, planptr->nodengbtab);
+  MPI_Group_free (&nodegrp);
+  MPI_Group_free (&procgrp);
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    planptr->nodeptrtab[procngbnum] = NULL;       /* Assume neighbor is not on the node */
+    if (planptr->nodengbtab[procngbnum] == MPI_UNDEFINED)
+      planptr->nodengbtab[procngbnum] = -1;
+    else {
+      MPI_Aint            segsiz;
+      int                 dspval;
+
+      MPI_Win_shared_query (planptr->nodewin, planptr->nodengbtab[procngbnum], &segsiz, &dspval, (void *) &planptr->nodeptrtab[procngbnum]);
+    }
+  }
+
+  MPI_Win_lock_all (MPI_MODE_NOCHECK, planptr->nodewin); /* Open passive epoch for the lifetime of the window */
+  MPI_Win_sync     (planptr->nodewin);            /* Make header visible before any exchange takes place */
+  if (MPI_Barrier (planptr->nodecomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloNodeInit: communication error (6)");
+    return (1);
+  }
+  MPI_Win_sync (planptr->nodewin);
+
+  *nodeptr = planptr->nodengbtab;
+  return (0);
+}
+
+/* This routine posts the data bound to the
+** neighbors of the same node, by copying them
+** into the next buffer of the local segment,
+** and starts the exchange of the flag messages
+** which tell neighbors that data are available.
+** Displacements and counts are expressed in
+** units of typesiz bytes, and are indexed by
+** global process number. Since buffers are used
+** alternately, a buffer is only overwritten once
+** all neighbors of the node have sent their flag
+** for the exchange before, hence have read it.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphHaloNodeSend (
+Dgraph * restrict const     grafptr,
+const void * const          datatab,              /*+ Array of outgoing data                     +*/
+const size_t                typesiz,              /*+ Size of data units, in bytes               +*/
+const int * const           dsptab,               /*+ Displacements of outgoing data, by process +*/
+const int * const           cnttab)               /*+ Counts of outgoing data, by process        +*/
+{
+  byte *              bufftab;
+  int *               bcnttab;
+  int *               bdsptab;
+  int                 procngbnum;
+
+  DgraphHaloPlan * restrict const planptr    = grafptr->haloptr;
+  MPI_Request * const             nodereqtab = planptr->nodereqtab;
+  const int                       procngbnbr = grafptr->procngbnbr;
+
+  planptr->nodeseqnum ++;
+  bufftab = planptr->nodesegtab + DGRAPHHALONODESIZE (sizeof (DgraphHaloNodeHead)) +
+            (planptr->nodeseqnum & 1) * ((DgraphHaloNodeHead *) planptr->nodesegtab)->bufsiz;
+  bcnttab = (int *) bufftab;
+  bdsptab = bcnttab + planptr->nodeprocnbr;
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    int                 nodengbnum;
+    int                 procglbnum;
+
+    nodengbnum = planptr->nodengbtab[procngbnum];
+    if (nodengbnum < 0)                           /* If neighbor not on the node */
+      continue;
+
+    procglbnum = grafptr->procngbtab[procngbnum];
+    bcnttab[nodengbnum] = cnttab[procglbnum];
+    bdsptab[nodengbnum] = dsptab[procglbnum];
+    memCpy (bufftab + planptr->nodehedsiz + (size_t) dsptab[procglbnum] * typesiz,
+            (const byte *) datatab + (size_t) dsptab[procglbnum] * typesiz,
+            (size_t) cnttab[procglbnum] * typesiz);
+  }
+  MPI_Win_sync (planptr->nodewin);                /* Make data visible before flags are sent */
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    int                 procglbnum;
+
+    nodereqtab[procngbnum]              =
+    nodereqtab[procngbnbr + procngbnum] = MPI_REQUEST_NULL;
+    if (planptr->nodengbtab[procngbnum] < 0)
+      continue;
+
+    procglbnum = grafptr->procngbtab[procngbnum];
+    if ((MPI_Irecv (NULL, 0, MPI_BYTE, procglbnum, TAGHALO + 1, grafptr->proccomm, &nodereqtab[procngbnum]) != MPI_SUCCESS) ||
+        (MPI_Isend (NULL, 0, MPI_BYTE, procglbnum, TAGHALO + 1, grafptr->proccomm, &nodereqtab[procngbnbr + procngbnum]) != MPI_SUCCESS)) {
+      errorPrint ("dgraphHaloNodeSend: communication error");
+      return (1);
+    }
+  }
+
+  return (0);
+}
+
+/* This routine receives the data posted by the
+** neighbors of the same node for the current
+** exchange, once their flags have arrived. Data
+** are copied at the given displacements, and
+** their counts are set in the count array.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphHaloNodeRecv (
+Dgraph * restrict const     grafptr,
+void * const                datatab,              /*+ Array of incoming data                     +*/
+const size_t                typesiz,              /*+ Size of data units, in bytes               +*/
+const int * const           dsptab,               /*+ Displacements of incoming data, by process +*/
+int * const                 cnttab)               /*+ Counts of incoming data, by process        +*/
+{
+  int                 procngbnum;
+
+  DgraphHaloPlan * restrict const planptr = grafptr->haloptr;
 
-  attrdsptab = (byte **) senddsptab;              /* TRICK: use senddsptab (int *) as attrdsptab (byte **) */
-  attrdsptab[0] = attrsndtab;                     /* Pre-set send arrays for send buffer filling routines */
-  for (procnum = 1; procnum < grafptr->procglbnbr; procnum ++)
-    attrdsptab[procnum] = attrdsptab[procnum - 1] + sendcnttab[procnum - 1] * attrglbsiz;
+  if (MPI_Waitall (2 * grafptr->procngbnbr, planptr->nodereqtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloNodeRecv: communication error");
+    return (1);
+  }
+  MPI_Win_sync (planptr->nodewin);                /* Do not read data before flags have arrived */
+
+  for (procngbnum = 0; procngbnum < grafptr->procngbnbr; procngbnum ++) {
+    const byte *        bufftab;
+    const int *         bcnttab;
+    int                 procglbnum;
+
+    if (planptr->nodengbtab[procngbnum] < 0)      /* If neighbor not on the node */
+      continue;
+
+    bufftab = planptr->nodeptrtab[procngbnum] + DGRAPHHALONODESIZE (sizeof (DgraphHaloNodeHead)) +
+              (planptr->nodeseqnum & 1) * ((DgraphHaloNodeHead *) planptr->nodeptrtab[procngbnum])->bufsiz;
+    bcnttab = (const int *) bufftab;
+    procglbnum = grafptr->procngbtab[procngbnum];
+    cnttab[procglbnum] = bcnttab[planptr->nodeproclocnum];
+    memCpy ((byte *) datatab + (size_t) dsptab[procglbnum] * typesiz,
+            bufftab + planptr->nodehedsiz + (size_t) bcnttab[planptr->nodeprocnbr + planptr->nodeproclocnum] * typesiz,
+            (size_t) cnttab[procglbnum] * typesiz);
+  }
+
+  return (0);
+}
+
+#endif /* DGRAPHHALONODE */
+
+/* This routine frees the halo exchange plan
+** of the given graph, if the graph owns it.
+** It is a collective routine, since the
+** neighbor communicator and the node-level
+** shared memory windows of the plan are
+** released: all processes of the graph must
+** call it together.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+dgraphHaloFree (
+Dgraph * restrict const     grafptr)
+{
+  DgraphHaloPlan * restrict planptr;
+
+  planptr = grafptr->haloptr;
+  if (((grafptr->flagval & DGRAPHFREEHALO) != 0) && (planptr != NULL)) {
+#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
+    if (planptr->ngbcomm != MPI_COMM_NULL) {
+      int                 fnlzval;
+
+      MPI_Finalized (&fnlzval);
+      if (fnlzval == 0)                           /* Communicator cannot be freed once MPI is finalized */
+        MPI_Comm_free (&planptr->ngbcomm);
+    }
+#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+#ifdef DGRAPHHALONODE
+    dgraphHaloNodeFree (planptr);
+#endif /* DGRAPHHALONODE */
+    if (planptr->attrsndtab != NULL)
+      memFree (planptr->attrsndtab);
+    if (planptr->vertsrttab != NULL)
+      memFree (planptr->vertsrttab);
+    memFree (planptr);                            /* Free group leader */
+  }
+
+  grafptr->haloptr  = NULL;
+  grafptr->flagval &= ~DGRAPHFREEHALO;
+}
+
+/* This routine returns the local vertices of
+** the given graph, split into interior vertices,
+** which have no ghost neighbors, and boundary
+** vertices, which have. Interior vertices come
+** first, and vertices are sorted by ascending
+** number within each set, so that computations
+** on interior vertices can overlap asynchronous
+** halo exchanges. The split is computed once
+** and kept in the halo exchange plan.
+** It returns:
+** - !NULL  : pointer to the un-based array of
+**            local vertex numbers, the number of
+**            interior vertices being set.
+** - NULL   : on error.
+*/
+
+const Gnum *
+dgraphHaloVert (
+Dgraph * restrict const     grafptr,
+Gnum * restrict const       vintlocptr)           /*+ Pointer to number of interior vertices +*/
+{
+  DgraphHaloPlan * restrict planptr;
+  Gnum * restrict           vertsrttab;
+  Gnum                      vertintnum;
+  Gnum                      vertbndnum;
+  Gnum                      vertlocnum;
+
+  const Gnum * restrict const vertloctax = grafptr->vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->vendloctax;
+
+  if ((planptr = dgraphHaloPlan (grafptr, 0)) == NULL) { /* Split is kept in plan, which also computes ghost edge array */
+    errorPrint ("dgraphHaloVert: cannot create halo exchange plan");
+    return (NULL);
+  }
+  if (planptr->vertsrttab != NULL) {              /* If split already computed */
+    *vintlocptr = planptr->vertintnbr;
+    return (planptr->vertsrttab);
+  }
+
+  if ((vertsrttab = memAlloc ((size_t) MAX (grafptr->vertlocnbr, 1) * sizeof (Gnum))) == NULL) {
+    errorPrint ("dgraphHaloVert: out of memory");
+    return (NULL);
+  }
+
+  for (vertlocnum = grafptr->baseval, vertintnum = 0, vertbndnum = grafptr->vertlocnbr; /* Boundary vertices are first written backwards */
+       vertlocnum < grafptr->vertlocnnd; vertlocnum ++) {
+    Gnum                edgelocnum;
+    Gnum                edgelocnnd;
+
+    for (edgelocnum = vertloctax[vertlocnum], edgelocnnd = vendloctax[vertlocnum];
+         edgelocnum < edgelocnnd; edgelocnum ++) {
+      if (grafptr->edgegsttax[edgelocnum] >= grafptr->vertlocnnd) /* If neighbor is a ghost vertex */
+        break;
+    }
+    if (edgelocnum < edgelocnnd)                  /* If vertex is a boundary vertex */
+      vertsrttab[-- vertbndnum] = vertlocnum;
+    else
+      vertsrttab[vertintnum ++] = vertlocnum;
+  }
+  for (vertlocnum = vertintnum, vertbndnum = grafptr->vertlocnbr - 1; /* Restore ascending order of boundary vertices */
+       vertlocnum < vertbndnum; vertlocnum ++, vertbndnum --) {
+    Gnum                verttmpnum;
+
+    verttmpnum             = vertsrttab[vertlocnum];
+    vertsrttab[vertlocnum] = vertsrttab[vertbndnum];
+    vertsrttab[vertbndnum] = verttmpnum;
+  }
+
+  planptr->vertsrttab = vertsrttab;
+  planptr->vertintnbr = vertintnum;
+
+  *vintlocptr = vertintnum;
+  return (vertsrttab);
+}
+
+/* This routine fills the send buffer with the
+** attribute values of the local vertices to be
+** sent, in the order of the send displacements
+** of the plan. If attrsndtab is NULL, the packing
+** buffer of the plan is used, else attrsndtab
+** must be large enough to hold all send data.
+** It returns:
+** - !NULL  : pointer to the filled send buffer.
+** - NULL   : on error.
+*/
+
+static
+byte *
+dgraphHaloFill (
+const Dgraph * restrict const   grafptr,
+DgraphHaloPlan * restrict const planptr,
+const void * restrict const     attrgsttab,       /* Attribute array to diffuse     */
+int                             attrglbsiz,       /* Type extent of attribute       */
+byte *                          attrsndtab)       /* Array for packing data to send */
+{
+  byte ** restrict    attrdsptab;
+  int                 procngbnum;
+
+  if (attrsndtab == NULL) {                       /* If plan buffer to be used */
+    size_t              attrsndsiz;
+
+    attrsndsiz = MAX ((size_t) grafptr->procsndnbr * (size_t) attrglbsiz, sizeof (double)); /* Never allocate an empty buffer */
+    if (attrsndsiz > planptr->attrsndsiz) {       /* If buffer too small for this datatype, replace it */
+      if (planptr->attrsndtab != NULL)
+        memFree (planptr->attrsndtab);
+      if ((planptr->attrsndtab = memAlloc (attrsndsiz)) == NULL) {
+        errorPrint ("dgraphHaloFill: out of memory");
+        planptr->attrsndsiz = 0;
+        return (NULL);
+      }
+      planptr->attrsndsiz = attrsndsiz;
+    }
+    attrsndtab = planptr->attrsndtab;
+  }
+
+  attrdsptab = planptr->attrdsptab;               /* Only pointers of neighbor processes are used by the fill routines */
+  for (procngbnum = 0; procngbnum < grafptr->procngbnbr; procngbnum ++)
+    attrdsptab[grafptr->procngbtab[procngbnum]] = attrsndtab + (size_t) planptr->ngbsnddsptab[procngbnum] * (size_t) attrglbsiz;
 
   if (attrglbsiz == sizeof (Gnum))
     dgraphHaloFillGnum (grafptr, attrgsttab, attrglbsiz, attrdsptab);
@@ -134,9 +713,7 @@ const int * restrict const    sendcnttab)         /* Count array
   else                                            /* Generic but slower fallback routine */
     dgraphHaloFillGeneric (grafptr, attrgsttab, attrglbsiz, attrdsptab);
 
-  senddsptab[0] = 0;                              /* Pre-set send arrays for data sending routines */
-  for (procnum = 1; procnum < grafptr->procglbnbr; procnum ++)
-    senddsptab[procnum] = senddsptab[procnum - 1] + sendcnttab[procnum - 1];
+  return (attrsndtab);
 }
 
 /* This function checks that the data of proc{snd,rcv}tab
@@ -187,62 +764,22 @@ const Dgraph * restrict const grafptr)
 */
 
 static
-int
-dgraphHaloSync2 (
-Dgraph * restrict const       grafptr,
-void * restrict const         attrgsttab,         /* Attribute array to share                          */
-const MPI_Datatype            attrglbtype,        /* Attribute datatype                                */
-byte ** const                 attrsndptr,         /* Pointer to array for packing data to send         */
-int ** const                  senddspptr,         /* Pointers to communication displacement arrays     */
-int ** const                  recvdspptr,
-MPI_Request ** const          requptr)            /* Pointer to local request array for point-to-point */
+MPI_Aint
+dgraphHaloExtent (
+const MPI_Datatype            attrglbtype)        /* Attribute datatype */
 {
 #if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
-  MPI_Aint              attrglbtmp;               /* Lower bound of attribute datatype (not used)            */
+  MPI_Aint              attrglbtmp;               /* Lower bound of attribute datatype (not used) */
 #endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
-  MPI_Aint              attrglbsiz;               /* Extent of attribute datatype                            */
-  int                   procngbsiz;               /* Size of request array for point-to-point communications */
-  int                   procngbnum;
-  int * restrict        recvdsptab;
-  const int * restrict  procrcvtab;
-
-  if (dgraphGhst (grafptr) != 0) {                /* Compute ghost edge array if not already present */
-    errorPrint ("dgraphHaloSync2: cannot compute ghost edge array");
-    return (1);
-  }
-
-  procngbsiz = ((grafptr->flagval & DGRAPHCOMMPTOP) != 0) ? grafptr->procngbnbr : 0;
+  MPI_Aint              attrglbsiz;               /* Extent of attribute datatype                 */
 
 #if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
   MPI_Type_get_extent (attrglbtype, &attrglbtmp, &attrglbsiz); /* Get type extent */
 #else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
   MPI_Type_extent (attrglbtype, &attrglbsiz);     /* Get type extent */
 #endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
-  if (memAllocGroup ((void **) (void *)
-                     attrsndptr, (size_t) (grafptr->procsndnbr * attrglbsiz),
-                     senddspptr, (size_t) (grafptr->procglbnbr * MAX (sizeof (int), sizeof (byte *))), /* TRICK: use senddsptab (int *) as attrdsptab (byte **) */
-                     recvdspptr, (size_t) (grafptr->procglbnbr * sizeof (int)),
-                     requptr,    (size_t) (procngbsiz * 2      * sizeof (MPI_Request)), NULL) == NULL) {
-    errorPrint ("dgraphHaloSync2: out of memory");
-    return (1);
-  }
-
-  dgraphHaloFill (grafptr, attrgsttab, (int) attrglbsiz, *attrsndptr, *senddspptr, grafptr->procsndtab); /* Fill data arrays */
-
-  recvdsptab = *recvdspptr;
-  procrcvtab = grafptr->procrcvtab;
-  recvdsptab[0] = grafptr->vertlocnbr;
-  for (procngbnum = 1; procngbnum < grafptr->procglbnbr; procngbnum ++)
-    recvdsptab[procngbnum] = recvdsptab[procngbnum - 1] + procrcvtab[procngbnum - 1];
 
-#ifdef SCOTCH_DEBUG_DGRAPH2
-  if (dgraphHaloCheck (grafptr) != 0) {
-    errorPrint ("dgraphHaloSync2: invalid communication data");
-    return (1);
-  }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-
-  return (0);
+  return (attrglbsiz);
 }
 
 int
@@ -251,21 +788,41 @@ Dgraph * restrict const       grafptr,
 void * restrict const         attrgsttab,         /* Attribute array to share */
 const MPI_Datatype            attrglbtype)        /* Attribute datatype       */
 {
+  DgraphHaloPlan *    planptr;
   byte *              attrsndtab;                 /* Array for packing data to send */
-  int *               senddsptab;
-  int *               recvdsptab;
-  MPI_Request *       requtab;
+  MPI_Aint            attrglbsiz;                 /* Extent of attribute datatype   */
   int                 o;
 
-  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &attrsndtab, &senddsptab, &recvdsptab, &requtab) != 0) /* Prepare communication arrays */
+  if ((planptr = dgraphHaloPlan (grafptr, 1)) == NULL) { /* Get communication arrays */
+    errorPrint ("dgraphHaloSync: cannot create halo exchange plan");
+    return (1);
+  }
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (dgraphHaloCheck (grafptr) != 0) {
+    errorPrint ("dgraphHaloSync: invalid communication data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  attrglbsiz = dgraphHaloExtent (attrglbtype);
+  if ((attrsndtab = dgraphHaloFill (grafptr, planptr, attrgsttab, (int) attrglbsiz, NULL)) == NULL) /* Fill data arrays */
     return (1);
 
-  o = 0;                                          /* Assume success                               */
-  if ((grafptr->flagval & DGRAPHCOMMPTOP) != 0) { /* If point-to-point exchange                   */
+  o = 0;                                          /* Assume success */
 #if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
-    MPI_Aint              attrglbtmp;             /* Lower bound of attribute datatype (not used) */
+  if (planptr->ngbcomm != MPI_COMM_NULL) {        /* If neighborhood communicator available */
+    if (MPI_Neighbor_alltoallv (attrsndtab, planptr->ngbsndcnttab, planptr->ngbsnddsptab, attrglbtype,
+                                attrgsttab, planptr->ngbrcvcnttab, planptr->ngbrcvdsptab, attrglbtype,
+                                planptr->ngbcomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphHaloSync: communication error (1)");
+      o = 1;
+    }
+  }
+  else
 #endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
-    MPI_Aint              attrglbsiz;             /* Extent of attribute datatype                 */
+  if ((grafptr->flagval & DGRAPHCOMMPTOP) != 0) { /* If point-to-point exchange */
+    MPI_Request *         requtab;
     int                   procngbnbr;
     int                   procngbnum;
     MPI_Comm              proccomm;
@@ -273,57 +830,47 @@ const MPI_Datatype            attrglbtype)        /* Attribute datatype       */
 
     proccomm   = grafptr->proccomm;
     procngbnbr = grafptr->procngbnbr;
-#if ((defined MPI_VERSION) && (MPI_VERSION >= 3))
-    MPI_Type_get_extent (attrglbtype, &attrglbtmp, &attrglbsiz); /* Get type extent */
-#else /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
-    MPI_Type_extent (attrglbtype, &attrglbsiz);   /* Get type extent */
-#endif /* ((defined MPI_VERSION) && (MPI_VERSION >= 3)) */
+    requtab    = planptr->requtab;
     for (procngbnum = procngbnbr - 1, requnbr = 0; procngbnum >= 0; procngbnum --, requnbr ++) { /* Post receives first */
-      int                 procglbnum;
-
-      procglbnum = grafptr->procngbtab[procngbnum];
-      if (MPI_Irecv ((byte *) attrgsttab + recvdsptab[procglbnum] * attrglbsiz, grafptr->procrcvtab[procglbnum],
-                     attrglbtype, procglbnum, TAGHALO, proccomm, requtab + requnbr) != MPI_SUCCESS) {
-        errorPrint ("dgraphHaloSync: communication error (1)");
+      if (MPI_Irecv ((byte *) attrgsttab + planptr->ngbrcvdsptab[procngbnum] * attrglbsiz, planptr->ngbrcvcnttab[procngbnum],
+                     attrglbtype, grafptr->procngbtab[procngbnum], TAGHALO, proccomm, requtab + requnbr) != MPI_SUCCESS) {
+        errorPrint ("dgraphHaloSync: communication error (2)");
         o = 1;
         break;
       }
     }
 
     for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++, requnbr ++) { /* Post sends afterwards */
-      int                 procglbnum;
-
-      procglbnum = grafptr->procngbtab[procngbnum];
-      if (MPI_Isend (attrsndtab + senddsptab[procglbnum] * attrglbsiz, grafptr->procsndtab[procglbnum],
-                     attrglbtype, procglbnum, TAGHALO, proccomm, requtab + requnbr) != MPI_SUCCESS) {
-        errorPrint ("dgraphHaloSync: communication error (2)");
+      if (MPI_Isend (attrsndtab + planptr->ngbsnddsptab[procngbnum] * attrglbsiz, planptr->ngbsndcnttab[procngbnum],
+                     attrglbtype, grafptr->procngbtab[procngbnum], TAGHALO, proccomm, requtab + requnbr) != MPI_SUCCESS) {
+        errorPrint ("dgraphHaloSync: communication error (3)");
         o = 1;
         break;
       }
     }
     if (MPI_Waitall (requnbr, requtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
-      errorPrint ("dgraphHaloSync: communication error (3)");
+      errorPrint ("dgraphHaloSync: communication error (4)");
       o = 1;
     }
   }
   else {                                          /* Collective communication */
-    if (MPI_Alltoallv (attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform diffusion */
-                       attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype,
+    if (MPI_Alltoallv (attrsndtab, grafptr->procsndtab, planptr->senddsptab, attrglbtype, /* Perform diffusion */
+                       attrgsttab, grafptr->procrcvtab, planptr->recvdsptab, attrglbtype,
                        grafptr->proccomm) != MPI_SUCCESS) {
-      errorPrint ("dgraphHaloSync: communication error (4)");
+      errorPrint ("dgraphHaloSync: communication error (5)");
       o = 1;
     }
   }
 
-  memFree (attrsndtab);                           /* Free group leader */
-
   return (o);
 }
 
 /* This function performs an asynchronous collective
 ** halo diffusion operation on the ghost array given
 ** on input. It fills the given request structure with
-** the relevant data.
+** the relevant data. As several asynchronous exchanges
+** may be pending at the same time, the send buffer is
+** private to the request and not taken from the plan.
 ** It returns:
 ** - 0   : if the halo has been successfully propagated.
 ** - !0  : on error.
@@ -337,22 +884,35 @@ const MPI_Datatype            attrglbtype,        /* Attribute datatype       */
 DgraphHaloRequest * restrict  requptr)
 {
 #ifdef SCOTCH_MPI_ASYNC_COLL
-  int *               senddsptab;
-  int *               recvdsptab;
-  MPI_Request *       requtab;                    /* Not used as only a single asynchronous communication takes place */
+  DgraphHaloPlan *    planptr;
+  MPI_Aint            attrglbsiz;                 /* Extent of attribute datatype */
+  int                 o;
 
   requptr->flagval    = 1;                        /* Assume error */
   requptr->attrsndtab = NULL;                     /* No memory    */
 
-  if (dgraphHaloSync2 (grafptr, attrgsttab, attrglbtype, &requptr->attrsndtab, &senddsptab, &recvdsptab, &requtab) != 0) { /* Prepare communication arrays */
-    errorPrint ("dgraphHaloAsync: cannot create halo exchange arrays");
+  if ((planptr = dgraphHaloPlan (grafptr, 1)) == NULL) { /* Get communication arrays */
+    errorPrint ("dgraphHaloAsync: cannot create halo exchange plan");
     return;
   }
 
-  if (MPI_Ialltoallv (requptr->attrsndtab, grafptr->procsndtab, senddsptab, attrglbtype, /* Perform asynchronous collective communication */
-                      attrgsttab, grafptr->procrcvtab, recvdsptab, attrglbtype,
-                      grafptr->proccomm, &requptr->requval) != MPI_SUCCESS) {
-    errorPrint ("dgraphHaloAsync: communication error"); /* Group leader will be freed on wait routine */
+  attrglbsiz = dgraphHaloExtent (attrglbtype);
+  if ((requptr->attrsndtab = memAlloc (MAX ((size_t) grafptr->procsndnbr * (size_t) attrglbsiz, sizeof (double)))) == NULL) {
+    errorPrint ("dgraphHaloAsync: out of memory");
+    return;
+  }
+  dgraphHaloFill (grafptr, planptr, attrgsttab, (int) attrglbsiz, requptr->attrsndtab); /* Fill data arrays */
+
+  if (planptr->ngbcomm != MPI_COMM_NULL)          /* If neighborhood communicator available */
+    o = MPI_Ineighbor_alltoallv (requptr->attrsndtab, planptr->ngbsndcnttab, planptr->ngbsnddsptab, attrglbtype,
+                                 attrgsttab, planptr->ngbrcvcnttab, planptr->ngbrcvdsptab, attrglbtype,
+                                 planptr->ngbcomm, &requptr->requval);
+  else
+    o = MPI_Ialltoallv (requptr->attrsndtab, grafptr->procsndtab, planptr->senddsptab, attrglbtype, /* Perform asynchronous collective communication */
+                        attrgsttab, grafptr->procrcvtab, planptr->recvdsptab, attrglbtype,
+                        grafptr->proccomm, &requptr->requval);
+  if (o != MPI_SUCCESS) {
+    errorPrint ("dgraphHaloAsync: communication error"); /* Send buffer will be freed on wait routine */
     return;
   }
   requptr->flagval = -1;                          /* Communication successfully launched */
@@ -361,10 +921,9 @@ DgraphHaloRequest * restrict  requptr)
 #endif /* SCOTCH_MPI_ASYNC_COLL */
 }
 
-/* This function performs an asynchronous collective
-** halo diffusion operation on the ghost array given
-** on input. It fills the given request structure with
-** the relevant data.
+/* This function waits for the completion of an
+** asynchronous halo diffusion operation, and frees
+** the send buffer of the given request.
 ** It returns:
 ** - 0   : if the halo has been successfully propagated.
 ** - !0  : on error.
@@ -378,7 +937,7 @@ DgraphHaloRequest * restrict  requptr)
   if (requptr->flagval == -1)                     /* If communication launched */
     requptr->flagval = (MPI_Wait (&requptr->requval, MPI_STATUS_IGNORE) != MPI_SUCCESS); /* Wait for completion of asynchronous collective communication */
 
-  if (requptr->attrsndtab != NULL)                /* Free group leader if it was successfully allocated before */
+  if (requptr->attrsndtab != NULL)                /* Free send buffer if it was successfully allocated before */
     memFree (requptr->attrsndtab);
 #endif /* SCOTCH_MPI_ASYNC_COLL */
 
@@ -48,15 +48,75 @@
 /**                # Version 6.1  : from : 24 dec 2021     **/
 /**                                 to   : 24 dec 2021     **/
 /**                # Version 7.0  : from : 18 dec 2021     **/
-/**                                 to   : 18 dec 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+** The defines.
+*/
+
+/*+ Alignment of the parts of node segments. +*/
+
+#define DGRAPHHALONODEALGN          16            /* Must be a power of two */
+
+#define DGRAPHHALONODESIZE(s)       (((s) + DGRAPHHALONODEALGN - 1) & ~((size_t) (DGRAPHHALONODEALGN - 1)))
+
 /*
 ** The type and structure definitions.
 */
 
-/* Sort structure for ghost edges. */
+/*+ The header of the segment of each process
+    in the node shared-memory window. It is
+    followed by two buffers, used alternately
+    by successive exchanges. Each buffer starts
+    with the counts and displacements of the
+    messages bound to every process of the node,
+    followed by the message data.               +*/
+
+typedef struct DgraphHaloNodeHead_ {
+  size_t                    bufsiz;               /*+ Size of each buffer, in bytes +*/
+} DgraphHaloNodeHead;
+
+/*+ The halo exchange plan, attached to the
+    graph on its first halo exchange. All of its
+    arrays are grouped with the plan structure,
+    save for the packing buffer and the node
+    exchange arrays.                             +*/
+
+typedef struct DgraphHaloPlan_ {
+  MPI_Comm                  proccomm;             /*+ Graph communicator the plan was built for            +*/
+  MPI_Comm                  ngbcomm;              /*+ Neighborhood communicator, or MPI_COMM_NULL          +*/
+  int                       passnbr;              /*+ Number of exchanges performed with the plan          +*/
+  int *                     senddsptab;           /*+ Send displacements per process [procglbnbr]          +*/
+  int *                     recvdsptab;           /*+ Receive displacements per process [procglbnbr]       +*/
+  byte **                   attrdsptab;           /*+ Packing pointers per process [procglbnbr]            +*/
+  int *                     ngbsndcnttab;         /*+ Send counts per neighbor process [procngbnbr]        +*/
+  int *                     ngbsnddsptab;         /*+ Send displacements per neighbor process              +*/
+  int *                     ngbrcvcnttab;         /*+ Receive counts per neighbor process                  +*/
+  int *                     ngbrcvdsptab;         /*+ Receive displacements per neighbor process           +*/
+  MPI_Request *             requtab;              /*+ Requests for point-to-point exchange [2*procngbnbr]  +*/
+  byte *                    attrsndtab;           /*+ Packing buffer for synchronous exchanges             +*/
+  size_t                    attrsndsiz;           /*+ Size of packing buffer, in bytes                     +*/
+  Gnum *                    vertsrttab;           /*+ Local vertices, interior ones first, or NULL         +*/
+  Gnum                      vertintnbr;           /*+ Number of interior vertices, without ghost neighbors +*/
+#ifdef DGRAPHHALONODE
+  int                       nodeval;              /*+ Node state: -1 if not set up, 0 if unused, 1 if used +*/
+  MPI_Comm                  nodecomm;             /*+ Communicator of the processes of the node            +*/
+  MPI_Win                   nodewin;              /*+ Shared-memory window of the node                     +*/
+  int                       nodeprocnbr;          /*+ Number of processes of the node                      +*/
+  int                       nodeproclocnum;       /*+ Rank of process in node communicator                 +*/
+  int                       nodeseqnum;           /*+ Number of node exchanges performed                   +*/
+  size_t                    nodeitemsiz;          /*+ Space reserved per halo vertex in buffers            +*/
+  size_t                    nodehedsiz;           /*+ Size of the header of each buffer                    +*/
+  byte *                    nodesegtab;           /*+ Local segment of the window                          +*/
+  byte **                   nodeptrtab;           /*+ Segments of neighbors, or NULL if not on the node    +*/
+  int *                     nodengbtab;           /*+ Node ranks of neighbors, or -1 if not on the node    +*/
+  MPI_Request *             nodereqtab;           /*+ Requests of flag messages [2*procngbnbr]             +*/
+#endif /* DGRAPHHALONODE */
+} DgraphHaloPlan;
+
+/*+ The asynchronous halo request. +*/
 
 typedef struct DgraphHaloRequest_ {
   int                       flagval;
@@ -72,5 +132,6 @@ typedef struct DgraphHaloRequest_ {
 
 void                        dgraphHaloAsync     (Dgraph * restrict const, void * restrict const, const MPI_Datatype, DgraphHaloRequest * restrict);
 int                         dgraphHaloWait      (DgraphHaloRequest * restrict);
+const Gnum *                dgraphHaloVert      (Dgraph * restrict const, Gnum * restrict const);
 
 int                         dgraphHaloCheck     (const Dgraph * restrict const);
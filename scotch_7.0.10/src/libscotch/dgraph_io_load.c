@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 25 aug 2012     **/
 /**                                 to   : 18 nov 2012     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,13 +63,16 @@
 #include "dgraph.h"
 #include "dgraph_allreduce.h"
 #include "dgraph_io_load.h"
+#include "graph_io_bin.h"
 
 /* This routine loads a distributed source
 ** graph from the given stream(s). Either
 ** one process holds a non-NULL stream
 ** of a centralized graph, or all of them
 ** hold valid streams to either a centralized
-** or a distributed graph.
+** or a distributed graph. Binary graph
+** files are recognized by their magic
+** string.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -101,12 +104,18 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
   reduloctab[2] = (Gnum) flagval;                 /* Exchange flagval to check it is the same for all */
   reduloctab[3] = - (Gnum) flagval;
   reduloctab[4] = 0;                              /* Set uneffective values for versval */
-  reduloctab[5] = -2;
+  reduloctab[5] = -3;
   reduloctab[6] =                                 /* Assume everything will be fine */
   reduloctab[7] =                                 /* Assume does not have a stream  */
   reduloctab[8] = 0;
   if (fileptr != NULL) {
-    if (intLoad (fileptr, &versval) != 1) {       /* Read version number */
+    int                 charval;
+
+    if ((charval = getc (fileptr)) != EOF)        /* Peek first character of stream */
+      ungetc (charval, fileptr);
+    if (charval == GRAPHBINMAGIC[0])              /* If binary graph file       */
+      versval = 3;                                /* Use internal version value */
+    else if (intLoad (fileptr, &versval) != 1) {  /* Read version number        */
       errorPrint ("dgraphLoad: bad input");
       versval       = 0;
       reduloctab[6] = 1;
@@ -143,7 +152,13 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
     return (1);
   }
 
-  if (reduglbtab[4] == 2) {                       /* If distributed graph format              */
+  if (reduglbtab[4] == 3) {                       /* If binary centralized graph format */
+    if (reduglbtab[7] == 1)                       /* If only one reader stream          */
+      return (dgraphLoadCentBin (grafptr, fileptr, baseval, flagval));
+    else if (reduglbtab[7] == grafptr->procglbnbr)
+      return (dgraphLoadMultiBin (grafptr, fileptr, baseval, flagval)); /* Each process maps its own part */
+  }
+  else if (reduglbtab[4] == 2) {                  /* If distributed graph format              */
     if (reduglbtab[7] == grafptr->procglbnbr)     /* If as many input streams as processes    */
       return (dgraphLoadDist (grafptr, fileptr, baseval, flagval)); /* Read distributed graph */
   }
@@ -903,3 +918,292 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
   errorPrint ("dgraphLoadMulti: not implemented");
   return (1);
 }
+
+/* This routine loads a centralized binary
+** source graph from a single stream. The
+** reader process maps the graph file as a
+** whole, and scatters it across processes.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadCentBin (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
+FILE * const                fileptr,              /* One single centralized stream        */
+Gnum                        baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval)              /* Graph loading flags                  */
+{
+  Graph               cgrfdat;                    /* Centralized graph of reader process */
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+  cheklocval = 0;
+  if (fileptr != NULL) {
+    graphInit (&cgrfdat);
+    if (graphLoadBin (&cgrfdat, fileptr, baseval, flagval) != 0)
+      cheklocval = 1;
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadCentBin: communication error");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if ((fileptr != NULL) && (cheklocval == 0))
+      graphExit (&cgrfdat);
+    return (1);
+  }
+
+  o = dgraphScatter (grafptr, (fileptr != NULL) ? &cgrfdat : NULL);
+
+  if (fileptr != NULL)
+    graphExit (&cgrfdat);
+
+  return (o);
+}
+
+/* This routine loads a distributed source
+** graph from a binary centralized source
+** graph file replicated on all of the
+** streams. Each process only reads its
+** own part of the vertex arrays, and maps
+** in memory the matching slices of the edge
+** arrays when its stream is a regular file.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadMultiBin (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
+FILE * const                fileptr,              /* Duplicated centralized streams       */
+Gnum                        baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval)              /* Graph loading flags                  */
+{
+  GraphBinHead        headdat;
+  GraphBinOffs        offsdat;
+  off_t               headoff;                    /* Offset of header in stream, if known  */
+  off_t               curoval;                    /* Current offset with respect to header */
+  Gnum                vertlocbas;                 /* Global index of first local vertex    */
+  Gnum                vertlocnbr;
+  Gnum                vertlocnnd;
+  Gnum                vertlocnum;
+  Gnum * restrict     vertloctax;
+  Gnum *              vertlocptr;
+  Gnum                velolocnbr;
+  Gnum                velolocsum;
+  Gnum * restrict     veloloctax;
+  Gnum                vlbllocnbr;
+  Gnum * restrict     vlblloctax;
+  Gnum                edgelocbas;                 /* Index of first local arc in file arrays */
+  Gnum                edgelocnbr;
+  Gnum                edgelocnnd;
+  Gnum                edgelocnum;
+  Gnum * restrict     edgeloctax;
+  Gnum * restrict     edloloctax;
+  Gnum                edlolocnbr;
+  Gnum                degrlocmax;
+  Gnum                baseadj;
+  Gnum                reduloctab[9];
+  Gnum                reduglbtab[9];
+  int                 flagloc;                    /* Extra flags of distributed graph */
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (fileptr == NULL) {
+    errorPrint ("dgraphLoadMultiBin: invalid parameter");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+#ifndef COMMON_OS_WINDOWS
+  headoff = ftello (fileptr);                     /* Negative if stream not seekable */
+#else /* COMMON_OS_WINDOWS */
+  headoff = -1;
+#endif /* COMMON_OS_WINDOWS */
+
+  reduloctab[0] = 0;                              /* Assume everything will be fine */
+  if (graphBinHeadLoad (&headdat, fileptr) != 0) {
+    memSet (&headdat, 0, sizeof (GraphBinHead));
+    reduloctab[0] = 1;
+  }
+  reduloctab[1] =   headdat.baseval;              /* Check that all headers are identical */
+  reduloctab[2] = - headdat.baseval;
+  reduloctab[3] =   headdat.vertnbr;
+  reduloctab[4] = - headdat.vertnbr;
+  reduloctab[5] =   headdat.edgenbr;
+  reduloctab[6] = - headdat.edgenbr;
+  reduloctab[7] =   (Gnum) headdat.propval;
+  reduloctab[8] = - (Gnum) headdat.propval;
+
+  if (MPI_Allreduce (reduloctab, reduglbtab, 9, GNUM_MPI, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadMultiBin: communication error (1)");
+    return (1);
+  }
+  if (reduglbtab[0] != 0)
+    return (1);
+  if ((reduglbtab[2] != - reduglbtab[1]) ||
+      (reduglbtab[4] != - reduglbtab[3]) ||
+      (reduglbtab[6] != - reduglbtab[5]) ||
+      (reduglbtab[8] != - reduglbtab[7])) {
+    errorPrint ("dgraphLoadMultiBin: inconsistent graph headers");
+    return (1);
+  }
+
+  if (baseval == -1) {                            /* If keep file graph base     */
+    baseval = headdat.baseval;                    /* Set graph base as file base */
+    baseadj = 0;                                  /* No base adjustment needed   */
+  }
+  else                                            /* If set graph base  */
+    baseadj = baseval - headdat.baseval;          /* Update base adjust */
+
+  graphBinOffs (&headdat, &offsdat);
+  curoval = (off_t) sizeof (GraphBinHead);
+
+  vertlocnbr = DATASIZE (headdat.vertnbr, grafptr->procglbnbr, grafptr->proclocnum);
+  vertlocbas = DATASCAN (headdat.vertnbr, grafptr->procglbnbr, grafptr->proclocnum);
+  vertlocnnd = vertlocnbr + baseval;
+  velolocnbr = (((headdat.propval & GRAPHBINHASVELO) != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertlocnbr : 0;
+  vlbllocnbr = ((headdat.propval & GRAPHBINHASVLBL) != 0) ? vertlocnbr : 0;
+  vlblloctax =
+  veloloctax =
+  vertloctax =
+  edgeloctax =
+  edloloctax = NULL;
+  edgelocbas =                                    /* Avoid "may be used uninitialized" warnings */
+  edgelocnbr = 0;
+  flagloc    = DGRAPHFREETABS | DGRAPHVERTGROUP;
+  cheklocval = 0;
+  if ((vertlocptr = memAlloc ((vertlocnbr + 1 + velolocnbr + vlbllocnbr) * sizeof (Gnum))) == NULL) {
+    errorPrint ("dgraphLoadMultiBin: out of memory (1)");
+    cheklocval = 1;
+  }
+  else {
+    vertloctax  =
+    vertlocptr -= baseval;
+    vertlocptr += vertlocnbr + 1;
+    if (velolocnbr != 0) {
+      veloloctax  = vertlocptr;
+      vertlocptr += vertlocnbr;
+    }
+    if (vlbllocnbr != 0)
+      vlblloctax = vertlocptr;
+
+    if ((graphBinRead (fileptr, &curoval, offsdat.vertoff + (off_t) vertlocbas * sizeof (Gnum),
+                       vertloctax + baseval, (vertlocnbr + 1) * sizeof (Gnum)) != 0) ||
+        ((veloloctax != NULL) &&
+         (graphBinRead (fileptr, &curoval, offsdat.velooff + (off_t) vertlocbas * sizeof (Gnum),
+                        veloloctax + baseval, vertlocnbr * sizeof (Gnum)) != 0)) ||
+        ((vlblloctax != NULL) &&
+         (graphBinRead (fileptr, &curoval, offsdat.vlbloff + (off_t) vertlocbas * sizeof (Gnum),
+                        vlblloctax + baseval, vertlocnbr * sizeof (Gnum)) != 0))) {
+      errorPrint ("dgraphLoadMultiBin: bad input (1)");
+      cheklocval = 1;
+    }
+    else {
+      edgelocbas = vertloctax[baseval] - headdat.baseval;
+      edgelocnbr = vertloctax[vertlocnnd] - vertloctax[baseval];
+      if ((edgelocbas < 0) || (edgelocnbr < 0) ||
+          ((edgelocbas + edgelocnbr) > headdat.edgenbr)) {
+        errorPrint ("dgraphLoadMultiBin: invalid vertex array");
+        cheklocval = 1;
+      }
+    }
+  }
+
+  if (cheklocval == 0) {
+    edlolocnbr = (((headdat.propval & GRAPHBINHASEDLO) != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? edgelocnbr : 0;
+
+    if (headoff >= 0) {                           /* If stream may be mapped, try to map edge slices in place */
+      Gnum *              edgelocptr;
+      Gnum *              edlolocptr;
+
+      edgelocptr = fileMap (fileptr, headoff + offsdat.edgeoff + (off_t) edgelocbas * sizeof (Gnum), edgelocnbr * sizeof (Gnum));
+      edlolocptr = ((edgelocptr != NULL) && (edlolocnbr != 0))
+                   ? fileMap (fileptr, headoff + offsdat.edlooff + (off_t) edgelocbas * sizeof (Gnum), edlolocnbr * sizeof (Gnum))
+                   : NULL;
+      if ((edgelocptr != NULL) && ((edlolocnbr == 0) || (edlolocptr != NULL))) {
+        edgeloctax = edgelocptr - baseval;
+        edloloctax = (edlolocptr != NULL) ? (edlolocptr - baseval) : NULL;
+        flagloc   |= DGRAPHEDGEMMAP;
+      }
+      else if (edgelocptr != NULL)                /* Partial mapping is of no use */
+        fileUnmap (edgelocptr);
+    }
+    if (edgeloctax == NULL) {                     /* If edge slices could not be mapped, read them */
+      if ((edgeloctax = memAlloc ((edgelocnbr + edlolocnbr) * sizeof (Gnum))) == NULL) {
+        errorPrint ("dgraphLoadMultiBin: out of memory (2)");
+        cheklocval = 1;
+      }
+      else {
+        edgeloctax -= baseval;
+        edloloctax  = (edlolocnbr != 0) ? (edgeloctax + edgelocnbr) : NULL;
+        flagloc    |= DGRAPHEDGEGROUP;
+        if ((graphBinRead (fileptr, &curoval, offsdat.edgeoff + (off_t) edgelocbas * sizeof (Gnum),
+                           edgeloctax + baseval, edgelocnbr * sizeof (Gnum)) != 0) ||
+            ((edloloctax != NULL) &&
+             (graphBinRead (fileptr, &curoval, offsdat.edlooff + (off_t) edgelocbas * sizeof (Gnum),
+                            edloloctax + baseval, edlolocnbr * sizeof (Gnum)) != 0))) {
+          errorPrint ("dgraphLoadMultiBin: bad input (2)");
+          cheklocval = 1;
+        }
+      }
+    }
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadMultiBin: communication error (2)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (edgeloctax != NULL) {
+      if ((flagloc & DGRAPHEDGEMMAP) != 0) {
+        fileUnmap (edgeloctax + baseval);
+        if (edloloctax != NULL)
+          fileUnmap (edloloctax + baseval);
+      }
+      else
+        memFree (edgeloctax + baseval);
+    }
+    if (vertloctax != NULL)
+      memFree (vertloctax + baseval);
+    return (1);
+  }
+
+  edgelocnnd = edgelocnbr + baseval;
+  for (vertlocnum = vertlocnnd; vertlocnum >= baseval; vertlocnum --) /* Rebase local vertex array */
+    vertloctax[vertlocnum] -= edgelocbas + headdat.baseval - baseval;
+  for (vertlocnum = baseval, degrlocmax = 0; vertlocnum < vertlocnnd; vertlocnum ++) {
+    Gnum                degrlocval;
+
+    degrlocval = vertloctax[vertlocnum + 1] - vertloctax[vertlocnum];
+    if (degrlocmax < degrlocval)
+      degrlocmax = degrlocval;
+  }
+  if (baseadj != 0) {                             /* If base must be changed, update private copies of mapped pages */
+    for (edgelocnum = baseval; edgelocnum < edgelocnnd; edgelocnum ++)
+      edgeloctax[edgelocnum] += baseadj;
+  }
+  if (veloloctax != NULL) {
+    for (vertlocnum = baseval, velolocsum = 0; vertlocnum < vertlocnnd; vertlocnum ++)
+      velolocsum += veloloctax[vertlocnum];
+  }
+  else
+    velolocsum = vertlocnbr;
+
+  o = dgraphBuild2 (grafptr, baseval,             /* Build distributed graph; arcs already hold vertex indices */
+                    vertlocnbr, vertlocnbr, vertloctax, vertloctax + 1, veloloctax, velolocsum, NULL, NULL,
+                    edgelocnbr, edgelocnbr, edgeloctax, NULL, edloloctax, degrlocmax);
+  grafptr->flagval   |= flagloc;
+  grafptr->vlblloctax = vlblloctax;               /* Add labels afterwards, since no relabeling needed */
+
+  return (o);
+}
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,4 +56,6 @@
 static int                  dgraphLoadCent      (Dgraph * restrict const, FILE * const, Gnum, const GraphLoadFlag, const int);
 static int                  dgraphLoadDist      (Dgraph * restrict const, FILE * const, Gnum, const GraphLoadFlag);
 static int                  dgraphLoadMulti     (Dgraph * restrict const, FILE * const, Gnum, const GraphLoadFlag);
+static int                  dgraphLoadCentBin   (Dgraph * restrict const, FILE * const, Gnum, const GraphLoadFlag);
+static int                  dgraphLoadMultiBin  (Dgraph * restrict const, FILE * const, Gnum, const GraphLoadFlag);
 #endif /* SCOTCH_DGRAPH_IO_LOAD */
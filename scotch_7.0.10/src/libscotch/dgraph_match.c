@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 10 oct 2013     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -96,6 +96,10 @@ const float                         probval)
   vertlocnbr = grafptr->vertlocnbr;
   vertgstnbr = grafptr->vertgstnbr;
 
+#ifdef DGRAPHMATCHNODE
+  mateptr->nodengbtab = NULL;                     /* Node-aware mode not yet set up */
+#endif /* DGRAPHMATCHNODE */
+
   if (memAllocGroup ((void **) (void *)
                      &mateptr->procvgbtab, (size_t) ((grafptr->procngbnbr + 1) * sizeof (Gnum)),
                      &mateptr->queuloctab, (size_t) (vertlocnbr * sizeof (Gnum)), NULL) == NULL) {
@@ -47,10 +47,22 @@
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 03 oct 2012     **/
 /**                # Version 7.0  : from : 30 mar 2023     **/
-/**                                 to   : 30 mar 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+** The defines.
+*/
+
+/*+ Node-aware matching, where matching messages
+    between processes sharing the same node go
+    through the node exchanges of the halo plan. +*/
+
+#ifdef DGRAPHHALONODE
+#define DGRAPHMATCHNODE
+#endif /* DGRAPHHALONODE */
+
 /*
 ** The type and structure definitions.
 */
@@ -65,6 +77,9 @@ typedef struct DgraphMatchData_ {
   Gnum                      queulocnbr;           /*+ Number of enqueued unmated vertices                         +*/
   Gnum *                    procvgbtab;           /*+ Global vertex number bounds for neighboring processors [+1] +*/
   float                     probval;              /*+ Vertex mating probability (1.0 is certain)                  +*/
+#ifdef DGRAPHMATCHNODE
+  const int *               nodengbtab;           /*+ Node ranks of neighbors, -1 if off node, or NULL if unused  +*/
+#endif /* DGRAPHMATCHNODE */
 } DgraphMatchData;
 
 /*
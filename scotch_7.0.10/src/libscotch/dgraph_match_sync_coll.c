@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 27 dec 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 30 mar 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +65,102 @@
 /*                                   */
 /*************************************/
 
+#ifdef DGRAPHMATCHNODE
+
+/* This routine exchanges a set of matching
+** messages in node-aware mode. Messages bound
+** to neighbors of the same node go through the
+** node exchanges of the halo plan, and only
+** messages bound to neighbors of other nodes
+** are sent, by point-to-point communication.
+** Counts and displacements are expressed in
+** Gnum's, and receive counts are computed on
+** the fly. Receive sub-arrays are bounded by
+** the item displacements of rcvidxtab.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphMatchSyncCollNode (
+DgraphMatchData * restrict const  mateptr,
+DgraphCoarsenVert * const         snddattab,      /*+ Outgoing messages                            +*/
+const int * const                 snddsptab,      /*+ Send displacements, in Gnum's                +*/
+const int * const                 sndcnttab,      /*+ Send counts, in Gnum's                       +*/
+DgraphCoarsenVert * const         rcvdattab,      /*+ Incoming messages                            +*/
+const int * const                 rcvdsptab,      /*+ Receive displacements, in Gnum's             +*/
+int * const                       rcvcnttab,      /*+ Receive counts, in Gnum's, to be computed     +*/
+const int * const                 rcvidxtab,      /*+ Item displacements of receive sub-arrays [+1] +*/
+const int                         tagval)
+{
+  int                 procngbnum;
+
+  Dgraph * restrict const     grafptr    = mateptr->c.finegrafptr;
+  const int * restrict const  procngbtab = grafptr->procngbtab;
+  const int * restrict const  nodengbtab = mateptr->nodengbtab;
+  MPI_Request * const         nrcvreqtab = mateptr->c.nrcvreqtab;
+  MPI_Request * const         nsndreqtab = mateptr->c.nsndreqtab;
+  const int                   procngbnbr = grafptr->procngbnbr;
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* Post receives from neighbors of other nodes */
+    int                 procglbnum;
+
+    nrcvreqtab[procngbnum] = MPI_REQUEST_NULL;
+    if (nodengbtab[procngbnum] >= 0)
+      continue;
+
+    procglbnum = procngbtab[procngbnum];
+    if (MPI_Irecv ((Gnum *) rcvdattab + rcvdsptab[procglbnum], 2 * (rcvidxtab[procglbnum + 1] - rcvidxtab[procglbnum]), GNUM_MPI,
+                   procglbnum, tagval, grafptr->proccomm, &nrcvreqtab[procngbnum]) != MPI_SUCCESS) {
+      errorPrint ("dgraphMatchSyncCollNode: communication error (1)");
+      return (1);
+    }
+  }
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* Send to neighbors of other nodes */
+    int                 procglbnum;
+
+    nsndreqtab[procngbnum] = MPI_REQUEST_NULL;
+    if (nodengbtab[procngbnum] >= 0)
+      continue;
+
+    procglbnum = procngbtab[procngbnum];
+    if (MPI_Isend ((Gnum *) snddattab + snddsptab[procglbnum], sndcnttab[procglbnum], GNUM_MPI,
+                   procglbnum, tagval, grafptr->proccomm, &nsndreqtab[procngbnum]) != MPI_SUCCESS) {
+      errorPrint ("dgraphMatchSyncCollNode: communication error (2)");
+      return (1);
+    }
+  }
+
+  if ((dgraphHaloNodeSend (grafptr, snddattab, sizeof (Gnum), snddsptab, sndcnttab) != 0) || /* Exchange messages within the node meanwhile */
+      (dgraphHaloNodeRecv (grafptr, rcvdattab, sizeof (Gnum), rcvdsptab, rcvcnttab) != 0)) {
+    errorPrint ("dgraphMatchSyncCollNode: cannot exchange node messages");
+    return (1);
+  }
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    MPI_Status          statdat;
+
+    if (nodengbtab[procngbnum] >= 0)
+      continue;
+
+    if ((MPI_Wait (&nrcvreqtab[procngbnum], &statdat) != MPI_SUCCESS) ||
+        (MPI_Get_count (&statdat, GNUM_MPI, &rcvcnttab[procngbtab[procngbnum]]) != MPI_SUCCESS)) {
+      errorPrint ("dgraphMatchSyncCollNode: communication error (3)");
+      return (1);
+    }
+  }
+  if (MPI_Waitall (procngbnbr, nsndreqtab, MPI_STATUSES_IGNORE) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncCollNode: communication error (4)");
+    return (1);
+  }
+
+  return (0);
+}
+
+#endif /* DGRAPHMATCHNODE */
+
 /* This routine performs a round of communication
 ** to synchronize enqueued matching requests across
 ** processors.
@@ -203,14 +299,26 @@ DgraphMatchData * restrict  mateptr)              /* [norestrict:async] */
     vsndcnttab[procglbnum] = 2 * (nsndidxtab[procngbnum] - mateptr->c.vsnddsptab[procglbnum]);
   }
 
-  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (2)");
-    return (1);
+#ifdef DGRAPHMATCHNODE
+  if (mateptr->nodengbtab != NULL) {              /* If messages to neighbors of the same node go through shared memory */
+    if (dgraphMatchSyncCollNode (mateptr, vsnddattab, vsnddsptab, vsndcnttab,
+                                 mateptr->c.vrcvdattab, vrcvdsptab, vrcvcnttab, mateptr->c.vrcvdsptab, TAGMATCH) != 0) {
+      errorPrint ("dgraphMatchSyncColl: communication error (4)");
+      return (1);
+    }
   }
-  if (MPI_Alltoallv (vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
-                     mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (3)");
-    return (1);
+  else
+#endif /* DGRAPHMATCHNODE */
+  {
+    if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphMatchSyncColl: communication error (2)");
+      return (1);
+    }
+    if (MPI_Alltoallv (vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
+                       mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphMatchSyncColl: communication error (3)");
+      return (1);
+    }
   }
 
   matelocnbr = mateptr->matelocnbr;
@@ -354,6 +462,16 @@ DgraphMatchData * restrict  mateptr)              /* [norestrict:async] */
     }
   }
 
+#ifdef DGRAPHMATCHNODE
+  if (mateptr->nodengbtab != NULL) {              /* Answers go back through shared memory as well */
+    if (dgraphMatchSyncCollNode (mateptr, mateptr->c.vrcvdattab, vrcvdsptab, vrcvcnttab,
+                                 vsnddattab, vsnddsptab, vsndcnttab, mateptr->c.vsnddsptab, TAGMATCH + 1) != 0) {
+      errorPrint ("dgraphMatchSyncColl: communication error (5)");
+      return (1);
+    }
+  }
+  else
+#endif /* DGRAPHMATCHNODE */
   if (MPI_Alltoallv (mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI,
                      vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
     errorPrint ("dgraphMatchSyncColl: communication error (3)");
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2010,2012,2014,2018,2019,2021,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2010,2012,2014,2018,2019,2021,2023-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 09 feb 2021     **/
 /**                                 to   : 22 jun 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 13 aug 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -280,6 +280,8 @@ char *                      argv[])
   subsFill ("##SCOTCH_NAME_SUFFIX", suffptr);
   if (suffptr[0] != '\0') {                       /* If suffix provided */
 #ifdef SCOTCH_RENAME_ALL
+    subsSuffix ("SCOTCH_COLORDEFAULT");
+    subsSuffix ("SCOTCH_COLORGREEDY");
     subsSuffix ("SCOTCH_COARSENNONE");
     subsSuffix ("SCOTCH_COARSENFOLD");
     subsSuffix ("SCOTCH_COARSENFOLDDUP");
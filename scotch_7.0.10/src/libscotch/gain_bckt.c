@@ -0,0 +1,569 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : gain_bckt.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles bucket array gain   **/
+/**                structures.                             **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GAIN_BCKT
+
+#include "module.h"
+#include "common.h"
+#include "gain_bckt.h"
+
+/*****************************************/
+/*                                       */
+/* These routines handle bucket arrays.  */
+/*                                       */
+/*****************************************/
+
+/* This routine returns the index of the
+** lowest bit set in the given non-zero word.
+*/
+
+#if ((defined __GNUC__) || (defined __clang__))
+#define gainBcktBitFrst(w)          ((INT) __builtin_ctzll ((unsigned long long) (w)))
+#else /* ((defined __GNUC__) || (defined __clang__)) */
+static inline
+INT
+gainBcktBitFrst (
+UINT64                      wordval)
+{
+  INT                 bitsnum;
+
+  for (bitsnum = 0; (wordval & 1) == 0; wordval >>= 1, bitsnum ++) ;
+
+  return (bitsnum);
+}
+#endif /* ((defined __GNUC__) || (defined __clang__)) */
+
+/* This routine returns the index of the
+** highest bit set in the given non-zero word.
+*/
+
+#if ((defined __GNUC__) || (defined __clang__))
+#define gainBcktBitLast(w)          ((INT) (63 - __builtin_clzll ((unsigned long long) (w))))
+#else /* ((defined __GNUC__) || (defined __clang__)) */
+static inline
+INT
+gainBcktBitLast (
+UINT64                      wordval)
+{
+  INT                 bitsnum;
+
+  for (bitsnum = 0; (wordval >>= 1) != 0; bitsnum ++) ;
+
+  return (bitsnum);
+}
+#endif /* ((defined __GNUC__) || (defined __clang__)) */
+
+/* This routine computes the bucket key of
+** the given gain value. Gains of absolute
+** value smaller than 2^GAINBCKTEXACTBITS are
+** their own key. Beyond, the key comprises the
+** position of the highest bit of the absolute
+** value of the gain, followed by its next
+** GAINBCKTSUBBITS bits. Keys therefore preserve
+** gain order, and gains sharing the same key
+** differ by less than 2^-GAINBCKTSUBBITS times
+** their value.
+** It returns:
+** - the key, in ]-GAINBCKTKEYMAX,GAINBCKTKEYMAX[.
+*/
+
+static
+INT
+gainBcktKey (
+const INT                   gainval)
+{
+  UINT64              absval;
+  INT                 bitsnum;
+  INT                 keyval;
+
+  absval = (gainval < 0) ? ((UINT64) 0 - (UINT64) gainval) : (UINT64) gainval; /* Avoid overflow on most negative value */
+  if (absval < ((UINT64) 1 << GAINBCKTEXACTBITS))
+    return (gainval);
+
+  bitsnum = gainBcktBitLast (absval);
+  keyval  = (1 << GAINBCKTEXACTBITS) + ((bitsnum - GAINBCKTEXACTBITS) << GAINBCKTSUBBITS) +
+            (INT) ((absval >> (bitsnum - GAINBCKTSUBBITS)) & ((1 << GAINBCKTSUBBITS) - 1));
+
+  return ((gainval < 0) ? - keyval : keyval);
+}
+
+/* This routine allocates the bucket and
+** bitmap arrays for the given number of
+** buckets, which must be a power of two
+** at least equal to GAINBCKTSIZEINIT. Bucket
+** heads need not be initialized, since only
+** the heads of buckets flagged as non-empty
+** in the bitmap are meaningful. The previous
+** arrays, if any, are not freed.
+** It returns:
+** - 0   : in case of success.
+** - !0  : on error.
+*/
+
+static
+int
+gainBcktAlloc (
+GainBckt * const            bcktptr,
+const INT                   bcktnbr)
+{
+  INT *               bckttab;
+  UINT64 *            bmaptab;
+  UINT64 *            bsumtab;
+  INT                 wordnbr;
+
+  wordnbr = bcktnbr >> GAINBCKTWORDBITS;
+  if (memAllocGroup ((void **) (void *)
+                     &bckttab, (size_t) (bcktnbr * sizeof (INT)),
+                     &bmaptab, (size_t) (wordnbr * sizeof (UINT64)),
+                     &bsumtab, (size_t) (gainBcktWordNbr (wordnbr) * sizeof (UINT64)), NULL) == NULL)
+    return (1);
+
+  memSet (bmaptab, 0, wordnbr * sizeof (UINT64)); /* All buckets are empty */
+  memSet (bsumtab, 0, gainBcktWordNbr (wordnbr) * sizeof (UINT64));
+
+  bcktptr->bcktnbr = bcktnbr;
+  bcktptr->bckttab = bckttab;                     /* Group leader */
+  bcktptr->bmaptab = bmaptab;
+  bcktptr->bsumtab = bsumtab;
+
+  return (0);
+}
+
+/* This routine searches the bitmaps for the
+** first non-empty bucket of index greater
+** than or equal to the given index. Its cost
+** does not depend on the number of empty
+** buckets in-between, but only on the number
+** of zero words of the summary bitmap.
+** It returns:
+** - bcktnbr   : if no such bucket.
+** - [0,bcktnbr[ : index of the bucket.
+*/
+
+static
+INT
+gainBcktSrch (
+const GainBckt * const      bcktptr,
+const INT                   bcktnum)
+{
+  const UINT64 * restrict bmaptab;
+  const UINT64 * restrict bsumtab;
+  UINT64                  wordval;
+  INT                     wordnbr;
+  INT                     wordnum;
+  INT                     sumnnd;
+  INT                     sumnum;
+
+  if (bcktnum >= bcktptr->bcktnbr)
+    return (bcktptr->bcktnbr);
+
+  bmaptab = bcktptr->bmaptab;
+  wordnum = bcktnum >> GAINBCKTWORDBITS;
+  wordval = bmaptab[wordnum] & ((~ ((UINT64) 0)) << (bcktnum & GAINBCKTWORDMASK));
+  if (wordval == 0) {                             /* If no non-empty bucket in current word, use summary bitmap */
+    wordnbr = bcktptr->bcktnbr >> GAINBCKTWORDBITS;
+    if (++ wordnum >= wordnbr)
+      return (bcktptr->bcktnbr);
+
+    bsumtab = bcktptr->bsumtab;
+    sumnum  = wordnum >> GAINBCKTWORDBITS;
+    sumnnd  = gainBcktWordNbr (wordnbr);
+    for (wordval = bsumtab[sumnum] & ((~ ((UINT64) 0)) << (wordnum & GAINBCKTWORDMASK));
+         wordval == 0; wordval = bsumtab[sumnum]) {
+      if (++ sumnum >= sumnnd)
+        return (bcktptr->bcktnbr);
+    }
+    wordnum = (sumnum << GAINBCKTWORDBITS) + gainBcktBitFrst (wordval);
+    wordval = bmaptab[wordnum];
+  }
+
+  return ((wordnum << GAINBCKTWORDBITS) + gainBcktBitFrst (wordval));
+}
+
+/* This routine initializes a bucket array
+** for the given element array.
+** It returns:
+** - 0   : in case of success.
+** - !0  : on error.
+*/
+
+int
+gainBcktInit (
+GainBckt * const            bcktptr,
+void * const                elemtab,              /*+ Array of elements, each starting with a GainBcktLink +*/
+const size_t                elemsiz)              /*+ Size of elements                                     +*/
+{
+  bcktptr->bckttab = NULL;                        /* In case allocation fails */
+  if (gainBcktAlloc (bcktptr, GAINBCKTSIZEINIT) != 0)
+    return (1);
+
+  bcktptr->elemtab = (byte *) elemtab;
+  bcktptr->elemsiz = elemsiz;
+  bcktptr->keybas  = - (GAINBCKTSIZEINIT / 2);    /* Center window around zero key */
+  bcktptr->bcktmin = GAINBCKTSIZEINIT;            /* Array is empty */
+  bcktptr->bcktmax = -1;
+  bcktptr->flagval = 0;
+
+  return (0);
+}
+
+/* This routine frees the contents
+** of the given bucket array.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+gainBcktExit (
+GainBckt * const            bcktptr)
+{
+  if (bcktptr->bckttab != NULL)
+    memFree (bcktptr->bckttab);                   /* Free group leader */
+}
+
+/* This routine flushes the contents
+** of the given bucket array.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+gainBcktFree (
+GainBckt * const            bcktptr)
+{
+  INT                 wordnum;
+
+  if (bcktptr->bcktmin <= bcktptr->bcktmax) {     /* Flush bitmap words covering used area only */
+    for (wordnum = bcktptr->bcktmin >> GAINBCKTWORDBITS;
+         wordnum <= (bcktptr->bcktmax >> GAINBCKTWORDBITS); wordnum ++)
+      bcktptr->bmaptab[wordnum] = 0;
+    for (wordnum = bcktptr->bcktmin >> (2 * GAINBCKTWORDBITS);
+         wordnum <= (bcktptr->bcktmax >> (2 * GAINBCKTWORDBITS)); wordnum ++)
+      bcktptr->bsumtab[wordnum] = 0;
+  }
+
+  bcktptr->bcktmin = bcktptr->bcktnbr;            /* Array is empty */
+  bcktptr->bcktmax = -1;
+}
+
+/* This routine slides and, if needed, enlarges
+** the key window of the bucket array, so that
+** it comprises the given key as well as the
+** keys of all the elements already in the array.
+** Since keys are bounded, the array never holds
+** more than GAINBCKTSIZEMAX buckets. New arrays
+** are allocated, in which the heads of the
+** non-empty buckets are copied, so that the
+** cost of the operation only depends on the
+** number of non-empty buckets. When memory is
+** exhausted, the window is left unchanged, the
+** key is merged into the extremal bucket closest
+** to it, and the bucket array is marked as
+** invalid, for its user to report the error.
+** It returns:
+** - the index of the bucket for the given key.
+*/
+
+static
+INT
+gainBcktShift (
+GainBckt * const            bcktptr,
+const INT                   keyval)
+{
+  GainBckt            bcktdat;                    /* Old bucket array data */
+  INT                 bcktnbr;
+  INT                 bcktmin;
+  INT                 bcktmax;
+  INT                 bcktnum;
+  INT                 keymin;
+  INT                 keymax;
+  INT                 keybas;
+  INT                 spannbr;
+  INT                 shftval;
+
+  bcktmin = gainBcktSrch (bcktptr, bcktptr->bcktmin); /* Compute exact bounds of non-empty area */
+  if (bcktmin > bcktptr->bcktmax) {               /* If array is empty, just center window around key */
+    bcktptr->keybas  = keyval - (bcktptr->bcktnbr / 2);
+    bcktptr->bcktmin = bcktptr->bcktnbr;
+    bcktptr->bcktmax = -1;
+    return (bcktptr->bcktnbr / 2);
+  }
+  for (bcktmax = bcktnum = bcktmin; (bcktnum = gainBcktSrch (bcktptr, bcktnum + 1)) <= bcktptr->bcktmax; bcktmax = bcktnum) ;
+
+  keymin = bcktptr->keybas + bcktmin;             /* Compute range of keys to cover */
+  keymax = bcktptr->keybas + bcktmax;
+  if (keyval < keymin)
+    keymin = keyval;
+  else
+    keymax = keyval;
+  spannbr = keymax - keymin + 1;
+
+  for (bcktnbr = bcktptr->bcktnbr; bcktnbr < spannbr; bcktnbr *= 2) ; /* Enlarge array if needed */
+#ifdef SCOTCH_DEBUG_GAIN2
+  if (bcktnbr > GAINBCKTSIZEMAX) {
+    errorPrint ("gainBcktShift: internal error");
+    bcktnbr = GAINBCKTSIZEMAX;
+  }
+#endif /* SCOTCH_DEBUG_GAIN2 */
+  keybas = keymin - (bcktnbr - spannbr) / 2;      /* Keep equal margins on both sides */
+
+  bcktdat = *bcktptr;
+  if (gainBcktAlloc (bcktptr, bcktnbr) != 0) {    /* If cannot allocate new arrays, keep current ones */
+    bcktptr->flagval = 1;                         /* But gain ordering is no longer preserved         */
+    bcktptr->bcktmin = bcktmin;
+    bcktptr->bcktmax = bcktmax;
+    return ((keyval < bcktptr->keybas) ? 0 : (bcktptr->bcktnbr - 1));
+  }
+
+  shftval = bcktdat.keybas - keybas;
+  for (bcktnum = bcktmin; bcktnum <= bcktmax; bcktnum = gainBcktSrch (&bcktdat, bcktnum + 1)) { /* Copy non-empty buckets */
+    bcktptr->bckttab[bcktnum + shftval] = bcktdat.bckttab[bcktnum];
+    gainBcktBitSet (bcktptr->bmaptab, bcktnum + shftval);
+    gainBcktBitSet (bcktptr->bsumtab, (bcktnum + shftval) >> GAINBCKTWORDBITS);
+  }
+  memFree (bcktdat.bckttab);                      /* Free old group leader */
+
+  bcktptr->keybas  = keybas;
+  bcktptr->bcktmin = bcktmin + shftval;
+  bcktptr->bcktmax = bcktmax + shftval;
+
+  return (keyval - keybas);
+}
+
+/* This routine adds the element of given
+** index to the bucket array, in the bucket
+** of the key of the given gain value.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+gainBcktAdd (
+GainBckt * const            bcktptr,
+const INT                   elemnum,              /*+ Index of element to add +*/
+const INT                   gainval)              /*+ Gain value              +*/
+{
+  GainBcktLink *      linkptr;
+  INT                 keyval;
+  INT                 bcktnum;
+  INT                 headnum;
+
+  keyval  = gainBcktKey (gainval);
+  bcktnum = keyval - bcktptr->keybas;
+  if ((bcktnum < 0) || (bcktnum >= bcktptr->bcktnbr)) /* If key out of window */
+    bcktnum = gainBcktShift (bcktptr, keyval);
+
+  if (bcktnum < bcktptr->bcktmin)
+    bcktptr->bcktmin = bcktnum;
+  if (bcktnum > bcktptr->bcktmax)
+    bcktptr->bcktmax = bcktnum;
+
+  linkptr = gainBcktLink (bcktptr, elemnum);
+  headnum = gainBcktBitTst (bcktptr->bmaptab, bcktnum) ? bcktptr->bckttab[bcktnum] : GAINBCKTNONE;
+  linkptr->nextnum = headnum;                     /* Link element at head of bucket list */
+  linkptr->prevnum = GAINBCKTNONE;
+  linkptr->keyval  = bcktptr->keybas + bcktnum;   /* Record key of bucket, which differs from actual key only when out of memory */
+  if (headnum != GAINBCKTNONE)
+    gainBcktLink (bcktptr, headnum)->prevnum = elemnum;
+  else {                                          /* Bucket was empty */
+    gainBcktBitSet (bcktptr->bmaptab, bcktnum);
+    gainBcktBitSet (bcktptr->bsumtab, bcktnum >> GAINBCKTWORDBITS);
+  }
+  bcktptr->bckttab[bcktnum] = elemnum;
+}
+
+/* This routine removes a link
+** from the bucket array.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+#ifdef SCOTCH_DEBUG_GAIN1                         /* Compiled only in debug mode */
+void
+gainBcktDel (
+GainBckt * const            bcktptr,
+GainBcktLink * const        linkptr)              /*+ Pointer to link to delete +*/
+{
+  INT                 bcktnum;
+
+  bcktnum = linkptr->keyval - bcktptr->keybas;
+  if ((bcktnum < bcktptr->bcktmin) || (bcktnum > bcktptr->bcktmax)) {
+    errorPrint ("gainBcktDel: invalid key value");
+    return;
+  }
+
+  if (linkptr->prevnum == GAINBCKTNONE) {
+    if (linkptr->nextnum == GAINBCKTNONE)         /* If bucket is now empty */
+      gainBcktBitEmpty (bcktptr, bcktnum);
+    else
+      bcktptr->bckttab[bcktnum] = linkptr->nextnum;
+  }
+  else
+    gainBcktLink (bcktptr, linkptr->prevnum)->nextnum = linkptr->nextnum;
+  if (linkptr->nextnum != GAINBCKTNONE)
+    gainBcktLink (bcktptr, linkptr->nextnum)->prevnum = linkptr->prevnum;
+}
+#endif /* SCOTCH_DEBUG_GAIN1 */
+
+/* This routine returns the index of the
+** first element of the bucket of best key
+** in the bucket array. Since large gains may
+** share the same key, users requiring the
+** element of exact best gain must scan this
+** bucket, up to the first element of greater
+** key.
+** It returns:
+** - !GAINBCKTNONE  : index of the element.
+** - GAINBCKTNONE   : if array is empty.
+*/
+
+INT
+gainBcktFrst (
+GainBckt * const            bcktptr)
+{
+  INT                 bcktnum;
+
+  bcktnum = gainBcktSrch (bcktptr, bcktptr->bcktmin);
+  if (bcktnum <= bcktptr->bcktmax) {              /* If found non-empty bucket */
+    bcktptr->bcktmin = bcktnum;                   /* Record its position       */
+    return (bcktptr->bckttab[bcktnum]);
+  }
+  bcktptr->bcktmin = bcktptr->bcktnbr;            /* Set array as empty */
+  bcktptr->bcktmax = -1;
+
+  return (GAINBCKTNONE);
+}
+
+/* This routine returns the index of the
+** element following the given element, in
+** the same bucket or in the next non-empty
+** bucket of greater key.
+** It returns:
+** - !GAINBCKTNONE  : index of the element.
+** - GAINBCKTNONE   : if no such element.
+*/
+
+INT
+gainBcktNext (
+GainBckt * const            bcktptr,
+const INT                   elemnum)
+{
+  const GainBcktLink *  linkptr;
+  INT                   bcktnum;
+
+  linkptr = gainBcktLink (bcktptr, elemnum);
+  if (linkptr->nextnum != GAINBCKTNONE)
+    return (linkptr->nextnum);
+
+  bcktnum = gainBcktSrch (bcktptr, linkptr->keyval - bcktptr->keybas + 1);
+  return ((bcktnum <= bcktptr->bcktmax) ? bcktptr->bckttab[bcktnum] : GAINBCKTNONE);
+}
+
+/* This routine checks the consistency
+** of the given bucket array.
+** It returns:
+** - 0   : if bucket array data are consistent.
+** - !0  : on error.
+*/
+
+#ifdef SCOTCH_DEBUG_GAIN2
+int
+gainBcktCheck (
+const GainBckt * const      bcktptr)
+{
+  INT                 bcktnum;
+  INT                 wordnum;
+
+  if ((bcktptr->bcktmin < 0) && (bcktptr->bcktmin <= bcktptr->bcktmax)) {
+    errorPrint ("gainBcktCheck: invalid lower bound");
+    return (1);
+  }
+  if ((bcktptr->bcktmax >= bcktptr->bcktnbr) && (bcktptr->bcktmin <= bcktptr->bcktmax)) {
+    errorPrint ("gainBcktCheck: invalid upper bound");
+    return (1);
+  }
+
+  for (bcktnum = 0; bcktnum < bcktptr->bcktnbr; bcktnum ++) {
+    if ((bcktnum >= bcktptr->bcktmin) && (bcktnum <= bcktptr->bcktmax))
+      continue;
+    if (gainBcktBitTst (bcktptr->bmaptab, bcktnum)) {
+      errorPrint ("gainBcktCheck: non-empty bucket out of bounds");
+      return (1);
+    }
+  }
+  for (wordnum = 0; wordnum < (bcktptr->bcktnbr >> GAINBCKTWORDBITS); wordnum ++) {
+    if (((bcktptr->bmaptab[wordnum] != 0) ? 1 : 0) !=
+        (int) ((bcktptr->bsumtab[wordnum >> GAINBCKTWORDBITS] >> (wordnum & GAINBCKTWORDMASK)) & 1)) {
+      errorPrint ("gainBcktCheck: invalid summary bitmap");
+      return (1);
+    }
+  }
+
+  for (bcktnum = bcktptr->bcktmin; bcktnum <= bcktptr->bcktmax; bcktnum ++) {
+    const GainBcktLink *  linkptr;
+    INT                   prevnum;
+    INT                   elemnum;
+
+    if (! gainBcktBitTst (bcktptr->bmaptab, bcktnum))
+      continue;
+
+    for (prevnum = GAINBCKTNONE, elemnum = bcktptr->bckttab[bcktnum];
+         elemnum != GAINBCKTNONE; prevnum = elemnum, elemnum = linkptr->nextnum) {
+      linkptr = gainBcktLink (bcktptr, elemnum);
+      if ((linkptr->prevnum != prevnum) ||
+          (linkptr->keyval != (bcktptr->keybas + bcktnum))) {
+        errorPrint ("gainBcktCheck: invalid link");
+        return (1);
+      }
+    }
+  }
+
+  return (0);
+}
+#endif /* SCOTCH_DEBUG_GAIN2 */
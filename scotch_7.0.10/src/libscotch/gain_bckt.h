@@ -0,0 +1,192 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : gain_bckt.h                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the definitions of **/
+/**                the bucket array gain structures.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Contrary to gain tables, links are    **/
+/**                  indices in a user-provided array of   **/
+/**                  elements, and all buckets are kept in **/
+/**                  a single contiguous array. Small gains **/
+/**                  have a bucket of their own, while     **/
+/**                  larger ones share logarithmically     **/
+/**                  sized buckets, so that the number of  **/
+/**                  bucket keys is bounded whatever the   **/
+/**                  range of gains. The window of keys    **/
+/**                  covered by the array slides and grows **/
+/**                  so as to follow the elements being    **/
+/**                  inserted, up to GAINBCKTSIZEMAX       **/
+/**                  buckets. Two levels of bitmaps record **/
+/**                  non-empty buckets, so that searching  **/
+/**                  for the best element does not depend  **/
+/**                  on the width of the window.           **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Initial number of buckets. It must
+    be a power of two, at least equal
+    to the number of bits of words.    +*/
+
+#define GAINBCKTSIZEINIT            256
+
+/*+ Bucket key parameters. Gains of absolute
+    value smaller than 2^GAINBCKTEXACTBITS have
+    a bucket key of their own. Beyond, each
+    range of gains between two consecutive
+    powers of two is split into 2^GAINBCKTSUBBITS
+    buckets. Keys are therefore bounded in
+    absolute value by GAINBCKTKEYMAX, and the
+    array never exceeds GAINBCKTSIZEMAX buckets. +*/
+
+#define GAINBCKTEXACTBITS           15
+#define GAINBCKTSUBBITS             8
+#define GAINBCKTKEYMAX              ((1 << GAINBCKTEXACTBITS) + ((64 - GAINBCKTEXACTBITS) << GAINBCKTSUBBITS))
+#define GAINBCKTSIZEMAX             (4 << GAINBCKTEXACTBITS)
+
+/*+ End of list index. +*/
+
+#define GAINBCKTNONE                ((INT) -1)
+
+/*+ Bitmap word parameters. +*/
+
+#define GAINBCKTWORDBITS            6             /*+ Log2 of number of bits per word +*/
+#define GAINBCKTWORDMASK            ((1 << GAINBCKTWORDBITS) - 1)
+
+/*
+**  The type and structure definitions.
+*/
+
+/* The bucket link data structure. This must be
+   the first item of the elements that are linked
+   into bucket arrays.                            */
+
+typedef struct GainBcktLink_ {
+  INT                       nextnum;              /*+ Index of next element, or GAINBCKTNONE: FIRST +*/
+  INT                       prevnum;              /*+ Index of previous element, or GAINBCKTNONE    +*/
+  INT                       keyval;               /*+ Key of the bucket holding the element         +*/
+} GainBcktLink;
+
+/* The bucket array structure. Bucket indices
+   are relative to the key of the first bucket.
+   Bit b of the bucket bitmap is set if bucket b
+   is non-empty, and bit w of the summary bitmap
+   is set if word w of the bucket bitmap is not
+   zero. The head of a bucket is only meaningful
+   when the bucket is flagged as non-empty.      */
+
+typedef struct GainBckt_ {
+  byte *                    elemtab;              /*+ Array of elements, each starting with a link    +*/
+  size_t                    elemsiz;              /*+ Size of elements                                +*/
+  INT                       keybas;               /*+ Key of first bucket                             +*/
+  INT                       bcktnbr;              /*+ Number of buckets                               +*/
+  INT                       bcktmin;              /*+ Lower bound of index of first non-empty bucket  +*/
+  INT                       bcktmax;              /*+ Upper bound of index of last non-empty bucket   +*/
+  INT *                     bckttab;              /*+ Index of first element of non-empty buckets     +*/
+  UINT64 *                  bmaptab;              /*+ Bitmap of non-empty buckets                     +*/
+  UINT64 *                  bsumtab;              /*+ Bitmap of non-zero words of bucket bitmap       +*/
+  int                       flagval;              /*+ Set if array could not be enlarged              +*/
+} GainBckt;
+
+/*
+**  The function prototypes.
+*/
+
+int                         gainBcktInit        (GainBckt * const, void * const, const size_t);
+void                        gainBcktExit        (GainBckt * const);
+void                        gainBcktFree        (GainBckt * const);
+void                        gainBcktAdd         (GainBckt * const, const INT, const INT);
+void                        gainBcktDel         (GainBckt * const, GainBcktLink * const);
+INT                         gainBcktFrst        (GainBckt * const);
+INT                         gainBcktNext        (GainBckt * const, const INT);
+#ifdef SCOTCH_GAIN_BCKT
+static int                  gainBcktAlloc       (GainBckt * const, const INT);
+static INT                  gainBcktSrch        (const GainBckt * const, const INT);
+static INT                  gainBcktKey         (const INT);
+static INT                  gainBcktShift       (GainBckt * const, const INT);
+#endif /* SCOTCH_GAIN_BCKT */
+#ifdef SCOTCH_DEBUG_GAIN2
+int                         gainBcktCheck       (const GainBckt * const);
+#endif /* SCOTCH_DEBUG_GAIN2 */
+
+/*
+**  The macro definitions.
+*/
+
+#define gainBcktLink(bckt,elem)     ((GainBcktLink *) ((bckt)->elemtab + (size_t) (elem) * (bckt)->elemsiz))
+#define gainBcktBase(bckt,elem)     ((bckt)->elemtab = (byte *) (elem))
+#define gainBcktEmpty(bckt)         (gainBcktFrst (bckt) == GAINBCKTNONE)
+#define gainBcktFail(bckt)          ((bckt)->flagval != 0)
+#define gainBcktWordNbr(n)          (((n) + GAINBCKTWORDMASK) >> GAINBCKTWORDBITS)
+#define gainBcktBitSet(tab,n)       ((tab)[(n) >> GAINBCKTWORDBITS] |= ((UINT64) 1) << ((n) & GAINBCKTWORDMASK))
+#define gainBcktBitTst(tab,n)       (((tab)[(n) >> GAINBCKTWORDBITS] & (((UINT64) 1) << ((n) & GAINBCKTWORDMASK))) != 0)
+#define gainBcktBitClr(tab,n)       ((tab)[(n) >> GAINBCKTWORDBITS] &= ~(((UINT64) 1) << ((n) & GAINBCKTWORDMASK)))
+#define gainBcktBitEmpty(bckt,n)    do {                                                               \
+                                      INT                 bitsnum;                                     \
+                                      bitsnum = (n);                                                   \
+                                      gainBcktBitClr ((bckt)->bmaptab, bitsnum);                       \
+                                      if ((bckt)->bmaptab[bitsnum >> GAINBCKTWORDBITS] == 0)           \
+                                        gainBcktBitClr ((bckt)->bsumtab, bitsnum >> GAINBCKTWORDBITS); \
+                                    } while (0)
+#if ((! defined SCOTCH_GAIN_BCKT) && (! defined SCOTCH_DEBUG_GAIN1))
+#define gainBcktDel(bckt,link)      do {                                                      \
+                                      GainBcktLink *      linkptr;                            \
+                                      INT                 nextnum;                            \
+                                      INT                 prevnum;                            \
+                                      INT                 bcktnum;                            \
+                                      linkptr = (link);                                       \
+                                      nextnum = linkptr->nextnum;                             \
+                                      prevnum = linkptr->prevnum;                             \
+                                      if (prevnum == GAINBCKTNONE) {                          \
+                                        bcktnum = linkptr->keyval - (bckt)->keybas;           \
+                                        if (nextnum == GAINBCKTNONE)                          \
+                                          gainBcktBitEmpty ((bckt), bcktnum);                 \
+                                        else                                                  \
+                                          (bckt)->bckttab[bcktnum] = nextnum;                 \
+                                      }                                                       \
+                                      else                                                    \
+                                        gainBcktLink ((bckt), prevnum)->nextnum = nextnum;    \
+                                      if (nextnum != GAINBCKTNONE)                            \
+                                        gainBcktLink ((bckt), nextnum)->prevnum = prevnum;    \
+                                    } while (0)
+#endif /* ((! defined SCOTCH_GAIN_BCKT) && (! defined SCOTCH_DEBUG_GAIN1)) */
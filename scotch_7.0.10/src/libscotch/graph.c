@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 sep 2012     **/
 /**                                 to   : 09 aug 2014     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -119,16 +119,24 @@ graphFree (
 Graph * const               grafptr)
 {
   if (((grafptr->flagval & GRAPHFREEEDGE) != 0) && /* If edgetab must be freed */
-      (grafptr->edgetax != NULL))                 /* And if it exists          */
-    memFree (grafptr->edgetax + grafptr->baseval); /* Free it                  */
+      (grafptr->edgetax != NULL)) {               /* And if it exists          */
+    if ((grafptr->flagval & GRAPHEDGEMMAP) != 0)  /* If edge group is mapped   */
+      fileUnmap (grafptr->edgetax + grafptr->baseval);
+    else
+      memFree (grafptr->edgetax + grafptr->baseval); /* Free it */
+  }
 
   if ((grafptr->flagval & GRAPHFREEVERT) != 0) {  /* If verttab/vendtab must be freed                            */
     if ((grafptr->vendtax != NULL) &&             /* If vendtax is distinct from verttab                         */
         (grafptr->vendtax != grafptr->verttax + 1) && /* (if vertex arrays grouped, vendtab not distinct anyway) */
         ((grafptr->flagval & GRAPHVERTGROUP) == 0))
       memFree (grafptr->vendtax + grafptr->baseval); /* Then free vendtax                                 */
-    if (grafptr->verttax != NULL)                 /* Free verttab anyway, as it is the array group leader */
-      memFree (grafptr->verttax + grafptr->baseval);
+    if (grafptr->verttax != NULL) {               /* Free verttab anyway, as it is the array group leader */
+      if ((grafptr->flagval & GRAPHVERTMMAP) != 0) /* If vertex group is mapped                             */
+        fileUnmap (grafptr->verttax + grafptr->baseval);
+      else
+        memFree (grafptr->verttax + grafptr->baseval);
+    }
   }
   if ((grafptr->flagval & GRAPHFREEVNUM) != 0) {  /* If vnumtab must be freed         */
     if ((grafptr->vnumtax != NULL) &&             /* And is not in vertex array group */
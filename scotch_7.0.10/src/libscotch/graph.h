@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 10 may 2019     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 16 aug 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,9 +85,11 @@
 #define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHVERTMMAP               0x0040        /*+ Vertex group is mapped    +*/
+#define GRAPHEDGEMMAP               0x0080        /*+ Edge group is mapped      +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x00FF        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0100        /*+ Value above which bits not used by plain graph routines +*/
 
 /*+ Graph loading flags. +*/
 
@@ -173,9 +175,11 @@ Gnum                        graphDiamPV         (const Graph * restrict const, C
 Gnum                        graphIelo           (const Graph * const, Gnum * const, Gnum * const);
 int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const);
 int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
-int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphLoadFlag);
+int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphLoadFlag, Context * const);
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
 int                         graphSave           (const Graph * const, FILE * const);
+int                         graphLoadBin        (Graph * restrict const, FILE * const, const Gnum, const GraphLoadFlag);
+int                         graphSaveBin        (const Graph * const, FILE * const);
 
 #ifdef SCOTCH_GEOM_H
 int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
@@ -0,0 +1,422 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_cache.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the caching of      **/
+/**                graph mapping and ordering results in   **/
+/**                execution contexts.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define SCOTCH_GRAPH_CACHE
+
+#include "module.h"
+#include "common.h"
+#include "common_values.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "order.h"
+#include "graph_cache.h"
+
+/*******************************/
+/*                             */
+/* These routines compute the  */
+/* keys of cached results.     */
+/*                             */
+/*******************************/
+
+/* This routine computes the hash value
+** of the topology and loads of the given
+** graph. Edge loads are only accounted
+** for when computing mapping keys.
+** It returns:
+** - the hash value.
+*/
+
+static
+UINT64
+graphCacheHash (
+const Graph * restrict const  grafptr,
+const int                     flagval)            /*+ Kind of cached result +*/
+{
+  const Gnum * restrict     edlotax;
+  Gnum                      headtab[5];
+  UINT64                    hashval;
+
+  const Gnum                baseval = grafptr->baseval;
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+
+  edlotax = (flagval == GRAPHCACHEMAP) ? grafptr->edlotax : NULL;
+
+  headtab[0] = baseval;
+  headtab[1] = grafptr->vertnbr;
+  headtab[2] = grafptr->edgenbr;
+  headtab[3] = (grafptr->velotax != NULL) ? 1 : 0;
+  headtab[4] = (edlotax != NULL) ? 1 : 0;
+  hashval = hashMem (headtab, sizeof (headtab), (UINT64) flagval);
+
+  if (vendtax == (verttax + 1)) {                 /* If graph is compact, hash arrays in one piece */
+    const Gnum          edgebas = verttax[baseval];
+    const Gnum          edgesiz = verttax[grafptr->vertnnd] - edgebas;
+
+    hashval = hashMem (verttax + baseval, (grafptr->vertnbr + 1) * sizeof (Gnum), hashval);
+    hashval = hashMem (edgetax + edgebas, edgesiz * sizeof (Gnum), hashval);
+    if (edlotax != NULL)
+      hashval = hashMem (edlotax + edgebas, edgesiz * sizeof (Gnum), hashval);
+  }
+  else {
+    Gnum                vertnum;
+
+    for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+      Gnum                degrval;
+
+      degrval = vendtax[vertnum] - verttax[vertnum];
+      hashval = hashMem (&degrval, sizeof (Gnum), hashval);
+      hashval = hashMem (edgetax + verttax[vertnum], degrval * sizeof (Gnum), hashval);
+      if (edlotax != NULL)
+        hashval = hashMem (edlotax + verttax[vertnum], degrval * sizeof (Gnum), hashval);
+    }
+  }
+  if (grafptr->velotax != NULL)
+    hashval = hashMem (grafptr->velotax + baseval, grafptr->vertnbr * sizeof (Gnum), hashval);
+
+  return (hashval);
+}
+
+/* This routine computes the hash value of
+** the textual forms of the given target
+** architecture, if any, and strategy.
+** It returns:
+** - 0   : if hash value computed.
+** - !0  : if texts could not be written.
+*/
+
+static
+int
+graphCacheText (
+const Arch * const          archptr,              /*+ Target architecture, or NULL +*/
+const Strat * const         straptr,
+UINT64 * const              hashptr)
+{
+  FILE *              fileptr;
+  char                textbuf[GRAPHCACHETEXTSIZE];
+  size_t              textnbr;
+  UINT64              hashval;
+  int                 o;
+
+  if ((fileptr = tmpfile ()) == NULL)             /* If no temporary file available, no caching */
+    return (1);
+
+  o = 0;
+  if (archptr != NULL)
+    o = archSave (archptr, fileptr);
+  o |= stratSave (straptr, fileptr);
+
+  if (o == 0) {
+    rewind (fileptr);
+    for (hashval = 0; (textnbr = fread (textbuf, 1, GRAPHCACHETEXTSIZE, fileptr)) > 0; )
+      hashval = hashMem (textbuf, textnbr, hashval);
+    o = ferror (fileptr);
+    *hashptr = hashval;
+  }
+
+  fclose (fileptr);
+
+  return (o);
+}
+
+/* This routine computes the key of the result
+** of a mapping or ordering of the given graph.
+** The key accounts for the graph topology and
+** loads, the target architecture, the strategy,
+** and the parameters of the execution context
+** which may influence the result: the seed of
+** the pseudo-random generator, the number of
+** threads and the context values. The current
+** state of the pseudo-random generator is not
+** accounted for, so that successive calls on
+** the same graph can hit the cache.
+** It returns:
+** - 0   : if key computed.
+** - !0  : if result cannot be cached.
+*/
+
+int
+graphCacheKey (
+const Graph * const         grafptr,
+const int                   flagval,              /*+ Kind of cached result        +*/
+const Arch * const          archptr,              /*+ Target architecture, or NULL +*/
+const Strat * const         straptr,
+Context * const             contptr,
+UINT64 * const              keytab)               /*+ Key array [CACHEKEYSIZE]     +*/
+{
+  UINT64              parmtab[4];
+
+  if (graphCacheText (archptr, straptr, &parmtab[0]) != 0)
+    return (1);
+
+  parmtab[1] = contptr->randptr->seedval;
+  parmtab[2] = (UINT64) contptr->randptr->procval;
+  parmtab[3] = (UINT64) contextThreadNbr (contptr);
+
+  keytab[0] = graphCacheHash (grafptr, flagval);
+  keytab[1] = hashMem (parmtab, sizeof (parmtab), (UINT64) flagval);
+  if (contptr->valuptr != NULL)
+    keytab[1] = hashMem (contptr->valuptr->dataptr, contptr->valuptr->datasiz, keytab[1]);
+
+  return (0);
+}
+
+/*********************************/
+/*                               */
+/* These routines store and      */
+/* retrieve mapping results.     */
+/*                               */
+/*********************************/
+
+/* This routine retrieves the cached
+** part array of the given key.
+** It returns:
+** - 0   : if part array retrieved.
+** - !0  : if not found.
+*/
+
+int
+graphCacheMapGet (
+Context * const             contptr,
+const UINT64 * const        keytab,
+const Graph * const         grafptr,
+Gnum * const                parttab)
+{
+  const void *        dataptr;
+  size_t              datasiz;
+
+  if ((dataptr = contextCacheFind (contptr, keytab, &datasiz)) == NULL)
+    return (1);
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (datasiz != (grafptr->vertnbr * sizeof (Gnum))) {
+    errorPrint ("graphCacheMapGet: invalid cached data");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  memCpy (parttab, dataptr, grafptr->vertnbr * sizeof (Gnum));
+
+  return (0);
+}
+
+/* This routine caches the given
+** part array under the given key.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphCacheMapPut (
+Context * const             contptr,
+const UINT64 * const        keytab,
+const Graph * const         grafptr,
+const Gnum * const          parttab)
+{
+  contextCacheStore (contptr, keytab, parttab, grafptr->vertnbr * sizeof (Gnum));
+}
+
+/*********************************/
+/*                               */
+/* These routines store and      */
+/* retrieve ordering results.    */
+/*                               */
+/*********************************/
+
+/* This routine flattens the given column
+** block tree in prefix order, as triplets
+** of type, number of node vertices and
+** number of sub-blocks.
+** It returns:
+** - the number of values written.
+*/
+
+static
+Gnum
+graphCacheOrderSave (
+const OrderCblk * restrict const  cblkptr,
+Gnum * restrict const             datatab)
+{
+  Gnum                datanum;
+  Gnum                cblknum;
+
+  datatab[0] = (Gnum) cblkptr->typeval;
+  datatab[1] = cblkptr->vnodnbr;
+  datatab[2] = cblkptr->cblknbr;
+
+  for (cblknum = 0, datanum = 3; cblknum < cblkptr->cblknbr; cblknum ++)
+    datanum += graphCacheOrderSave (&cblkptr->cblktab[cblknum], datatab + datanum);
+
+  return (datanum);
+}
+
+/* This routine rebuilds a column block
+** tree from its flattened form. Sub-block
+** arrays are initialized before being
+** filled, so that a partially rebuilt tree
+** can always be freed by orderExit().
+** It returns:
+** - 0   : if tree rebuilt.
+** - !0  : on error.
+*/
+
+static
+int
+graphCacheOrderLoad (
+OrderCblk * restrict const        cblkptr,
+const Gnum * restrict * const     dataptr)        /*+ Pointer to current flattened data, updated +*/
+{
+  const Gnum * restrict datatab;
+  OrderCblk *           cblktab;
+  Gnum                  cblknbr;
+  Gnum                  cblknum;
+
+  datatab = *dataptr;
+  cblkptr->typeval = (int) datatab[0];
+  cblkptr->vnodnbr = datatab[1];
+  cblknbr          = datatab[2];
+  cblkptr->cblknbr = 0;
+  cblkptr->cblktab = NULL;
+  *dataptr = datatab + 3;
+
+  if (cblknbr <= 0)                               /* If leaf block, nothing more to do */
+    return (0);
+
+  if ((cblktab = (OrderCblk *) memAlloc (cblknbr * sizeof (OrderCblk))) == NULL)
+    return (1);
+  for (cblknum = 0; cblknum < cblknbr; cblknum ++) {
+    cblktab[cblknum].cblknbr = 0;
+    cblktab[cblknum].cblktab = NULL;
+  }
+  cblkptr->cblknbr = cblknbr;
+  cblkptr->cblktab = cblktab;
+
+  for (cblknum = 0; cblknum < cblknbr; cblknum ++) {
+    if (graphCacheOrderLoad (&cblktab[cblknum], dataptr) != 0)
+      return (1);
+  }
+
+  return (0);
+}
+
+/* This routine retrieves the cached
+** ordering of the given key into the
+** given ordering, whose column block
+** tree must be a single leaf.
+** It returns:
+** - 0   : if ordering retrieved.
+** - 1   : if not found.
+** - 2   : on error.
+*/
+
+int
+graphCacheOrderGet (
+Context * const             contptr,
+const UINT64 * const        keytab,
+Order * const               ordeptr)
+{
+  const Gnum *        datatab;
+  size_t              datasiz;
+
+  if ((datatab = (const Gnum *) contextCacheFind (contptr, keytab, &datasiz)) == NULL)
+    return (1);
+
+  ordeptr->cblknbr = datatab[0];
+  ordeptr->treenbr = datatab[1];
+  memCpy (ordeptr->peritab, datatab + 2, ordeptr->vnodnbr * sizeof (Gnum));
+
+  datatab += 2 + ordeptr->vnodnbr;
+  if (graphCacheOrderLoad (&ordeptr->rootdat, &datatab) != 0) {
+    errorPrint ("graphCacheOrderGet: out of memory");
+    return (2);
+  }
+
+  return (0);
+}
+
+/* This routine caches the given
+** ordering under the given key.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphCacheOrderPut (
+Context * const             contptr,
+const UINT64 * const        keytab,
+const Order * const         ordeptr)
+{
+  Gnum *              datatab;
+  Gnum                datanbr;
+
+  datanbr = 2 + ordeptr->vnodnbr + 3 * ordeptr->treenbr;
+  if ((datatab = (Gnum *) memAlloc (datanbr * sizeof (Gnum))) == NULL) {
+    errorPrintW ("graphCacheOrderPut: out of memory");
+    return;
+  }
+
+  datatab[0] = ordeptr->cblknbr;
+  datatab[1] = ordeptr->treenbr;
+  memCpy (datatab + 2, ordeptr->peritab, ordeptr->vnodnbr * sizeof (Gnum));
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCacheOrderSave (&ordeptr->rootdat, datatab + 2 + ordeptr->vnodnbr) != (3 * ordeptr->treenbr)) {
+    errorPrint ("graphCacheOrderPut: invalid ordering tree");
+    memFree    (datatab);
+    return;
+  }
+#else /* SCOTCH_DEBUG_GRAPH2 */
+  graphCacheOrderSave (&ordeptr->rootdat, datatab + 2 + ordeptr->vnodnbr);
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  contextCacheStore (contptr, keytab, datatab, datanbr * sizeof (Gnum));
+
+  memFree (datatab);
+}
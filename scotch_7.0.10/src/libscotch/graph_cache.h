@@ -0,0 +1,75 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_cache.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the caching of graph mapping and    **/
+/**                ordering results.                       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Kinds of cached results. +*/
+
+#define GRAPHCACHEMAP               1             /*+ Mapping: edge loads matter     +*/
+#define GRAPHCACHEORDER             2             /*+ Ordering: edge loads discarded +*/
+
+/*+ Size of buffer for hashing texts. +*/
+
+#define GRAPHCACHETEXTSIZE          4096
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_GRAPH_CACHE
+static UINT64               graphCacheHash      (const Graph * restrict const, const int);
+static int                  graphCacheText      (const Arch * const, const Strat * const, UINT64 * const);
+static Gnum                 graphCacheOrderSave (const OrderCblk * restrict const, Gnum * restrict const);
+static int                  graphCacheOrderLoad (OrderCblk * restrict const, const Gnum * restrict * const);
+#endif /* SCOTCH_GRAPH_CACHE */
+
+int                         graphCacheKey       (const Graph * const, const int, const Arch * const, const Strat * const, Context * const, UINT64 * const);
+int                         graphCacheMapGet    (Context * const, const UINT64 * const, const Graph * const, Gnum * const);
+void                        graphCacheMapPut    (Context * const, const UINT64 * const, const Graph * const, const Gnum * const);
+int                         graphCacheOrderGet  (Context * const, const UINT64 * const, Order * const);
+void                        graphCacheOrderPut  (Context * const, const UINT64 * const, const Order * const);
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2011-2016,2018,2020,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 29 apr 2019     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,13 +92,13 @@
 #include "graph_coarsen_edge.c"
 #undef GRAPHCOARSENEDGENAME
 
-#ifndef GRAPHCOARSENNOTHREAD                      /* Only relevant when threads are enabled */
+#ifdef SCOTCH_PTHREAD                             /* Only relevant when threads are enabled */
 #define GRAPHCOARSENEDGENAME        graphCoarsenEdgeCt
 #define GRAPHCOARSENEDGECOUNT                     /* Local coarse edge count routine */
 #include "graph_coarsen_edge.c"
 #undef GRAPHCOARSENEDGENAME
 #undef GRAPHCOARSENEDGECOUNT
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
 
 /***************************/
 /*                         */
@@ -106,7 +106,7 @@
 /*                         */
 /***************************/
 
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
 
 /* This routine aggregates a sum and max
 ** reduction of partial coarse graph
@@ -143,7 +143,7 @@ const void * const          globptr)              /* Unused                  */
 {
   tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
 }
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
 
 /* This routine is the threaded core of the building
 ** of the coarse graph from the fine graph.
@@ -201,18 +201,9 @@ GraphCoarsenData * restrict const coarptr)
   else
     coarvertnbr = coarptr->coarvertnbr;           /* Get provided number of vertices */
 
-#ifdef GRAPHCOARSENNOTHREAD
 #ifdef SCOTCH_PTHREAD
-  if (thrdnum != 0) {                             /* Only thread 0 will perform the work    */
-    threadBarrier (descptr);                      /* End-of-routine synchronization barrier */
-    return;
-  }
-#endif /* SCOTCH_PTHREAD */
-  thrdptr->finevertbas = baseval;                 /* Now thread 0 takes care of all vertices */
-  thrdptr->finevertnnd = finegrafptr->vertnnd;
-#else /* GRAPHCOARSENNOTHREAD */
   if (thrdnum == 0)                               /* Thread 0 populates the graph data structure */
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
   {
     GraphCoarsenMulti * coarmulttab;              /* [norestrict]                     */
     Gnum                coarmultsiz;              /* Size of embedded multinode array */
@@ -256,12 +247,6 @@ GraphCoarsenData * restrict const coarptr)
       if (coargrafptr->verttax != NULL)
         memFree (coargrafptr->verttax);
       coarptr->retuval = 2;
-#ifdef GRAPHCOARSENNOTHREAD
-#ifdef SCOTCH_PTHREAD
-      threadBarrier (descptr);                    /* End-of-routine synchronization barrier for thread 0 */
-#endif /* SCOTCH_PTHREAD */
-      return;                                     /* Thread 0 returns */
-#endif /* GRAPHCOARSENNOTHREAD */
     }
     else {
       coargrafptr->verttax -= baseval;            /* Base coarse graph arrays */
@@ -274,7 +259,7 @@ GraphCoarsenData * restrict const coarptr)
     }
   }
 
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
   if (thrdnbr > 1) {                              /* If more than one thread */
     Gnum                finevertnum;
     Gnum                finevertnnd;
@@ -329,16 +314,14 @@ GraphCoarsenData * restrict const coarptr)
     }
   }
   else
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
   {
     Gnum                finevertnnd;
     Gnum                finevertnum;
     Gnum                coarvertnum;
 
-#ifndef GRAPHCOARSENNOTHREAD
     if (coarptr->retuval != 0)                    /* In case memory allocation failed */
       return;
-#endif /* GRAPHCOARSENNOTHREAD */
 
     coarmulttax = coarptr->coarmulttab - baseval; /* Only thread 0 knows coarptr->coarmulttab */
     for (finevertnum = thrdptr->finevertbas, finevertnnd = thrdptr->finevertnnd, coarvertnum = baseval; /* Finalize finecoartab array */
@@ -369,17 +352,11 @@ GraphCoarsenData * restrict const coarptr)
   if ((thrdptr->coarhashtab = memAlloc (coarhashnbr * sizeof (GraphCoarsenHash))) == NULL) { /* Allocate local thread memory */
     errorPrint ("graphCoarsen3: out of memory (2)");
     coarptr->retuval = 2;                         /* No problem if concurrent writes */
-#ifdef GRAPHCOARSENNOTHREAD
-#ifdef SCOTCH_PTHREAD
-    threadBarrier (descptr);                      /* End-of-routine synchronization barrier */
-#endif /* SCOTCH_PTHREAD */
-    return;                                       /* Thread 0 returns */
-#endif /* GRAPHCOARSENNOTHREAD */
   }
   else
     memSet (thrdptr->coarhashtab, ~0, coarhashnbr * sizeof (GraphCoarsenHash)); /* Initialize (local) hash table */
 
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
   if (thrdnbr > 1) {                              /* If more than one thread                                      */
     threadBarrier (descptr);                      /* Ensure all of finecoartax has been written (or memory error) */
 
@@ -409,9 +386,8 @@ GraphCoarsenData * restrict const coarptr)
       thrdptr->coaredgebas = coaredgenbr;         /* Save upper bound on local number of coarse edges for scan */
     }
     else {
-      thrdptr->coaredgebas = 0;                   /* No coarse edges accounted for yet                                */
-      graphCoarsenEdgeCt (coarptr, thrdptr);      /* Count number of coarse local edges in thrdptr->coaredgebas       */
-      memSet (thrdptr->coarhashtab, ~0, coarhashnbr * sizeof (GraphCoarsenHash)); /* Re-initialize (local) hash table */
+      thrdptr->coaredgebas = 0;                   /* No coarse edges accounted for yet                          */
+      graphCoarsenEdgeCt (coarptr, thrdptr);      /* Count number of coarse local edges in thrdptr->coaredgebas */
     }
     thrdptr->scantab[0] = thrdptr->coaredgebas;
     threadScan (descptr, &thrdptr->scantab[0], sizeof (GraphCoarsenThread), (ThreadScanFunc) graphCoarsenScan, NULL); /* Compute scan on coarse edge indices */
@@ -430,12 +406,10 @@ GraphCoarsenData * restrict const coarptr)
     thrdptr->coaredgebas = thrdptr->scantab[0] - thrdptr->coaredgebas + baseval; /* Adjust value to have real edge start index */
   }
   else
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
   {
-#ifndef GRAPHCOARSENNOTHREAD
     if (coarptr->retuval != 0)                    /* In case memory allocation failed */
       return;
-#endif /* GRAPHCOARSENNOTHREAD */
 
     thrdptr->coaredgebas = baseval;               /* Start from the beginning */
   }
@@ -447,19 +421,19 @@ GraphCoarsenData * restrict const coarptr)
 
   thrdptr->coaredgebas -= coaredgebas;            /* Compute accurate number of local edges */
 
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
   if (thrdnbr > 1)
     threadReduce (descptr, thrdptr, sizeof (GraphCoarsenThread), (ThreadReduceFunc) graphCoarsenReduce, 0, NULL); /* Sum edloadj and get maximum of degrmax */
 
   if (thrdnum == 0)
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
   {
     coargrafptr->edgenbr = thrdptr->coaredgebas;
     coargrafptr->edlosum = thrdptr->coaredloadj + finegrafptr->edlosum;
     coargrafptr->degrmax = thrdptr->coardegrmax;
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
     if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) == 0) /* If graph is compact */
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
     {
       size_t              coaredlooft;
       byte *              coaredgetab;
@@ -472,12 +446,6 @@ GraphCoarsenData * restrict const coarptr)
       coargrafptr->edlotax = (Gnum *) (coaredgetab + coaredlooft) - baseval;
     }
   }
-
-#ifdef GRAPHCOARSENNOTHREAD
-#ifdef SCOTCH_PTHREAD
-  threadBarrier (descptr);                        /* End-of-routine synchronization barrier for thread 0 */
-#endif /* SCOTCH_PTHREAD */
-#endif /* GRAPHCOARSENNOTHREAD */
 }
 
 /* This routine is the sequential core of the
@@ -518,9 +486,9 @@ GraphCoarsenData * restrict const     coarptr)
     coarptr->finematetax = finematetab - baseval;
   }
 
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
   if (thrdnbr <= 1)                               /* If no multithreading, coarse graph will always be compact */
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
     coarptr->flagval &= ~GRAPHCOARSENNOCOMPACT;   /* Non-compact graphs always imply more than one thread */
 
   if ((coarptr->flagval & GRAPHCOARSENUSEMATE) == 0) { /* If mating array not provided          */
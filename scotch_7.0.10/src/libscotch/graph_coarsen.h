@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2013,2015,2018-2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -57,7 +57,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 30 aug 2020     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,10 +65,6 @@
 **  The defines.
 */
 
-#if (! defined SCOTCH_PTHREAD) && (! defined GRAPHCOARSENNOTHREAD)
-#define GRAPHCOARSENNOTHREAD
-#endif /* (! defined SCOTCH_PTHREAD) && (! defined GRAPHCOARSENNOTHREAD) */
-
 /*+ Graph option flags. Their values must be equal
     to those defined in library.h and library_f.h  +*/
 
@@ -87,6 +83,13 @@
 
 #define GRAPHCOARSENHASHPRIME       1049          /*+ Prime number +*/
 
+/*+ Largest hash table mask for which the whole
+    table is always used. Above, only the part
+    needed by the current coarse vertex is used,
+    so as to preserve cache locality.          +*/
+
+#define GRAPHCOARSENHASHCACHEMSK    4095
+
 /*
 **  The type and structure definitions.
 */
@@ -155,7 +158,7 @@ typedef struct GraphCoarsenData_ {
   Gnum                      coarvertnbr;          /*+ Global number of coarse vertices after matching +*/
   GraphCoarsenMulti *       coarmulttab;          /*+ Multinode array                                 +*/
   Gnum                      coarmultsiz;          /*+ Size of multinode array allocated in graph      +*/
-  Gnum                      coarhashmsk;          /*+ Hash table mask                                 +*/
+  Gnum                      coarhashmsk;          /*+ Hash table mask, for vertices of highest degree  +*/
   int *                     finelocktax;          /*+ Global matching lock array (if any)             +*/
   GraphCoarsenThread *      thrdtab;              /*+ Array of thread-specific data                   +*/
   int                       fumaval;              /*+ Index of mating routine in function array       +*/
@@ -168,9 +171,9 @@ typedef struct GraphCoarsenData_ {
 */
 
 #ifdef SCOTCH_GRAPH_COARSEN
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
 static void                 graphCoarsenEdgeCt  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
 static void                 graphCoarsenEdgeLl  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 static void                 graphCoarsenEdgeLu  (const GraphCoarsenData * restrict const, GraphCoarsenThread * restrict const);
 #endif /* SCOTCH_GRAPH_COARSEN */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009,2012,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009,2012,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 28 oct 2012     **/
 /**                                 to   : 28 feb 2015     **/
 /**                # Version 7.0  : from : 28 jul 2018     **/
-/**                                 to   : 02 aug 2018     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +62,8 @@ GraphCoarsenThread * restrict const     thrdptr)
   Gnum                coarvertnum;
   Gnum                coarvertnnd;
   Gnum                coaredgenum;
+  Gnum                coarhashnum;                /* Tag of hash slots for current coarse vertex */
+  Gnum                coarhashtmp;                /* Hash mask for current coarse vertex         */
 #ifndef GRAPHCOARSENEDGECOUNT
   Gnum                coaredloadj;                /* Edge load sum adjust with respect to fine graph edge load sum */
   Gnum                coardegrmax;
@@ -105,6 +107,25 @@ GraphCoarsenThread * restrict const     thrdptr)
     coaredgetmp = coaredgenum;
     coarveloval = 0;
 #endif /* GRAPHCOARSENEDGECOUNT */
+    coarhashtmp = coarhashmsk;                    /* Assume whole hash table will be used */
+    if (coarhashmsk > GRAPHCOARSENHASHCACHEMSK) { /* If hash table may not fit in cache    */
+      Gnum                coardegrtmp;
+
+      i = 0;
+      coardegrtmp = 0;
+      do {                                        /* Bound number of neighbors of multinode */
+        finevertnum  = coarmulttax[coarvertnum].vertnum[i];
+        coardegrtmp += finevendtax[finevertnum] - fineverttax[finevertnum];
+      } while (i ++, finevertnum != coarmulttax[coarvertnum].vertnum[1]);
+      for (coardegrtmp *= 2, coarhashtmp = GRAPHCOARSENHASHCACHEMSK; /* Only use the smallest part of hash table that is large enough */
+           (coarhashtmp < coardegrtmp) && (coarhashtmp < coarhashmsk); coarhashtmp = coarhashtmp * 2 + 1) ;
+    }
+#ifdef GRAPHCOARSENEDGECOUNT
+    coarhashnum = -2 - coarvertnum;               /* Counting tags differ from building tags, so that table need not be reset */
+#else /* GRAPHCOARSENEDGECOUNT */
+    coarhashnum = coarvertnum;
+#endif /* GRAPHCOARSENEDGECOUNT */
+
     i = 0;
     do {                                          /* For all fine edges of multinode vertices */
       Gnum                fineedgenum;
@@ -121,9 +142,9 @@ GraphCoarsenThread * restrict const     thrdptr)
 
         coarvertend = finecoartax[fineedgetax[fineedgenum]];
         if (coarvertend != coarvertnum) {         /* If not end of collapsed edge */
-          for (h = (coarvertend * GRAPHCOARSENHASHPRIME) & coarhashmsk; ; h = (h + 1) & coarhashmsk) {
-            if (coarhashtab[h].vertorgnum != coarvertnum) { /* If old slot           */
-              coarhashtab[h].vertorgnum = coarvertnum; /* Mark it in reference array */
+          for (h = (coarvertend * GRAPHCOARSENHASHPRIME) & coarhashtmp; ; h = (h + 1) & coarhashtmp) {
+            if (coarhashtab[h].vertorgnum != coarhashnum) { /* If old slot           */
+              coarhashtab[h].vertorgnum = coarhashnum; /* Mark it in reference array */
               coarhashtab[h].vertendnum = coarvertend;
               coarhashtab[h].edgenum    = coaredgenum;
 #ifndef GRAPHCOARSENEDGECOUNT                     /* If we do not only want to count */
@@ -166,10 +187,10 @@ GraphCoarsenThread * restrict const     thrdptr)
     coaredgetmp = coaredgenum - coaredgetmp;      /* Compute degree of current vertex */
     if (coardegrmax < coaredgetmp)
       coardegrmax = coaredgetmp;
-#ifndef GRAPHCOARSENNOTHREAD
+#ifdef SCOTCH_PTHREAD
     if ((coarptr->flagval & GRAPHCOARSENNOCOMPACT) != 0) /* In all cases except for non-compact, multi-threaded graphs */
       coargrafptr->vendtax[coarvertnum] = coaredgenum;
-#endif /* GRAPHCOARSENNOTHREAD */
+#endif /* SCOTCH_PTHREAD */
 #endif /* GRAPHCOARSENEDGECOUNT */
   }                                               /* End of (local) edge array not marked since will be done by next or main thread */
 
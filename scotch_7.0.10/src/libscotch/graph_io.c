@@ -59,7 +59,7 @@
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 03 aug 2016     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,10 +67,17 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_GRAPH_IO
+
 #include "module.h"
 #include "common.h"
+#ifndef COMMON_OS_WINDOWS
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* COMMON_OS_WINDOWS */
 #include "graph.h"
 #include "graph_io.h"
+#include "graph_io_bin.h"
 
 /*******************************************/
 /*                                         */
@@ -78,8 +85,392 @@
 /*                                         */
 /*******************************************/
 
+/* This routine parses an integer value
+** from the given line of text. It behaves
+** as intLoad(), except that the value must
+** be followed by a blank or by the end of
+** the line.
+** It returns:
+** - 0   : on success.
+** - !0  : if no valid value found.
+*/
+
+static
+int
+graphLoadMemInt (
+const char ** const         charpptr,             /*+ Pointer to current character +*/
+const char * const          charnnd,              /*+ End of line                  +*/
+Gnum * const                valuptr)              /*+ Area where to put value      +*/
+{
+  const char *        charptr;
+  Gnum                valuval;
+  int                 signval;
+
+  for (charptr = *charpptr; (charptr < charnnd) && GRAPHLOADMEMBLANK (*charptr); charptr ++) ;
+
+  signval = 0;
+  if (charptr < charnnd) {
+    if (*charptr == '-') {
+      signval = 1;
+      charptr ++;
+    }
+    else if (*charptr == '+')
+      charptr ++;
+  }
+  if ((charptr >= charnnd) ||                     /* If first char is non numeric */
+      (*charptr < '0') || (*charptr > '9'))
+    return (1);
+
+  for (valuval = 0; (charptr < charnnd) && (*charptr >= '0') && (*charptr <= '9'); charptr ++)
+    valuval = valuval * 10 + (*charptr - '0');    /* Accumulate digits */
+  if ((charptr < charnnd) && (! GRAPHLOADMEMBLANK (*charptr)))
+    return (1);
+
+  *charpptr = charptr;
+  *valuptr  = (signval != 0) ? (- valuval) : valuval;
+
+  return (0);
+}
+
+/* This routine computes the start of the
+** text chunk of the given thread, which is
+** the start of the first line beginning in
+** its even share of the text.
+** It returns:
+** - !NULL  : pointer to start of chunk.
+*/
+
+static
+const char *
+graphLoadMemChunk (
+const GraphLoadMemData * restrict const loadptr,
+const int                               thrdnum,
+const int                               thrdnbr)
+{
+  const char *        charptr;
+
+  const char * const  charnnd = loadptr->dataptr + loadptr->datasiz;
+
+  if (thrdnum >= thrdnbr)                         /* Last thread ends at end of text */
+    return (charnnd);
+
+  charptr = loadptr->dataptr + (loadptr->datasiz / thrdnbr) * thrdnum + MIN ((size_t) thrdnum, loadptr->datasiz % thrdnbr);
+  if (thrdnum > 0) {                              /* First thread starts at beginning of text */
+    for ( ; (charptr < charnnd) && (charptr[-1] != '\n'); charptr ++) ;
+  }
+
+  return (charptr);
+}
+
+/* This routine returns the end of the
+** current line, and whether it holds
+** non-blank characters.
+** It returns:
+** - !NULL  : pointer to end of line.
+*/
+
+static
+const char *
+graphLoadMemLine (
+const char * const          charbas,
+const char * const          charnnd,
+int * const                 flagptr)
+{
+  const char *        charptr;
+  int                 flagval;
+
+  for (charptr = charbas, flagval = 0; (charptr < charnnd) && (*charptr != '\n'); charptr ++) {
+    if (! GRAPHLOADMEMBLANK (*charptr))
+      flagval = 1;
+  }
+  *flagptr = flagval;
+
+  return (charptr);
+}
+
+/* These routines perform the reduction and
+** prefix scan operations of the parallel
+** in-memory graph loading routine.
+*/
+
+static
+void
+graphLoadMemReduce (
+GraphLoadMemThread * restrict const tlocptr,      /* Pointer to local thread block  */
+GraphLoadMemThread * restrict const tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->velosum += tremptr->velosum;
+  tlocptr->edlosum += tremptr->edlosum;
+  if (tremptr->vlblmax > tlocptr->vlblmax)
+    tlocptr->vlblmax = tremptr->vlblmax;
+  if (tremptr->degrmax > tlocptr->degrmax)
+    tlocptr->degrmax = tremptr->degrmax;
+}
+
+static
+void
+graphLoadMemScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine is the threaded core of the
+** in-memory graph loading routine. Each thread
+** counts the vertex lines of its chunk, reads
+** vertex data and degrees, computes its edge
+** range by prefix scan, and then reads its
+** edge data. Any inconsistency is reported
+** by the return value, so that the caller can
+** fall back to reading the stream.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadMem2 (
+ThreadDescriptor * restrict const descptr,
+GraphLoadMemData * restrict const loadptr)
+{
+  const char *        charptr;
+  const char *        lineend;
+  Gnum                vertnum;
+  Gnum                vertnnd;
+  Gnum                edgenum;
+  Gnum                edgenbr;
+  int                 flagval;
+
+  const int                     thrdnbr = threadNbr (descptr);
+  const int                     thrdnum = threadNum (descptr);
+  GraphLoadMemThread * restrict thrdptr = &loadptr->thrdtab[thrdnum];
+  Graph * restrict const        grafptr = loadptr->grafptr;
+  Gnum * restrict const         verttax = grafptr->verttax;
+  Gnum * restrict const         velotax = grafptr->velotax;
+  Gnum * restrict const         vlbltax = grafptr->vlbltax;
+  Gnum * restrict const         edgetax = grafptr->edgetax;
+  Gnum * restrict const         edlotax = grafptr->edlotax;
+  const Gnum                    baseadj = loadptr->baseadj;
+  const char * const            charbas = graphLoadMemChunk (loadptr, thrdnum,     thrdnbr);
+  const char * const            charnnd = graphLoadMemChunk (loadptr, thrdnum + 1, thrdnbr);
+
+  for (charptr = charbas, vertnum = 0; charptr < charnnd; charptr = lineend + 1) { /* Count vertex lines */
+    lineend  = graphLoadMemLine (charptr, charnnd, &flagval);
+    vertnum += flagval;
+  }
+
+  thrdptr->vscntab[0] = vertnum;
+  threadScan (descptr, (void *) &thrdptr->vscntab[0], sizeof (GraphLoadMemThread), (ThreadScanFunc) graphLoadMemScan, NULL); /* Compute start vertex of chunk */
+  if (loadptr->thrdtab[thrdnbr - 1].vscntab[0] != grafptr->vertnbr) { /* If not one vertex per line, give up */
+    loadptr->revaval = 1;
+    return;
+  }
+  thrdptr->vertbas = thrdptr->vscntab[0] - vertnum + grafptr->baseval;
+  thrdptr->vertnnd = thrdptr->vscntab[0] + grafptr->baseval;
+
+  thrdptr->vlblmax = grafptr->vertnnd - 1;        /* No vertex labels known */
+  thrdptr->velosum = 0;
+  thrdptr->edlosum = 0;
+  thrdptr->degrmax = 0;
+  for (charptr = charbas, vertnum = thrdptr->vertbas, edgenbr = 0; charptr < charnnd; charptr = lineend + 1) { /* Read vertex data */
+    Gnum                degrval;
+    Gnum                valuval;
+    Gnum                edgeidx;
+
+    lineend = graphLoadMemLine (charptr, charnnd, &flagval);
+    if (flagval == 0)                             /* Skip empty lines */
+      continue;
+
+    if (loadptr->vlblflag != 0) {
+      if (graphLoadMemInt (&charptr, lineend, &valuval) != 0)
+        break;
+      vlbltax[vertnum] = valuval;
+      if (valuval > thrdptr->vlblmax)
+        thrdptr->vlblmax = valuval;
+    }
+    if (loadptr->veloflag != 0) {
+      if (graphLoadMemInt (&charptr, lineend, &valuval) != 0)
+        break;
+      if (velotax != NULL)
+        thrdptr->velosum  +=
+        velotax[vertnum] = valuval;
+    }
+    if ((graphLoadMemInt (&charptr, lineend, &degrval) != 0) ||
+        (degrval < 0) || (degrval > grafptr->edgenbr))
+      break;
+    for (edgeidx = degrval << loadptr->edloflag; edgeidx > 0; edgeidx --) { /* Check edge data */
+      if (graphLoadMemInt (&charptr, lineend, &valuval) != 0)
+        break;
+    }
+    if (edgeidx > 0)                              /* If not enough edge data */
+      break;
+    for ( ; (charptr < lineend) && GRAPHLOADMEMBLANK (*charptr); charptr ++) ;
+    if (charptr < lineend)                        /* If trailing data on line */
+      break;
+
+    if (degrval > thrdptr->degrmax)
+      thrdptr->degrmax = degrval;
+    verttax[vertnum ++] = degrval;                /* Keep degree until edge indices known */
+    edgenbr += degrval;
+  }
+  if (vertnum != thrdptr->vertnnd)                /* If could not parse whole chunk */
+    loadptr->revaval = 1;
+
+  thrdptr->escntab[0] = edgenbr;
+  threadScan (descptr, (void *) &thrdptr->escntab[0], sizeof (GraphLoadMemThread), (ThreadScanFunc) graphLoadMemScan, NULL); /* Compute start edge of chunk */
+  if ((loadptr->revaval != 0) ||                  /* If some thread failed or edge count does not match */
+      (loadptr->thrdtab[thrdnbr - 1].escntab[0] != grafptr->edgenbr)) {
+    loadptr->revaval = 1;
+    return;
+  }
+
+  for (vertnum = thrdptr->vertbas, vertnnd = thrdptr->vertnnd, edgenum = thrdptr->escntab[0] - edgenbr + grafptr->baseval;
+       vertnum < vertnnd; vertnum ++) {           /* Turn degrees into edge indices */
+    Gnum                degrval;
+
+    degrval = verttax[vertnum];
+    verttax[vertnum] = edgenum;
+    edgenum += degrval;
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread sets end of edge array */
+    verttax[grafptr->vertnnd] = edgenum;
+
+  for (charptr = charbas, edgenum = thrdptr->escntab[0] - edgenbr + grafptr->baseval; /* Read edge data, already checked */
+       charptr < charnnd; charptr = lineend + 1) { /* Degrees re-read since next chunk may not have its indices yet */
+    Gnum                valuval;
+    Gnum                edgennd;
+
+    lineend = graphLoadMemLine (charptr, charnnd, &flagval);
+    if (flagval == 0)
+      continue;
+
+    if (loadptr->vlblflag != 0)                   /* Skip vertex data */
+      graphLoadMemInt (&charptr, lineend, &valuval);
+    if (loadptr->veloflag != 0)
+      graphLoadMemInt (&charptr, lineend, &valuval);
+    graphLoadMemInt (&charptr, lineend, &valuval);
+
+    for (edgennd = edgenum + valuval; edgenum < edgennd; edgenum ++) {
+      if (loadptr->edloflag != 0) {
+        graphLoadMemInt (&charptr, lineend, &valuval);
+        if (edlotax != NULL)
+          thrdptr->edlosum  +=
+          edlotax[edgenum] = valuval;
+      }
+      graphLoadMemInt (&charptr, lineend, &valuval);
+      edgetax[edgenum] = valuval + baseadj;
+    }
+  }
+
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphLoadMemThread), (ThreadReduceFunc) graphLoadMemReduce, 0, NULL);
+}
+
+/* This routine tries to read the vertex and
+** edge data of a graph, the header of which
+** has already been read, by mapping in memory
+** the remainder of the file and parsing it in
+** parallel. This is only possible for regular
+** files holding one vertex per line, without
+** trailing data; in all other cases (pipes,
+** compressed streams, unusual layout, or bad
+** data), the caller must read the stream,
+** which has been left untouched.
+** It returns:
+** - 0   : if graph data have been read.
+** - !0  : if the stream must be read instead.
+*/
+
+static
+int
+graphLoadMem (
+Graph * restrict const      grafptr,              /* Graph with allocated arrays          */
+FILE * const                stream,               /* Stream positioned after graph header */
+const Gnum                  baseadj,              /* Base adjustment for edge ends        */
+const char * const          proptab,              /* File property flags                  */
+Gnum * const                vlblptr,              /* Pointer to maximum vertex label      */
+Context * const             contptr)              /* Execution context (may be NULL)      */
+{
+#ifndef COMMON_OS_WINDOWS
+  GraphLoadMemData    loaddat;
+  Context             contdat;                    /* Local sequential context if none provided */
+  Context *           conttmp;
+  struct stat         statdat;
+  off_t               fileoff;
+  void *              mmapptr;
+  int                 thrdnbr;
+
+  if ((grafptr->vertnbr <= 0) ||                  /* Nothing worth mapping */
+      (fstat (fileno (stream), &statdat) != 0) ||
+      (! S_ISREG (statdat.st_mode))             || /* Pipes and compressed streams are read as streams */
+      ((fileoff = ftello (stream)) < 0)         ||
+      (fileoff >= statdat.st_size))
+    return (1);
+
+  if ((mmapptr = mmap (NULL, (size_t) statdat.st_size, PROT_READ, MAP_PRIVATE, fileno (stream), 0)) == MAP_FAILED)
+    return (1);
+
+  conttmp = contptr;
+  if (conttmp == NULL) {                          /* If no context provided, run sequentially */
+    conttmp = &contdat;
+    contextInit (conttmp);
+    if (contextThreadInit2 (conttmp, 1, NULL) != 0) {
+      munmap (mmapptr, (size_t) statdat.st_size);
+      return (1);
+    }
+    contextCommit (conttmp);
+  }
+  thrdnbr = contextThreadNbr (conttmp);
+
+  loaddat.revaval = 1;                            /* Assume failure */
+  if ((loaddat.thrdtab = memAlloc (thrdnbr * sizeof (GraphLoadMemThread))) != NULL) {
+    loaddat.grafptr  = grafptr;
+    loaddat.dataptr  = (const char *) mmapptr + fileoff;
+    loaddat.datasiz  = (size_t) (statdat.st_size - fileoff);
+    loaddat.baseadj  = baseadj;
+    loaddat.vlblflag = (proptab[0] != 0) ? 1 : 0;
+    loaddat.veloflag = (proptab[2] != 0) ? 1 : 0;
+    loaddat.edloflag = (proptab[1] != 0) ? 1 : 0;
+    loaddat.revaval  = 0;
+
+    contextThreadLaunch (conttmp, (ThreadFunc) graphLoadMem2, (void *) &loaddat);
+
+    if (loaddat.revaval == 0) {                   /* If graph data read, reduced data are in first block */
+      grafptr->velosum = (grafptr->velotax != NULL) ? loaddat.thrdtab[0].velosum : grafptr->vertnbr;
+      grafptr->edlosum = (grafptr->edlotax != NULL) ? loaddat.thrdtab[0].edlosum : grafptr->edgenbr;
+      grafptr->degrmax = loaddat.thrdtab[0].degrmax;
+      *vlblptr         = loaddat.thrdtab[0].vlblmax;
+    }
+
+    memFree (loaddat.thrdtab);
+  }
+
+  if (conttmp == &contdat)
+    contextExit (&contdat);
+  munmap (mmapptr, (size_t) statdat.st_size);
+
+  if (loaddat.revaval != 0)
+    return (1);
+
+  fseeko (stream, 0, SEEK_END);                   /* All remaining data of stream consumed */
+  return (0);
+#else /* COMMON_OS_WINDOWS */
+  return (1);                                     /* Always read streams */
+#endif /* COMMON_OS_WINDOWS */
+}
+
 /* This routine loads a source graph from
-** the given stream.
+** the given stream. When the stream is a
+** regular file, vertex and edge data are
+** first parsed in memory, in parallel on
+** the threads of the given context, if any.
+** Binary graph files are recognized by
+** their magic string and handed over to
+** graphLoadBin().
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -90,12 +481,13 @@ graphLoad (
 Graph * restrict const      grafptr,              /* Graph structure to fill              */
 FILE * const                stream,               /* Stream from which to read graph data */
 const Gnum                  baseval,              /* Base value (-1 means keep file base) */
-const GraphLoadFlag         flagval)              /* Graph loading flags                  */
+const GraphLoadFlag         flagval,              /* Graph loading flags                  */
+Context * const             contptr)              /* Execution context (may be NULL)      */
 {
   Gnum                edgenum;                    /* Number of edges really allocated */
   Gnum                edgennd;
   Gnum                vlblsiz;                    /* = vertnbr if vertex labels       */
-  Gnum                vlblmax;                    /* Maximum vertex label number      */
+  Gnum                vlblmax = 0;                /* Maximum vertex label number      */
   Gnum                velosiz;                    /* = vertnbr if vertex loads wanted */
   Gnum                velosum;                    /* Sum of vertex loads              */
   Gnum                edlosiz;                    /* = edgenbr if edge loads wanted   */
@@ -107,9 +499,17 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
   Gnum                propval;
   char                proptab[4];
   Gnum                vertnum;
+  int                 charval;
 
   memSet (grafptr, 0, sizeof (Graph));
 
+  if ((charval = getc (stream)) == GRAPHBINMAGIC[0]) { /* If binary graph file */
+    ungetc (charval, stream);
+    return (graphLoadBin (grafptr, stream, baseval, flagval));
+  }
+  if (charval != EOF)
+    ungetc (charval, stream);
+
   if (intLoad (stream, &versval) != 1) {          /* Read version number */
     errorPrint ("graphLoad: bad input (1)");
     return (1);
@@ -179,85 +579,87 @@ const GraphLoadFlag         flagval)              /* Graph loading flags
   grafptr->edgetax -= grafptr->baseval;
   grafptr->edlotax  = (edlosiz != 0) ? (grafptr->edlotax - grafptr->baseval) : NULL;
 
-  vlblmax = grafptr->vertnnd - 1;                 /* No vertex labels known */
-  velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
-  edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
-  edgennd = grafptr->edgenbr + grafptr->baseval;
-  degrmax = 0;                                    /* No maximum degree yet */
+  if (graphLoadMem (grafptr, stream, baseadj, proptab, &vlblmax, contptr) != 0) { /* If data could not be parsed in memory, read stream */
+    vlblmax = grafptr->vertnnd - 1;               /* No vertex labels known */
+    velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0;
+    edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
+    edgennd = grafptr->edgenbr + grafptr->baseval;
+    degrmax = 0;                                  /* No maximum degree yet */
 
-  for (vertnum = edgenum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
-    Gnum                degrval;
+    for (vertnum = edgenum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+      Gnum                degrval;
 
-    if (grafptr->vlbltax != NULL) {               /* If must read label               */
-      Gnum                vlblval;                /* Value where to read vertex label */
+      if (grafptr->vlbltax != NULL) {             /* If must read label               */
+        Gnum                vlblval;              /* Value where to read vertex label */
+
+        if (intLoad (stream, &vlblval) != 1) {    /* Read label data */
+          errorPrint ("graphLoad: bad input (3)");
+          graphFree  (grafptr);
+          return (1);
+        }
+        grafptr->vlbltax[vertnum] = vlblval;
+        if (grafptr->vlbltax[vertnum] > vlblmax)  /* Get maximum vertex label */
+          vlblmax = grafptr->vlbltax[vertnum];
+      }
+      if (proptab[2] != 0) {                      /* If must read vertex load        */
+        Gnum                veloval;              /* Value where to read vertex load */
 
-      if (intLoad (stream, &vlblval) != 1) {      /* Read label data */
-        errorPrint ("graphLoad: bad input (3)");
+        if (intLoad (stream, &veloval) != 1) {    /* Read vertex load data */
+          errorPrint ("graphLoad: bad input (4)");
+          graphFree  (grafptr);
+          return (1);
+        }
+        if (grafptr->velotax != NULL)
+          velosum                  +=
+          grafptr->velotax[vertnum] = veloval;
+      }
+      if (intLoad (stream, &degrval) != 1) {      /* Read vertex degree */
+        errorPrint ("graphLoad: bad input (5)");
         graphFree  (grafptr);
         return (1);
       }
-      grafptr->vlbltax[vertnum] = vlblval;
-      if (grafptr->vlbltax[vertnum] > vlblmax)    /* Get maximum vertex label */
-        vlblmax = grafptr->vlbltax[vertnum];
-    }
-    if (proptab[2] != 0) {                        /* If must read vertex load        */
-      Gnum                veloval;                /* Value where to read vertex load */
+      if (degrmax < degrval)                      /* Set maximum degree */
+        degrmax = degrval;
 
-      if (intLoad (stream, &veloval) != 1) {      /* Read vertex load data */
-        errorPrint ("graphLoad: bad input (4)");
+      grafptr->verttax[vertnum] = edgenum;        /* Set index in edge array */
+      degrval += edgenum;
+      if (degrval > edgennd) {                    /* Check if edge array overflows */
+        errorPrint ("graphLoad: invalid arc count (1)");
         graphFree  (grafptr);
         return (1);
       }
-      if (grafptr->velotax != NULL)
-        velosum                  +=
-        grafptr->velotax[vertnum] = veloval;
-    }
-    if (intLoad (stream, &degrval) != 1) {        /* Read vertex degree */
-      errorPrint ("graphLoad: bad input (5)");
-      graphFree  (grafptr);
-      return (1);
-    }
-    if (degrmax < degrval)                        /* Set maximum degree */
-      degrmax = degrval;
 
-    grafptr->verttax[vertnum] = edgenum;          /* Set index in edge array */
-    degrval += edgenum;
-    if (degrval > edgennd) {                      /* Check if edge array overflows */
-      errorPrint ("graphLoad: invalid arc count (1)");
-      graphFree  (grafptr);
-      return (1);
-    }
-
-    for ( ; edgenum < degrval; edgenum ++) {
-      if (proptab[1] != 0) {                      /* If must read edge load        */
-        Gnum                edloval;              /* Value where to read edge load */
-
-        if (intLoad (stream, &edloval) != 1) {    /* Read edge load data */
-          errorPrint ("graphLoad: bad input (6)");
+      for ( ; edgenum < degrval; edgenum ++) {
+        if (proptab[1] != 0) {                    /* If must read edge load        */
+          Gnum                edloval;            /* Value where to read edge load */
+
+          if (intLoad (stream, &edloval) != 1) {  /* Read edge load data */
+            errorPrint ("graphLoad: bad input (6)");
+            graphFree  (grafptr);
+            return (1);
+          }
+          if (grafptr->edlotax != NULL)
+            edlosum                  +=
+            grafptr->edlotax[edgenum] = (Gnum) edloval;
+        }
+        if (intLoad (stream, &edgeval) != 1) {    /* Read edge data */
+          errorPrint ("graphLoad: bad input (7)");
           graphFree  (grafptr);
           return (1);
         }
-        if (grafptr->edlotax != NULL)
-          edlosum                  +=
-          grafptr->edlotax[edgenum] = (Gnum) edloval;
+        grafptr->edgetax[edgenum] = edgeval + baseadj;
       }
-      if (intLoad (stream, &edgeval) != 1) {      /* Read edge data */
-        errorPrint ("graphLoad: bad input (7)");
-        graphFree  (grafptr);
-        return (1);
-      }
-      grafptr->edgetax[edgenum] = edgeval + baseadj;
     }
+    grafptr->verttax[vertnum] = edgenum;          /* Set end of edge array             */
+    if (edgenum != edgennd) {                     /* Check if number of edges is valid */
+      errorPrint ("graphLoad: invalid arc count (2)");
+      graphFree  (grafptr);
+      return (1);
+    }
+    grafptr->velosum = velosum;
+    grafptr->edlosum = edlosum;
+    grafptr->degrmax = degrmax;
   }
-  grafptr->verttax[vertnum] = edgenum;            /* Set end of edge array             */
-  if (edgenum != edgennd) {                       /* Check if number of edges is valid */
-    errorPrint ("graphLoad: invalid arc count (2)");
-    graphFree  (grafptr);
-    return (1);
-  }
-  grafptr->velosum = velosum;
-  grafptr->edlosum = edlosum;
-  grafptr->degrmax = degrmax;
 
   if (grafptr->vlbltax != NULL) {                 /* If vertex label renaming necessary       */
     if (graphLoad2 (grafptr->baseval, grafptr->vertnnd, grafptr->verttax, /* Rename edge ends */
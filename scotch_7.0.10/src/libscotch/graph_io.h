@@ -57,12 +57,63 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : to   : 11 jul 2024     **/
-/**                                 to   : 11 jul 2024     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Blank characters within a line. +*/
+
+#define GRAPHLOADMEMBLANK(c)        (((c) == ' ') || ((c) == '\t') || ((c) == '\r') || ((c) == '\v') || ((c) == '\f'))
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block for
+    loading a graph from memory.      +*/
+
+typedef struct GraphLoadMemThread_ {
+  Gnum                      vertbas;              /*+ First vertex of chunk                +*/
+  Gnum                      vertnnd;              /*+ After-last vertex of chunk           +*/
+  Gnum                      vscntab[2];           /*+ Area for vertex scan                 +*/
+  Gnum                      escntab[2];           /*+ Area for edge scan                   +*/
+  Gnum                      vlblmax;              /*+ Maximum vertex label                 +*/
+  Gnum                      velosum;              /*+ Sum of vertex loads                  +*/
+  Gnum                      edlosum;              /*+ Sum of edge loads                    +*/
+  Gnum                      degrmax;              /*+ Maximum degree                       +*/
+} GraphLoadMemThread;
+
+/*+ The data structure for loading a graph
+    from memory. Text is expected to hold
+    exactly one vertex per (non-empty) line,
+    so that chunks can be parsed in parallel. +*/
+
+typedef struct GraphLoadMemData_ {
+  Graph *                   grafptr;              /*+ Graph being loaded                   +*/
+  const char *              dataptr;              /*+ Start of text of vertex data         +*/
+  size_t                    datasiz;              /*+ Size of text of vertex data          +*/
+  Gnum                      baseadj;              /*+ Base adjustment for edge ends        +*/
+  int                       vlblflag;             /*+ Vertex labels present in file        +*/
+  int                       veloflag;             /*+ Vertex loads present in file         +*/
+  int                       edloflag;             /*+ Edge loads present in file           +*/
+  GraphLoadMemThread *      thrdtab;              /*+ Array of thread-specific data blocks +*/
+  volatile int              revaval;              /*+ Return value, set if text not usable +*/
+} GraphLoadMemData;
+
 /*
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_GRAPH_IO
+static int                  graphLoadMemInt     (const char ** const, const char * const, Gnum * const);
+static const char *         graphLoadMemChunk   (const GraphLoadMemData * restrict const, const int, const int);
+static const char *         graphLoadMemLine    (const char * const, const char * const, int * const);
+static void                 graphLoadMem2       (ThreadDescriptor * restrict const, GraphLoadMemData * restrict const);
+static int                  graphLoadMem        (Graph * restrict const, FILE * const, const Gnum, const char * const, Gnum * const, Context * const);
+#endif /* SCOTCH_GRAPH_IO */
+
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
@@ -0,0 +1,412 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the binary source   **/
+/**                graph format, the arrays of which can   **/
+/**                be mapped in memory without copy.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 16 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+
+/* This routine reads and checks the header
+** of a binary graph file.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphBinHeadLoad (
+GraphBinHead * const        headptr,              /*+ Header to fill                    +*/
+FILE * const                stream)               /*+ Stream positioned at header start +*/
+{
+  if (fread (headptr, sizeof (GraphBinHead), 1, stream) != 1) {
+    errorPrint ("graphBinHeadLoad: bad input");
+    return (1);
+  }
+  if (memcmp (headptr->magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ) != 0) {
+    errorPrint ("graphBinHeadLoad: not a binary graph file");
+    return (1);
+  }
+  if (headptr->versval != GRAPHBINVERSION) {
+    errorPrint ("graphBinHeadLoad: unsupported binary graph version");
+    return (1);
+  }
+  if ((headptr->endival != GRAPHBINENDIAN) ||
+      (headptr->numbsiz != (int) sizeof (Gnum))) {
+    errorPrint ("graphBinHeadLoad: file written with different endianness or integer size");
+    return (1);
+  }
+  if (((headptr->propval & ~GRAPHBINHASMASK) != 0) ||
+      (headptr->vertnbr < 0) ||
+      (headptr->edgenbr < 0) ||
+      (headptr->degrmax < 0)) {
+    errorPrint ("graphBinHeadLoad: invalid header");
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine computes the offsets of
+** the arrays of a binary graph file.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+graphBinOffs (
+const GraphBinHead * const  headptr,
+GraphBinOffs * const        offsptr)
+{
+  off_t               vertsiz;
+  off_t               edgesiz;
+
+  vertsiz = (off_t) headptr->vertnbr * sizeof (Gnum);
+  edgesiz = (off_t) headptr->edgenbr * sizeof (Gnum);
+
+  offsptr->vertoff = GRAPHBINALIGNOFF ((off_t) sizeof (GraphBinHead));
+  offsptr->velooff = GRAPHBINALIGNOFF (offsptr->vertoff + vertsiz + sizeof (Gnum));
+  offsptr->vlbloff = GRAPHBINALIGNOFF (offsptr->velooff + (((headptr->propval & GRAPHBINHASVELO) != 0) ? vertsiz : 0));
+  offsptr->vertend = GRAPHBINALIGNOFF (offsptr->vlbloff + (((headptr->propval & GRAPHBINHASVLBL) != 0) ? vertsiz : 0));
+  offsptr->edgeoff = offsptr->vertend;
+  offsptr->edlooff = GRAPHBINALIGNOFF (offsptr->edgeoff + edgesiz);
+  offsptr->edgeend = GRAPHBINALIGNOFF (offsptr->edlooff + (((headptr->propval & GRAPHBINHASEDLO) != 0) ? edgesiz : 0));
+}
+
+/* This routine reads data from the given
+** offset of a stream that cannot be mapped.
+** Since the stream may not be seekable,
+** offsets must be increasing, and skipped
+** bytes are read when seeking fails.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphBinRead (
+FILE * const                stream,               /*+ Stream to read from             +*/
+off_t * const               curoptr,              /*+ Current offset in stream        +*/
+const off_t                 dataoff,              /*+ Offset of data to read          +*/
+void * const                dataptr,              /*+ Area where to put data          +*/
+const size_t                datasiz)              /*+ Size of data to read, in bytes  +*/
+{
+  off_t               curoval;
+
+  curoval = *curoptr;
+#ifndef COMMON_OS_WINDOWS
+  if ((curoval < dataoff) &&                      /* Seek forward if stream allows it */
+      (fseeko (stream, dataoff - curoval, SEEK_CUR) == 0))
+    curoval = dataoff;
+#endif /* COMMON_OS_WINDOWS */
+  for ( ; curoval < dataoff; curoval ++) {        /* Else skip unwanted bytes */
+    if (getc (stream) == EOF)
+      return (1);
+  }
+  if ((datasiz > 0) &&
+      (fread (dataptr, datasiz, 1, stream) != 1))
+    return (1);
+
+  *curoptr = dataoff + datasiz;
+
+  return (0);
+}
+
+/* This routine loads a source graph from a
+** binary graph file. When the stream is a
+** regular file, vertex and edge arrays are
+** mapped in memory without any copy, and
+** the graph is flagged so that they are
+** unmapped rather than freed. Else, they
+** are read into allocated arrays. The stream
+** must be positioned at the start of the
+** header, and is left after the end of the
+** graph data.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBin (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphLoadFlag         flagval)              /* Graph loading flags                  */
+{
+  GraphBinHead        headdat;
+  GraphBinOffs        offsdat;
+  off_t               headoff;                    /* Offset of header in stream, if known */
+  off_t               curoval;                    /* Current offset with respect to header */
+  byte *              vertptr;                    /* Pointer to vertex area               */
+  byte *              edgeptr;                    /* Pointer to edge area                 */
+  Gnum                baseadj;
+  Gnum                vertnum;
+  Gnum                edgenum;
+
+#ifndef COMMON_OS_WINDOWS
+  headoff = ftello (stream);                      /* Negative if stream not seekable */
+#else /* COMMON_OS_WINDOWS */
+  headoff = -1;
+#endif /* COMMON_OS_WINDOWS */
+
+  if (graphBinHeadLoad (&headdat, stream) != 0)
+    return (1);
+  graphBinOffs (&headdat, &offsdat);
+  curoval = (off_t) sizeof (GraphBinHead);
+
+  grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+
+  vertptr = (headoff >= 0) ? fileMap (stream, headoff + offsdat.vertoff, (size_t) (offsdat.vertend - offsdat.vertoff)) : NULL;
+  edgeptr = (headoff >= 0) ? fileMap (stream, headoff + offsdat.edgeoff, (size_t) (offsdat.edgeend - offsdat.edgeoff)) : NULL;
+  if (vertptr != NULL)
+    grafptr->flagval |= GRAPHVERTMMAP;
+  else if ((vertptr = memAlloc ((size_t) (offsdat.vertend - offsdat.vertoff))) == NULL) {
+    errorPrint ("graphLoadBin: out of memory (1)");
+    if (edgeptr != NULL)
+      fileUnmap (edgeptr);
+    return (1);
+  }
+  if (edgeptr != NULL)
+    grafptr->flagval |= GRAPHEDGEMMAP;
+  else if ((edgeptr = memAlloc ((size_t) (offsdat.edgeend - offsdat.edgeoff))) == NULL) {
+    errorPrint ("graphLoadBin: out of memory (2)");
+    if ((grafptr->flagval & GRAPHVERTMMAP) != 0)
+      fileUnmap (vertptr);
+    else
+      memFree (vertptr);
+    return (1);
+  }
+
+  grafptr->baseval = headdat.baseval;             /* Set file base for now */
+  grafptr->vertnbr = headdat.vertnbr;
+  grafptr->vertnnd = headdat.vertnbr + headdat.baseval;
+  grafptr->verttax = (Gnum *) vertptr - headdat.baseval;
+  grafptr->vendtax = grafptr->verttax + 1;        /* Binary graphs are always compact */
+  grafptr->velotax = (((headdat.propval & GRAPHBINHASVELO) != 0) && ((flagval & GRAPHIONOLOADVERT) == 0))
+                     ? (Gnum *) (vertptr + (offsdat.velooff - offsdat.vertoff)) - headdat.baseval : NULL;
+  grafptr->velosum = (grafptr->velotax != NULL) ? headdat.velosum : headdat.vertnbr;
+  grafptr->vlbltax = ((headdat.propval & GRAPHBINHASVLBL) != 0)
+                     ? (Gnum *) (vertptr + (offsdat.vlbloff - offsdat.vertoff)) - headdat.baseval : NULL;
+  grafptr->edgenbr = headdat.edgenbr;
+  grafptr->edgetax = (Gnum *) edgeptr - headdat.baseval;
+  grafptr->edlotax = (((headdat.propval & GRAPHBINHASEDLO) != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0))
+                     ? (Gnum *) (edgeptr + (offsdat.edlooff - offsdat.edgeoff)) - headdat.baseval : NULL;
+  grafptr->edlosum = (grafptr->edlotax != NULL) ? headdat.edlosum : headdat.edgenbr;
+  grafptr->degrmax = headdat.degrmax;
+
+  if ((((grafptr->flagval & GRAPHVERTMMAP) == 0) &&
+       (graphBinRead (stream, &curoval, offsdat.vertoff, vertptr, (size_t) (offsdat.vertend - offsdat.vertoff)) != 0)) ||
+      (((grafptr->flagval & GRAPHEDGEMMAP) == 0) &&
+       (graphBinRead (stream, &curoval, offsdat.edgeoff, edgeptr, (size_t) (offsdat.edgeend - offsdat.edgeoff)) != 0))) {
+    errorPrint ("graphLoadBin: bad input");
+    graphFree  (grafptr);
+    return (1);
+  }
+#ifndef COMMON_OS_WINDOWS
+  if (((grafptr->flagval & (GRAPHVERTMMAP | GRAPHEDGEMMAP)) != 0) && /* If some data skipped, move after graph data */
+      (fseeko (stream, headoff + offsdat.edgeend, SEEK_SET) != 0)) {
+    errorPrint ("graphLoadBin: cannot skip graph data");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* COMMON_OS_WINDOWS */
+
+  if ((grafptr->verttax[grafptr->baseval] != grafptr->baseval) || /* Minimal sanity checks, as arrays are used as is */
+      (grafptr->verttax[grafptr->vertnnd] != (grafptr->edgenbr + grafptr->baseval))) {
+    errorPrint ("graphLoadBin: invalid vertex array");
+    graphFree  (grafptr);
+    return (1);
+  }
+
+  baseadj = (baseval == -1) ? 0 : (baseval - headdat.baseval);
+  if (baseadj != 0) {                             /* If base must be changed, update private copies of mapped pages */
+    for (vertnum = grafptr->baseval; vertnum <= grafptr->vertnnd; vertnum ++)
+      grafptr->verttax[vertnum] += baseadj;
+    for (edgenum = grafptr->baseval; edgenum < (grafptr->edgenbr + grafptr->baseval); edgenum ++)
+      grafptr->edgetax[edgenum] += baseadj;
+
+    grafptr->baseval  = baseval;
+    grafptr->vertnnd += baseadj;
+    grafptr->verttax -= baseadj;
+    grafptr->vendtax -= baseadj;
+    grafptr->velotax  = (grafptr->velotax != NULL) ? (grafptr->velotax - baseadj) : NULL;
+    grafptr->vlbltax  = (grafptr->vlbltax != NULL) ? (grafptr->vlbltax - baseadj) : NULL;
+    grafptr->edgetax -= baseadj;
+    grafptr->edlotax  = (grafptr->edlotax != NULL) ? (grafptr->edlotax - baseadj) : NULL;
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadBin: inconsistent graph data");
+    graphFree  (grafptr);
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine writes zero bytes up to
+** the given offset.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+graphSaveBinPad (
+FILE * const                stream,
+off_t * const               curoptr,
+const off_t                 dataoff)
+{
+  off_t               curoval;
+
+  for (curoval = *curoptr; curoval < dataoff; curoval ++) {
+    if (putc (0, stream) == EOF)
+      return (1);
+  }
+  *curoptr = dataoff;
+
+  return (0);
+}
+
+/* This routine saves a source graph in
+** the binary graph format. Non-compact
+** graphs are compacted on the fly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBin (
+const Graph * const         grafptr,
+FILE * const                stream)
+{
+  GraphBinHead        headdat;
+  GraphBinOffs        offsdat;
+  off_t               curoval;
+  Gnum                vertnum;
+  Gnum                edgenum;
+  int                 o;
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+
+  memSet (&headdat, 0, sizeof (GraphBinHead));    /* Do not write uninitialized padding bytes */
+  memCpy (headdat.magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ);
+  headdat.versval = GRAPHBINVERSION;
+  headdat.numbsiz = (int) sizeof (Gnum);
+  headdat.endival = GRAPHBINENDIAN;
+  headdat.propval = ((grafptr->velotax != NULL) ? GRAPHBINHASVELO : 0) |
+                    ((grafptr->vlbltax != NULL) ? GRAPHBINHASVLBL : 0) |
+                    ((grafptr->edlotax != NULL) ? GRAPHBINHASEDLO : 0);
+  headdat.baseval = grafptr->baseval;
+  headdat.vertnbr = grafptr->vertnbr;
+  headdat.edgenbr = grafptr->edgenbr;
+  headdat.velosum = grafptr->velosum;
+  headdat.edlosum = grafptr->edlosum;
+  headdat.degrmax = grafptr->degrmax;
+  graphBinOffs (&headdat, &offsdat);
+
+  o = (fwrite (&headdat, sizeof (GraphBinHead), 1, stream) != 1);
+  curoval = (off_t) sizeof (GraphBinHead);
+
+  o |= graphSaveBinPad (stream, &curoval, offsdat.vertoff);
+  for (vertnum = grafptr->baseval, edgenum = grafptr->baseval; /* Write compact vertex array */
+       (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) {
+    o |= (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+    edgenum += vendtax[vertnum] - verttax[vertnum];
+  }
+  o |= (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+  curoval += (off_t) (grafptr->vertnbr + 1) * sizeof (Gnum);
+  if ((o == 0) && (edgenum != (grafptr->edgenbr + grafptr->baseval))) {
+    errorPrint ("graphSaveBin: invalid edge count");
+    return (1);
+  }
+
+  if (grafptr->velotax != NULL) {
+    o |= graphSaveBinPad (stream, &curoval, offsdat.velooff);
+    o |= (fwrite (grafptr->velotax + grafptr->baseval, sizeof (Gnum), grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    curoval += (off_t) grafptr->vertnbr * sizeof (Gnum);
+  }
+  if (grafptr->vlbltax != NULL) {
+    o |= graphSaveBinPad (stream, &curoval, offsdat.vlbloff);
+    o |= (fwrite (grafptr->vlbltax + grafptr->baseval, sizeof (Gnum), grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    curoval += (off_t) grafptr->vertnbr * sizeof (Gnum);
+  }
+
+  o |= graphSaveBinPad (stream, &curoval, offsdat.edgeoff);
+  for (vertnum = grafptr->baseval; (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) { /* Write adjacency of each vertex, in case graph not compact */
+    Gnum                degrval;
+
+    degrval = vendtax[vertnum] - verttax[vertnum];
+    o |= (fwrite (grafptr->edgetax + verttax[vertnum], sizeof (Gnum), degrval, stream) != (size_t) degrval);
+  }
+  curoval += (off_t) grafptr->edgenbr * sizeof (Gnum);
+
+  if (grafptr->edlotax != NULL) {
+    o |= graphSaveBinPad (stream, &curoval, offsdat.edlooff);
+    for (vertnum = grafptr->baseval; (vertnum < grafptr->vertnnd) && (o == 0); vertnum ++) {
+      Gnum                degrval;
+
+      degrval = vendtax[vertnum] - verttax[vertnum];
+      o |= (fwrite (grafptr->edlotax + verttax[vertnum], sizeof (Gnum), degrval, stream) != (size_t) degrval);
+    }
+    curoval += (off_t) grafptr->edgenbr * sizeof (Gnum);
+  }
+  o |= graphSaveBinPad (stream, &curoval, offsdat.edgeend); /* Pad end of file, so that last area can be mapped as a whole */
+
+  if (o != 0)
+    errorPrint ("graphSaveBin: bad output");
+
+  return (o);
+}
@@ -0,0 +1,113 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the binary source graph format      **/
+/**                handling routines.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 16 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Binary graph file format. Arrays are stored
+    in native format, so that they can be mapped
+    in memory without any copy. Hence, files can
+    only be read by machines having the same
+    endianness and integer size as the writer. +*/
+
+#define GRAPHBINMAGIC               "SCOTCHBG"    /*+ File signature; first character must not be a digit or a blank +*/
+#define GRAPHBINMAGICSIZ            8             /*+ Size of signature, without trailing '\0'                        +*/
+#define GRAPHBINVERSION             1             /*+ Version of binary format                                        +*/
+#define GRAPHBINENDIAN              0x01020304    /*+ Value to check endianness                                       +*/
+#define GRAPHBINALIGN               64            /*+ Alignment of arrays in file, with respect to header start       +*/
+
+#define GRAPHBINHASVELO             0x0001        /*+ Vertex load array present  +*/
+#define GRAPHBINHASVLBL             0x0002        /*+ Vertex label array present +*/
+#define GRAPHBINHASEDLO             0x0004        /*+ Edge load array present    +*/
+#define GRAPHBINHASMASK             0x0007        /*+ All valid property flags   +*/
+
+#define GRAPHBINALIGNOFF(o)         (((o) + (GRAPHBINALIGN - 1)) & ~((off_t) (GRAPHBINALIGN - 1)))
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The binary graph file header. The fixed-size
+    fields come first, so that the integer size
+    can be checked before reading the rest.     +*/
+
+typedef struct GraphBinHead_ {
+  char                      magitab[GRAPHBINMAGICSIZ]; /*+ File signature          +*/
+  int                       versval;              /*+ Format version                 +*/
+  int                       numbsiz;              /*+ Size of Gnum, in bytes         +*/
+  int                       endival;              /*+ Endianness check value         +*/
+  int                       propval;              /*+ Property flags                 +*/
+  Gnum                      baseval;              /*+ Base value of stored arrays    +*/
+  Gnum                      vertnbr;              /*+ Number of vertices             +*/
+  Gnum                      edgenbr;              /*+ Number of arcs                 +*/
+  Gnum                      velosum;              /*+ Sum of vertex loads            +*/
+  Gnum                      edlosum;              /*+ Sum of edge loads              +*/
+  Gnum                      degrmax;              /*+ Maximum degree                 +*/
+} GraphBinHead;
+
+/*+ The offsets of the arrays in the file, with
+    respect to the start of the header. Vertex
+    and edge arrays are grouped in two areas,
+    each of which can be mapped at once.     +*/
+
+typedef struct GraphBinOffs_ {
+  off_t                     vertoff;              /*+ Offset of vertex array (vertnbr + 1) +*/
+  off_t                     velooff;              /*+ Offset of vertex load array          +*/
+  off_t                     vlbloff;              /*+ Offset of vertex label array         +*/
+  off_t                     vertend;              /*+ End of vertex area                   +*/
+  off_t                     edgeoff;              /*+ Offset of edge array                 +*/
+  off_t                     edlooff;              /*+ Offset of edge load array            +*/
+  off_t                     edgeend;              /*+ End of edge area                     +*/
+} GraphBinOffs;
+
+/*
+**  The function prototypes.
+*/
+
+int                         graphBinHeadLoad    (GraphBinHead * const, FILE * const);
+void                        graphBinOffs        (const GraphBinHead * const, GraphBinOffs * const);
+int                         graphBinRead        (FILE * const, off_t * const, const off_t, void * const, const size_t);
@@ -49,7 +49,7 @@
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -91,7 +91,7 @@ const char * const          dataptr)              /* No use           */
   int                           o;
 
   if (filesrcptr != NULL) {
-    if (graphLoad (grafptr, filesrcptr, -1, 0) != 0)
+    if (graphLoad (grafptr, filesrcptr, -1, 0, NULL) != 0)
       return (1);
   }
 
@@ -204,6 +204,8 @@ const char * const          dataptr)              /* No use           */
 
 /* This routine saves the source process graph
 ** in the Scotch source and geometry formats.
+** If the auxiliary data string starts with
+** 'b', the graph is saved in binary form.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -215,14 +217,16 @@ const Graph * restrict const  grafptr,            /* Graph to save    */
 const Geom * restrict const   geomptr,            /* Geometry to save */
 FILE * const                  filesrcptr,         /* Topological data */
 FILE * const                  filegeoptr,         /* No use           */
-const char * const            dataptr)            /* No use           */
+const char * const            dataptr)            /* "b" for binary   */
 {
   Gnum              vertnum;
   int               dimnnbr;
   int               o;
 
   if (filesrcptr != NULL) {
-    if (graphSave (grafptr, filesrcptr) != 0)     /* Save graph structural data */
+    if (((dataptr != NULL) && (dataptr[0] == 'b')) /* Save graph structural data */
+        ? (graphSaveBin (grafptr, filesrcptr) != 0)
+        : (graphSave    (grafptr, filesrcptr) != 0))
       return (1);
   }
 
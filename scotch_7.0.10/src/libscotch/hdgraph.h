@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 19 jun 2021     **/
 /**                                 to   : 07 oct 2021     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 19 jan 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,7 +58,7 @@
 
 /*+ Graph option flags. +*/
 
-#define HDGRAPHFREEVHND             0x0400        /* Free vnhdtab array */
+#define HDGRAPHFREEVHND             (DGRAPHBITSNOTUSED) /* Free vnhdtab array */
 #define HDGRAPHFREEALL              (DGRAPHFREEALL | HDGRAPHFREEVHND)
 
 /*
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 12 sep 2012     **/
 /**                                 to   : 01 may 2019     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 03 jul 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -219,6 +219,8 @@ HdgraphOrderNdGraph * restrict const  fldgrafptr)
     contextThreadLaunch (orggrafptr->contptr, (ThreadFunc) hdgraphOrderNdFold3, (void *) fldthrdtab); /* Only threads 0 and 1 will work */
 
     MPI_Comm_free (&orggrafdat.s.proccomm);
+    if (orggrafdat.s.haloptr != orggrafptr->s.haloptr) /* Free halo exchange plan built on duplicated communicator */
+      dgraphHaloFree (&orggrafdat.s);
 
     o = ((fldthrdtab[0].orggrafptr == NULL) ||    /* See if an error occured */
          (fldthrdtab[1].orggrafptr == NULL));
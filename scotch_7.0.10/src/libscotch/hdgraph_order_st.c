@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**                # Version 5.1  : from : 11 nov 2008     **/
 /**                                 to   : 11 nov 2008     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -173,6 +173,7 @@ DorderCblk * restrict const   cblkptr,            /*+ Current column block    +*
 const Strat * restrict const  straptr)            /*+ Graph ordering strategy +*/
 {
   StratTest           testdat;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
 
   if (grafptr->s.vertglbnbr == 0)                 /* Return immediately if nothing to do */
@@ -213,8 +214,14 @@ const Strat * restrict const  straptr)            /*+ Graph ordering strategy +*
 #else /* SCOTCH_DEBUG_HDGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
-      return (((HdgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, cblkptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "hdgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertglbnbr, grafptr->s.edgeglbnbr, -1.0, -1.0);
+      o = ((HdgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, cblkptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, -1.0, -1.0, o);
+      return (o);
 #ifdef SCOTCH_DEBUG_HDGRAPH2
     default :
       errorPrint ("hdgraphOrderSt: invalid parameter");
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2012,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2012,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -50,7 +50,7 @@
 /**                # Version 6.0  : from : 17 oct 2012     **/
 /**                                 to   : 05 apr 2018     **/
 /**                # Version 7.0  : from : 19 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -267,6 +267,7 @@ OrderCblk * restrict const      cblkptr,          /*+ Current column block
 const Strat * restrict const    straptr)          /*+ Graph ordering strategy    +*/
 {
   StratTest           testdat;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
 
   if (grafptr->vnohnbr == 0)                      /* Return immediately if nothing to do */
@@ -307,8 +308,14 @@ const Strat * restrict const    straptr)          /*+ Graph ordering strategy
 #else /* SCOTCH_DEBUG_HGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_HGRAPH2 */
-      return (((HgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "hgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->vnohnbr, grafptr->enohnbr, -1.0, -1.0);
+      o = ((HgraphOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, -1.0, -1.0, o);
+      return (o);
 #ifdef SCOTCH_DEBUG_HGRAPH2
     default :
       errorPrint ("hgraphOrderSt: invalid parameter");
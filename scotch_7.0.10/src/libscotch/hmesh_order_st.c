@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 4.0  : from : 28 sep 2002     **/
 /**                                 to   : 05 jan 2005     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -247,6 +247,7 @@ OrderCblk * restrict const      cblkptr,          /*+ Current column block
 const Strat * restrict const    straptr)          /*+ Mesh ordering strategy      +*/
 {
   StratTest           testdat;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
 
   if (meshptr->vnohnbr == 0)                      /* Return immediately if nothing to do */
@@ -287,8 +288,14 @@ const Strat * restrict const    straptr)          /*+ Mesh ordering strategy
 #else /* SCOTCH_DEBUG_HMESH2 */
     default :
 #endif /* SCOTCH_DEBUG_HMESH2 */
-      return (((HmeshOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (meshptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (meshptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (meshptr->contptr, &markdat, "hmesh", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          meshptr->vnohnbr, meshptr->enohnbr, -1.0, -1.0);
+      o = ((HmeshOrderFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (meshptr, ordeptr, ordenum, cblkptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (meshptr->contptr))
+        contextStatEnd (meshptr->contptr, &markdat, -1.0, -1.0, o);
+      return (o);
 #ifdef SCOTCH_DEBUG_HMESH2
     default :
       errorPrint ("hmeshOrderSt: invalid parameter");
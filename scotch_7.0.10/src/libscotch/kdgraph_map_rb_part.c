@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 03 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -326,6 +326,8 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
     contextThreadLaunch (actgrafptr->contptr, (ThreadFunc) kdgraphMapRbPartFold3, (void *) fldthrdtab); /* Only threads 0 and 1 will work */
 
     MPI_Comm_free (&orggrafdat.proccomm);
+    if (orggrafdat.haloptr != actgrafptr->s.haloptr) /* Free halo exchange plan built on duplicated communicator */
+      dgraphHaloFree (&orggrafdat);
 
     o = ((fldthrdtab[0].orggrafptr == NULL) ||    /* See if an error occured */
          (fldthrdtab[1].orggrafptr == NULL));
@@ -1,4 +1,4 @@
-/* Copyright 2008-2011,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008-2011,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -43,7 +43,7 @@
 /**   DATES      : # Version 5.1  : from : 16 jun 2008     **/
 /**                                 to   : 14 apr 2011     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -127,6 +127,7 @@ Kdmapping * restrict const    mappptr,            /*+ Dynamic mapping  +*/
 const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
 {
   StratTest           testdat;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
 
 #ifdef SCOTCH_DEBUG_KDGRAPH2
@@ -183,8 +184,14 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
 #else  /* SCOTCH_DEBUG_KDGRAPH1 */
     default :
 #endif /* SCOTCH_DEBUG_KDGRAPH1 */
-      return (((KdgraphMapFunc) straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr)
-              (grafptr, mappptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "kdgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertglbnbr, grafptr->s.edgeglbnbr, -1.0, -1.0);
+      o = ((KdgraphMapFunc) straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr)
+          (grafptr, mappptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, -1.0, -1.0, o);
+      return (o);
 #ifdef SCOTCH_DEBUG_KDGRAPH1
     default :
       errorPrint ("kdgraphMapSt: invalid parameter (2)");
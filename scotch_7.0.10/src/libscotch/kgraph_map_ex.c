@@ -1,4 +1,4 @@
-/* Copyright 2011,2013,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2011,2013,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 27 may 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 11 jul 2021     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -193,7 +193,7 @@ const KgraphMapExParam * const  paraptr)          /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
   if (velotax != NULL)                            /* If vertices are weighted, sort them in ascending order */
-    intSort2asc1 (sorttab, sortnbr);
+    intRsort2asc1 (sorttab, sortnbr, grafptr->contptr);
 
   for (sortnum = sortnbr - 1; sortnum >= 0; sortnum --) { /* For all sorted vertex indices, by descending weights */
     Gnum                  vertnum;
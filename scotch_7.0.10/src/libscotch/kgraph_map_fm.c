@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2014,2016,2018,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -52,12 +52,14 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_KGRAPH_MAP_FM
 #define SCOTCH_TABLE_GAIN
 
 #include "module.h"
 #include "common.h"
 #include "gain.h"
 #include "fibo.h"
+#include "gain_bckt.h"
 #include "graph.h"
 #include "arch.h"
 #include "mapping.h"
@@ -83,7 +85,7 @@
 
 static
 KgraphMapFmEdge *
-kgraphMapFmTablGet (
+kgraphMapFmTablGetGain (
 KgraphMapFmTabl * restrict const    tablptr,      /*+ Gain table                       +*/
 KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array +*/
 const Gnum * restrict const         comploaddlt,  /*+ Current imbalance array          +*/
@@ -98,15 +100,15 @@ Gnum * restrict                     flagval)
   const GainEntr * restrict       tablbest;
   Gnum                            deltbest;
 
-  gaintab  = *tablptr;
+  gaintab  = tablptr->tabldat;
   tablbest = gaintab->tend;                       /* Assume no candidate vertex found yet */
   gainbest = GAINMAX;
   edxxbest = NULL;
   deltbest = GNUMMAX;
 
   for (edxxptr = (KgraphMapFmEdge *) gainTablFrst (gaintab); /* Select candidate edges */
-       (edxxptr != NULL) && (edxxptr->gainlink.tabl < tablbest);
-       edxxptr = (KgraphMapFmEdge *) gainTablNext (gaintab, &edxxptr->gainlink)) {
+       (edxxptr != NULL) && (edxxptr->gainlink.tabldat.tabl < tablbest);
+       edxxptr = (KgraphMapFmEdge *) gainTablNext (gaintab, &edxxptr->gainlink.tabldat)) {
     Gnum                                vexxidx;
     Gnum                                veloval;
     Anum                                domnnumold;
@@ -120,7 +122,7 @@ Gnum * restrict                     flagval)
     veloval = vexxtab[vexxidx].veloval;
 #ifdef SCOTCH_DEBUG_KGRAPH2
     if (vexxtab[vexxidx].lockptr != NULL) {       /* If vertex is locked */
-      errorPrint ("kgraphMapFmTablGet: internal error (1)");
+      errorPrint ("kgraphMapFmTablGetGain: internal error (1)");
       return     (NULL);
     }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
@@ -132,8 +134,8 @@ Gnum * restrict                     flagval)
         ((deltvalnew > comploadmax[domnnumnew]) && (deltvalnew >= abs (comploaddlt[domnnumnew])))) {
       if (edxxptr->cmigmask == ~0) {
         edxxptr->cmigmask = 0;
-        kgraphMapFmTablDel (&gaintab, edxxptr);
-        kgraphMapFmTablAdd (&gaintab, edxxptr);
+        kgraphMapFmGainDel (gaintab, edxxptr);
+        kgraphMapFmGainAdd (gaintab, edxxptr);
       }
       continue;
     }
@@ -144,7 +146,7 @@ Gnum * restrict                     flagval)
     if ((commgain < gainbest) ||                  /* And if it gives better gain */
         ((commgain == gainbest) &&                /* Or if it gives better load  */
          (deltnew < deltbest))) {
-      tablbest = edxxptr->gainlink.tabl;          /* Select it */
+      tablbest = edxxptr->gainlink.tabldat.tabl;  /* Select it */
       gainbest = commgain;
       edxxbest = edxxptr;
       deltbest = deltnew;
@@ -192,7 +194,7 @@ const FiboNode * const      data1ptr)
 
 static
 KgraphMapFmEdge *
-kgraphMapFmTablGet (
+kgraphMapFmTablGetGain (
 KgraphMapFmTabl * restrict const    tablptr,      /*+ Gain table                       +*/
 KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array +*/
 const Gnum * restrict const         comploaddlt,  /*+ Current imbalance array          +*/
@@ -208,7 +210,7 @@ Gnum * restrict                     flagval)
   edxxptr = NULL;
   remoptr = NULL;
 
-  while ((linkptr = fiboHeapMin (tablptr)) != NULL) { /* Select candidate vertices */
+  while ((linkptr = fiboHeapMin (&tablptr->tabldat)) != NULL) { /* Select candidate vertices */
     Gnum                      vexxidx;
     Gnum                      veloval;
     Anum                      domnnumold;
@@ -221,12 +223,12 @@ Gnum * restrict                     flagval)
     veloval = vexxtab[vexxidx].veloval;
 #ifdef SCOTCH_DEBUG_KGRAPH2
     if (vexxtab[vexxidx].lockptr != NULL) {       /* If vertex is locked */
-      errorPrint ("kgraphMapFmTablGet: internal error (2)");
+      errorPrint ("kgraphMapFmTablGetGain: internal error (2)");
       return     (NULL);
     }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-    fiboHeapDel (tablptr, linkptr);               /* Remove vertex link from table         */
+    fiboHeapDel (&tablptr->tabldat, linkptr);     /* Remove vertex link from table         */
     linkptr->linkdat.prevptr = remoptr;           /* Node has been removed but is not kept */
     remoptr = linkptr;                            /* It will be chained back afterwards    */
 
@@ -246,8 +248,8 @@ Gnum * restrict                     flagval)
     else {
       if (edxxptr->cmigmask == ~0) {
         edxxptr->cmigmask = 0;
-        kgraphMapFmTablDel (&gaintab, edxxptr);
-        kgraphMapFmTablAdd (&gaintab, edxxptr);
+        kgraphMapFmGainDel (tablptr->tabldat, edxxptr);
+        kgraphMapFmGainAdd (tablptr->tabldat, edxxptr);
       }
     }
   }
@@ -257,7 +259,7 @@ Gnum * restrict                     flagval)
 
     tempptr = remoptr;                            /* Get pointer to node */
     remoptr = remoptr->linkdat.prevptr;           /* Find next node      */
-    fiboHeapAdd (tablptr, tempptr);               /* Re-link node        */
+    fiboHeapAdd (&tablptr->tabldat, tempptr);     /* Re-link node        */
   }
 
   if (linkptr == NULL)
@@ -269,6 +271,105 @@ Gnum * restrict                     flagval)
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+/* This routine returns the vertex of best gain
+** whose swap will keep the balance correct,
+** when gains are kept in a bucket array. Since
+** large gains may share the same bucket, the
+** whole bucket holding the best vertex is
+** scanned. Among vertices of same gain, the one
+** which yields the best balance is preferred.
+** It returns:
+** - !NULL  : pointer to the vertex.
+** - NULL   : if no more vertices available.
+*/
+
+static
+KgraphMapFmEdge *
+kgraphMapFmTablGetBckt (
+KgraphMapFmTabl * restrict const    tablptr,      /*+ Gain table                       +*/
+KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array +*/
+const Gnum * restrict const         comploaddlt,  /*+ Current imbalance array          +*/
+const Gnum * restrict const         comploadmax,  /*+ Maximum imbalance array          +*/
+Gnum * restrict                     comploaddiff,
+Gnum * restrict                     flagval)
+{
+  GainBckt *                      bcktptr;
+  KgraphMapFmEdge *               edxxtab;
+  KgraphMapFmEdge *               edxxbest;
+  Gnum                            gainbest;
+  INT                             bcktbest;       /* Key of bucket holding best edge */
+  Gnum                            deltbest;
+  INT                             edxxnum;
+  INT                             edxxnxt;
+
+  bcktptr  = &tablptr->bcktdat;
+  edxxtab  = (KgraphMapFmEdge *) bcktptr->elemtab;
+  bcktbest = GAINMAX;                             /* Assume no candidate vertex found yet */
+  gainbest = GAINMAX;
+  edxxbest = NULL;
+  deltbest = GNUMMAX;
+
+  for (edxxnum = gainBcktFrst (bcktptr);          /* Select candidate edges */
+       (edxxnum != GAINBCKTNONE) && (edxxtab[edxxnum].gainlink.bcktdat.keyval <= bcktbest);
+       edxxnum = edxxnxt) {
+    KgraphMapFmEdge *                   edxxptr;
+    Gnum                                vexxidx;
+    Gnum                                veloval;
+    Anum                                domnnumold;
+    Anum                                domnnumnew;
+    Gnum                                deltvalold;
+    Gnum                                deltvalnew;
+    Gnum                                deltnew;
+    Gnum                                commgain;
+
+    edxxptr = &edxxtab[edxxnum];
+    edxxnxt = gainBcktNext (bcktptr, edxxnum);    /* Get next edge before current one may be re-linked */
+    vexxidx = edxxptr->vexxidx;
+    veloval = vexxtab[vexxidx].veloval;
+#ifdef SCOTCH_DEBUG_KGRAPH2
+    if (vexxtab[vexxidx].lockptr != NULL) {       /* If vertex is locked */
+      errorPrint ("kgraphMapFmTablGetBckt: internal error");
+      return     (NULL);
+    }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+    domnnumold = vexxtab[vexxidx].domnnum;
+    domnnumnew = edxxptr->domnnum;
+    deltvalold = abs (comploaddlt[domnnumold] - veloval);
+    deltvalnew = abs (comploaddlt[domnnumnew] + veloval);
+    if (((deltvalold > comploadmax[domnnumold]) && (deltvalold >= abs (comploaddlt[domnnumold]))) || /* If vertex does not enforce or improve balance, skip it */
+        ((deltvalnew > comploadmax[domnnumnew]) && (deltvalnew >= abs (comploaddlt[domnnumnew])))) {
+      if (edxxptr->cmigmask == ~0) {
+        edxxptr->cmigmask = 0;
+        kgraphMapFmBcktDel (tablptr, edxxptr);
+        kgraphMapFmBcktAdd (tablptr, edxxptr);
+      }
+      continue;
+    }
+
+    deltnew = deltvalold - abs (comploaddlt[domnnumold]) + /* Compute difference in imbalance load sum */
+              deltvalnew - abs (comploaddlt[domnnumnew]);
+    commgain = edxxptr->commgain + edxxptr->cmiggain;
+    if ((commgain < gainbest) ||                  /* And if it gives better gain */
+        ((commgain == gainbest) &&                /* Or if it gives better load  */
+         (deltnew < deltbest))) {
+      bcktbest = edxxptr->gainlink.bcktdat.keyval; /* Select it */
+      gainbest = commgain;
+      edxxbest = edxxptr;
+      deltbest = deltnew;
+      if ((abs (comploaddlt[domnnumold]) > comploadmax[domnnumold]) ||
+          (abs (comploaddlt[domnnumnew]) > comploadmax[domnnumnew]))
+        *flagval = 1;
+      else
+        *flagval = 0;
+    }
+  }
+
+  if (edxxbest != NULL)
+    *comploaddiff += deltbest;
+
+  return (edxxbest);
+}
+
 /* This routine checks the consistency of
 ** the hash structures.
 ** It returns:
@@ -533,6 +634,7 @@ KgraphMapFmTabl * restrict const    tablptr)
 
     edxxtab = *edxxtabptr = edxxtmp;            /* Point to new array location */
 
+    kgraphMapFmTablBase (tablptr, edxxtab);     /* Set new edge array             */
     kgraphMapFmTablFree (tablptr);              /* Free all edges in gain structure */
 
     for (edxxidx = 0; edxxidx < edxxnbr; edxxidx ++) {
@@ -546,6 +648,53 @@ KgraphMapFmTabl * restrict const    tablptr)
   return (0);
 }
 
+/* This routine computes the communication
+** gains of moving a vertex to each of the
+** neighbor domains of its list of extended
+** edges, the distances of which to the vertex
+** domain must have been set. It is shared
+** by the sequential and threaded variants.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapFmPartGain (
+const Kgraph * restrict const       grafptr,
+KgraphMapFmEdge * restrict const    edxxtab,
+const Gnum                          edxxfrst,     /*+ Index of first extended edge of vertex         +*/
+const Gnum                          edlosum,      /*+ Load of edges to vertex domain                 +*/
+const Gnum                          commload)     /*+ Communication load of vertex, times crloval    +*/
+{
+  Gnum                          edxxidx;
+
+  const Arch * restrict const     archptr = grafptr->m.archptr;
+  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+
+  for (edxxidx = edxxfrst; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
+    Gnum                domncur;
+    Gnum                edxxtmp;
+    Gnum                commgain;
+
+    domncur = edxxtab[edxxidx].domnnum;
+
+    commgain = 0;
+    for (edxxtmp = edxxfrst; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
+      Anum                domnend;
+
+      if (edxxtmp == edxxidx)
+        continue;
+
+      domnend = edxxtab[edxxtmp].domnnum;
+      commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
+                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
+    }
+    commgain += edlosum * edxxtab[edxxidx].distval;
+    edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
+  }
+}
+
 static
 int
 kgraphMapFmPartAdd2 (
@@ -735,27 +884,7 @@ KgraphMapFmTabl * restrict const            tablptr)
   vexxtab[vexxidx].edlosum = edlosum;
   vexxtab[vexxidx].edgenbr = edgenbr;
 
-  for (edxxidx = vexxtab[vexxidx].edxxidx; edxxidx != -1; edxxidx = edxxtab[edxxidx].edxxidx) {
-    Gnum                domncur;
-    Gnum                edxxtmp;
-    Gnum                commgain;
-
-    domncur = edxxtab[edxxidx].domnnum;
-
-    commgain = 0;
-    for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
-      Anum                domnend;
-
-      if (edxxtmp == edxxidx)
-        continue;
-
-      domnend = edxxtab[edxxtmp].domnnum;
-      commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
-                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
-    }
-    commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
-    edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
-  }
+  kgraphMapFmPartGain (grafptr, edxxtab, vexxtab[vexxidx].edxxidx, edlosum, commload);
 
   vexxtab[vexxidx].cmigload = 0;
   if (vexxtab[vexxidx].domoptr != NULL) {
@@ -937,6 +1066,374 @@ KgraphMapFmVertex ** const        lockptr)        /*+ Pointer to locked list
 /*                           */
 /*****************************/
 
+/******************************/
+/*                            */
+/* The threaded loop routine. */
+/*                            */
+/******************************/
+
+/* This routine performs the threaded variant
+** of the k-way refinement. Vertices are split
+** across threads according to their index.
+** At each pass, every thread proposes, for
+** each of its vertices whose neighborhood
+** changed, the best move with respect to its
+** own copy of the domain load imbalances.
+** A proposed move is kept only if no neighbor
+** of the vertex proposed a better move, so
+** that the gains of all kept moves are exact.
+** Then, as long as the combination of the
+** moves of all threads makes the balance
+** of some domains worse beyond the allowed
+** bound, all the moves from and to these
+** domains are rolled back. The remaining
+** moves are committed as a batch.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+kgraphMapFmLoop (
+ThreadDescriptor * restrict const descptr,
+KgraphMapFmData * restrict const  loopptr)
+{
+  KgraphMapFmThread * restrict  thrdptr;
+  Gnum * restrict               compdlttab;       /* Thread-local variation of domain imbalances */
+  KgraphMapFmEdge * restrict    edxxlcltab;       /* Extended edges of current vertex            */
+  Gnum * restrict               domnidxtab;       /* Index of extended edge of each domain       */
+  Gnum * restrict               listtab;          /* Local move list                             */
+  Gnum                          listnbr;
+  Gnum                          listnum;
+  Gnum                          movenbr;
+  Gnum                          vertbas;          /* Range of vertices to process                */
+  Gnum                          vertnnd;
+  Gnum                          vertnum;
+  Anum                          domnbas;          /* Range of domains to reduce                  */
+  Anum                          domnnnd;
+  Anum                          domnnum;
+  INT                           passnbr;
+  int                           thrdtmp;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  const Kgraph * restrict const       grafptr = loopptr->grafptr;
+  const Gnum                          baseval = grafptr->s.baseval;
+  const Gnum * restrict const         verttax = grafptr->s.verttax;
+  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Arch * restrict const         archptr = grafptr->m.archptr;
+  const ArchDom * restrict const      domntab = grafptr->m.domntab;
+  const Anum                          domnnbr = grafptr->m.domnnbr;
+  Anum * restrict const               parttax = grafptr->m.parttax;
+  const Anum * restrict const         pfixtax = grafptr->pfixtax;
+  const Gnum * restrict const         comploadmax = loopptr->comploadmax;
+  Gnum * restrict const               comploaddlt = loopptr->comploaddlt;
+  Anum * restrict const               movetax = loopptr->movetax;
+  Gnum * restrict const               gaintax = loopptr->gaintax;
+  byte * restrict const               flagtax = loopptr->flagtax;
+  byte * restrict const               rolltab = loopptr->rolltab;
+  KgraphMapFmThread * restrict const  thrdtab = loopptr->thrdtab;
+
+  vertbas = baseval + DATASCAN (loopptr->vertnnd - baseval, thrdnbr, thrdnum);
+  vertnnd = baseval + DATASCAN (loopptr->vertnnd - baseval, thrdnbr, thrdnum + 1);
+  domnbas = DATASCAN (domnnbr, thrdnbr, thrdnum);
+  domnnnd = DATASCAN (domnnbr, thrdnbr, thrdnum + 1);
+
+  thrdptr    = &thrdtab[thrdnum];
+  compdlttab = thrdptr->compdlttab;
+  edxxlcltab = thrdptr->edxxtab;
+  domnidxtab = thrdptr->domnidxtab;
+  listtab    = loopptr->listtax + vertbas;        /* Local move list is held in local vertex range */
+
+  for (passnbr = loopptr->passnbr; passnbr != 0; passnbr --) { /* TRICK: negative values mean infinite */
+    memSet (compdlttab, 0, domnnbr * sizeof (Gnum));
+
+    for (vertnum = vertbas, listnbr = 0; vertnum < vertnnd; vertnum ++) { /* Propose moves for local vertices */
+      Gnum                edgenum;
+      Gnum                edlosum;                /* Sum of edge loads linking to origin domain        */
+      Gnum                commload;               /* Communication load of vertex in its origin domain */
+      Gnum                veloval;
+      Gnum                gainbst;
+      Gnum                deltbst;
+      Gnum                dltaorg;                /* Local imbalance of origin domain                  */
+      Gnum                edxxfrst;
+      Gnum                edxxnbr;
+      Gnum                edxxidx;
+      Anum                domnorg;
+      Anum                domnbst;
+
+      if (flagtax[vertnum] == 0)                  /* If vertex neighborhood did not change */
+        continue;
+      flagtax[vertnum] = 0;
+
+      if ((pfixtax != NULL) && (pfixtax[vertnum] != -1)) /* Fixed vertices never move */
+        continue;
+
+      domnorg  = parttax[vertnum];
+      edlosum  = 0;
+      commload = 0;
+      edxxfrst = -1;
+      edxxnbr  = 0;
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) { /* Accumulate loads of edges to neighbor domains */
+        Gnum                edloval;
+        Anum                domnend;
+
+        domnend = parttax[edgetax[edgenum]];
+        edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
+        if (domnend == domnorg) {
+          edlosum += edloval;
+          continue;
+        }
+
+        edxxidx = domnidxtab[domnend];
+        if (edxxidx == -1) {                      /* If neighbor domain not yet recorded, create its extended edge */
+          edxxidx = edxxnbr ++;
+          domnidxtab[domnend] = edxxidx;
+          edxxlcltab[edxxidx].domnnum = domnend;
+          edxxlcltab[edxxidx].distval = archDomDist (archptr, &domntab[domnorg], &domntab[domnend]);
+          edxxlcltab[edxxidx].edlosum = 0;
+          edxxlcltab[edxxidx].edxxidx = edxxfrst;
+          edxxfrst = edxxidx;
+        }
+        edxxlcltab[edxxidx].edlosum += edloval;
+        commload += edloval * edxxlcltab[edxxidx].distval;
+      }
+      if (edxxnbr == 0)                           /* If vertex not in frontier */
+        continue;
+      for (edxxidx = 0; edxxidx < edxxnbr; edxxidx ++) /* Reset domain index array for next vertex */
+        domnidxtab[edxxlcltab[edxxidx].domnnum] = -1;
+
+      kgraphMapFmPartGain (grafptr, edxxlcltab, edxxfrst, edlosum, commload * grafptr->r.crloval);
+
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      dltaorg = comploaddlt[domnorg] + compdlttab[domnorg];
+      domnbst = -1;
+      gainbst = GNUMMAX;
+      deltbst = GNUMMAX;
+      for (edxxidx = 0; edxxidx < edxxnbr; edxxidx ++) { /* For all candidate destination domains */
+        Gnum                dltaend;
+        Gnum                deltorg;
+        Gnum                deltend;
+        Gnum                deltnew;
+        Gnum                commgain;
+        Anum                domnend;
+
+        domnend = edxxlcltab[edxxidx].domnnum;
+        dltaend = comploaddlt[domnend] + compdlttab[domnend];
+        deltorg = abs (dltaorg - veloval);
+        deltend = abs (dltaend + veloval);
+        if (((deltorg > comploadmax[domnorg]) && (deltorg >= abs (dltaorg))) || /* If move does not enforce or improve balance, skip it */
+            ((deltend > comploadmax[domnend]) && (deltend >= abs (dltaend))))
+          continue;
+        deltnew = deltorg - abs (dltaorg) + deltend - abs (dltaend); /* Compute difference in imbalance load sum */
+
+        commgain = edxxlcltab[edxxidx].commgain;
+        if ((commgain < gainbst) ||               /* Keep move of best gain, then of best balance */
+            ((commgain == gainbst) && (deltnew < deltbst))) {
+          domnbst = domnend;
+          gainbst = commgain;
+          deltbst = deltnew;
+        }
+      }
+      if ((domnbst == -1) ||                      /* If no useful move: gain must be negative, or balance of overloaded domain improved */
+          ((gainbst >= 0) && ((deltbst >= 0) || (abs (dltaorg) <= comploadmax[domnorg]))))
+        continue;
+
+      movetax[vertnum]   = domnbst;               /* Propose move */
+      gaintax[vertnum]   = gainbst;
+      listtab[listnbr ++] = vertnum;
+      compdlttab[domnorg] -= veloval;             /* Account for move in local imbalances */
+      compdlttab[domnbst] += veloval;
+    }
+
+    threadBarrier (descptr);                      /* Wait until all moves are proposed */
+
+    memSet (compdlttab, 0, domnnbr * sizeof (Gnum));
+    for (listnum = movenbr = 0; listnum < listnbr; listnum ++) { /* Keep only moves for which no neighbor proposed a better move */
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                gainval;
+      Gnum                veloval;
+
+      vertnum = listtab[listnum];
+      gainval = gaintax[vertnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if ((movetax[vertend] != -1) &&           /* If neighbor move has priority */
+            ((gaintax[vertend] < gainval) || ((gaintax[vertend] == gainval) && (vertend < vertnum))))
+          break;
+      }
+      if (edgenum < edgennd)                      /* If move rejected, leave it past end of kept moves */
+        continue;
+
+      listtab[listnum]   = listtab[movenbr];      /* Swap kept move with first rejected one */
+      listtab[movenbr ++] = vertnum;
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      compdlttab[parttax[vertnum]] -= veloval;
+      compdlttab[movetax[vertnum]] += veloval;
+    }
+
+    threadBarrier (descptr);                      /* Wait until all proposals are read */
+
+    for (listnum = movenbr; listnum < listnbr; listnum ++) /* Withdraw rejected moves */
+      movetax[listtab[listnum]] = -1;
+    listnbr = movenbr;
+
+    while (1) {                                   /* Roll back moves of domains whose balance got worse */
+      int                 rollval;
+
+      for (domnnum = domnbas, rollval = 0; domnnum < domnnnd; domnnum ++) {
+        Gnum                dltaval;
+
+        for (thrdtmp = 0, dltaval = comploaddlt[domnnum]; thrdtmp < thrdnbr; thrdtmp ++)
+          dltaval += thrdtab[thrdtmp].compdlttab[domnnum];
+        if ((dltaval != comploaddlt[domnnum]) &&  /* If moves make domain out of bounds without improving it */
+            (abs (dltaval) > comploadmax[domnnum]) && (abs (dltaval) >= abs (comploaddlt[domnnum]))) {
+          rolltab[domnnum] = 1;
+          rollval = 1;
+        }
+      }
+      thrdptr->rollval = rollval;
+
+      threadBarrier (descptr);                    /* Wait until all domains are checked */
+
+      for (thrdtmp = 0, rollval = 0; thrdtmp < thrdnbr; thrdtmp ++)
+        rollval |= thrdtab[thrdtmp].rollval;
+      if (rollval == 0)                           /* All threads take the same decision */
+        break;
+
+      for (listnum = 0; listnum < listnbr; ) {
+        Gnum                veloval;
+
+        vertnum = listtab[listnum];
+        if ((rolltab[parttax[vertnum]] == 0) && (rolltab[movetax[vertnum]] == 0)) {
+          listnum ++;
+          continue;
+        }
+
+        veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+        compdlttab[parttax[vertnum]] += veloval;  /* Cancel move */
+        compdlttab[movetax[vertnum]] -= veloval;
+        movetax[vertnum] = -1;
+        listtab[listnum] = listtab[-- listnbr];
+      }
+
+      threadBarrier (descptr);                    /* Wait until all moves are cancelled */
+    }
+
+    for (listnum = 0; listnum < listnbr; listnum ++) { /* Commit remaining moves */
+      Gnum                edgenum;
+
+      vertnum = listtab[listnum];
+      parttax[vertnum] = movetax[vertnum];
+      movetax[vertnum] = -1;
+      flagtax[vertnum] = 1;                       /* Vertex and its neighbors will be considered again */
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++)
+        flagtax[edgetax[edgenum]] = 1;
+    }
+    for (domnnum = domnbas; domnnum < domnnnd; domnnum ++) { /* Update imbalances of local domain range */
+      for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++)
+        comploaddlt[domnnum] += thrdtab[thrdtmp].compdlttab[domnnum];
+      rolltab[domnnum] = 0;
+    }
+    thrdptr->listnbr = listnbr;
+
+    threadBarrier (descptr);                      /* Wait until all moves are committed */
+
+    for (thrdtmp = 0, movenbr = 0; thrdtmp < thrdnbr; thrdtmp ++)
+      movenbr += thrdtab[thrdtmp].listnbr;
+    if (movenbr == 0)                             /* If no move could be done, stop */
+      break;
+  }
+}
+
+/* This routine performs the threaded
+** variant of the k-way refinement.
+** It returns:
+** - 0 : if k-partition could be computed.
+** - 1 : on error.
+*/
+
+static
+int
+kgraphMapFmThrd (
+Kgraph * restrict const           grafptr,        /*+ Active graph            +*/
+const KgraphMapFmParam * const    paraptr,        /*+ Method parameters       +*/
+const Gnum * const                comploadmax,    /*+ Maximum imbalance array +*/
+Gnum * const                      comploaddlt)    /*+ Current imbalance array +*/
+{
+  KgraphMapFmData     loopdat;
+  Gnum *              compdlttab;
+  KgraphMapFmEdge *   edxxtab;
+  Gnum *              domnidxtab;
+  Gnum                fronnum;
+  int                 thrdnbr;
+  int                 thrdnum;
+
+  const Gnum                baseval = grafptr->s.baseval;
+  const Gnum                vertnbr = grafptr->s.vertnbr;
+  const Gnum                degrmax = grafptr->s.degrmax;
+  const Anum                domnnbr = grafptr->m.domnnbr;
+
+  thrdnbr = contextThreadNbr (grafptr->contptr);
+  if (memAllocGroup ((void **) (void *)
+                     &loopdat.thrdtab, (size_t) (thrdnbr * sizeof (KgraphMapFmThread)),
+                     &compdlttab,      (size_t) (thrdnbr * domnnbr * sizeof (Gnum)),
+                     &edxxtab,         (size_t) (thrdnbr * degrmax * sizeof (KgraphMapFmEdge)),
+                     &domnidxtab,      (size_t) (thrdnbr * domnnbr * sizeof (Gnum)),
+                     &loopdat.gaintax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &loopdat.listtax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &loopdat.movetax, (size_t) (vertnbr * sizeof (Anum)),
+                     &loopdat.flagtax, (size_t) (vertnbr * sizeof (byte)),
+                     &loopdat.rolltab, (size_t) (domnnbr * sizeof (byte)), NULL) == NULL) {
+    errorPrint ("kgraphMapFmThrd: out of memory");
+    return     (1);
+  }
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+    loopdat.thrdtab[thrdnum].compdlttab = compdlttab + thrdnum * domnnbr;
+    loopdat.thrdtab[thrdnum].edxxtab    = edxxtab    + thrdnum * degrmax;
+    loopdat.thrdtab[thrdnum].domnidxtab = domnidxtab + thrdnum * domnnbr;
+  }
+  loopdat.gaintax -= baseval;
+  loopdat.listtax -= baseval;
+  loopdat.movetax -= baseval;
+  loopdat.flagtax -= baseval;
+
+  memSet (loopdat.movetax + baseval, ~0, vertnbr * sizeof (Anum)); /* No moves proposed yet */
+  memSet (loopdat.flagtax + baseval, 0, vertnbr * sizeof (byte));
+  memSet (loopdat.rolltab, 0, domnnbr * sizeof (byte));
+  memSet (domnidxtab, ~0, thrdnbr * domnnbr * sizeof (Gnum)); /* No domain recorded yet */
+  for (fronnum = 0; fronnum < grafptr->fronnbr; fronnum ++) /* Only frontier vertices are considered at first */
+    loopdat.flagtax[grafptr->frontab[fronnum]] = 1;
+
+  loopdat.grafptr     = grafptr;
+  loopdat.comploadmax = comploadmax;
+  loopdat.comploaddlt = comploaddlt;
+  loopdat.vertnnd     = grafptr->s.vertnnd - (((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) ? domnnbr : 0); /* Anchors never move */
+  loopdat.passnbr     = paraptr->passnbr;
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapFmLoop, (void *) &loopdat);
+
+  memFree (loopdat.thrdtab);                      /* Free group leader */
+
+  kgraphFron (grafptr);
+  kgraphCost (grafptr);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapFmThrd: inconsistent graph data");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
+
 /* This routine performs the k-way partitioning.
 ** It returns:
 ** - 0 : if k-partition could be computed.
@@ -994,8 +1491,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
   const Arch * restrict const     archptr = grafptr->m.archptr;
-  const Gnum                      domnnbr = grafptr->m.domnnbr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
+  Gnum                            domnnbr = grafptr->m.domnnbr; /* Not constant, since fallback mapping may change them */
+  const ArchDom * restrict        domntab = grafptr->m.domntab;
   Anum * restrict const           parttax = grafptr->m.parttax;
   Anum * restrict const           parotax = grafptr->r.m.parttax;
   const Gnum * restrict const     pfixtax = grafptr->pfixtax;
@@ -1038,6 +1535,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
       strat = stratInit (&kgraphmapststratab, "r{sep=h{pass=10}}"); /* Use a standard algorithm */
       kgraphMapSt (grafptr, strat);               /* Perform mapping */
+      domnnbr = grafptr->m.domnnbr;               /* Domain array may have been resized */
+      domntab = grafptr->m.domntab;
 
       if (grafptr->fronnbr == 0) {                /* If new partition has no frontier */
         memFree (comploadmax);
@@ -1058,6 +1557,25 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     }
   }
 
+  if ((paraptr->flagthrd != 0) &&                 /* If threaded variant requested                                  */
+      (parotax == NULL) &&                        /* And if it can be used, since it does not handle repartitioning */
+      (contextThreadNbr (grafptr->contptr) > 1) &&
+      (grafptr->fronnbr >= (KGRAPHMAPFMTHRDFRONMIN * contextThreadNbr (grafptr->contptr)))) {
+    if (kgraphMapFmThrd (grafptr, paraptr, comploadmax, comploaddlt) != 0) { /* Perform bulk of moves in parallel */
+      errorPrint ("kgraphMapFm: cannot perform threaded refinement");
+      memFree    (comploadmax);
+      return     (1);
+    }
+    if (grafptr->fronnbr == 0) {                  /* If no frontier remains, nothing more to do */
+      memFree (comploadmax);
+      return  (0);
+    }
+
+    grafptr->commload *= grafptr->r.crloval;      /* Sequential hill-climbing passes will resume from new mapping */
+    for (domnnum = 0; domnnum < grafptr->m.domnnbr; domnnum ++)
+      comploaddlt[domnnum] = grafptr->comploaddlt[domnnum];
+  }
+
 #ifdef SCOTCH_DEBUG_KGRAPH2                       /* Allocation of extended vertex hash table and extended edge array */
   hashnbr = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
   savesiz = 2 * grafptr->fronnbr + 1;             /* Ensure resizing will be performed, for maximum code coverage     */
@@ -1076,7 +1594,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;
 
-  if (kgraphMapFmTablInit (tablptr) != 0) {
+  if (kgraphMapFmTablInit (tablptr, paraptr->tablval) != 0) {
     errorPrint ("kgraphMapFm: internal error (1)"); /* Unable to do proper initialization */
     kgraphMapFmTablExit (tablptr);
     return (1);
@@ -1092,6 +1610,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   }
   memSet (vexxtab, ~0, hashsiz * sizeof (KgraphMapFmVertex)); /* Set all vertex numbers to ~0 */
   memSet (edxxtab, ~0, edxxsiz * sizeof (KgraphMapFmEdge));   /* Set all edge numbers to ~0   */
+  kgraphMapFmTablBase (tablptr, edxxtab);
 
   hashnbr = grafptr->fronnbr;
   while (hashnbr >= hashmax) {
@@ -1716,6 +2235,16 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   } while ((moveflag != 0) &&                     /* As long as vertices are moved                          */
            (-- passnbr != 0));                    /* And we are allowed to loop (TRICK for negative values) */
 
+  if (kgraphMapFmTablFail (tablptr)) {            /* If bucket array could not be enlarged */
+    errorPrint ("kgraphMapFm: out of memory (8)");
+    memFree (comploadmax);                        /* Free group leader */
+    memFree (vexxtab);
+    memFree (savetab);
+    memFree (edxxtab);
+    kgraphMapFmTablExit (tablptr);
+    return (1);
+  }
+
 #ifdef SCOTCH_DEBUG_KGRAPH3
   if (kgraphMapFmCheck (tablptr, grafptr, vexxtab, edxxtab, hashmsk, commload, chektab) != 0) {
     errorPrint ("kgraphMapFm: internal error (18)");
@@ -1,4 +1,4 @@
-/* Copyright 2004,2010-2012,2016,2018 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2010-2012,2016,2018,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,6 +48,8 @@
 /**                                 to   : 12 oct 2006     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +65,10 @@
 
 #define KGRAPHMAPFMEDXXCOMP         5             /*+ Compact if edxunbr > (edxxnbr / KGRAPHMAPFMEDXXCOMP) */
 
+/*+ Minimum number of frontier vertices per thread for the threaded variant. +*/
+
+#define KGRAPHMAPFMTHRDFRONMIN      256
+
 /*+ Save type identifier +*/
 
 #define KGRAPHMAPPFMSAVEVEXX        0
@@ -75,12 +81,21 @@
 **  The type and structure definitions.
 */
 
+/*+ Gain structure type. +*/
+
+typedef enum KgraphMapFmGain_ {
+  KGRAPHMAPFMGAINTABL,                            /*+ Gain table or heap, depending on compilation flags +*/
+  KGRAPHMAPFMGAINBCKT                             /*+ Bucket array                                        +*/
+} KgraphMapFmGain;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct KgraphMapFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
+  KgraphMapFmGain           tablval;              /*+ Type of gain structure                               +*/
+  int                       flagthrd;             /*+ Flag set if threaded gradient pass can be performed  +*/
 } KgraphMapFmParam;
 
 /*+ The extended edge structure. In fact, this
@@ -92,16 +107,27 @@ typedef struct KgraphMapFmParam_ {
 
 #ifdef SCOTCH_TABLE_GAIN
 
-typedef GainTabl * KgraphMapFmTabl;
-typedef GainLink KgraphMapFmLink;
+typedef GainTabl * KgraphMapFmGainTabl;
+typedef GainLink KgraphMapFmGainLink;
 
 #else /* SCOTCH_TABLE_GAIN */
 
-typedef FiboHeap KgraphMapFmTabl;
-typedef FiboNode KgraphMapFmLink;
+typedef FiboHeap KgraphMapFmGainTabl;
+typedef FiboNode KgraphMapFmGainLink;
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+typedef union KgraphMapFmLink_ {
+  KgraphMapFmGainLink       tabldat;              /*+ Link in gain table or heap +*/
+  GainBcktLink              bcktdat;              /*+ Link in bucket array       +*/
+} KgraphMapFmLink;
+
+typedef struct KgraphMapFmTabl_ {
+  KgraphMapFmGain           typeval;              /*+ Type of gain structure in use +*/
+  KgraphMapFmGainTabl       tabldat;              /*+ Gain table or heap            +*/
+  GainBckt                  bcktdat;              /*+ Bucket array                  +*/
+} KgraphMapFmTabl;
+
 typedef struct KgraphMapFmEdge_ {
   KgraphMapFmLink           gainlink;             /*+ Gain link; TRICK: FIRST                 +*/
   Gnum                      commgain;             /*+ Communication gain                      +*/
@@ -161,10 +187,47 @@ typedef struct KgraphMapFmSave_ {
   } u;
 } KgraphMapFmSave;
 
+/*+ The thread-specific data block of the
+    threaded variant.                       +*/
+
+typedef struct KgraphMapFmThread_ {
+  Gnum *                    compdlttab;           /*+ Thread-local variation of domain load imbalances +*/
+  KgraphMapFmEdge *         edxxtab;              /*+ Extended edges of current vertex                 +*/
+  Gnum *                    domnidxtab;           /*+ Index of extended edge of each domain, or -1     +*/
+  Gnum                      listnbr;              /*+ Number of moves in local move list               +*/
+  int                       rollval;              /*+ Flag set if local domains must be rolled back    +*/
+} KgraphMapFmThread;
+
+/*+ The loop routine parameter structure
+    of the threaded variant. It contains
+    the thread-independent data.          +*/
+
+typedef struct KgraphMapFmData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                                +*/
+  const Gnum *              comploadmax;          /*+ Maximum imbalance array                         +*/
+  Gnum *                    comploaddlt;          /*+ Current imbalance array                         +*/
+  Anum *                    movetax;              /*+ Proposed destination domain of vertices, or -1  +*/
+  Gnum *                    gaintax;              /*+ Communication gain of proposed moves            +*/
+  Gnum *                    listtax;              /*+ Local move lists, in thread vertex ranges       +*/
+  byte *                    flagtax;              /*+ Flag array of vertices to (re)consider          +*/
+  byte *                    rolltab;              /*+ Flag array of domains whose moves are cancelled +*/
+  KgraphMapFmThread *       thrdtab;              /*+ Array of thread-specific data                   +*/
+  Gnum                      vertnnd;              /*+ End of range of movable vertices                +*/
+  INT                       passnbr;              /*+ Number of passes to do (-1 : infinite)          +*/
+} KgraphMapFmData;
+
 /*
 **  The function prototypes.
 */
 
+#ifdef SCOTCH_KGRAPH_MAP_FM
+static KgraphMapFmEdge *    kgraphMapFmTablGetGain (KgraphMapFmTabl * restrict const, KgraphMapFmVertex * restrict const, const Gnum * restrict const, const Gnum * restrict const, Gnum * restrict, Gnum * restrict);
+static KgraphMapFmEdge *    kgraphMapFmTablGetBckt (KgraphMapFmTabl * restrict const, KgraphMapFmVertex * restrict const, const Gnum * restrict const, const Gnum * restrict const, Gnum * restrict, Gnum * restrict);
+static void                 kgraphMapFmPartGain (const Kgraph * restrict const, KgraphMapFmEdge * restrict const, const Gnum, const Gnum, const Gnum);
+static void                 kgraphMapFmLoop     (ThreadDescriptor * restrict const, KgraphMapFmData * restrict const);
+static int                  kgraphMapFmThrd     (Kgraph * restrict const, const KgraphMapFmParam * const, const Gnum * const, Gnum * const);
+#endif /* SCOTCH_KGRAPH_MAP_FM */
+
 int                         kgraphMapFm         (Kgraph * restrict const, const KgraphMapFmParam * const);
 
 /*
@@ -179,26 +242,70 @@ int                         kgraphMapFm         (Kgraph * restrict const, const
 
 /*+ Service routines. +*/
 
-#define kgraphMapFmTablInit(t)      (((*(t)) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS)) == NULL)
-#define kgraphMapFmTablFree(t)      gainTablFree (*(t))
-#define kgraphMapFmTablExit(t)      do {                     \
-                                      if (*(t) != NULL)      \
-                                        gainTablExit (*(t)); \
+#define kgraphMapFmGainInit(t)      (((t) = gainTablInit (GAINMAX, KGRAPHMAPFMSUBBITS)) == NULL)
+#define kgraphMapFmGainFree(t)      gainTablFree (t)
+#define kgraphMapFmGainExit(t)      do {                   \
+                                      if ((t) != NULL)     \
+                                        gainTablExit (t);  \
                                     } while (0)
-#define kgraphMapFmTablAdd(t,e)     gainTablAdd ((*(t)), &(e)->gainlink, ((e)->commgain + (((e)->cmiggain) & ((e)->cmigmask))) * (e)->distval)
-#define kgraphMapFmTablDel(t,e)     gainTablDel ((*(t)), &(e)->gainlink)
+#define kgraphMapFmGainAdd(t,e)     gainTablAdd ((t), &(e)->gainlink.tabldat, ((e)->commgain + (((e)->cmiggain) & ((e)->cmigmask))) * (e)->distval)
+#define kgraphMapFmGainDel(t,e)     gainTablDel ((t), &(e)->gainlink.tabldat)
 #else /* SCOTCH_TABLE_GAIN */
 
 /*+ Service routines. +*/
 
-#define kgraphMapFmTablInit(t)      (fiboHeapInit ((t), kgraphMapFmCmpFunc))
-#define kgraphMapFmTablFree(t)      fiboHeapFree (t)
-#define kgraphMapFmTablExit(t)      fiboHeapExit (t)
-#define kgraphMapFmTablAdd(t,e)     fiboHeapAdd ((t), &(e)->gainlink)
-#define kgraphMapFmTablDel(t,e)     fiboHeapDel ((t), &(e)->gainlink)
+#define kgraphMapFmGainInit(t)      (fiboHeapInit (&(t), kgraphMapFmCmpFunc))
+#define kgraphMapFmGainFree(t)      fiboHeapFree (&(t))
+#define kgraphMapFmGainExit(t)      fiboHeapExit (&(t))
+#define kgraphMapFmGainAdd(t,e)     fiboHeapAdd (&(t), &(e)->gainlink.tabldat)
+#define kgraphMapFmGainDel(t,e)     fiboHeapDel (&(t), &(e)->gainlink.tabldat)
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+/*+ Bucket array service routines. Extended
+    edges are linked by index in their array,
+    which must be rebased when it is moved.   +*/
+
+#define kgraphMapFmBcktNum(t,e)     ((INT) ((e) - (KgraphMapFmEdge *) (t)->bcktdat.elemtab))
+#define kgraphMapFmBcktAdd(t,e)     gainBcktAdd (&(t)->bcktdat, kgraphMapFmBcktNum ((t), (e)), (INT) (((e)->commgain + (((e)->cmiggain) & ((e)->cmigmask))) * (e)->distval))
+#define kgraphMapFmBcktDel(t,e)     gainBcktDel (&(t)->bcktdat, &(e)->gainlink.bcktdat)
+
+/*+ Service routines, for the type of
+    gain structure selected at run time. +*/
+
+#define kgraphMapFmIsBckt(t)        ((t)->typeval == KGRAPHMAPFMGAINBCKT)
+#define kgraphMapFmTablInit(t,g)    ((((t)->typeval = (g)) == KGRAPHMAPFMGAINBCKT) ? gainBcktInit (&(t)->bcktdat, NULL, sizeof (KgraphMapFmEdge)) : kgraphMapFmGainInit ((t)->tabldat))
+#define kgraphMapFmTablExit(t)      do {                                    \
+                                      if (kgraphMapFmIsBckt (t))            \
+                                        gainBcktExit (&(t)->bcktdat);       \
+                                      else                                  \
+                                        kgraphMapFmGainExit ((t)->tabldat); \
+                                    } while (0)
+#define kgraphMapFmTablBase(t,e)    do {                                   \
+                                      if (kgraphMapFmIsBckt (t))           \
+                                        gainBcktBase (&(t)->bcktdat, (e)); \
+                                    } while (0)
+#define kgraphMapFmTablFree(t)      do {                                    \
+                                      if (kgraphMapFmIsBckt (t))            \
+                                        gainBcktFree (&(t)->bcktdat);       \
+                                      else                                  \
+                                        kgraphMapFmGainFree ((t)->tabldat); \
+                                    } while (0)
+#define kgraphMapFmTablAdd(t,e)     do {                                        \
+                                      if (kgraphMapFmIsBckt (t))                \
+                                        kgraphMapFmBcktAdd ((t), (e));          \
+                                      else                                      \
+                                        kgraphMapFmGainAdd ((t)->tabldat, (e)); \
+                                    } while (0)
+#define kgraphMapFmTablDel(t,e)     do {                                        \
+                                      if (kgraphMapFmIsBckt (t))                \
+                                        kgraphMapFmBcktDel ((t), (e));          \
+                                      else                                      \
+                                        kgraphMapFmGainDel ((t)->tabldat, (e)); \
+                                    } while (0)
+#define kgraphMapFmTablGet(t,v,d,m,c,f) (kgraphMapFmIsBckt (t) ? kgraphMapFmTablGetBckt ((t), (v), (d), (m), (c), (f)) : kgraphMapFmTablGetGain ((t), (v), (d), (m), (c), (f)))
+#define kgraphMapFmTablFail(t)      (kgraphMapFmIsBckt (t) && gainBcktFail (&(t)->bcktdat))
+
 #define kgraphMapFmLock(l,v)        do {                                        \
                                       (v)->lockptr = (KgraphMapFmVertex *) (l); \
                                       (l) = (v);                                \
@@ -1,4 +1,4 @@
-/* Copyright 2008,2011,2014,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2008,2011,2014,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 28 jun 2021     **/
 /**                                 to   : 28 jun 2021     **/
 /**                # Version 7.0  : from : 03 may 2021     **/
-/**                                 to   : 16 jul 2023     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This is a rewrite of kgraphMapRb()    **/
 /**                  for complete-graph target topologies. **/
@@ -313,7 +313,7 @@ KgraphMapRbPartSplit * const  spltptr)
   spltdat.revaptr = &o;
 
 #ifndef KGRAPHMAPRBPARTNOTHREAD
-  if (contextThreadLaunchSplit (contptr, (ContextSplitFunc) kgraphMapRbPart2, &spltdat) != 0) /* If counld not split context to run concurrently */
+  if (contextThreadLaunchTask (contptr, (ContextSplitFunc) kgraphMapRbPart2, &spltdat, actgrafdat.s.vertnbr) != 0) /* If could not run jobs concurrently */
 #endif /* KGRAPHMAPRBPARTNOTHREAD */
   {
     kgraphMapRbPart2 (contptr, 0, &spltdat);      /* Run tasks in sequence */
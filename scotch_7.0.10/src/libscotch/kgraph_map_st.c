@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2009-2011,2014,2018,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,6 +68,7 @@
 #include "parser.h"
 #include "gain.h"
 #include "fibo.h"
+#include "gain_bckt.h"
 #include "graph.h"
 #include "arch.h"
 #include "graph_coarsen.h"
@@ -112,7 +113,7 @@ static union {
 static union {
   KgraphMapFmParam          param;
   StratNodeMethodData       padding;
-} kgraphmapstdefaultfm = { { 200, ~0, 0.05 } };
+} kgraphmapstdefaultfm = { { 200, ~0, 0.05, KGRAPHMAPFMGAINTABL, 0 } };
 
 static union {
   KgraphMapMlParam          param;
@@ -175,6 +176,14 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultfm.param,
                                 (byte *) &kgraphmapstdefaultfm.param.deltval,
                                 NULL },
+                              { KGRAPHMAPSTMETHFM,  STRATPARAMCASE,   "gain",
+                                (byte *) &kgraphmapstdefaultfm.param,
+                                (byte *) &kgraphmapstdefaultfm.param.tablval,
+                                (void *) "tb" },
+                              { KGRAPHMAPSTMETHFM,  STRATPARAMCASE,   "thrd",
+                                (byte *) &kgraphmapstdefaultfm.param,
+                                (byte *) &kgraphmapstdefaultfm.param.flagthrd,
+                                (void *) "ny" },
                               { KGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.stratasc,
@@ -243,6 +252,35 @@ StratTab                    kgraphmapststratab = { /* Strategy tables for graph
                               kgraphmapstparatab,
                               kgraphmapstcondtab };
 
+/* This routine computes the largest relative
+** load imbalance over all domains of the
+** current mapping, for method call statistics.
+** It returns:
+** - >= 0  : largest imbalance ratio.
+*/
+
+static
+double
+kgraphMapStImba (
+const Kgraph * restrict const grafptr)
+{
+  Anum                domnnum;
+  double              imbaval;
+
+  for (domnnum = 0, imbaval = 0.0; domnnum < grafptr->m.domnnbr; domnnum ++) {
+    double              imbatmp;
+
+    if (grafptr->comploadavg[domnnum] <= 0)       /* Skip domains which should not receive any load */
+      continue;
+
+    imbatmp = (double) abs (grafptr->comploaddlt[domnnum]) / (double) grafptr->comploadavg[domnnum];
+    if (imbatmp > imbaval)
+      imbaval = imbatmp;
+  }
+
+  return (imbaval);
+}
+
 /****************************************/
 /*                                      */
 /* This is the generic mapping routine. */
@@ -266,6 +304,7 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
   KgraphStore         savetab[2];                 /* Results of the two strategies          */
   Gnum                comploaddltasu[2];          /* Absolute sum of computation load delta */
   Anum                partnum;
+  StatMark            markdat;                    /* Mark of recorded method call */
   int                 o;
   int                 o2;
 
@@ -390,8 +429,14 @@ const Strat * restrict const  straptr)            /*+ Mapping strategy +*/
 #else /* SCOTCH_DEBUG_KGRAPH1 */
     default :
 #endif /* SCOTCH_DEBUG_KGRAPH1 */
-      return (((KgraphMapFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, (void *) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "kgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertnbr, grafptr->s.edgenbr, (double) grafptr->commload, kgraphMapStImba (grafptr));
+      o = ((KgraphMapFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, (void *) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->commload, kgraphMapStImba (grafptr), o);
+      return (o);
 #ifdef SCOTCH_DEBUG_KGRAPH1
     default :
       errorPrint ("kgraphMapSt: invalid parameter (2)");
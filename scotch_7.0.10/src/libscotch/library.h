@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014-2016,2018-2021,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014-2016,2018-2021,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,7 +58,7 @@
 /**                # Version 6.1  : from : 05 sep 2020     **/
 /**                                 to   : 01 apr 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 03 jun 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,6 +100,13 @@ typedef DUMMYINT SCOTCH_Num;
 #define SCOTCH_OPTIONNUMNBR         2
 #endif /* SCOTCH_OPTIONNUMNBR */
 
+/*+ Coloring flags. +*/
+
+#ifndef SCOTCH_COLORDEFAULT
+#define SCOTCH_COLORDEFAULT         0x0000
+#define SCOTCH_COLORGREEDY          0x0001
+#endif /* SCOTCH_COLORDEFAULT */
+
 /*+ Coarsening flags. +*/
 
 #ifndef SCOTCH_COARSENNONE
@@ -221,12 +228,20 @@ SCOTCH_Context *            SCOTCH_contextAlloc (void);
 int                         SCOTCH_contextSizeof (void);
 int                         SCOTCH_contextInit  (SCOTCH_Context * const);
 void                        SCOTCH_contextExit  (SCOTCH_Context * const);
+int                         SCOTCH_contextCacheInit (SCOTCH_Context * const, const SCOTCH_Num);
+void                        SCOTCH_contextCacheReset (SCOTCH_Context * const);
+void                        SCOTCH_contextCacheStat (SCOTCH_Context * const, SCOTCH_Num * const, SCOTCH_Num * const);
 int                         SCOTCH_contextOptionGetNum (SCOTCH_Context * const, const int, SCOTCH_Num * const);
 int                         SCOTCH_contextOptionSetNum (SCOTCH_Context * const, const int, const SCOTCH_Num);
 int                         SCOTCH_contextOptionParse (SCOTCH_Context * const, const char *);
 int                         SCOTCH_contextRandomClone (SCOTCH_Context * const);
 void                        SCOTCH_contextRandomReset (SCOTCH_Context * const);
 void                        SCOTCH_contextRandomSeed (SCOTCH_Context * const, const SCOTCH_Num);
+int                         SCOTCH_contextStatGet (SCOTCH_Context * const, const SCOTCH_Num, const char ** const, const char ** const, SCOTCH_Num * const, SCOTCH_Num * const, SCOTCH_Num * const, double * const, double * const, double * const);
+int                         SCOTCH_contextStatInit (SCOTCH_Context * const);
+SCOTCH_Num                  SCOTCH_contextStatNbr (SCOTCH_Context * const);
+void                        SCOTCH_contextStatReset (SCOTCH_Context * const);
+int                         SCOTCH_contextStatSave (SCOTCH_Context * const, FILE * const);
 int                         SCOTCH_contextThreadImport1 (SCOTCH_Context * const, const int);
 int                         SCOTCH_contextThreadImport2 (SCOTCH_Context * const, const int);
 int                         SCOTCH_contextThreadSpawn (SCOTCH_Context * const, const int, const int * const);
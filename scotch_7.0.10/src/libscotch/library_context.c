@@ -1,4 +1,4 @@
-/* Copyright 2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -40,7 +40,7 @@
 /**                library.                                **/
 /**                                                        **/
 /**   DATES      : # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 03 jun 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -181,6 +181,161 @@ const SCOTCH_Num            seedval)
   intRandSeed (((Context *) libcontptr)->randptr, seedval);
 }
 
+/****************************************/
+/*                                      */
+/* These routines handle the statistics */
+/* features of contexts.                */
+/*                                      */
+/****************************************/
+
+/*+ This routine enables the recording of
+*** all strategy method calls performed
+*** within the given context.
+*** It returns:
+*** - 0   : if statistics enabled.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatInit (
+SCOTCH_Context * const      libcontptr)
+{
+  return (contextStatInit ((Context *) libcontptr));
+}
+
+/*+ This routine discards all the method
+*** call records of the given context.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_contextStatReset (
+SCOTCH_Context * const      libcontptr)
+{
+  contextStatReset ((Context *) libcontptr);
+}
+
+/*+ This routine returns the number of
+*** method call records of the given context.
+*** It returns:
+*** - >=0  : number of records.
++*/
+
+SCOTCH_Num
+SCOTCH_contextStatNbr (
+SCOTCH_Context * const      libcontptr)
+{
+  return ((SCOTCH_Num) contextStatNbr ((Context *) libcontptr));
+}
+
+/*+ This routine retrieves the data of the
+*** given method call record. Any of the
+*** pointers may be NULL if the associated
+*** data is not wanted. Costs and imbalances
+*** are given before and after the call, and
+*** are negative when not relevant.
+*** It returns:
+*** - 0   : if record data retrieved.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatGet (
+SCOTCH_Context * const      libcontptr,
+const SCOTCH_Num            recdnum,
+const char ** const         typeptr,
+const char ** const         methptr,
+SCOTCH_Num * const          levlptr,
+SCOTCH_Num * const          vertptr,
+SCOTCH_Num * const          edgeptr,
+double * const              timeptr,
+double * const              costtab,
+double * const              imbatab)
+{
+  return (contextStatGet ((Context *) libcontptr, (INT) recdnum, typeptr, methptr,
+                          (INT *) levlptr, (INT *) vertptr, (INT *) edgeptr, timeptr, costtab, imbatab));
+}
+
+/*+ This routine saves the method call
+*** records of the given context, as well
+*** as a per-method summary, in JSON format.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextStatSave (
+SCOTCH_Context * const      libcontptr,
+FILE * const                stream)
+{
+  return (contextStatSave ((Context *) libcontptr, stream));
+}
+
+/************************************/
+/*                                  */
+/* These routines handle the result */
+/* cache features of contexts.      */
+/*                                  */
+/************************************/
+
+/*+ This routine enables the caching of
+*** mapping and ordering results within
+*** the given context, keeping at most
+*** the given number of results.
+*** It returns:
+*** - 0   : if cache enabled.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_contextCacheInit (
+SCOTCH_Context * const      libcontptr,
+const SCOTCH_Num            entrnbr)
+{
+  return (contextCacheInit ((Context *) libcontptr, (INT) entrnbr));
+}
+
+/*+ This routine discards all the results
+*** cached in the given context, and
+*** resets its hit and miss counters.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_contextCacheReset (
+SCOTCH_Context * const      libcontptr)
+{
+  contextCacheReset ((Context *) libcontptr);
+}
+
+/*+ This routine returns the number of
+*** cache hits and misses of the given
+*** context. Any of the pointers may be
+*** NULL if the associated data is not
+*** wanted.
+*** It returns:
+*** - void  : in all cases.
++*/
+
+void
+SCOTCH_contextCacheStat (
+SCOTCH_Context * const      libcontptr,
+SCOTCH_Num * const          hitsptr,
+SCOTCH_Num * const          missptr)
+{
+  INT                 hitnbr;
+  INT                 misnbr;
+
+  contextCacheStat ((Context *) libcontptr, &hitnbr, &misnbr);
+  if (hitsptr != NULL)
+    *hitsptr = (SCOTCH_Num) hitnbr;
+  if (missptr != NULL)
+    *missptr = (SCOTCH_Num) misnbr;
+}
+
 /************************************/
 /*                                  */
 /* These routines handle the thread */
@@ -1,4 +1,4 @@
-!* Copyright 2004,2007,2009,2010,2012,2014,2018,2019,2021 IPB, Universite de Bordeaux, INRIA & CNRS
+!* Copyright 2004,2007,2009,2010,2012,2014,2018,2019,2021,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 !*
 !* This file is part of the Scotch software package for static mapping,
 !* graph partitioning and sparse matrix ordering.
@@ -53,7 +53,7 @@
 !*                # Version 6.1  : from : 22 jun 2021     **
 !*                                 to   : 22 jun 2021     **
 !*                # Version 7.0  : from : 25 aug 2019     **
-!*                                 to   : 23 oct 2021     **
+!*                                 to   : 17 oct 2026     **
 !*                                                        **
 !***********************************************************
 
@@ -74,6 +74,14 @@
         PARAMETER (SCOTCH_OPTIONNUMRANDOMFIXEDSEED = 1)
         PARAMETER (SCOTCH_OPTIONNUMNBR             = 2)
 
+!* Flag definitions for the coloring
+!* routine.
+
+        INTEGER SCOTCH_COLORDEFAULT
+        INTEGER SCOTCH_COLORGREEDY
+        PARAMETER (SCOTCH_COLORDEFAULT = 0)
+        PARAMETER (SCOTCH_COLORGREEDY  = 1)
+
 !* Flag definitions for the coarsening
 !* routines.
 
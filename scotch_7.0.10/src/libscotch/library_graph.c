@@ -54,7 +54,7 @@
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 31 may 2021     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 11 aug 2025     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -175,6 +175,8 @@ const SCOTCH_Num            baseval,
 const SCOTCH_Num            flagval)
 {
   GraphLoadFlag       flagtmp;                    /* Graph load flags */
+  CONTEXTDECL         (grafptr);
+  int                 o;
 
   if ((flagval < 0) || (flagval > 3)) {
     errorPrint (STRINGIFY (SCOTCH_graphLoad) ": invalid flag parameter");
@@ -192,7 +194,15 @@ const SCOTCH_Num            flagval)
   flagtmp = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
             (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
 
-  return (graphLoad ((Graph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, flagtmp));
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphLoad) ": cannot initialize context");
+    return (1);
+  }
+
+  o = graphLoad ((Graph * const) CONTEXTGETOBJECT (grafptr), stream, (Gnum) baseval, flagtmp, CONTEXTGETDATA (grafptr));
+
+  CONTEXTEXIT (grafptr);
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
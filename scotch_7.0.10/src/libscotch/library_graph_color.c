@@ -1,4 +1,4 @@
-/* Copyright 2012,2014,2018,2019,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2012,2014,2018,2019,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 02 jan 2012     **/
 /**                                 to   : 25 apr 2018     **/
 /**                # Version 7.0  : from : 24 aug 2019     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -50,6 +50,8 @@
 **  The defines and includes.
 */
 
+#define SCOTCH_LIBRARY_GRAPH_COLOR
+
 #include "module.h"
 #include "common.h"
 #include "context.h"
@@ -57,6 +59,272 @@
 #include "graph.h"
 #include "graph_coarsen.h"
 #include "scotch.h"
+#include "library_graph_color.h"
+
+/***********************************/
+/*                                 */
+/* These routines are the threaded */
+/* graph coloring routines.        */
+/*                                 */
+/***********************************/
+
+/* This routine performs the prefix scan
+** of the sizes of the queue slices kept
+** by each thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/* This routine computes a coloring by means
+** of a variant of Luby's algorithm: at every
+** round, each uncolored vertex which has the
+** highest priority among its neighbors that
+** were still uncolored at the beginning of
+** the round receives the color of the round.
+** Since decisions only depend on colors of
+** previous rounds, the result does not depend
+** on the number of threads. Every thread
+** processes a slice of the current queue, and
+** the remaining vertices are compacted into
+** the next queue by means of a prefix scan.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorLuby (
+ThreadDescriptor * restrict const descptr,
+GraphColorData * restrict const   dataptr)
+{
+  Gnum                queunbr;
+  Gnum                queunum;
+  Gnum                queubas;
+  Gnum                queunnd;
+  Gnum                queunew;
+  Gnum                colonum;
+
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  GraphColorThread * restrict const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const      grafptr = dataptr->grafptr;
+  const Gnum * restrict const       verttax = grafptr->verttax;
+  const Gnum * restrict const       vendtax = grafptr->vendtax;
+  const Gnum * restrict const       edgetax = grafptr->edgetax;
+  const Gnum * restrict const       randtax = dataptr->randtax;
+  Gnum * restrict const             colotax = dataptr->colotax;
+  Gnum * restrict                   qoldtab = dataptr->queutab[0];
+  Gnum * restrict                   qnewtab = dataptr->queutab[1];
+
+  queunbr = grafptr->vertnbr;
+  for (queunum = DATASCAN (queunbr, thrdnbr, thrdnum), queunnd = DATASCAN (queunbr, thrdnbr, thrdnum + 1);
+       queunum < queunnd; queunum ++)             /* Initial queue slice is processed by the same thread */
+    qoldtab[queunum] = queunum + grafptr->baseval;
+
+  for (colonum = 0; queunbr > 0; colonum ++) {    /* Color numbers are not based */
+    Gnum * restrict     qtmptab;
+
+    for (queunum = queunew = queubas = DATASCAN (queunbr, thrdnbr, thrdnum), queunnd = DATASCAN (queunbr, thrdnbr, thrdnum + 1);
+         queunum < queunnd; queunum ++) {
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                randval;
+
+      vertnum = qoldtab[queunum];
+      randval = randtax[vertnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+        Gnum                coloend;
+        Gnum                randend;
+
+        vertend = edgetax[edgenum];
+        coloend = colotax[vertend];               /* May be concurrently set to colonum, which does not matter */
+        if ((coloend >= 0) && (coloend < colonum)) /* Skip neighbors colored in previous rounds only          */
+          continue;
+
+        randend = randtax[vertend];
+        if ((randend > randval) ||
+            ((randend == randval) && (vertend > vertnum))) /* Tie breaking when same random value */
+          break;
+      }
+      if (edgenum >= edgennd)
+        colotax[vertnum] = colonum;
+      else
+        qoldtab[queunew ++] = vertnum;            /* Compact remaining vertices at beginning of slice */
+    }
+
+    thrdptr->scantab[0] = queunew - queubas;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphColorThread), (ThreadScanFunc) graphColorScan, NULL); /* Compute start of slice in next queue */
+    queunbr = dataptr->thrdtab[thrdnbr - 1].scantab[0];
+    memCpy (qnewtab + thrdptr->scantab[0] - (queunew - queubas), qoldtab + queubas, (queunew - queubas) * sizeof (Gnum));
+    threadBarrier (descptr);                      /* Next queue must be complete before next round */
+
+    qtmptab = qoldtab;                            /* Swap queues */
+    qoldtab = qnewtab;
+    qnewtab = qtmptab;
+  }
+
+  if (thrdnum == 0)
+    dataptr->colonbr = colonum;
+}
+
+/* This routine computes a coloring by means
+** of speculative greedy coloring followed by
+** conflict repair. At every round, each thread
+** assigns to the vertices of its slice of the
+** queue the smallest color not used by their
+** neighbors colored in previous rounds or
+** already processed by the same thread. Then,
+** of every pair of neighbors which received
+** the same color, the vertex of lowest priority
+** is put back into the queue. Tentative colors
+** are encoded as (-2 - color) so that they are
+** never mistaken for final colors by other
+** threads. Since queues are kept sorted by
+** increasing vertex number, the vertices of a
+** slice lie within a vertex interval, which is
+** how a thread identifies its own vertices.
+** The result only depends on the number of
+** threads and on the vertex priorities.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorGreedy (
+ThreadDescriptor * restrict const descptr,
+GraphColorData * restrict const   dataptr)
+{
+  Gnum                queunbr;
+  Gnum                queunum;
+  Gnum                queubas;
+  Gnum                queunnd;
+  Gnum                queunew;
+  Gnum                markval;
+  Gnum                colomax;
+
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  GraphColorThread * restrict const thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const      grafptr = dataptr->grafptr;
+  const Gnum * restrict const       verttax = grafptr->verttax;
+  const Gnum * restrict const       vendtax = grafptr->vendtax;
+  const Gnum * restrict const       edgetax = grafptr->edgetax;
+  const Gnum * restrict const       randtax = dataptr->randtax;
+  Gnum * restrict const             colotax = dataptr->colotax;
+  Gnum * restrict const             qoldtab = dataptr->queutab[0];
+  Gnum * restrict const             qnewtab = dataptr->queutab[1];
+  Gnum * restrict const             marktab = dataptr->marktab + thrdnum * dataptr->marksiz;
+
+  memSet (marktab, ~0, dataptr->marksiz * sizeof (Gnum)); /* No color marked yet */
+  markval = 0;
+  colomax = -1;
+
+  queunbr = grafptr->vertnbr;
+  for (queunum = DATASCAN (queunbr, thrdnbr, thrdnum), queunnd = DATASCAN (queunbr, thrdnbr, thrdnum + 1);
+       queunum < queunnd; queunum ++)
+    qoldtab[queunum] = queunum + grafptr->baseval;
+
+  while (queunbr > 0) {
+    Gnum                vertbas;
+
+    queubas = DATASCAN (queunbr, thrdnbr, thrdnum);
+    queunnd = DATASCAN (queunbr, thrdnbr, thrdnum + 1);
+    vertbas = (queubas < queunnd) ? qoldtab[queubas] : 0; /* First vertex of slice */
+
+    for (queunum = queubas; queunum < queunnd; queunum ++, markval ++) { /* Speculative coloring */
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                colonum;
+
+      vertnum = qoldtab[queunum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+        Gnum                coloend;
+
+        vertend = edgetax[edgenum];
+        coloend = colotax[vertend];
+        if (coloend >= 0)                         /* If neighbor colored in a previous round */
+          marktab[coloend] = markval;
+        else if ((coloend < -1) &&                /* If neighbor already processed by this thread */
+                 (vertend >= vertbas) && (vertend < vertnum))
+          marktab[-2 - coloend] = markval;
+      }
+      for (colonum = 0; marktab[colonum] == markval; colonum ++) ; /* Find smallest free color */
+      colotax[vertnum] = -2 - colonum;
+    }
+
+    threadBarrier (descptr);                      /* All tentative colors must be set */
+
+    for (queunum = queunew = queubas; queunum < queunnd; queunum ++) { /* Conflict detection */
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                colotmp;
+      Gnum                randval;
+
+      vertnum = qoldtab[queunum];
+      colotmp = colotax[vertnum];
+      randval = randtax[vertnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+        Gnum                randend;
+
+        vertend = edgetax[edgenum];
+        if (colotax[vertend] != colotmp)
+          continue;
+
+        randend = randtax[vertend];
+        if ((randend > randval) ||
+            ((randend == randval) && (vertend > vertnum)))
+          break;
+      }
+      if (edgenum < edgennd)                      /* If vertex has to be colored again */
+        qnewtab[queunew ++] = vertnum;
+    }
+
+    thrdptr->scantab[0] = queunew - queubas;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphColorThread), (ThreadScanFunc) graphColorScan, NULL); /* Compute start of slice in next queue */
+    queunbr = dataptr->thrdtab[thrdnbr - 1].scantab[0];
+
+    for (queunum = queubas; queunum < queunew; queunum ++) /* Uncolor vertices in conflict */
+      colotax[qnewtab[queunum]] = -1;
+    for (queunum = queubas; queunum < queunnd; queunum ++) { /* Make remaining colors final */
+      Gnum                vertnum;
+      Gnum                colotmp;
+
+      vertnum = qoldtab[queunum];
+      colotmp = colotax[vertnum];
+      if (colotmp < -1) {
+        colotmp = -2 - colotmp;
+        colotax[vertnum] = colotmp;
+        if (colotmp > colomax)
+          colomax = colotmp;
+      }
+    }
+
+    threadBarrier (descptr);                      /* Current queue no longer read */
+    memCpy (qoldtab + thrdptr->scantab[0] - (queunew - queubas), qnewtab + queubas, (queunew - queubas) * sizeof (Gnum));
+    threadBarrier (descptr);                      /* Next queue must be complete before next round */
+  }
+
+  thrdptr->colomax = colomax;
+}
 
 /*********************************/
 /*                               */
@@ -66,11 +334,15 @@
 /*********************************/
 
 /*+ This routine creates a color array for the
-*** given graph.
+*** given graph. Coloring rounds are run by all
+*** the threads of the context of the graph.
+*** For a given random seed, the coloring does
+*** not depend on the number of threads, unless
+*** the SCOTCH_COLORGREEDY flag is set, in which
+*** case it depends on it.
 *** It returns:
-*** - 0  : if the graph has been coarsened.
-*** - 1  : if the graph could not be coarsened.
-*** - 2  : on error.
+*** - 0  : if the graph has been colored.
+*** - 1  : on error.
 +*/
 
 int
@@ -78,18 +350,17 @@ SCOTCH_graphColor (
 const SCOTCH_Graph * restrict const libgrafptr,   /* Graph to color              */
 SCOTCH_Num * restrict const         colotab,      /* Pointer to color array      */
 SCOTCH_Num * restrict const         coloptr,      /* Pointer to number of colors */
-const SCOTCH_Num                    flagval)      /* Flag value (not used)       */
+const SCOTCH_Num                    flagval)      /* Coloring method flags       */
 {
   CONTEXTDECL        (libgrafptr);
+  GraphColorData      colodat;
   Gnum                baseval;
   Gnum                vertnum;
   Gnum                vertnbr;
   Gnum                vertnnd;
-  Gnum                queunnd;
-  Gnum * restrict     queutax;
   Gnum * restrict     randtax;
-  Gnum                colonum;
-  Gnum * restrict     colotax;
+  int                 thrdnbr;
+  int                 thrdnum;
   int                 o;
 
   if (CONTEXTINIT (libgrafptr) != 0) {
@@ -98,69 +369,50 @@ const SCOTCH_Num                    flagval)      /* Flag value (not used)
   }
 
   const Graph * restrict const  grafptr = CONTEXTGETOBJECT (libgrafptr);
-  const Gnum * restrict const   verttax = grafptr->verttax;
-  const Gnum * restrict const   vendtax = grafptr->vendtax;
-  const Gnum * restrict const   edgetax = grafptr->edgetax;
 
   baseval = grafptr->baseval;
   vertnbr = grafptr->vertnbr;
   vertnnd = vertnbr + baseval;
+  thrdnbr = contextThreadNbr (CONTEXTGETDATA (libgrafptr));
 
   memSet (colotab, ~0, vertnbr * sizeof (Gnum));
-  colotax = ((Gnum *) colotab) - baseval;
 
   o = 1;                                          /* Assume an error */
 
+  colodat.marksiz = ((flagval & SCOTCH_COLORGREEDY) != 0) ? (grafptr->degrmax + 1) : 0; /* Colors never exceed maximum degree */
   if (memAllocGroup ((void **) (void *)
-                     &queutax, (size_t) (vertnbr * sizeof (Gnum)),
-                     &randtax, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
+                     &colodat.queutab[0], (size_t) (vertnbr * sizeof (Gnum)),
+                     &colodat.queutab[1], (size_t) (vertnbr * sizeof (Gnum)),
+                     &randtax,            (size_t) (vertnbr * sizeof (Gnum)),
+                     &colodat.marktab,    (size_t) (thrdnbr * colodat.marksiz * sizeof (Gnum)),
+                     &colodat.thrdtab,    (size_t) (thrdnbr * sizeof (GraphColorThread)), NULL) == NULL) {
     errorPrint (STRINGIFY (SCOTCH_graphColor) ": out of memory");
     goto abort;
   }
-  queutax -= baseval;
   randtax -= baseval;
 
-  for (vertnum = baseval; vertnum < vertnnd; vertnum ++)
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) /* Priorities do not depend on number of threads */
     randtax[vertnum] = contextIntRandVal (CONTEXTGETDATA (libgrafptr), 32768);
 
-  queunnd = vertnnd;
-  for (colonum = 0; queunnd > baseval; colonum ++) { /* Color numbers are not based */
-    Gnum                queuold;
-    Gnum                queunew;
+  colodat.grafptr = grafptr;
+  colodat.colotax = ((Gnum *) colotab) - baseval;
+  colodat.randtax = randtax;
+  colodat.colonbr = 0;
 
-    for (queunew = queuold = baseval; queuold < queunnd; queuold ++) {
-      Gnum                vertnum;
-      Gnum                edgenum;
-      Gnum                edgennd;
-      Gnum                randval;
+  if ((flagval & SCOTCH_COLORGREEDY) != 0) {
+    contextThreadLaunch (CONTEXTGETDATA (libgrafptr), (ThreadFunc) graphColorGreedy, (void *) &colodat);
 
-      vertnum = (queunnd == vertnnd) ? queuold : queutax[queuold];
-      randval = randtax[vertnum];
-      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
-        Gnum                vertend;
-        Gnum                randend;
-
-        vertend = edgetax[edgenum];
-
-        if (colotax[vertend] >= 0)
-          continue;
-
-        randend = randtax[vertend];
-        if ((randend > randval) ||
-            ((randend == randval) && (vertend > vertnum))) /* Tie breaking when same random value */
-          break;
-      }
-      if (edgenum >= edgennd)
-        colotax[vertnum] = colonum;
-      else
-        queutax[queunew ++] = vertnum;
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) { /* Number of colors is one more than largest color */
+      if (colodat.thrdtab[thrdnum].colomax >= colodat.colonbr)
+        colodat.colonbr = colodat.thrdtab[thrdnum].colomax + 1;
     }
-    queunnd = queunew;
   }
+  else
+    contextThreadLaunch (CONTEXTGETDATA (libgrafptr), (ThreadFunc) graphColorLuby, (void *) &colodat);
 
-  *coloptr = colonum;                             /* Set number of colors found */
+  *coloptr = colodat.colonbr;                     /* Set number of colors found */
 
-  memFree (queutax + baseval);
+  memFree (colodat.queutab[0]);                   /* Free group leader */
 
   o = 0;
 
@@ -0,0 +1,81 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : library_graph_color.h                   **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the declarations for    **/
+/**                the graph coloring routine of the       **/
+/**                libSCOTCH library.                      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphColorThread_ {
+  Gnum                      scantab[2];           /*+ Area for scan of queue slice sizes      +*/
+  Gnum                      colomax;              /*+ Largest color value assigned by thread  +*/
+} GraphColorThread;
+
+/*+ The data structure shared by all coloring
+    threads. Queue arrays are not based, and
+    are swapped at the end of every round.    +*/
+
+typedef struct GraphColorData_ {
+  const Graph *             grafptr;              /*+ Graph to color                           +*/
+  Gnum *                    colotax;              /*+ Based color array                        +*/
+  const Gnum *              randtax;              /*+ Based array of vertex priorities         +*/
+  Gnum *                    queutab[2];           /*+ Current and next queues of vertices      +*/
+  Gnum *                    marktab;              /*+ Per-thread arrays of forbidden colors    +*/
+  Gnum                      marksiz;              /*+ Size of each per-thread array            +*/
+  Gnum                      colonbr;              /*+ Number of rounds, for Luby's method      +*/
+  GraphColorThread *        thrdtab;              /*+ Array of thread-specific data blocks     +*/
+} GraphColorData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef SCOTCH_LIBRARY_GRAPH_COLOR
+static void                 graphColorScan      (Gnum * const, Gnum * const, const int, const int, const void * const);
+static void                 graphColorLuby      (ThreadDescriptor * restrict const, GraphColorData * restrict const);
+static void                 graphColorGreedy    (ThreadDescriptor * restrict const, GraphColorData * restrict const);
+#endif /* SCOTCH_LIBRARY_GRAPH_COLOR */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2012,2014,2018,2019,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 11 sep 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,6 +68,8 @@
 #include "arch.h"
 #include "arch_dist.h"
 #include "mapping.h"
+#include "order.h"
+#include "graph_cache.h"
 #include "kgraph.h"
 #include "kgraph_map_st.h"
 #include "library_mapping.h"
@@ -162,6 +164,9 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   Gnum                crloval;                    /* Coefficient load for regular edges   */
   Gnum                cmloval;                    /* Coefficient load for migration edges */
   const Gnum *        vmlotax;                    /* Vertex migration cost array          */
+  Context *           contptr;                    /* Execution context                    */
+  UINT64              keytab[CACHEKEYSIZE];       /* Key of cached mapping                */
+  int                 keyflag;                    /* Flag set if mapping cacheable        */
   int                 o;
 
   o = 1;                                          /* Assume an error */
@@ -253,6 +258,18 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
   else
     pfixtax = NULL;
 
+  contptr = CONTEXTGETDATA (actgrafptr);
+  keyflag = 0;
+  if ((contextCacheActive (contptr)) &&           /* Only plain mappings are cached */
+      (vfixnbr == 0) && (lmaoptr == NULL) &&
+      (graphCacheKey (grafptr, GRAPHCACHEMAP, lmapptr->archptr, mapstraptr, contptr, keytab) == 0)) {
+    if (graphCacheMapGet (contptr, keytab, grafptr, lmapptr->parttab) == 0) { /* If mapping found in cache, use it */
+      o = 0;
+      goto abort;
+    }
+    keyflag = 1;
+  }
+
   if (lmaoptr != NULL) {                          /* We are doing a repartitioning */
     Gnum                        numeval;
     Gnum                        denoval;
@@ -289,10 +306,12 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
     }
   }
 
-  mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
+  mapgrafdat.contptr = contptr;
 
   o = kgraphMapSt (&mapgrafdat, mapstraptr);
   mapTerm (&mapgrafdat.m, lmapptr->parttab - baseval); /* Propagate mapping result to part array */
+  if ((o == 0) && (keyflag != 0))                 /* If mapping can be cached, store it */
+    graphCacheMapPut (contptr, keytab, grafptr, lmapptr->parttab);
 
   kgraphExit (&mapgrafdat);
 
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2012-2014,2018,2019,2023-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2012-2014,2018,2019,2023-2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 08 jan 2012     **/
 /**                                 to   : 29 sep 2019     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 29 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,7 +65,9 @@
 #include "context.h"
 #include "parser.h"
 #include "graph.h"
+#include "arch.h"
 #include "order.h"
+#include "graph_cache.h"
 #include "hgraph.h"
 #include "hgraph_order_st.h"
 #include "library_order.h"
@@ -249,6 +251,8 @@ SCOTCH_Strat * const        stratptr)             /*+ Ordering strategy
   CONTEXTDECL        (libgrafptr);
   const Strat *       ordstratptr;                /* Pointer to ordering strategy    */
   OrderCblk *         cblkptr;
+  UINT64              keytab[CACHEKEYSIZE];       /* Key of cached ordering          */
+  int                 keyflag;                    /* Flag set if ordering cacheable  */
   int                 o;
 
   o = 1;                                          /* Assume an error */
@@ -297,7 +301,18 @@ SCOTCH_Strat * const        stratptr)             /*+ Ordering strategy
   halgrafdat.levlnum = 0;                         /* No nested dissection yet       */
   halgrafdat.contptr = CONTEXTGETDATA (libgrafptr);
 
+  keyflag = 0;
   if (listnbr == srcgrafptr->vertnbr) {           /* If work on full graph */
+    if ((contextCacheActive (halgrafdat.contptr)) && /* If ordering may be cached */
+        (graphCacheKey (srcgrafptr, GRAPHCACHEORDER, NULL, ordstratptr, halgrafdat.contptr, keytab) == 0)) {
+      o = graphCacheOrderGet (halgrafdat.contptr, keytab, &libordeptr->o);
+      if (o == 0)                                 /* If ordering found in cache, use it */
+        goto skip;
+      if (o != 1)
+        goto abort;
+      keyflag = 1;
+    }
+
     halgrafptr = &halgrafdat;
     cblkptr    = &libordeptr->o.rootdat;
   }
@@ -365,6 +380,9 @@ SCOTCH_Strat * const        stratptr)             /*+ Ordering strategy
   if (o != 0)
     goto abort;
 
+  if (keyflag != 0)                               /* If ordering can be cached, store it */
+    graphCacheOrderPut (halgrafdat.contptr, keytab, &libordeptr->o);
+
 skip:
 #ifdef SCOTCH_DEBUG_LIBRARY2
   if (orderCheck (&libordeptr->o) != 0) {
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007-2016,2018-2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007-2016,2018-2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 24 aug 2020     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 19 feb 2018     **/
-/**                                 to   : 12 sep 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -261,6 +261,8 @@
 #define SCOTCH_VERSION              SCOTCH_NAME_PUBLIC (SCOTCH_VERSION)
 #define SCOTCH_RELEASE              SCOTCH_NAME_PUBLIC (SCOTCH_RELEASE)
 #define SCOTCH_PATCHLEVEL           SCOTCH_NAME_PUBLIC (SCOTCH_PATCHLEVEL)
+#define SCOTCH_COLORDEFAULT         SCOTCH_NAME_PUBLIC (SCOTCH_COLORDEFAULT)
+#define SCOTCH_COLORGREEDY          SCOTCH_NAME_PUBLIC (SCOTCH_COLORGREEDY)
 #define SCOTCH_COARSENNONE          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNONE)
 #define SCOTCH_COARSENFOLD          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLD)
 #define SCOTCH_COARSENFOLDDUP       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLDDUP)
@@ -309,14 +311,29 @@
 
 #define commonStubDummy             SCOTCH_NAME_INTERN (commonStubDummy)
 
+#define contextCacheExit            SCOTCH_NAME_INTERN (contextCacheExit)
+#define contextCacheFind            SCOTCH_NAME_INTERN (contextCacheFind)
+#define contextCacheInit            SCOTCH_NAME_INTERN (contextCacheInit)
+#define contextCacheReset           SCOTCH_NAME_INTERN (contextCacheReset)
+#define contextCacheStat            SCOTCH_NAME_INTERN (contextCacheStat)
+#define contextCacheStore           SCOTCH_NAME_INTERN (contextCacheStore)
 #define contextCommit               SCOTCH_NAME_INTERN (contextCommit)
 #define contextExit                 SCOTCH_NAME_INTERN (contextExit)
 #define contextInit                 SCOTCH_NAME_INTERN (contextInit)
 #define contextOptionsInit          SCOTCH_NAME_INTERN (contextOptionsInit)
 #define contextRandomClone          SCOTCH_NAME_INTERN (contextRandomClone)
+#define contextStatBegin            SCOTCH_NAME_INTERN (contextStatBegin)
+#define contextStatEnd              SCOTCH_NAME_INTERN (contextStatEnd)
+#define contextStatExit             SCOTCH_NAME_INTERN (contextStatExit)
+#define contextStatGet              SCOTCH_NAME_INTERN (contextStatGet)
+#define contextStatInit             SCOTCH_NAME_INTERN (contextStatInit)
+#define contextStatNbr              SCOTCH_NAME_INTERN (contextStatNbr)
+#define contextStatReset            SCOTCH_NAME_INTERN (contextStatReset)
+#define contextStatSave             SCOTCH_NAME_INTERN (contextStatSave)
 #define contextThreadInit           SCOTCH_NAME_INTERN (contextThreadInit)
 #define contextThreadInit2          SCOTCH_NAME_INTERN (contextThreadInit2)
 #define contextThreadLaunchSplit    SCOTCH_NAME_INTERN (contextThreadLaunchSplit)
+#define contextThreadLaunchTask     SCOTCH_NAME_INTERN (contextThreadLaunchTask)
 
 #define contextValuesGetDbl         SCOTCH_NAME_INTERN (contextValuesGetDbl)
 #define contextValuesGetInt         SCOTCH_NAME_INTERN (contextValuesGetInt)
@@ -336,7 +353,11 @@
 #define fileCompressType            SCOTCH_NAME_INTERN (fileCompressType)
 #define fileDecompress              SCOTCH_NAME_INTERN (fileDecompress)
 #define fileDecompressType          SCOTCH_NAME_INTERN (fileDecompressType)
+#define fileMap                     SCOTCH_NAME_INTERN (fileMap)
 #define fileNameDistExpand          SCOTCH_NAME_INTERN (fileNameDistExpand)
+#define fileUnmap                   SCOTCH_NAME_INTERN (fileUnmap)
+
+#define hashMem                     SCOTCH_NAME_INTERN (hashMem)
 
 #define intLoad                     SCOTCH_NAME_INTERN (intLoad)
 #define intSave                     SCOTCH_NAME_INTERN (intSave)
@@ -355,6 +376,11 @@
 #define intRandVal                  SCOTCH_NAME_INTERN (intRandVal)
 #define intRandVal2                 SCOTCH_NAME_INTERN (intRandVal2)
 #define intRandVal3                 SCOTCH_NAME_INTERN (intRandVal3)
+#define intRsort1asc1               SCOTCH_NAME_INTERN (intRsort1asc1)
+#define intRsort2asc1               SCOTCH_NAME_INTERN (intRsort2asc1)
+#define intRsort2asc2               SCOTCH_NAME_INTERN (intRsort2asc2)
+#define intRsort3asc1               SCOTCH_NAME_INTERN (intRsort3asc1)
+#define intRsort3asc2               SCOTCH_NAME_INTERN (intRsort3asc2)
 #define intSort1asc1                SCOTCH_NAME_INTERN (intSort1asc1)
 #define intSort2asc1                SCOTCH_NAME_INTERN (intSort2asc1)
 #define intSort2asc2                SCOTCH_NAME_INTERN (intSort2asc2)
@@ -755,8 +781,11 @@
 #define dgraphExit                  SCOTCH_NAME_INTERN (dgraphExit)
 #define dgraphFold                  SCOTCH_NAME_INTERN (dgraphFold)
 #define dgraphFold2                 SCOTCH_NAME_INTERN (dgraphFold2)
+#define dgraphFold3                 SCOTCH_NAME_INTERN (dgraphFold3)
 #define dgraphFoldComm              SCOTCH_NAME_INTERN (dgraphFoldComm)
 #define dgraphFoldDup               SCOTCH_NAME_INTERN (dgraphFoldDup)
+#define dgraphFoldPlanExit          SCOTCH_NAME_INTERN (dgraphFoldPlanExit)
+#define dgraphFoldPlanInit          SCOTCH_NAME_INTERN (dgraphFoldPlanInit)
 #define dgraphFree                  SCOTCH_NAME_INTERN (dgraphFree)
 #define dgraphGather                SCOTCH_NAME_INTERN (dgraphGather)
 #define dgraphGatherAll             SCOTCH_NAME_INTERN (dgraphGatherAll)
@@ -771,6 +800,11 @@
 #define dgraphHaloAsync             SCOTCH_NAME_INTERN (dgraphHaloAsync)
 #define dgraphHaloWait              SCOTCH_NAME_INTERN (dgraphHaloWait)
 #define dgraphHaloCheck             SCOTCH_NAME_INTERN (dgraphHaloCheck)
+#define dgraphHaloFree              SCOTCH_NAME_INTERN (dgraphHaloFree)
+#define dgraphHaloNodeInit          SCOTCH_NAME_INTERN (dgraphHaloNodeInit)
+#define dgraphHaloNodeRecv          SCOTCH_NAME_INTERN (dgraphHaloNodeRecv)
+#define dgraphHaloNodeSend          SCOTCH_NAME_INTERN (dgraphHaloNodeSend)
+#define dgraphHaloVert              SCOTCH_NAME_INTERN (dgraphHaloVert)
 #define dgraphInduceList            SCOTCH_NAME_INTERN (dgraphInduceList)
 #define dgraphInducePart            SCOTCH_NAME_INTERN (dgraphInducePart)
 #define dgraphInducePart2           SCOTCH_NAME_INTERN (dgraphInducePart2)
@@ -848,6 +882,17 @@
 #define gainTablNext                SCOTCH_NAME_INTERN (gainTablNext)
 #define gainTablMove                SCOTCH_NAME_INTERN (gainTablMove)
 
+#define gainBcktAdd                 SCOTCH_NAME_INTERN (gainBcktAdd)
+#define gainBcktCheck               SCOTCH_NAME_INTERN (gainBcktCheck)
+#ifdef SCOTCH_DEBUG_GAIN1                         /* If not already redefined as accelerated macro */
+#define gainBcktDel                 SCOTCH_NAME_INTERN (gainBcktDel)
+#endif /* SCOTCH_DEBUG_GAIN1 */
+#define gainBcktExit                SCOTCH_NAME_INTERN (gainBcktExit)
+#define gainBcktFree                SCOTCH_NAME_INTERN (gainBcktFree)
+#define gainBcktFrst                SCOTCH_NAME_INTERN (gainBcktFrst)
+#define gainBcktInit                SCOTCH_NAME_INTERN (gainBcktInit)
+#define gainBcktNext                SCOTCH_NAME_INTERN (gainBcktNext)
+
 #define geomExit                    SCOTCH_NAME_INTERN (geomExit)
 #define geomInit                    SCOTCH_NAME_INTERN (geomInit)
 
@@ -856,9 +901,19 @@
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadBin                SCOTCH_NAME_INTERN (graphLoadBin)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
+#define graphSaveBin                SCOTCH_NAME_INTERN (graphSaveBin)
+#define graphBinHeadLoad            SCOTCH_NAME_INTERN (graphBinHeadLoad)
+#define graphBinOffs                SCOTCH_NAME_INTERN (graphBinOffs)
+#define graphBinRead                SCOTCH_NAME_INTERN (graphBinRead)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
+#define graphCacheKey               SCOTCH_NAME_INTERN (graphCacheKey)
+#define graphCacheMapGet            SCOTCH_NAME_INTERN (graphCacheMapGet)
+#define graphCacheMapPut            SCOTCH_NAME_INTERN (graphCacheMapPut)
+#define graphCacheOrderGet          SCOTCH_NAME_INTERN (graphCacheOrderGet)
+#define graphCacheOrderPut          SCOTCH_NAME_INTERN (graphCacheOrderPut)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
 #define graphClone                  SCOTCH_NAME_INTERN (graphClone)
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
@@ -1069,6 +1124,9 @@
 #define threadLaunch                SCOTCH_NAME_INTERN (threadLaunch)
 #define threadReduce                SCOTCH_NAME_INTERN (threadReduce)
 #define threadScan                  SCOTCH_NAME_INTERN (threadScan)
+#define threadTaskLaunch            SCOTCH_NAME_INTERN (threadTaskLaunch)
+#define threadTaskSpawn             SCOTCH_NAME_INTERN (threadTaskSpawn)
+#define threadTaskSync              SCOTCH_NAME_INTERN (threadTaskSync)
 
 #define vdgraphseparateststratab    SCOTCH_NAME_INTERN (vdgraphseparateststratab)
 #define vdgraphCheck                SCOTCH_NAME_INTERN (vdgraphCheck)
@@ -1183,6 +1241,9 @@
 #define SCOTCH_contextBindDgraph    SCOTCH_NAME_PUBLIC (SCOTCH_contextBindDgraph)
 #define SCOTCH_contextBindGraph     SCOTCH_NAME_PUBLIC (SCOTCH_contextBindGraph)
 #define SCOTCH_contextBindMesh      SCOTCH_NAME_PUBLIC (SCOTCH_contextBindMesh)
+#define SCOTCH_contextCacheInit     SCOTCH_NAME_PUBLIC (SCOTCH_contextCacheInit)
+#define SCOTCH_contextCacheReset    SCOTCH_NAME_PUBLIC (SCOTCH_contextCacheReset)
+#define SCOTCH_contextCacheStat     SCOTCH_NAME_PUBLIC (SCOTCH_contextCacheStat)
 #define SCOTCH_contextExit          SCOTCH_NAME_PUBLIC (SCOTCH_contextExit)
 #define SCOTCH_contextInit          SCOTCH_NAME_PUBLIC (SCOTCH_contextInit)
 #define SCOTCH_contextOptionGetNum  SCOTCH_NAME_PUBLIC (SCOTCH_contextOptionGetNum)
@@ -1191,6 +1252,11 @@
 #define SCOTCH_contextRandomClone   SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomClone)
 #define SCOTCH_contextRandomReset   SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomReset)
 #define SCOTCH_contextRandomSeed    SCOTCH_NAME_PUBLIC (SCOTCH_contextRandomSeed)
+#define SCOTCH_contextStatGet       SCOTCH_NAME_PUBLIC (SCOTCH_contextStatGet)
+#define SCOTCH_contextStatInit      SCOTCH_NAME_PUBLIC (SCOTCH_contextStatInit)
+#define SCOTCH_contextStatNbr       SCOTCH_NAME_PUBLIC (SCOTCH_contextStatNbr)
+#define SCOTCH_contextStatReset     SCOTCH_NAME_PUBLIC (SCOTCH_contextStatReset)
+#define SCOTCH_contextStatSave      SCOTCH_NAME_PUBLIC (SCOTCH_contextStatSave)
 #define SCOTCH_contextThreadImport1 SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadImport1)
 #define SCOTCH_contextThreadImport2 SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadImport2)
 #define SCOTCH_contextThreadSpawn   SCOTCH_NAME_PUBLIC (SCOTCH_contextThreadSpawn)
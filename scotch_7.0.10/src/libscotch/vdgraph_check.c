@@ -42,7 +42,7 @@
 /**   DATES      : # Version 5.0  : from : 07 feb 2006     **/
 /**                                 to   : 01 mar 2008     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 20 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -225,6 +225,8 @@ const Vdgraph * const       grafptr)
     memFree (grafdat.edgegsttax + grafptr->s.baseval);
   if (grafptr->s.procsidtab != grafdat.procsidtab) /* The same for procsidtab */
     memFree (grafdat.procsidtab);
+  if (grafptr->s.haloptr != grafdat.haloptr)      /* The same for the halo exchange plan */
+    dgraphHaloFree (&grafdat);
   memFree (partgsttax + grafptr->s.baseval);
 
   if ((cheklocval == 0) &&
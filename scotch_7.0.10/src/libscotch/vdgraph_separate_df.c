@@ -43,7 +43,7 @@
 /**   DATES      : # Version 5.1  : from : 05 nov 2007     **/
 /**                                 to   : 09 nov 2008     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -54,6 +54,7 @@
 #include "module.h"
 #include "common.h"
 #include "dgraph.h"
+#include "dgraph_halo.h"
 #include "vdgraph.h"
 #include "vdgraph_separate_df.h"
 
@@ -63,6 +64,77 @@
 
 static const Gnum           vdgraphseparatedfloadone = 1;
 
+/* This routine computes the new diffusion
+** values of the given non-anchor vertices,
+** from the old diffusion values of their
+** neighbors. As vertices are sorted by
+** ascending number, processing stops at
+** the first anchor vertex, if any.
+** It returns:
+** - 0   : if no overflow occured.
+** - !0  : on overflow.
+*/
+
+static
+int
+vdgraphSeparateDfVert (
+const Vdgraph * restrict const  grafptr,          /*+ Distributed graph                   +*/
+const Gnum * restrict const     vertsrttab,       /*+ Array of vertices to process        +*/
+const Gnum                      vertsrtnbr,       /*+ Number of vertices in array         +*/
+const Gnum                      vanclocnnd,       /*+ Number of first local anchor vertex +*/
+const float * restrict const    ielsloctax,       /*+ Inverse of degree array             +*/
+const float * restrict const    difogsttax,       /*+ Old diffusion value array           +*/
+float * restrict const          difngsttax,       /*+ New diffusion value array           +*/
+const float                     cdifval,          /*+ Coefficient of diffused load        +*/
+const float                     cremval)          /*+ Coefficient of remaining load       +*/
+{
+  Gnum                vertsrtnum;
+  float               veloval;
+
+  const Gnum * restrict const vertloctax = grafptr->s.vertloctax;
+  const Gnum * restrict const vendloctax = grafptr->s.vendloctax;
+  const Gnum * restrict const veloloctax = grafptr->s.veloloctax;
+  const Gnum * restrict const edgegsttax = grafptr->s.edgegsttax;
+
+  veloval = 1.0F;                                 /* Assume no vertex loads */
+  for (vertsrtnum = 0; vertsrtnum < vertsrtnbr; vertsrtnum ++) {
+    Gnum                vertlocnum;
+    Gnum                edgelocnum;
+    Gnum                edgelocnnd;
+    float               diffval;
+
+    vertlocnum = vertsrttab[vertsrtnum];
+    if (vertlocnum >= vanclocnnd)                 /* Anchor vertices are processed separately */
+      break;
+
+    diffval = 0.0F;
+    for (edgelocnum = vertloctax[vertlocnum], edgelocnnd = vendloctax[vertlocnum];
+         edgelocnum < edgelocnnd; edgelocnum ++)
+      diffval += difogsttax[edgegsttax[edgelocnum]];
+
+    diffval *= cdifval;
+    diffval += (difogsttax[vertlocnum] * cremval) / ielsloctax[vertlocnum];
+
+    if (veloloctax != NULL)
+      veloval = (float) veloloctax[vertlocnum];
+    if (diffval >= 0.0F) {
+      diffval = (diffval - veloval) * ielsloctax[vertlocnum];
+      if (diffval <= 0.0F)
+        diffval = +VDGRAPHSEPARATEDFEPSILON;
+    }
+    else {
+      diffval = (diffval + veloval) * ielsloctax[vertlocnum];
+      if (diffval >= 0.0F)
+        diffval = -VDGRAPHSEPARATEDFEPSILON;
+    }
+    if (isnan (diffval))                          /* If overflow occured */
+      return (1);
+    difngsttax[vertlocnum] = diffval;
+  }
+
+  return (0);
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -86,6 +158,8 @@ const VdgraphSeparateDfParam * const  paraptr)    /*+ Method parameters +*/
   float * restrict                difogsttax;     /* Old diffusion value array */
   float * restrict                difngsttax;     /* New diffusion value array */
   const Gnum * restrict           edgegsttax;
+  const Gnum * restrict           vertsrttab;     /* Interior vertices first   */
+  Gnum                            vintlocnbr;     /* Number of inner vertices  */
   Gnum                            fronlocnum;
   float                           compglbavg;
   Gnum                            complocload1;
@@ -120,7 +194,12 @@ const VdgraphSeparateDfParam * const  paraptr)    /*+ Method parameters +*/
     reduloctab[3] = grafptr->s.veloloctax[grafptr->s.vertlocnnd - 1];
   }
 
-  if (memAllocGroup ((void **) (void *)
+  if ((vertsrttab = dgraphHaloVert (&grafptr->s, &vintlocnbr)) == NULL) { /* Split local vertices to overlap halo exchanges */
+    errorPrint ("vdgraphSeparateDf: cannot compute vertex split");
+    reduloctab[0] = -1;
+    ielsloctax    = NULL;
+  }
+  else if (memAllocGroup ((void **) (void *)
                      &ielsloctax, (size_t) (grafptr->s.vertlocnbr * sizeof (float)),
                      &difogsttax, (size_t) (grafptr->s.vertgstnbr * sizeof (float)),
                      &difngsttax, (size_t) (grafptr->s.vertgstnbr * sizeof (float)), NULL) == NULL) {
@@ -184,55 +263,33 @@ const VdgraphSeparateDfParam * const  paraptr)    /*+ Method parameters +*/
   difngsttax[vanclocnnd]     =                    /* In case of isolated anchors, do not risk overflow because of NaN */
   difngsttax[vanclocnnd + 1] = 0.0F;
 
-  if (dgraphHaloSync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT) != 0) { /* Perform initial diffusion (and build communication structures) */
-    errorPrint ("vdgraphSeparateDf: cannot propagate diffusion data (1)");
-    memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
-    return     (1);
-  }
-
   ovflval    = 0;
   cdifval    = (float) paraptr->cdifval;
   cremval    = (float) paraptr->cremval;
   edgegsttax = grafptr->s.edgegsttax;
-  for (passnum = 0; ; ) {                         /* For all passes         */
+  for (passnum = 0; ; ) {                         /* For all passes */
+    DgraphHaloRequest   requdat;
+
+    dgraphHaloAsync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT, &requdat); /* Perform diffusion of ghost values */
+    if ((ovflval == 0) &&                         /* Process interior vertices while exchange is in flight */
+        (vdgraphSeparateDfVert (grafptr, vertsrttab, vintlocnbr, vanclocnnd, ielsloctax, difogsttax, difngsttax, cdifval, cremval) != 0))
+      ovflval = 1;                                /* We are in state of overflow; arrays will not be swapped */
+    if (dgraphHaloWait (&requdat) != 0) {
+      errorPrint ("vdgraphSeparateDf: cannot propagate diffusion data");
+      memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
+      return     (1);
+    }
+
     if (ovflval == 0) {                           /* If no overflow occured */
       Gnum                vertlocnum;
       float *             diftgsttax;             /* Temporary swap value */
-      float               veloval;
-
-      veloval = 1.0F;                             /* Assume no vertex loads */
-      for (vertlocnum = grafptr->s.baseval; vertlocnum < vanclocnnd; vertlocnum ++) {
-        Gnum                edgelocnum;
-        Gnum                edgelocnnd;
-        float               diffval;
-
-        diffval = 0.0F;
-        for (edgelocnum = grafptr->s.vertloctax[vertlocnum], edgelocnnd = grafptr->s.vendloctax[vertlocnum];
-             edgelocnum < edgelocnnd; edgelocnum ++)
-          diffval += difogsttax[edgegsttax[edgelocnum]];
-
-        diffval *= cdifval;
-        diffval += (difogsttax[vertlocnum] * cremval) / ielsloctax[vertlocnum];
 
-        if (grafptr->s.veloloctax != NULL)
-          veloval = (float) grafptr->s.veloloctax[vertlocnum];
-        if (diffval >= 0.0F) {
-          diffval = (diffval - veloval) * ielsloctax[vertlocnum];
-          if (diffval <= 0.0F)
-            diffval = +VDGRAPHSEPARATEDFEPSILON;
-        }
-        else {
-          diffval = (diffval + veloval) * ielsloctax[vertlocnum];
-          if (diffval >= 0.0F)
-            diffval = -VDGRAPHSEPARATEDFEPSILON;
-        }
-        if (isnan (diffval)) {                    /* If overflow occured                    */
-          ovflval = 1;                            /* We are in state of overflow            */
-          goto abort;                             /* Exit this loop without swapping arrays */
-        }
-        difngsttax[vertlocnum] = diffval;
+      if (vdgraphSeparateDfVert (grafptr, vertsrttab + vintlocnbr, grafptr->s.vertlocnbr - vintlocnbr, vanclocnnd, /* Process boundary vertices */
+                                 ielsloctax, difogsttax, difngsttax, cdifval, cremval) != 0) {
+        ovflval = 1;                              /* We are in state of overflow            */
+        goto abort;                               /* Exit this loop without swapping arrays */
       }
-      for ( ; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) { /* For the two local anchor vertices */
+      for (vertlocnum = vanclocnnd; vertlocnum < grafptr->s.vertlocnnd; vertlocnum ++) { /* For the two local anchor vertices */
         Gnum                edgelocnum;
         Gnum                edgelocnnd;
         float               diffval;
@@ -272,12 +329,6 @@ const VdgraphSeparateDfParam * const  paraptr)    /*+ Method parameters +*/
 abort :                                           /* If overflow occured, resume here    */
     if (++ passnum >= paraptr->passnbr)           /* If maximum number of passes reached */
       break;                                      /* Exit main loop                      */
-
-    if (dgraphHaloSync (&grafptr->s, (byte *) (void *) (difogsttax + grafptr->s.baseval), MPI_FLOAT) != 0) {
-      errorPrint ("vdgraphSeparateDf: cannot propagate diffusion data (2)");
-      memFree    (ielsloctax + grafptr->s.baseval); /* Free group leader */
-      return     (1);
-    }
   }
 
   for (vertlocnum = grafptr->s.baseval; vertlocnum < vanclocnnd; vertlocnum ++) /* Pre-set parts without separator */
@@ -1,4 +1,4 @@
-/* Copyright 2007-2010,2012,2014,2019,2020,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2010,2012,2014,2019,2020,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 11 sep 2012     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 14 aug 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -543,7 +543,7 @@ const DgraphCoarsenMulti * restrict const coarmulttax) /*+ Based multinode array
     finegrafptr->complocsize[1] = finecomplocsize1;
     finegrafptr->complocsize[2] = finecomplocsize2;
 
-    intSort2asc1 ((void *) vsnddattab, vsnddatnbr >> 1); /* Sort vertices to send by ascending global numbers */
+    intRsort2asc1 ((void *) vsnddattab, vsnddatnbr >> 1, finegrafptr->contptr); /* Sort vertices to send by ascending global numbers */
 
     finevertsndnbr1 =
     finevertsndnbr2 = 0;
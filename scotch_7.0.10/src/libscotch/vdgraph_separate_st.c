@@ -1,4 +1,4 @@
-/* Copyright 2007-2009,2014,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2009,2014,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 01 may 2014     **/
 /**                                 to   : 30 sep 2014     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -237,6 +237,7 @@ const Strat * restrict const  straptr)            /*+ Separation strategy
   StratTest           testdat;
   VdgraphStore        savetab[2];                 /* Results of the two strategies */
   Gnum                compglbload2;               /* Saved global separator load   */
+  StatMark            markdat;                    /* Mark of recorded method call   */
   int                 o;
 #ifdef SCOTCH_DEBUG_VDGRAPH2
   MPI_Comm            proccommold;                /* Save area for old communicator */
@@ -326,8 +327,13 @@ const Strat * restrict const  straptr)            /*+ Separation strategy
       proccommold = grafptr->s.proccomm;          /* Create new communicator to isolate method communications */
       MPI_Comm_dup (proccommold, &grafptr->s.proccomm);
 #endif /* SCOTCH_DEBUG_VDGRAPH2 */
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "vdgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertglbnbr, grafptr->s.edgeglbnbr, (double) grafptr->compglbload[2], fabs ((double) grafptr->compglbloaddlt));
       o = ((VdgraphSeparateFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
           (grafptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->compglbload[2], fabs ((double) grafptr->compglbloaddlt), o);
 #ifdef SCOTCH_DEBUG_VDGRAPH2
       MPI_Comm_free (&grafptr->s.proccomm);       /* Restore old communicator */
       grafptr->s.proccomm = proccommold;
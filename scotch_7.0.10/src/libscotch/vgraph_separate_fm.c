@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 27 nov 2021     **/
 /**                                 to   : 01 dec 2021     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 09 aug 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,6 +69,7 @@
 #include "module.h"
 #include "common.h"
 #include "gain.h"
+#include "gain_bckt.h"
 #include "graph.h"
 #include "vgraph.h"
 #include "vgraph_separate_gg.h"
@@ -95,8 +96,9 @@ static VgraphSeparateFmVertex vexxdat;            /* Dummy structure for computi
 
 static
 GainLink *
-vgraphSeparateFmTablGet (
-GainTabl * const            tablptr,              /* Gain table        */
+vgraphSeparateFmTablGetGain (
+VgraphSeparateFmTabl * const    tablptr,          /* Gain table        */
+VgraphSeparateFmVertex * const  hashtab,          /* Hash vertex table */
 const Gnum *                dwgttab,              /* Domain weights    */
 const Gnum                  deltcur,              /* Current imbalance */
 const Gnum                  deltmax,              /* Maximum imbalance */
@@ -110,12 +112,12 @@ const int                   partval)              /* Current preferred */
   Gnum                            gainbest;       /* Separator gain of best link       */
 
   linkbest = NULL;                                /* Assume no candidate vertex found yet */
-  tablbest = tablptr->tend;
+  tablbest = tablptr->tabldat->tend;
   gainbest = GAINMAX;
 
-  for (linkptr = gainTablFrst (tablptr);          /* Select candidate vertices */
+  for (linkptr = gainTablFrst (tablptr->tabldat); /* Select candidate vertices */
        (linkptr != NULL) && (linkptr->tabl <= tablbest);
-       linkptr = gainTablNext (tablptr, linkptr)) {
+       linkptr = gainTablNext (tablptr->tabldat, linkptr)) {
     int                       vertpart;           /* Part of current vertex */
 
     vertpart = 0;                                 /* Assume we point to gainlink0      */
@@ -143,6 +145,72 @@ const int                   partval)              /* Current preferred */
   return ((GainLink *) linkbest);                 /* Return best link found */
 }
 
+/* This routine returns the vertex of best gain
+** whose swap will keep the balance correct,
+** when gains are kept in a bucket array. Since
+** large gains may share the same bucket, the
+** whole bucket holding the best link is scanned.
+** It returns:
+** - !NULL  : pointer to the vertex gainlink.
+** - NULL   : if no more vertices available.
+*/
+
+static
+GainLink *
+vgraphSeparateFmTablGetBckt (
+VgraphSeparateFmTabl * const    tablptr,          /* Gain table        */
+VgraphSeparateFmVertex * const  hashtab,          /* Hash vertex table */
+const Gnum *                dwgttab,              /* Domain weights    */
+const Gnum                  deltcur,              /* Current imbalance */
+const Gnum                  deltmax,              /* Maximum imbalance */
+const int                   partval)              /* Current preferred */
+{
+  GainBckt *                      bcktptr;
+  const GainBcktLink *            linktab;        /* Array of bucket links             */
+  VgraphSeparateFmVertex *        vexxbest;       /* Pointer to vertex of best link    */
+  INT                             linknum;        /* Index of current bucket link      */
+  INT                             bcktbest;       /* Key of bucket holding best link   */
+  Gnum                            gaincur;        /* Separator gain of current link    */
+  Gnum                            gainbest;       /* Separator gain of best link       */
+  int                             partbest;       /* Part of best link                 */
+
+  bcktptr  = &tablptr->bcktdat;
+  linktab  = (const GainBcktLink *) bcktptr->elemtab;
+  vexxbest = NULL;                                /* Assume no candidate vertex found yet */
+  bcktbest = GAINMAX;
+  gainbest = GAINMAX;
+  partbest = 0;
+
+  for (linknum = gainBcktFrst (bcktptr);          /* Select candidate vertices */
+       (linknum != GAINBCKTNONE) && (linktab[linknum].keyval <= bcktbest);
+       linknum = gainBcktNext (bcktptr, linknum)) {
+    VgraphSeparateFmVertex *  vexxptr;            /* Pointer to vertex of current link */
+    int                       vertpart;           /* Part of current vertex            */
+
+    vexxptr  = hashtab + (linknum >> 1);          /* Two links per hash vertex */
+    vertpart = linknum & 1;
+    gaincur  = vexxptr->compgain[vertpart];       /* Get separator gain and vertex balance */
+
+    if (gaincur == vexxptr->veloval)              /* If vertex is isolated separator vertex */
+      return ((vertpart == 0) ? &vexxptr->gainlink0 : &vexxptr->gainlink1); /* Select it immediatly */
+
+    if (abs (deltcur + (1 - 2 * vertpart) * (gaincur * dwgttab[vertpart] - vexxptr->veloval * (dwgttab[0] + dwgttab[1]))) <= deltmax)  { /* If vertex enforces balance; TRICK: -veloval */
+      if ((gaincur < gainbest) ||                 /* And if it gives better gain */
+          ((gaincur == gainbest) &&               /* Or is in preferred part     */
+           (partval == vertpart))) {
+        vexxbest = vexxptr;                       /* Select it */
+        partbest = vertpart;
+        bcktbest = linktab[linknum].keyval;
+        gainbest = gaincur;
+      }
+    }
+  }
+
+  if (vexxbest == NULL)
+    return (NULL);
+  return ((partbest == 0) ? &vexxbest->gainlink0 : &vexxbest->gainlink1); /* Return best link found */
+}
+
 /*****************************/
 /*                           */
 /* This is the main routine. */
@@ -154,7 +222,9 @@ vgraphSeparateFm (
 Vgraph * restrict const             grafptr,      /*+ Active graph      +*/
 const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
 {
-  GainTabl * restrict             tablptr;        /* Pointer to gain tables                  */
+  VgraphSeparateFmTabl            tabldat;        /* Gain table                              */
+  VgraphSeparateFmTabl * restrict tablptr;        /* Pointer to gain table                   */
+  GainBcktLink *                  linktab;        /* Array of bucket links, if any           */
   INT                             passnbr;        /* Maximum number of passes to go          */
   Gnum                            movenbr;        /* Number of uneffective moves done        */
   int                             moveflag;       /* Flag set if useful moves made           */
@@ -215,15 +285,17 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;                         /* Use hash table at 1/4 of its capacity */
 
-  if (((tablptr = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS)) == NULL) || /* Use logarithmic array only */
+  tablptr = &tabldat;
+  if ((vgraphSeparateFmTablInit (tablptr, paraptr->tablval) != 0) || /* Use logarithmic array only */
       (memAllocGroup ((void **) (void *)
                       &hashtab, (size_t) (hashsiz * sizeof (VgraphSeparateFmVertex)),
-                      &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)), NULL) == NULL)) {
+                      &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)),
+                      &linktab, (size_t) (vgraphSeparateFmIsBckt (tablptr) ? (2 * hashsiz * sizeof (GainBcktLink)) : 0), NULL) == NULL)) {
     errorPrint ("vgraphSeparateFm: out of memory (1)");
-    if (tablptr != NULL)
-      gainTablExit (tablptr);
+    vgraphSeparateFmTablExit (tablptr);
     return (1);
   }
+  vgraphSeparateFmTablBase (tablptr, linktab);
   memSet (hashtab, ~0, hashsiz * sizeof (VgraphSeparateFmVertex)); /* Set all vertex numbers to ~0 */
 
   for (fronnum = 0, hashnbr = grafptr->fronnbr;   /* Set initial gains */
@@ -288,8 +360,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
     hashtab[hashnum].partval = 2;
     hashtab[hashnum].vertnum = vertnum;
 
-    gainTablAdd (tablptr, &hashtab[hashnum].gainlink0, hashtab[hashnum].compgain[0]); /* Link both directions of separator vertex */
-    gainTablAdd (tablptr, &hashtab[hashnum].gainlink1, hashtab[hashnum].compgain[1]);
+    vgraphSeparateFmTablAdd (tablptr, hashtab, &hashtab[hashnum]); /* Link both directions of separator vertex */
   }
 
   comploaddltmax = MAX (comploaddltmat, abs (grafptr->comploaddlt)); /* Set current maximum distance */
@@ -322,13 +393,11 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
       hashtab[hashnum].compgain[1] = savetab[savenbr].compgain[1];
 
       if (hashtab[hashnum].gainlink0.next >= VGRAPHSEPAFMSTATELINK) { /* If vertex is linked */
-        gainTablDel (tablptr, &hashtab[hashnum].gainlink0); /* Unlink it                     */
-        gainTablDel (tablptr, &hashtab[hashnum].gainlink1);
+        vgraphSeparateFmTablDel (tablptr, hashtab, &hashtab[hashnum]); /* Unlink it */
         hashtab[hashnum].gainlink0.next = VGRAPHSEPAFMSTATEFREE; /* Set it as free */
       }
       if ((hashtab[hashnum].gainlink0.next == VGRAPHSEPAFMSTATEFREE) && (partval == 2)) { /* If vertex not locked and in separator */
-        gainTablAdd (tablptr, &hashtab[hashnum].gainlink0, hashtab[hashnum].compgain[0]); /* Re-link it                            */
-        gainTablAdd (tablptr, &hashtab[hashnum].gainlink1, hashtab[hashnum].compgain[1]);
+        vgraphSeparateFmTablAdd (tablptr, hashtab, &hashtab[hashnum]); /* Re-link it */
       }
     }
     compload2   = compload2bst;                   /* Restore best separator parameters */
@@ -359,8 +428,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
           return (1);
         }
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
-        gainTablAdd (tablptr, &vexxptr->gainlink0, vexxptr->compgain[0]); /* Link it */
-        gainTablAdd (tablptr, &vexxptr->gainlink1, vexxptr->compgain[1]);
+        vgraphSeparateFmTablAdd (tablptr, hashtab, vexxptr); /* Link it */
       }
       else                                        /* Vertex does not belong to separator */
         vexxptr->gainlink0.next = VGRAPHSEPAFMSTATEFREE; /* Set it as free for this run  */
@@ -371,7 +439,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
     movenbr  =                                    /* No uneffective moves yet                  */
     savenbr  = 0;                                 /* No recorded moves yet                     */
     while ((movenbr < paraptr->movenbr) &&        /* As long as we can find effective vertices */
-           ((vexxptr = (VgraphSeparateFmVertex *) vgraphSeparateFmTablGet (tablptr, grafptr->dwgttab, comploaddlt, comploaddltmax, (passnbr & 1))) != NULL)) {
+           ((vexxptr = (VgraphSeparateFmVertex *) vgraphSeparateFmTablGet (tablptr, hashtab, grafptr->dwgttab, comploaddlt, comploaddltmax, (passnbr & 1))) != NULL)) {
       Gnum                comploadabsdlt;
       int                 partval;                /* Part of current vertex */
       Gnum                vertnum;
@@ -388,8 +456,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
         return (1);
       }
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
-      gainTablDel (tablptr, &vexxptr->gainlink0); /* Remove it from table */
-      gainTablDel (tablptr, &vexxptr->gainlink1);
+      vgraphSeparateFmTablDel (tablptr, hashtab, vexxptr); /* Remove it from table */
       vexxptr->gainlink0.next = VGRAPHSEPAFMSTATESUCH; /* Mark it as used and avoid chaining */
       vexxptr->gainlink1.prev = &lockdat;         /* Lock it                                 */
       vexxptr->gainlink1.next = lockdat.next;
@@ -455,8 +522,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
               }
               vexxend->compgain[1 - partval] -= vexxptr->veloval; /* TRICK: -veloval                              */
               if (vexxend->gainlink0.next >= VGRAPHSEPAFMSTATELINK) { /* If vertex is linked                      */
-                gainTablDel (tablptr, &vexxend->gainlink0); /* Unlink it temporarily                              */
-                gainTablDel (tablptr, &vexxend->gainlink1); /* TRICK: gainlink1.next != NULL                      */
+                vgraphSeparateFmTablDel (tablptr, hashtab, vexxend); /* Unlink it temporarily */
                 vexxend->gainlink0.next = VGRAPHSEPAFMSTATEFREE; /* Mark separator vertex as temporarily unlinked */
                 vexxend->gainlink0.prev = (GainLink *) sepaptr; /* Chain it for relinking                         */
                 sepaptr                 = vexxend;
@@ -523,8 +589,7 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
 
                       vexxent->compgain[partval] += vexxend->veloval; /* TRICK: -veloval                                  */
                       if (vexxent->gainlink0.next >= VGRAPHSEPAFMSTATELINK) { /* If not already chained                   */
-                        gainTablDel (tablptr, &vexxent->gainlink0); /* Unlink it temporarily                              */
-                        gainTablDel (tablptr, &vexxent->gainlink1); /* TRICK: gainlink1.next != NULL                      */
+                        vgraphSeparateFmTablDel (tablptr, hashtab, vexxent); /* Unlink it temporarily */
                         vexxent->gainlink0.next = VGRAPHSEPAFMSTATEFREE; /* Mark separator vertex as temporarily unlinked */
                         vexxent->gainlink0.prev = (GainLink *) sepaptr; /* Chain it                                       */
                         sepaptr                 = vexxent;
@@ -564,16 +629,14 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
 
         if (vexxptr->gainlink0.next == VGRAPHSEPAFMSTATEFREE) { /* If vertex is not used */
-          gainTablAdd (tablptr, &vexxptr->gainlink0, vexxptr->compgain[0]); /* Link it   */
-          gainTablAdd (tablptr, &vexxptr->gainlink1, vexxptr->compgain[1]);
+          vgraphSeparateFmTablAdd (tablptr, hashtab, vexxptr); /* Link it */
         }
         else {
           vexxptr->gainlink0.next = VGRAPHSEPAFMSTATEUSED;
           if (vexxptr->compgain[partval] == vexxptr->veloval) { /* If immediate gain                 */
             vexxptr->gainlink1.next->prev = vexxptr->gainlink1.prev; /* Remove vertex from lock list */
             vexxptr->gainlink1.prev->next = vexxptr->gainlink1.next;
-            gainTablAdd (tablptr, &vexxptr->gainlink0, vexxptr->compgain[0]); /* Link it */
-            gainTablAdd (tablptr, &vexxptr->gainlink1, vexxptr->compgain[1]);
+            vgraphSeparateFmTablAdd (tablptr, hashtab, vexxptr); /* Link it */
           }
         }
       }
@@ -639,6 +702,13 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   } while ((moveflag != 0) &&                     /* As long as vertices are moved                          */
            (-- passnbr != 0));                    /* And we are allowed to loop (TRICK for negative values) */
 
+  if (vgraphSeparateFmTablFail (tablptr)) {       /* If bucket array could not be enlarged */
+    errorPrint ("vgraphSeparateFm: out of memory (3)");
+    memFree (hashtab);                            /* Free group leader */
+    vgraphSeparateFmTablExit (tablptr);
+    return (1);
+  }
+
   while (savenbr -- > 0) {                        /* Delete exceeding moves */
     Gnum                hashnum;
     int                 partval;
@@ -686,8 +756,8 @@ const VgraphSeparateFmParam * const paraptr)      /*+ Method parameters +*/
   }
 #endif /* SCOTCH_DEBUG_VGRAPH2 */
 
-  memFree      (hashtab);                         /* Free group leader */
-  gainTablExit (tablptr);
+  memFree (hashtab);                              /* Free group leader */
+  vgraphSeparateFmTablExit (tablptr);
 
   return (0);
 }
@@ -708,12 +778,13 @@ Gnum * const                        hashmaxptr,   /*+ Pointer to maximum number
 Gnum * const                        hashmskptr,   /*+ Pointer to hash table mask                     +*/
 VgraphSeparateFmSave * restrict *   savetabptr,   /*+ Pointer to move array                          +*/
 const Gnum                          savenbr,      /*+ Current number of active slots in move array   +*/
-GainTabl * const                    tablptr,      /*+ Gain table                                     +*/
+VgraphSeparateFmTabl * const        tablptr,      /*+ Gain table                                     +*/
 GainLink * const                    lockptr)
 {
   VgraphSeparateFmVertex * restrict hashtab;      /* Pointer to new hash table                    */
   VgraphSeparateFmSave *            savetab;      /* Pointer to new save array                    */
   VgraphSeparateFmSave *            saveold;      /* Pointer to translated old save array         */
+  GainBcktLink *                    linktab;      /* Pointer to new bucket link array             */
   Gnum                              savenum;
   Gnum                              hashold;      /* Size of old hash table (half of new)         */
   Gnum                              hashsiz;
@@ -730,7 +801,8 @@ GainLink * const                    lockptr)
 
   if (memReallocGroup ((void *) *hashtabptr,
                        &hashtab, (size_t) (hashsiz * sizeof (VgraphSeparateFmVertex)),
-                       &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)), NULL) == NULL) {
+                       &savetab, (size_t) (hashsiz * sizeof (VgraphSeparateFmSave)),
+                       &linktab, (size_t) (vgraphSeparateFmIsBckt (tablptr) ? (2 * hashsiz * sizeof (GainBcktLink)) : 0), NULL) == NULL) {
     errorPrint ("vgraphSeparateFmResize: out of memory");
     return (1);
   }
@@ -750,7 +822,8 @@ GainLink * const                    lockptr)
 
   memSet (hashtab + hashold, ~0, hashold * sizeof (VgraphSeparateFmVertex));
 
-  gainTablFree (tablptr);                         /* Reset gain table  */
+  vgraphSeparateFmTablBase (tablptr, linktab);    /* Set new bucket link array */
+  vgraphSeparateFmTablFree (tablptr);             /* Reset gain table          */
   lockptr->next =                                 /* Rebuild lock list */
   lockptr->prev = lockptr;
 
@@ -783,8 +856,7 @@ GainLink * const                    lockptr)
         }
 
         if (hashtab[hashnew].gainlink0.next >= VGRAPHSEPAFMSTATELINK) { /* If vertex was linked, re-link it */
-          gainTablAdd (tablptr, &hashtab[hashnew].gainlink0, hashtab[hashnew].compgain[0]);
-          gainTablAdd (tablptr, &hashtab[hashnew].gainlink1, hashtab[hashnew].compgain[1]);
+          vgraphSeparateFmTablAdd (tablptr, hashtab, &hashtab[hashnew]);
         }
         else if (hashtab[hashnew].gainlink0.next == VGRAPHSEPAFMSTATEUSED) { /* Re-lock used vertices */
           hashtab[hashnew].gainlink1.prev = lockptr; /* Lock it */
@@ -49,6 +49,8 @@
 /**                                 to   : 30 apr 2018     **/
 /**                # Version 6.1  : from : 01 dec 2021     **/
 /**                                 to   : 01 dec 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,20 +71,42 @@
 #define VGRAPHSEPAFMSTATEFREE       ((GainLink *) 0) /*+ Vertex is free or separator-chained  +*/
 #define VGRAPHSEPAFMSTATESUCH       ((GainLink *) 1) /*+ Separator vertex is used and chained +*/
 #define VGRAPHSEPAFMSTATEUSED       ((GainLink *) 2) /*+ Vertex already swapped once          +*/
-#define VGRAPHSEPAFMSTATELINK       ((GainLink *) 3) /*+ Currently in gain table if higher    +*/
+#define VGRAPHSEPAFMSTATELINK       ((GainLink *) 3) /*+ Currently in gain table if not lower +*/
 
 /*
 **  The type and structure definitions.
 */
 
+/*+ Gain structure type. +*/
+
+typedef enum VgraphSeparateFmGain_ {
+  VGRAPHSEPAFMGAINTABL,                           /*+ Gain table   +*/
+  VGRAPHSEPAFMGAINBCKT                            /*+ Bucket array +*/
+} VgraphSeparateFmGain;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct VgraphSeparateFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1 : infinite)     +*/
   double                    deltrat;              /*+ Maximum weight imbalance ratio                       +*/
+  VgraphSeparateFmGain      tablval;              /*+ Type of gain structure                               +*/
 } VgraphSeparateFmParam;
 
+/*+ The gain structure, which is either a gain
+    table or a bucket array. Since the gain links
+    of hash vertices also hold their state and
+    chainings, bucket array links are kept in a
+    separate array, two per hash slot, such that
+    link (2 * hashnum + partval) holds the move
+    of vertex hashnum to part partval.            +*/
+
+typedef struct VgraphSeparateFmTabl_ {
+  VgraphSeparateFmGain      typeval;              /*+ Type of gain structure in use +*/
+  GainTabl *                tabldat;              /*+ Gain table                    +*/
+  GainBckt                  bcktdat;              /*+ Bucket array                  +*/
+} VgraphSeparateFmTabl;
+
 /*+ The hash vertex structure. For trick reasons,
     one of the gain table data structures is followed
     by a negative integer, and the other by a positive
@@ -125,8 +149,9 @@ typedef struct VgraphSeparateFmSave_ {
 
 #ifdef SCOTCH_VGRAPH_SEPARATE_FM
 
-static int                  vgraphSeparateFmResize (VgraphSeparateFmVertex * restrict * hashtabptr, Gnum * const, Gnum * const, VgraphSeparateFmSave * restrict *, const Gnum, GainTabl * const, GainLink * const);
-static GainLink *           vgraphSeparateFmTablGet (GainTabl * const, const Gnum * const, const Gnum, const Gnum, const int);
+static int                  vgraphSeparateFmResize (VgraphSeparateFmVertex * restrict * hashtabptr, Gnum * const, Gnum * const, VgraphSeparateFmSave * restrict *, const Gnum, VgraphSeparateFmTabl * const, GainLink * const);
+static GainLink *           vgraphSeparateFmTablGetGain (VgraphSeparateFmTabl * const, VgraphSeparateFmVertex * const, const Gnum * const, const Gnum, const Gnum, const int);
+static GainLink *           vgraphSeparateFmTablGetBckt (VgraphSeparateFmTabl * const, VgraphSeparateFmVertex * const, const Gnum * const, const Gnum, const Gnum, const int);
 #ifdef SCOTCH_DEBUG_VGRAPH3
 static int                  vgraphSeparateFmCheck (const Vgraph * const, const VgraphSeparateFmVertex * restrict const, const Gnum, const Gnum, const Gnum);
 #endif /* SCOTCH_DEBUG_VGRAPH3 */
@@ -134,3 +159,58 @@ static int                  vgraphSeparateFmCheck (const Vgraph * const, const V
 #endif /* SCOTCH_VGRAPH_SEPARATE_FM */
 
 int                         vgraphSeparateFm    (Vgraph * const, const VgraphSeparateFmParam * const);
+
+/*
+**  The macro definitions.
+*/
+
+/*+ Service routines, for the type of
+    gain structure selected at run time.
+    Both moves of a hash vertex are
+    always linked and unlinked together.
+    When linked in the bucket array, the
+    vertex is flagged as such in its own
+    gain link.                            +*/
+
+#define vgraphSeparateFmIsBckt(t)   ((t)->typeval == VGRAPHSEPAFMGAINBCKT)
+#define vgraphSeparateFmBcktNum(h,v) ((INT) (2 * ((v) - (h))))
+#define vgraphSeparateFmTablInit(t,g) ((((t)->typeval = (g)) == VGRAPHSEPAFMGAINBCKT) ? gainBcktInit (&(t)->bcktdat, NULL, sizeof (GainBcktLink)) : (((t)->tabldat = gainTablInit (GAINMAX, VGRAPHSEPAFMGAINBITS)) == NULL))
+#define vgraphSeparateFmTablExit(t) do {                              \
+                                      if (vgraphSeparateFmIsBckt (t)) \
+                                        gainBcktExit (&(t)->bcktdat); \
+                                      else if ((t)->tabldat != NULL)  \
+                                        gainTablExit ((t)->tabldat);  \
+                                    } while (0)
+#define vgraphSeparateFmTablBase(t,l) do {                                 \
+                                      if (vgraphSeparateFmIsBckt (t))      \
+                                        gainBcktBase (&(t)->bcktdat, (l)); \
+                                    } while (0)
+#define vgraphSeparateFmTablFree(t) do {                              \
+                                      if (vgraphSeparateFmIsBckt (t)) \
+                                        gainBcktFree (&(t)->bcktdat); \
+                                      else                            \
+                                        gainTablFree ((t)->tabldat);  \
+                                    } while (0)
+#define vgraphSeparateFmTablAdd(t,h,v) do {                                                                                          \
+                                      if (vgraphSeparateFmIsBckt (t)) {                                                              \
+                                        gainBcktAdd (&(t)->bcktdat, vgraphSeparateFmBcktNum ((h), (v)),     (INT) (v)->compgain[0]); \
+                                        gainBcktAdd (&(t)->bcktdat, vgraphSeparateFmBcktNum ((h), (v)) + 1, (INT) (v)->compgain[1]); \
+                                        (v)->gainlink0.next = VGRAPHSEPAFMSTATELINK;                                                 \
+                                      }                                                                                              \
+                                      else {                                                                                         \
+                                        gainTablAdd ((t)->tabldat, &(v)->gainlink0, (v)->compgain[0]);                               \
+                                        gainTablAdd ((t)->tabldat, &(v)->gainlink1, (v)->compgain[1]);                               \
+                                      }                                                                                              \
+                                    } while (0)
+#define vgraphSeparateFmTablDel(t,h,v) do {                                                                                                \
+                                      if (vgraphSeparateFmIsBckt (t)) {                                                                    \
+                                        gainBcktDel (&(t)->bcktdat, gainBcktLink (&(t)->bcktdat, vgraphSeparateFmBcktNum ((h), (v))));     \
+                                        gainBcktDel (&(t)->bcktdat, gainBcktLink (&(t)->bcktdat, vgraphSeparateFmBcktNum ((h), (v)) + 1)); \
+                                      }                                                                                                    \
+                                      else {                                                                                               \
+                                        gainTablDel ((t)->tabldat, &(v)->gainlink0);                                                       \
+                                        gainTablDel ((t)->tabldat, &(v)->gainlink1);                                                       \
+                                      }                                                                                                    \
+                                    } while (0)
+#define vgraphSeparateFmTablGet(t,h,w,d,m,p) (vgraphSeparateFmIsBckt (t) ? vgraphSeparateFmTablGetBckt ((t), (h), (w), (d), (m), (p)) : vgraphSeparateFmTablGetGain ((t), (h), (w), (d), (m), (p)))
+#define vgraphSeparateFmTablFail(t) (vgraphSeparateFmIsBckt (t) && gainBcktFail (&(t)->bcktdat))
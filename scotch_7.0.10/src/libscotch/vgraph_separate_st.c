@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2011-2014,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2011-2014,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 01 may 2014     **/
 /**                # Version 7.0  : from : 16 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,7 @@
 #include "module.h"
 #include "common.h"
 #include "gain.h"
+#include "gain_bckt.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -101,7 +102,7 @@ static union {
 static union {
   VgraphSeparateFmParam     param;
   StratNodeMethodData       padding;
-} vgraphseparatedefaultfm = { { 200, 1000, 0.1L } };
+} vgraphseparatedefaultfm = { { 200, 1000, 0.1L, VGRAPHSEPAFMGAINTABL } };
 
 static union {
   VgraphSeparateGgParam     param;
@@ -162,6 +163,10 @@ static StratParamTab        vgraphseparatestparatab[] = { /* Graph separation me
                                 (byte *) &vgraphseparatedefaultfm.param,
                                 (byte *) &vgraphseparatedefaultfm.param.deltrat,
                                 NULL },
+                              { VGRAPHSEPASTMETHFM,  STRATPARAMCASE,   "gain",
+                                (byte *) &vgraphseparatedefaultfm.param,
+                                (byte *) &vgraphseparatedefaultfm.param.tablval,
+                                (void *) "tb" },
                               { VGRAPHSEPASTMETHGG,  STRATPARAMINT,    "pass",
                                 (byte *) &vgraphseparatedefaultgg.param,
                                 (byte *) &vgraphseparatedefaultgg.param.passnbr,
@@ -240,6 +245,7 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
   StratTest           testdat;
   VgraphStore         savetab[2];                 /* Results of the two strategies */
   Gnum                compload2;                  /* Saved separator load          */
+  StatMark            markdat;                    /* Mark of recorded method call   */
   int                 o;
 
 #ifdef SCOTCH_DEBUG_VGRAPH2
@@ -325,8 +331,14 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
 #else /* SCOTCH_DEBUG_VGRAPH1 */
     default :
 #endif /* SCOTCH_DEBUG_VGRAPH1 */
-      return (((VgraphSeparateFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "vgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertnbr, grafptr->s.edgenbr, (double) grafptr->compload[2], fabs ((double) grafptr->comploaddlt));
+      o = ((VgraphSeparateFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->compload[2], fabs ((double) grafptr->comploaddlt), o);
+      return (o);
 #ifdef SCOTCH_DEBUG_VGRAPH1
     default :
       errorPrint ("vgraphSeparateSt: invalid parameter (2)");
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2018,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2018,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 20 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -204,6 +204,7 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
 {
   StratTest           testdat;
   VmeshStore          savetab[2];                 /* Results of the two strategies */
+  StatMark            markdat;                    /* Mark of recorded method call   */
   int                 o;
 
 #ifdef SCOTCH_DEBUG_VMESH2
@@ -281,8 +282,14 @@ const Strat * restrict const  straptr)            /*+ Separation strategy +*/
 #else /* SCOTCH_DEBUG_VMESH1 */
     default :
 #endif /* SCOTCH_DEBUG_VMESH1 */
-      return (((VmeshSeparateFunc) straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr)
-              (meshptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (meshptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (meshptr->contptr, &markdat, "vmesh", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          meshptr->m.velmnbr + meshptr->m.vnodnbr, meshptr->m.edgenbr, (double) meshptr->ncmpload[2], fabs ((double) meshptr->ncmploaddlt));
+      o = ((VmeshSeparateFunc) straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr)
+          (meshptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (meshptr->contptr))
+        contextStatEnd (meshptr->contptr, &markdat, (double) meshptr->ncmpload[2], fabs ((double) meshptr->ncmploaddlt), o);
+      return (o);
 #ifdef SCOTCH_DEBUG_VMESH1
     default :
       errorPrint ("vmeshSeparateSt: invalid parameter (2)");
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 30 jul 2020     **/
 /**                                 to   : 18 dec 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 09 jul 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -64,6 +64,7 @@
 #include "module.h"
 #include "common.h"
 #include "gain.h"
+#include "gain_bckt.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -100,7 +101,7 @@ static WgraphPartFmVertex   wgraphpartfmvertexdummy; /* Dummy graph vertex actin
 static
 int
 wgraphPartFmTablAdd (
-GainTabl * restrict const             tablptr,    /*+ Gain table                                +*/
+WgraphPartFmTabl * restrict const     tablptr,    /*+ Gain table                                +*/
 Wgraph * restrict const               grafptr,    /*+ Active graph                              +*/
 WgraphPartFmVertex * restrict const   hashtab,
 const Gnum                            hashmsk,
@@ -220,9 +221,9 @@ WgraphPartFmVertex * const            vexxptr)
     if ((linktab[linknum].npmipartnum == -1) ||   /* If link would not cause imbalance */
         ((comploadtab[nplsidx] < cplomax) &&
          (comploadtab[linktab[linknum].npmipartnum] > cplomin)))
-      gainTablAdd (tablptr, (GainLink *) &linktab[linknum], linktab[linknum].gainval); /* Add link to gain table */
+      wgraphPartFmTablLink (tablptr, &linktab[linknum]); /* Add link to gain table */
     else
-      linktab[linknum].gainlink.tabl = NULL;      /* Set link as not chained */
+      wgraphPartFmSetFree (tablptr, &linktab[linknum]); /* Set link as not chained */
 
     nplstmp = nplstab[nplsidx].nextidx;
     nplstab[nplsidx].nextidx = -2;
@@ -243,8 +244,8 @@ WgraphPartFmVertex * const            vexxptr)
 
 static
 WgraphPartFmLink *
-wgraphPartFmTablGet (
-GainTabl * restrict const     tablptr,            /*+ Gain table                                +*/
+wgraphPartFmTablGetGain (
+WgraphPartFmTabl * restrict const tablptr,        /*+ Gain table                                +*/
 const Wgraph * restrict const grafptr,            /*+ Active graph                              +*/
 const Gnum                    cplomin,            /*+ Minimum with respect to average part load +*/
 const Gnum                    cplomax)            /*+ Maximum with respect to average part load +*/
@@ -258,13 +259,13 @@ const Gnum                    cplomax)            /*+ Maximum with respect to av
   const Gnum * restrict const comploadtab = grafptr->compload;
 
   linkbst = NULL;                                 /* Assume no candidate vertex found yet */
-  tablbst = tablptr->tend;
+  tablbst = tablptr->tabldat->tend;
   cdltbst =                                       /* Prevent compiler from yelling */
   gainbst = GAINMAX;
 
-  for (linkptr = (WgraphPartFmLink *) gainTablFrst (tablptr); /* Select candidate vertices */
-       (linkptr != NULL) && (linkptr->gainlink.tabl <= tablbst);
-       linkptr = (WgraphPartFmLink *) gainTablNext (tablptr, (GainLink *) linkptr)) {
+  for (linkptr = (WgraphPartFmLink *) gainTablFrst (tablptr->tabldat); /* Select candidate vertices */
+       (linkptr != NULL) && (linkptr->gainlink.tabldat.tabl <= tablbst);
+       linkptr = (WgraphPartFmLink *) gainTablNext (tablptr->tabldat, &linkptr->gainlink.tabldat)) {
     Anum                      partnum;            /* Destination part of vertex    */
     Anum                      pminnum;            /* Smallest impacted part        */
     Gnum                      gaincur;            /* Frontier gain of current link */
@@ -285,7 +286,75 @@ const Gnum                    cplomax)            /*+ Maximum with respect to av
          ((comploadtab[partnum] - comploadtab[pminnum]) < cdltbst))) {
       linkbst = linkptr;                          /* Select it */
       gainbst = gaincur;
-      tablbst = linkptr->gainlink.tabl;
+      tablbst = linkptr->gainlink.tabldat.tabl;
+      cdltbst = comploadtab[partnum] - comploadtab[pminnum];
+    }
+  }
+
+  return (linkbst);                               /* Return best link found */
+}
+
+/* This routine returns the vertex of best gain
+** whose swap will keep the balance correct,
+** when gains are kept in a bucket array. Since
+** large gains may share the same bucket, the
+** whole bucket holding the best link is scanned.
+** It returns:
+** - !NULL  : pointer to the vertex gainlink.
+** - NULL   : if no more vertices available.
+*/
+
+static
+WgraphPartFmLink *
+wgraphPartFmTablGetBckt (
+WgraphPartFmTabl * restrict const tablptr,        /*+ Gain table                                +*/
+const Wgraph * restrict const grafptr,            /*+ Active graph                              +*/
+const Gnum                    cplomin,            /*+ Minimum with respect to average part load +*/
+const Gnum                    cplomax)            /*+ Maximum with respect to average part load +*/
+{
+  GainBckt *                  bcktptr;
+  WgraphPartFmLink *          linktab;            /* Array of links                   */
+  Gnum                        gainbst;            /* Frontier gain of best link       */
+  Gnum                        cdltbst;            /* Part load imbalance of best link */
+  INT                         bcktbst;            /* Key of bucket holding best link  */
+  WgraphPartFmLink *          linkbst;            /* Pointer to best link found       */
+  INT                         linknum;            /* Index of current gain link       */
+
+  const Gnum * restrict const comploadtab = grafptr->compload;
+
+  bcktptr = &tablptr->bcktdat;
+  linktab = (WgraphPartFmLink *) bcktptr->elemtab;
+  linkbst = NULL;                                 /* Assume no candidate vertex found yet */
+  bcktbst = GAINMAX;
+  cdltbst =                                       /* Prevent compiler from yelling */
+  gainbst = GAINMAX;
+
+  for (linknum = gainBcktFrst (bcktptr);          /* Select candidate vertices */
+       (linknum != GAINBCKTNONE) && (linktab[linknum].gainlink.bcktdat.keyval <= bcktbst);
+       linknum = gainBcktNext (bcktptr, linknum)) {
+    WgraphPartFmLink *        linkptr;            /* Pointer to current gain link  */
+    Anum                      partnum;            /* Destination part of vertex    */
+    Anum                      pminnum;            /* Smallest impacted part        */
+    Gnum                      gaincur;            /* Frontier gain of current link */
+
+    linkptr = &linktab[linknum];
+    partnum = linkptr->partnum;
+    pminnum = linkptr->npmipartnum;
+    gaincur = linkptr->gainval;                   /* Get frontier gain */
+
+    if (pminnum == -1)                            /* If frontier vertex can go to one part only */
+      return (linkptr);                           /* Return its link as it is an obvious gain   */
+
+    if ((comploadtab[pminnum] <= cplomin) ||      /* If move would cause part imbalance, reject it */
+        (comploadtab[partnum] >= cplomax))
+      continue;
+
+    if ((gaincur < gainbst) ||                    /* If it gives better gain than gain max */
+        ((gaincur == gainbst) &&                  /* Or reduces imbalance most             */
+         ((comploadtab[partnum] - comploadtab[pminnum]) < cdltbst))) {
+      linkbst = linkptr;                          /* Select it */
+      gainbst = gaincur;
+      bcktbst = linkptr->gainlink.bcktdat.keyval;
       cdltbst = comploadtab[partnum] - comploadtab[pminnum];
     }
   }
@@ -312,7 +381,8 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
   Gnum                            fronnbr;
   Gnum                            fronnum;
   WgraphPartFmVertex *            vexxptr;
-  GainTabl * restrict             tablptr;        /* Pointer to gain table                         */
+  WgraphPartFmTabl                tabldat;        /* Gain table                                    */
+  WgraphPartFmTabl * restrict     tablptr;        /* Pointer to gain table                         */
   WgraphPartFmHashData            hashdat;        /* Hash table management data                    */
   WgraphPartFmLinkData            linkdat;        /* Link array management data                    */
   WgraphPartFmSaveData            savedat;        /* Save array management data                    */
@@ -382,25 +452,29 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
   savedat.savenbr = 0;                            /* No moves saved (yet) */
 
-  if (((tablptr = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS)) == NULL) || /* Use logarithmic array only         */
-      ((nplstab = memAlloc ((partnbr + 1) * sizeof (WgraphPartFmPartList))) == NULL) || /* TRICK: +1 for frontier */
+  tablptr = &tabldat;
+  if (wgraphPartFmTablInit (tablptr, paraptr->tablval) != 0) { /* Use logarithmic array only */
+    errorPrint ("wgraphPartFm: out of memory");
+    wgraphPartFmTablExit (tablptr);
+    return (1);
+  }
+  if (((nplstab = memAlloc ((partnbr + 1) * sizeof (WgraphPartFmPartList))) == NULL) || /* TRICK: +1 for frontier */
       ((hashdat.hashtab = memAlloc (hashdat.hashsiz * sizeof (WgraphPartFmVertex))) == NULL) ||
       ((linkdat.linktab = memAlloc (linkdat.linksiz * sizeof (WgraphPartFmLink)))   == NULL) ||
       ((savedat.savetab = memAlloc (savedat.savesiz * sizeof (WgraphPartFmSave)))   == NULL)) {
     errorPrint ("wgraphPartFm: out of memory");
-    if (tablptr != NULL) {
-      if (nplstab != NULL) {
-        if (hashdat.hashtab != NULL) {
-          if (linkdat.linktab != NULL)
-            memFree (linkdat.linktab);
-          memFree (hashdat.hashtab);
-        }
-        memFree (nplstab);
+    if (nplstab != NULL) {
+      if (hashdat.hashtab != NULL) {
+        if (linkdat.linktab != NULL)
+          memFree (linkdat.linktab);
+        memFree (hashdat.hashtab);
       }
-      gainTablExit (tablptr);
+      memFree (nplstab);
     }
+    wgraphPartFmTablExit (tablptr);
     return (1);
   }
+  wgraphPartFmTablBase (tablptr, linkdat.linktab); /* Set link array of bucket array */
   nplstab ++;                                     /* TRICK: move one slot ahead for frontier */
   hashdat.hashmax = hashdat.hashsiz >> 2;         /* Use hash table at 1/4 of its capacity   */
   hashdat.hashmsk = hashdat.hashsiz - 1;
@@ -556,8 +630,8 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
         Anum                partend;
         Gnum                linktmp;
 
-        if (linkdat.linktab[linknum].gainlink.tabl != NULL) /* If link was chained in gain table, remove it */
-          gainTablDel (tablptr, (GainLink *) &linkdat.linktab[linknum].gainlink);
+        if (wgraphPartFmIsLink (tablptr, &linkdat.linktab[linknum])) /* If link was chained in gain table, remove it */
+          wgraphPartFmTablUnlink (tablptr, &linkdat.linktab[linknum]);
         partend = linkdat.linktab[linknum].partnum;
         if (partend != partnum) {
 #ifdef SCOTCH_DEBUG_WGRAPH2
@@ -767,8 +841,8 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
           for (linknum = vexxend->linkidx; linknum != -1; ) { /* As frontier vertex incurs change, remove its links if any */
             Gnum                linktmp;
 
-            if (linkdat.linktab[linknum].gainlink.tabl != NULL) /* If link was chained in gain table, remove it */
-              gainTablDel (tablptr, (GainLink *) &linkdat.linktab[linknum].gainlink);
+            if (wgraphPartFmIsLink (tablptr, &linkdat.linktab[linknum])) /* If link was chained in gain table, remove it */
+              wgraphPartFmTablUnlink (tablptr, &linkdat.linktab[linknum]);
             linktmp = linknum;
             linknum = linkdat.linktab[linknum].nextidx; /* Get next link       */
             wgraphPartFmLinkPut (&linkdat, linktmp); /* Free old link in table */
@@ -949,8 +1023,8 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
           for (linknum = vexxptr->linkidx; linknum != -1; ) { /* For all potential links of vertex (if frontier vertex) */
             Gnum                linktmp;
 
-            if (linkdat.linktab[linknum].gainlink.tabl != NULL) /* If link was chained in gain table, remove it */
-              gainTablDel (tablptr, (GainLink *) &linkdat.linktab[linknum].gainlink);
+            if (wgraphPartFmIsLink (tablptr, &linkdat.linktab[linknum])) /* If link was chained in gain table, remove it */
+              wgraphPartFmTablUnlink (tablptr, &linkdat.linktab[linknum]);
             linktmp = linknum;
             linknum = linkdat.linktab[linknum].nextidx;
             wgraphPartFmLinkPut (&linkdat, linktmp); /* Release link from vertex */
@@ -980,6 +1054,11 @@ const WgraphPartFmParam * const paraptr)    /*+ Method parameters +*/
   } while ((moveflag != 0) &&                     /* As long as vertices are moved */
            (-- passnbr > 0));                     /* And we are allowed to loop    */
 
+  if (wgraphPartFmTablFail (tablptr)) {           /* If bucket array could not be enlarged */
+    errorPrint ("wgraphPartFm: out of memory (1)");
+    goto abort;
+  }
+
   grafptr->fronload = frlosum;                    /* Write back frontier loads */
   grafptr->fronnbr  = fronnbr;
 
@@ -1023,7 +1102,7 @@ abort:
   memFree (linkdat.linktab);
   memFree (hashdat.hashtab);
   memFree (nplstab - 1);                          /* TRICK: array starts one cell before */
-  gainTablExit (tablptr);
+  wgraphPartFmTablExit (tablptr);
 
   return (o);
 }
@@ -1280,7 +1359,7 @@ static
 int
 wgraphPartFmLinkResize (
 WgraphPartFmLinkData * const  ldatptr,
-GainTabl * restrict const     tablptr)
+WgraphPartFmTabl * const      tablptr)
 {
   WgraphPartFmLink *  linktab;                    /* Pointer to reallocated array */
   Gnum                linksiz;                    /* Size of reallocated array    */
@@ -1296,8 +1375,12 @@ GainTabl * restrict const     tablptr)
   }
 
   addrdlt = (byte *) linktab - (byte *) ldatptr->linktab;
-  if (addrdlt != 0)                               /* If array changed of location             */
-    gainTablMove (tablptr, addrdlt);              /* Skew gain table pointers into link table */
+  if (addrdlt != 0) {                             /* If array changed of location */
+    if (wgraphPartFmIsBckt (tablptr))             /* Bucket array links by index  */
+      gainBcktBase (&tablptr->bcktdat, linktab);
+    else
+      gainTablMove (tablptr->tabldat, addrdlt);   /* Skew gain table pointers into link table */
+  }
 
   for (linknum = ldatptr->linksiz; linknum < (linksiz - 1); linknum ++) /* Initialize new free list of links */
     linktab[linknum].nextidx = linknum + 1;
@@ -49,7 +49,7 @@
 /**                # Version 6.1  : from : 30 jul 2020     **/
 /**                                 to   : 04 apr 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 17 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -69,14 +69,31 @@
 **  The type and structure definitions.
 */
 
+/*+ Gain structure type. +*/
+
+typedef enum WgraphPartFmGain_ {
+  WGRAPHPARTFMGAINTABL,                           /*+ Gain table   +*/
+  WGRAPHPARTFMGAINBCKT                            /*+ Bucket array +*/
+} WgraphPartFmGain;
+
 /*+ This structure holds the method parameters. +*/
 
 typedef struct WgraphPartFmParam_ {
   INT                       movenbr;              /*+ Maximum number of uneffective moves that can be done +*/
   INT                       passnbr;              /*+ Number of passes to be performed (-1: infinite)      +*/
   double                    deltrat;              /*+ Maximum weight imbalance ratio                       +*/
+  WgraphPartFmGain          tablval;              /*+ Type of gain structure                               +*/
 } WgraphPartFmParam;
 
+/*+ The gain structure, which is either a
+    gain table or a bucket array.         +*/
+
+typedef struct WgraphPartFmTabl_ {
+  WgraphPartFmGain          typeval;              /*+ Type of gain structure in use +*/
+  GainTabl *                tabldat;              /*+ Gain table                    +*/
+  GainBckt                  bcktdat;              /*+ Bucket array                  +*/
+} WgraphPartFmTabl;
+
 /*+ The part list structure, to record used neighboring parts. +*/
 
 typedef struct WgraphPartFmPartList_ {
@@ -111,7 +128,10 @@ typedef struct WgraphPartFmHashData_ {
 /*+ The vertex link structure. +*/
 
 typedef struct WgraphPartFmLink_ {
-  GainLink                  gainlink;             /*+ Gain link: FIRST                                   +*/
+  union {
+    GainLink                tabldat;              /*+ Link in gain table                                 +*/
+    GainBcktLink            bcktdat;              /*+ Link in bucket array                               +*/
+  }                         gainlink;             /*+ Gain link: FIRST                                   +*/
   Gnum                      nextidx;              /*+ Index of next link for vertex                      +*/
   Gnum                      partnum;              /*+ Part to whick the linked vertex should move        +*/
   Gnum                      vertnum;              /*+ Number of vertex to which link belongs             +*/
@@ -170,7 +190,7 @@ static int                  wgraphPartFmHashResize (WgraphPartFmHashData * const
 static void                 wgraphPartFmLinkInit (WgraphPartFmLinkData * const);
 static Gnum                 wgraphPartFmLinkGet (WgraphPartFmLinkData * const);
 static void                 wgraphPartFmLinkPut (WgraphPartFmLinkData * const, const Gnum);
-static int                  wgraphPartFmLinkResize (WgraphPartFmLinkData * const, GainTabl * const);
+static int                  wgraphPartFmLinkResize (WgraphPartFmLinkData * const, WgraphPartFmTabl * const);
 
 static int                  wgraphPartFmSaveResize (WgraphPartFmSaveData * const);
 
@@ -189,5 +209,51 @@ int                         wgraphPartFm        (Wgraph * restrict const, const
 
 #define wgraphPartFmLinkClaim(ldatptr,linknbr) ((ldatptr)->lfrenbr < (linknbr))
 
+/** Bucket array link status. Chained links
+    hold the index of their next link, which
+    is never smaller than GAINBCKTNONE.      **/
+
+#define WGRAPHPARTFMBCKTFREE        ((INT) -2)    /*+ Link not chained +*/
+
+/*+ Service routines for links, for the type
+    of gain structure selected at run time.
+    Links are chained by index in the bucket
+    array, which must be rebased when the
+    link array is moved.                     +*/
+
+#define wgraphPartFmIsBckt(t)       ((t)->typeval == WGRAPHPARTFMGAINBCKT)
+#define wgraphPartFmTablInit(t,g)   ((((t)->typeval = (g)) == WGRAPHPARTFMGAINBCKT) ? gainBcktInit (&(t)->bcktdat, NULL, sizeof (WgraphPartFmLink)) : (((t)->tabldat = gainTablInit (GAINMAX, WGRAPHPARTFMGAINBITS)) == NULL))
+#define wgraphPartFmTablExit(t)     do {                              \
+                                      if (wgraphPartFmIsBckt (t))     \
+                                        gainBcktExit (&(t)->bcktdat); \
+                                      else if ((t)->tabldat != NULL)  \
+                                        gainTablExit ((t)->tabldat);  \
+                                    } while (0)
+#define wgraphPartFmTablBase(t,l)   do {                                   \
+                                      if (wgraphPartFmIsBckt (t))          \
+                                        gainBcktBase (&(t)->bcktdat, (l)); \
+                                    } while (0)
+#define wgraphPartFmTablLink(t,l)   do {                                                                                                          \
+                                      if (wgraphPartFmIsBckt (t))                                                                                 \
+                                        gainBcktAdd (&(t)->bcktdat, (INT) ((l) - (WgraphPartFmLink *) (t)->bcktdat.elemtab), (INT) (l)->gainval); \
+                                      else                                                                                                        \
+                                        gainTablAdd ((t)->tabldat, &(l)->gainlink.tabldat, (l)->gainval);                                         \
+                                    } while (0)
+#define wgraphPartFmTablUnlink(t,l) do {                                                     \
+                                      if (wgraphPartFmIsBckt (t))                            \
+                                        gainBcktDel (&(t)->bcktdat, &(l)->gainlink.bcktdat); \
+                                      else                                                   \
+                                        gainTablDel ((t)->tabldat, &(l)->gainlink.tabldat);  \
+                                    } while (0)
+#define wgraphPartFmTablFail(t)     (wgraphPartFmIsBckt (t) && gainBcktFail (&(t)->bcktdat))
+#define wgraphPartFmTablGet(t,g,n,x) (wgraphPartFmIsBckt (t) ? wgraphPartFmTablGetBckt ((t), (g), (n), (x)) : wgraphPartFmTablGetGain ((t), (g), (n), (x)))
+#define wgraphPartFmIsLink(t,l)     (wgraphPartFmIsBckt (t) ? ((l)->gainlink.bcktdat.nextnum != WGRAPHPARTFMBCKTFREE) : ((l)->gainlink.tabldat.tabl != NULL))
+#define wgraphPartFmSetFree(t,l)    do {                                                      \
+                                      if (wgraphPartFmIsBckt (t))                             \
+                                        (l)->gainlink.bcktdat.nextnum = WGRAPHPARTFMBCKTFREE; \
+                                      else                                                    \
+                                        (l)->gainlink.tabldat.tabl = NULL;                    \
+                                    } while (0)
+
 #define wgraphPartFmSaveInit(sdatptr) (sdatptr)->savenbr = 0
 #define wgraphPartFmSaveClaim(sdatptr,savvnbr) (((sdatptr)->savesiz - (sdatptr)->savenbr) < (savvnbr))
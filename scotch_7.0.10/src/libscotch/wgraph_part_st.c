@@ -1,4 +1,4 @@
-/* Copyright 2007-2011,2018,2020,2021,2023,2024 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2011,2018,2020,2021,2023,2024,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 25 aug 2020     **/
 /**                                 to   : 26 nov 2021     **/
 /**                # Version 7.0  : from : 17 jan 2023     **/
-/**                                 to   : 07 nov 2024     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -59,6 +59,7 @@
 #include "module.h"
 #include "common.h"
 #include "gain.h"
+#include "gain_bckt.h"
 #include "parser.h"
 #include "graph.h"
 #include "arch.h"
@@ -90,7 +91,7 @@ static union {
 static union {
   WgraphPartFmParam         param;
   StratNodeMethodData       padding;
-} wgraphpartdefaultfm = { { 10, 40, 0.1L } };
+} wgraphpartdefaultfm = { { 10, 40, 0.1L, WGRAPHPARTFMGAINTABL } };
 
 static union {
   WgraphPartMlParam         param;
@@ -127,6 +128,10 @@ static StratParamTab        wgraphpartstparatab[] = { /* Method parameter list *
                                 (byte *) &wgraphpartdefaultfm.param,
                                 (byte *) &wgraphpartdefaultfm.param.deltrat,
                                 NULL },
+                              { WGRAPHPARTSTMETHFM,  STRATPARAMCASE,   "gain",
+                                (byte *) &wgraphpartdefaultfm.param,
+                                (byte *) &wgraphpartdefaultfm.param.tablval,
+                                (void *) "tb" },
                               { WGRAPHPARTSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &wgraphpartdefaultml.param,
                                 (byte *) &wgraphpartdefaultml.param.stratasc,
@@ -192,6 +197,7 @@ const Strat * restrict const straptr)             /*+ Overlap partitioning strat
 {
   StratTest           testdat;                    /* Result of condition evaluation */
   WgraphStore         savetab[2];                 /* Results of the two strategies  */
+  StatMark            markdat;                    /* Mark of recorded method call    */
   int                 o;
   int                 o2;
 
@@ -270,8 +276,14 @@ const Strat * restrict const straptr)             /*+ Overlap partitioning strat
 #else /* SCOTCH_DEBUG_WGRAPH2 */
     default :
 #endif /* SCOTCH_DEBUG_WGRAPH2 */
-      return (((WgraphPartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
-              (grafptr, (const void * const) &straptr->data.methdat.datadat));
+      if (contextStatActive (grafptr->contptr))   /* If method calls are recorded */
+        contextStatBegin (grafptr->contptr, &markdat, "wgraph", straptr->tablptr->methtab[straptr->data.methdat.methnum].nameptr,
+                          grafptr->s.vertnbr, grafptr->s.edgenbr, (double) grafptr->fronload, -1.0);
+      o = ((WgraphPartFunc) (straptr->tablptr->methtab[straptr->data.methdat.methnum].funcptr))
+          (grafptr, (const void * const) &straptr->data.methdat.datadat);
+      if (contextStatActive (grafptr->contptr))
+        contextStatEnd (grafptr->contptr, &markdat, (double) grafptr->fronload, -1.0, o);
+      return (o);
 #ifdef SCOTCH_DEBUG_WGRAPH2
     default :
       errorPrint ("wgraphPartSt: invalid parameter (2)");
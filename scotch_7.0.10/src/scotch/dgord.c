@@ -1,4 +1,4 @@
-/* Copyright 2007-2012,2014,2018-2021,2023,2025 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007-2012,2014,2018-2021,2023,2025,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 17 apr 2019     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 10 jun 2025     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,6 +72,7 @@ static File                 C_fileTab[C_FILENBR] = { /* File array
                               { FILEMODEW },
                               { FILEMODEW },
                               { FILEMODEW },
+                              { FILEMODEW },
                               { FILEMODEW } };
 
 static const char *         C_usageList[] = {
@@ -90,6 +91,7 @@ static const char *         C_usageList[] = {
   "                 t  : enforce safety",
   "                 x  : enforce scalability",
   "  -h         : Display this help",
+  "  -j<file>   : Save strategy method statistics of root process to <file> in JSON format",
   "  -m<file>   : Save column block mapping data to <file>",
   "  -o<strat>  : Set parallel ordering strategy (see user's manual)",
   "  -r<num>    : Set root process for centralized files (default is 0)",
@@ -221,6 +223,12 @@ char *              argv[])
         case 'h' :
           usagePrint (stdout, C_usageList);
           return     (EXIT_SUCCESS);
+        case 'J' :                                /* Output method statistics */
+        case 'j' :
+          flagval |= C_FLAGSTAOUT;
+          if (argv[i][2] != '\0')
+            C_filenamestaout = &argv[i][2];
+          break;
         case 'M' :                                /* Output separator mapping */
         case 'm' :
           flagval |= C_FLAGMAPOUT;
@@ -312,6 +320,8 @@ char *              argv[])
     SCOTCH_stratDgraphOrderBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, 0, 0.2);
   }
 
+  if ((flagval & C_FLAGSTAOUT) != 0)              /* If method statistics wanted */
+    SCOTCH_contextStatInit (&contdat);
   SCOTCH_contextBindDgraph (&contdat, &grafdat, &cogrdat);
 
   clockStop (&runtime[0]);                        /* Get input time */
@@ -347,6 +357,8 @@ char *              argv[])
       SCOTCH_dgraphOrderSaveMap (&grafdat, &ordedat, C_filepntrmapout); /* Write mapping */
     if ((flagval & C_FLAGTREOUT) != 0)            /* If separator tree wanted            */
       SCOTCH_dgraphOrderSaveTree (&grafdat, &ordedat, C_filepntrtreout); /* Write tree   */
+    if ((flagval & C_FLAGSTAOUT) != 0)            /* If method statistics wanted         */
+      SCOTCH_contextStatSave (&contdat, C_filepntrstaout); /* Write root statistics  */
   }
   else {
     if ((flagval & C_FLAGBLOCK) == 0)
@@ -1,4 +1,4 @@
-/* Copyright 2007,2008,2014 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2007,2008,2014,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -46,7 +46,7 @@
 /**                # Version 5.1  : from : 22 nov 2008     **/
 /**                                 to   : 22 nov 2008     **/
 /**                # Version 6.0  : from : 10 nov 2014     **/
-/**                                 to   : 10 nov 2014     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,7 +56,7 @@
 
 /*+ File name aliases. +*/
 
-#define C_FILENBR                   5             /* Number of files in list                */
+#define C_FILENBR                   6             /* Number of files in list                */
 #define C_FILEARGNBR                3             /* Number of files which can be arguments */
 
 #define C_filenamesrcinp            fileBlockName (C_fileTab, 0) /* Source graph input file name */
@@ -64,12 +64,14 @@
 #define C_filenamelogout            fileBlockName (C_fileTab, 2) /* Log file name                */
 #define C_filenamemapout            fileBlockName (C_fileTab, 3) /* Separator mapping file name  */
 #define C_filenametreout            fileBlockName (C_fileTab, 4) /* Separator tree file name     */
+#define C_filenamestaout            fileBlockName (C_fileTab, 5) /* Method statistics file name  */
 
 #define C_filepntrsrcinp            fileBlockFile (C_fileTab, 0) /* Source graph input file */
 #define C_filepntrordout            fileBlockFile (C_fileTab, 1) /* Ordering output file    */
 #define C_filepntrlogout            fileBlockFile (C_fileTab, 2) /* Log file                */
 #define C_filepntrmapout            fileBlockFile (C_fileTab, 3) /* Separator mapping file  */
 #define C_filepntrtreout            fileBlockFile (C_fileTab, 4) /* Separator tre file      */
+#define C_filepntrstaout            fileBlockFile (C_fileTab, 5) /* Method statistics file  */
 
 /*+ Process flags. +*/
 
@@ -81,6 +83,7 @@
 #define C_FLAGVERBMEM               0x0010        /* Output memory information  */
 #define C_FLAGBLOCK                 0x0020        /* Output block ordering      */
 #define C_FLAGDEBUG                 0x0040        /* Debugging                  */
+#define C_FLAGSTAOUT                0x0080        /* Output method statistics   */
 
 /*
 **  The function prototypes.
@@ -62,7 +62,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 24 sep 2019     **/
 /**                # Version 7.0  : from : 21 jan 2023     **/
-/**                                 to   : 10 sep 2024     **/
+/**                                 to   : 16 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -116,11 +116,12 @@ static const char *         C_usageList[] = {
   "                  b  : Boeing-Harwell format (matrices)",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market format (edges, symmetrized)",
-  "                  s  : Scotch v3.0 format (adjacency)",
+  "                  s  : Scotch v3.0 format (adjacency, text or binary)",
   "  -o<format>  : Select output file format",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market symmetric pattern format (edges)",
   "                  s  : Scotch v3.0 format (adjacency)",
+  "                  sb : Scotch binary format (adjacency, mappable)",
   "  -V          : Print program version and copyright",
   "",
   "Default option set is : '-Ib -Os'",
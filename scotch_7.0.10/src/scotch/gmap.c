@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018-2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -68,7 +68,7 @@
 /**                # Version 6.0  : from : 29 may 2010     **/
 /**                                 to   : 26 aug 2020     **/
 /**                # Version 7.0  : from : 10 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -97,6 +97,7 @@ static File                 C_fileTab[C_FILENBR] = { /* File array
                               { FILEMODEW },
                               { FILEMODER },
                               { FILEMODER },
+                              { FILEMODEW },
                               { FILEMODEW } };
 
 static const char *         C_usageList[] = {     /* Usage */
@@ -117,6 +118,7 @@ static const char *         C_usageList[] = {     /* Usage */
   "                 t  : enforce safety",
   "  -f<file>   : Fixed vertices input file",
   "  -h         : Display this help",
+  "  -j<file>   : Save strategy method statistics to <file> in JSON format",
   "  -m<strat>  : Set mapping strategy (see user's manual)",
   "  -o         : Use partitioning with overlap (only for gpart)",
   "  -q         : Do graph clustering instead of graph partitioning (for gpart)",
@@ -260,6 +262,12 @@ char *                      argv[])
         case 'h' :
           usagePrint (stdout, C_usageList);
           return     (EXIT_SUCCESS);
+        case 'J' :                                /* Output method statistics */
+        case 'j' :
+          flagval |= C_FLAGSTAOUT;
+          if (argv[i][2] != '\0')
+            C_filenamestaout = &argv[i][2];
+          break;
         case 'M' :
         case 'm' :
           straptr = &argv[i][2];
@@ -433,6 +441,8 @@ char *                      argv[])
     }
   }
 
+  if ((flagval & C_FLAGSTAOUT) != 0)              /* If method statistics wanted */
+    SCOTCH_contextStatInit (&contdat);
   SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat);
 
   clockStop  (&runtime[0]);                       /* Get input time */
@@ -509,6 +519,9 @@ char *                      argv[])
     }
   }
 
+  if (flagval & C_FLAGSTAOUT)                     /* If method statistics wanted */
+    SCOTCH_contextStatSave (&contdat, C_filepntrstaout);
+
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
 
   SCOTCH_graphExit   (&cogrdat);                  /* Destroy context binding first */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010,2011,2014,2019 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010,2011,2014,2019,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -63,7 +63,7 @@
 /**                # Version 5.1  : from : 28 aug 2010     **/
 /**                                 to   : 18 jul 2011     **/
 /**                # Version 6.0  : from : 29 may 2010     **/
-/**                                 to   : 24 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -73,7 +73,7 @@
 
 /*+ File name aliases. +*/
 
-#define C_FILENBR                   7             /* Number of files in list */
+#define C_FILENBR                   8             /* Number of files in list */
 
 #define C_filenamesrcinp            fileBlockName (C_fileTab, 0) /* Source graph input file name        */
 #define C_filenametgtinp            fileBlockName (C_fileTab, 1) /* Target architecture input file name */
@@ -82,6 +82,7 @@
 #define C_filenamevfxinp            fileBlockName (C_fileTab, 4) /* Fixed vertex file                   */
 #define C_filenamemaoinp            fileBlockName (C_fileTab, 5) /* Old mapping file                    */
 #define C_filenamevmlinp            fileBlockName (C_fileTab, 6) /* Vertex migration load file          */
+#define C_filenamestaout            fileBlockName (C_fileTab, 7) /* Method statistics file name         */
 
 #define C_filepntrsrcinp            fileBlockFile (C_fileTab, 0) /* Source graph input file        */
 #define C_filepntrtgtinp            fileBlockFile (C_fileTab, 1) /* Target architecture input file */
@@ -90,6 +91,7 @@
 #define C_filepntrvfxinp            fileBlockFile (C_fileTab, 4) /* Fixed vertex file                   */
 #define C_filepntrmaoinp            fileBlockFile (C_fileTab, 5) /* Old mapping file                    */
 #define C_filepntrvmlinp            fileBlockFile (C_fileTab, 6) /* Vertex migration load file          */
+#define C_filepntrstaout            fileBlockFile (C_fileTab, 7) /* Method statistics file              */
 
 /*+ Process flags. +*/
 
@@ -105,3 +107,4 @@
 #define C_FLAGRMAPOLD               0x0100        /* Old mapping file           */
 #define C_FLAGRMAPRAT               0x0200        /* Edge migration ratio       */
 #define C_FLAGRMAPCST               0x0400        /* Vertex migration cost file */
+#define C_FLAGSTAOUT                0x0800        /* Output method statistics   */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2021,2023 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2008,2010-2012,2014,2018,2019,2021,2023,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 30 oct 2019     **/
 /**                                 to   : 30 oct 2019     **/
 /**                # Version 7.0  : from : 23 oct 2021     **/
-/**                                 to   : 21 jan 2023     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -79,6 +79,7 @@ static File                 C_fileTab[C_FILENBR] = { /* File array
                               { FILEMODEW },
                               { FILEMODEW },
                               { FILEMODEW },
+                              { FILEMODEW },
                               { FILEMODEW } };
 
 static const char *         C_usageList[] = {
@@ -95,6 +96,7 @@ static const char *         C_usageList[] = {
   "                 s  : privilege speed over quality",
   "                 t  : enforce safety",
   "  -h         : Display this help",
+  "  -j<file>   : Save strategy method statistics to <file> in JSON format",
   "  -m<file>   : Save column block mapping data to <file>",
   "  -o<strat>  : Set ordering strategy (see user's manual)",
   "  -t<file>   : Save partitioning tree data to <file>",
@@ -186,6 +188,12 @@ char *                      argv[])
         case 'h' :
           usagePrint (stdout, C_usageList);
           return     (EXIT_SUCCESS);
+        case 'J' :                                /* Output method statistics */
+        case 'j' :
+          flagval |= C_FLAGSTAOUT;
+          if (argv[i][2] != '\0')
+            C_filenamestaout = &argv[i][2];
+          break;
         case 'M' :                                /* Output separator mapping */
         case 'm' :
           flagval |= C_FLAGMAPOUT;
@@ -248,6 +256,8 @@ char *                      argv[])
     SCOTCH_stratGraphOrderBuild (&stradat, straval, 0, 0.2);
   }
 
+  if ((flagval & C_FLAGSTAOUT) != 0)              /* If method statistics wanted */
+    SCOTCH_contextStatInit (&contdat);
   SCOTCH_contextBindGraph (&contdat, &grafdat, &cogrdat);
 
   clockStop  (&runtime[0]);                       /* Get input time */
@@ -273,6 +283,8 @@ char *                      argv[])
     SCOTCH_graphOrderSaveMap (&grafdat, &ordedat, C_filepntrmapout); /* Write mapping */
   if (flagval & C_FLAGTREOUT)                     /* If separator tree wanted         */
     SCOTCH_graphOrderSaveTree (&grafdat, &ordedat, C_filepntrtreout); /* Write tree   */
+  if (flagval & C_FLAGSTAOUT)                     /* If method statistics wanted      */
+    SCOTCH_contextStatSave (&contdat, C_filepntrstaout); /* Write statistics       */
 
   clockStop (&runtime[0]);                        /* Get output time */
 